@@ -1,5 +1,6 @@
 #include "arch_direct.h"
 
+#include "openfpga_binary_archive.h"
 #include "vtr_assert.h"
 
 /************************************************************************
@@ -112,3 +113,15 @@ bool ArchDirect::valid_direct_id(const ArchDirectId& direct_id) const {
   return (size_t(direct_id) < direct_ids_.size()) &&
          (direct_id == direct_ids_[direct_id]);
 }
+
+/************************************************************************
+ * Serialization
+ ***********************************************************************/
+template <class Archive>
+void ArchDirect::serialize(Archive& archive) {
+  archive(direct_ids_, names_, circuit_models_, types_, directions_,
+          direct_name2ids_);
+}
+
+template void ArchDirect::serialize(openfpga::BinaryWriter& archive);
+template void ArchDirect::serialize(openfpga::BinaryReader& archive);
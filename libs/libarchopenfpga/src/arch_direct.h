@@ -79,6 +79,11 @@ class ArchDirect {
  public: /* Public invalidators/validators */
   bool valid_direct_id(const ArchDirectId& direct_id) const;
 
+ public: /* Serialization */
+  /* Read or write all the internal data with a binary archive */
+  template <class Archive>
+  void serialize(Archive& archive);
+
  private: /* Internal data */
   vtr::vector<ArchDirectId, ArchDirectId> direct_ids_;
 
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <numeric>
 
+#include "openfpga_binary_archive.h"
 #include "openfpga_port_parser.h"
 #include "vtr_assert.h"
 #include "vtr_log.h"
@@ -627,10 +628,21 @@ CircuitPortId CircuitLibrary::model_port(const CircuitModelId& model_id,
                                          const std::string& name) const {
   /* validate the model_id */
   VTR_ASSERT(valid_model_id(model_id));
+  /* Use the fast look-up when it is built */
+  if (!model_port_name_lookup_.empty()) {
+    auto result = model_port_name_lookup_[model_id].find(name);
+    if (result == model_port_name_lookup_[model_id].end()) {
+      return CircuitPortId::INVALID();
+    }
+    /* A name shared by multiple ports is caught by the search below */
+    if (CircuitPortId::INVALID() != result->second) {
+      return result->second;
+    }
+  }
   /* Walk through the ports and try to find a matched name */
   CircuitPortId ret = CircuitPortId::INVALID();
   size_t num_found = 0;
-  for (auto model_ports_by_type : model_port_lookup_[model_id]) {
+  for (const auto& model_ports_by_type : model_port_lookup_[model_id]) {
     for (auto port_id : model_ports_by_type) {
       if (0 != name.compare(port_prefix(port_id))) {
         continue; /* Not the one, go to the next*/
@@ -650,7 +662,7 @@ size_t CircuitLibrary::num_model_ports(const CircuitModelId& model_id) const {
   VTR_ASSERT(valid_model_id(model_id));
   /* Search the port look up and return a list */
   size_t num_of_ports = 0;
-  for (auto model_ports_by_type : model_port_lookup_[model_id]) {
+  for (const auto& model_ports_by_type : model_port_lookup_[model_id]) {
     num_of_ports += model_ports_by_type.size();
   }
   return num_of_ports;
@@ -687,7 +699,7 @@ std::vector<CircuitPortId> CircuitLibrary::model_ports(
   VTR_ASSERT(valid_model_id(model_id));
   /* Search the port look up and return a list */
   std::vector<CircuitPortId> port_ids;
-  for (auto model_ports_by_type : model_port_lookup_[model_id]) {
+  for (const auto& model_ports_by_type : model_port_lookup_[model_id]) {
     for (auto port_id : model_ports_by_type) {
       port_ids.push_back(port_id);
     }
@@ -854,15 +866,10 @@ std::vector<CircuitPortId> CircuitLibrary::model_global_ports_by_type(
 std::vector<CircuitPortId> CircuitLibrary::model_ports_by_type(
   const CircuitModelId& model_id,
   const enum e_circuit_model_port_type& type) const {
-  std::vector<CircuitPortId> port_ids;
-  for (const auto& port_id : model_ports(model_id)) {
-    /* We skip unmatched ports */
-    if (type != port_type(port_id)) {
-      continue;
-    }
-    port_ids.push_back(port_id);
-  }
-  return port_ids;
+  /* validate the model_id */
+  VTR_ASSERT(valid_model_id(model_id));
+  /* Ports are already classified by types in the fast look-up */
+  return model_port_lookup_[model_id][type];
 }
 
 /* Find the ports of a circuit model by a given type, return a list of qualified
@@ -1216,6 +1223,18 @@ CircuitModelId CircuitLibrary::model(const char* name) const {
 
 /* Find a circuit model by a given name and return its id */
 CircuitModelId CircuitLibrary::model(const std::string& name) const {
+  /* Use the fast look-up when it is built */
+  if (!model_name_lookup_.empty()) {
+    auto result = model_name_lookup_.find(name);
+    if (result == model_name_lookup_.end()) {
+      return CircuitModelId::INVALID();
+    }
+    /* A name shared by multiple models is caught by the search below */
+    if (CircuitModelId::INVALID() != result->second) {
+      return result->second;
+    }
+  }
+
   CircuitModelId ret = CircuitModelId::INVALID();
   size_t num_found = 0;
   for (circuit_model_string_iterator it = model_names_.begin();
@@ -1224,9 +1243,7 @@ CircuitModelId CircuitLibrary::model(const std::string& name) const {
     if (0 != name.compare(*it)) {
       continue;
     }
-    /* Find one and record it
-     * FIXME: I feel that we may have a better way in getting the CircuitModelId
-     */
+    /* Find one and record it */
     ret = CircuitModelId(it - model_names_.begin());
     num_found++;
   }
@@ -1365,6 +1382,9 @@ CircuitModelId CircuitLibrary::add_model(
   model_port_lookup_.resize(model_ids_.size());
   model_port_lookup_[model_id].resize(NUM_CIRCUIT_MODEL_PORT_TYPES);
 
+  /* Name look-up will be rebuilt when building links */
+  invalidate_model_name_lookup();
+
   return model_id;
 }
 
@@ -1374,6 +1394,7 @@ void CircuitLibrary::set_model_name(const CircuitModelId& model_id,
   /* validate the model_id */
   VTR_ASSERT(valid_model_id(model_id));
   model_names_[model_id] = name;
+  invalidate_model_name_lookup();
   return;
 }
 
@@ -1587,8 +1608,10 @@ CircuitPortId CircuitLibrary::add_model_port(
   port_in_edge_ids_.emplace_back();
   port_out_edge_ids_.emplace_back();
 
-  /* Build the fast look-up for circuit model ports */
-  build_model_port_lookup();
+  /* Update the fast look-up for circuit model ports. The new port has the
+   * largest id, so appending it keeps the same order as a full rebuild */
+  model_port_lookup_[model_id][port_type].push_back(circuit_port_id);
+  invalidate_model_name_lookup();
 
   return circuit_port_id;
 }
@@ -1608,6 +1631,7 @@ void CircuitLibrary::set_port_prefix(const CircuitPortId& circuit_port_id,
   /* validate the circuit_port_id */
   VTR_ASSERT(valid_circuit_port_id(circuit_port_id));
   port_prefix_[circuit_port_id] = port_prefix;
+  invalidate_model_name_lookup();
   return;
 }
 
@@ -2346,6 +2370,9 @@ void CircuitLibrary::build_model_timing_graph(const CircuitModelId& model_id) {
  ***********************************************************************/
 /* Build the links for attributes of each model by searching the model_names */
 void CircuitLibrary::build_model_links() {
+  /* Names are used to find the linked models, build the look-up first */
+  build_model_name_lookup();
+
   /* Walk through each circuit model, build links one by one */
   for (auto& model_id : models()) {
     /* Build links for buffers, pass-gates model */
@@ -2590,20 +2617,27 @@ void CircuitLibrary::build_model_lookup() {
   return;
 }
 
-/* Build fast look-up for circuit model ports */
-void CircuitLibrary::build_model_port_lookup() {
-  /* For all the ports in the list, categorize by model_id and port_type */
-  /* invalidate fast look-up */
-  invalidate_model_port_lookup();
-  /* Classify circuit models by type */
-  model_port_lookup_.resize(model_ids_.size());
+/* Build fast look-up for circuit models and their ports by names */
+void CircuitLibrary::build_model_name_lookup() {
+  invalidate_model_name_lookup();
+
+  model_name_lookup_.reserve(model_ids_.size());
   for (const auto& model_id : model_ids_) {
-    model_port_lookup_[model_id].resize(NUM_CIRCUIT_MODEL_PORT_TYPES);
+    auto result = model_name_lookup_.emplace(model_names_[model_id], model_id);
+    /* Duplicated names are marked so that the look-up falls back to the
+     * exhaustive search, which errors out */
+    if (false == result.second) {
+      result.first->second = CircuitModelId::INVALID();
+    }
   }
-  /* Walk through models and categorize */
+
+  model_port_name_lookup_.resize(model_ids_.size());
   for (const auto& port : port_ids_) {
-    CircuitModelId model_id = port_model_ids_[port];
-    model_port_lookup_[model_id][port_type(port)].push_back(port);
+    auto result = model_port_name_lookup_[port_model_ids_[port]].emplace(
+      port_prefix_[port], port);
+    if (false == result.second) {
+      result.first->second = CircuitPortId::INVALID();
+    }
   }
   return;
 }
@@ -2670,9 +2704,10 @@ void CircuitLibrary::invalidate_model_lookup() const {
   return;
 }
 
-/* Empty fast lookup for circuit ports for a model */
-void CircuitLibrary::invalidate_model_port_lookup() const {
-  model_port_lookup_.clear();
+/* Empty fast lookup for names of models and ports */
+void CircuitLibrary::invalidate_model_name_lookup() const {
+  model_name_lookup_.clear();
+  model_port_name_lookup_.clear();
   return;
 }
 
@@ -2695,6 +2730,45 @@ void CircuitLibrary::invalidate_model_timing_graph() {
   return;
 }
 
+/************************************************************************
+ * Serialization
+ ***********************************************************************/
+template <class Archive>
+void CircuitLibrary::serialize(Archive& archive) {
+  archive(model_ids_, model_types_, model_names_, model_prefix_,
+          model_verilog_netlists_, model_spice_netlists_, model_is_default_,
+          sub_models_, model_lookup_, model_port_lookup_, model_name_lookup_,
+          model_port_name_lookup_, dump_structural_verilog_,
+          dump_explicit_port_map_, design_tech_types_, is_power_gated_,
+          device_model_names_, buffer_existence_, buffer_model_names_,
+          buffer_model_ids_, buffer_location_maps_,
+          pass_gate_logic_model_names_, pass_gate_logic_model_ids_,
+          last_stage_pass_gate_logic_model_names_,
+          last_stage_pass_gate_logic_model_ids_, port_ids_, port_model_ids_,
+          port_types_, port_sizes_, port_prefix_, port_lib_names_,
+          port_inv_prefix_, port_default_values_, port_is_io_,
+          port_is_data_io_, port_is_mif_data_bus_, port_is_mode_select_,
+          port_is_global_, port_is_reset_, port_is_set_,
+          port_is_config_enable_, port_is_prog_, port_is_shift_register_,
+          port_tri_state_model_names_, port_tri_state_model_ids_,
+          port_inv_model_names_, port_inv_model_ids_, port_tri_state_maps_,
+          port_lut_frac_level_, port_is_harden_lut_port_,
+          port_lut_output_masks_, port_sram_orgz_, edge_ids_,
+          edge_parent_model_ids_, port_in_edge_ids_, port_out_edge_ids_,
+          edge_src_port_ids_, edge_src_pin_ids_, edge_sink_port_ids_,
+          edge_sink_pin_ids_, edge_timing_info_, delay_types_,
+          delay_in_port_names_, delay_out_port_names_, delay_values_,
+          buffer_types_, buffer_sizes_, buffer_num_levels_,
+          buffer_f_per_stage_, pass_gate_logic_types_, pass_gate_logic_sizes_,
+          mux_structure_, mux_num_levels_, mux_const_input_values_,
+          mux_use_local_encoder_, mux_use_advanced_rram_design_,
+          lut_is_fracturable_, gate_types_, rram_res_, wprog_set_,
+          wprog_reset_, wire_types_, wire_rc_, wire_num_levels_);
+}
+
+template void CircuitLibrary::serialize(openfpga::BinaryWriter& archive);
+template void CircuitLibrary::serialize(openfpga::BinaryReader& archive);
+
 /************************************************************************
  * End of file : circuit_library.cpp
  ***********************************************************************/
@@ -13,6 +13,7 @@
 /* Header files should be included in a sequence */
 /* Standard header files required go first */
 #include <string>
+#include <unordered_map>
 
 #include "circuit_library_fwd.h"
 #include "circuit_types.h"
@@ -63,6 +64,11 @@
  *the default model in the first element for each type.
  *  2. model_port_lookup_: A multi-dimension vector to provide fast look-up on
  *ports of circuit models for users It classifies Ports by their types
+ *  3. model_name_lookup_: A hash table to find a circuit model by its name.
+ *It is built by build_model_links() and cleared once a model is added or
+ *renamed. When empty, the names are searched one by one.
+ *  4. model_port_name_lookup_: A hash table per circuit model to find a port
+ *by its name (prefix). It follows the same life cycle as model_name_lookup_
  *
  *  ------ Verilog generation options -----
  * 1. dump_structural_verilog_: if Verilog generator will output structural
@@ -608,7 +614,7 @@ class CircuitLibrary {
 
  public: /* Internal mutators: build fast look-ups */
   void build_model_lookup();
-  void build_model_port_lookup();
+  void build_model_name_lookup();
 
  public: /* Public invalidators/validators */
   bool valid_model_id(const CircuitModelId& model_id) const;
@@ -626,9 +632,15 @@ class CircuitLibrary {
   bool valid_mux_const_input_value(const size_t& const_input_value) const;
   /* Invalidators */
   void invalidate_model_lookup() const;
-  void invalidate_model_port_lookup() const;
+  void invalidate_model_name_lookup() const;
   void invalidate_model_timing_graph();
 
+ public: /* Serialization */
+  /* Read or write all the internal data, including the fast look-ups, with
+   * a binary archive (see openfpga_binary_archive.h) */
+  template <class Archive>
+  void serialize(Archive& archive);
+
  private: /* Internal data */
   /* Fundamental information */
   vtr::vector<CircuitModelId, CircuitModelId> model_ids_;
@@ -653,6 +665,14 @@ class CircuitLibrary {
     CircuitModelPortLookup;
   mutable CircuitModelPortLookup
     model_port_lookup_; /* [model_id][port_type][port_ids] */
+  /* fast look-up for circuit models and their ports by names.
+   * An invalid id is stored for a name shared by more than one model (port),
+   * which is an error to be reported by the checker */
+  mutable std::unordered_map<std::string, CircuitModelId>
+    model_name_lookup_; /* [model_name] */
+  mutable vtr::vector<CircuitModelId,
+                      std::unordered_map<std::string, CircuitPortId>>
+    model_port_name_lookup_; /* [model_id][port_name] */
 
   /* Verilog generator options */
   vtr::vector<CircuitModelId, bool> dump_structural_verilog_;
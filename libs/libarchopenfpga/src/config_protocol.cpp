@@ -1,5 +1,6 @@
 #include "config_protocol.h"
 
+#include "openfpga_binary_archive.h"
 #include "openfpga_tokenizer.h"
 #include "vtr_assert.h"
 #include "vtr_log.h"
@@ -337,3 +338,18 @@ int ConfigProtocol::validate() const {
   }
   return num_err;
 }
+
+/************************************************************************
+ * Serialization
+ ***********************************************************************/
+template <class Archive>
+void ConfigProtocol::serialize(Archive& archive) {
+  archive(type_, memory_model_name_, memory_model_, num_regions_,
+          prog_clk_port_, prog_clk_ccff_head_indices_, INDICE_STRING_DELIM_,
+          bl_protocol_type_, bl_memory_model_name_, bl_memory_model_,
+          bl_num_banks_, wl_protocol_type_, wl_memory_model_name_,
+          wl_memory_model_, wl_num_banks_, ql_memory_bank_config_setting_);
+}
+
+template void ConfigProtocol::serialize(openfpga::BinaryWriter& archive);
+template void ConfigProtocol::serialize(openfpga::BinaryReader& archive);
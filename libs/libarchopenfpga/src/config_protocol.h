@@ -98,6 +98,11 @@ class ConfigProtocol {
    */
   int validate_ccff_prog_clocks() const;
 
+ public: /* Serialization */
+  /* Read or write all the internal data with a binary archive */
+  template <class Archive>
+  void serialize(Archive& archive);
+
  private: /* Internal data */
   /* The type of configuration protocol.
    * In other words, it is about how to organize and access each configurable
@@ -61,6 +61,14 @@ struct Arch {
    * Bind from physical to circuit model
    */
   std::vector<PbTypeAnnotation> pb_type_annotations;
+
+  /* Read or write the whole architecture with a binary archive */
+  template <class Archive>
+  void serialize(Archive& archive) {
+    archive(circuit_lib, tech_lib, circuit_tech_binding, config_protocol,
+            cb_switch2circuit, sb_switch2circuit, routing_seg2circuit,
+            arch_direct, tile_annotations, pb_type_annotations);
+  }
 };
 
 }  // namespace openfpga
@@ -0,0 +1,159 @@
+/********************************************************************
+ * This file includes functions to cache an OpenFPGA architecture in a
+ * binary file, so that runs on the same architecture file can restore
+ * the architecture without parsing and linking the XML again.
+ *
+ * A cache file is organized as follows:
+ * - a magic number
+ * - the version of the cache format
+ * - the key of the architecture file, see openfpga_arch_cache_key()
+ * - the architecture data, see Arch::serialize()
+ * - the magic number again, to detect incomplete files
+ *******************************************************************/
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <random>
+
+/* Headers from vtrutil library */
+#include "vtr_log.h"
+#include "vtr_time.h"
+
+/* Headers from openfpgautil library */
+#include "openfpga_binary_archive.h"
+#include "openfpga_digest.h"
+#include "openfpga_version.h"
+
+/* Headers from libopenfpgashell library */
+#include "command_exit_codes.h"
+
+/* Headers from readarchopenfpga library */
+#include "openfpga_arch_cache.h"
+
+/* The magic number reads "OFPGAARC" in a little-endian file */
+constexpr uint64_t ARCH_CACHE_MAGIC = 0x435241414750464f;
+/* Increase the version whenever the cache format is changed */
+constexpr uint32_t ARCH_CACHE_FORMAT_VERSION = 1;
+
+/********************************************************************
+ * Accumulate a FNV-1a hash over a range of bytes
+ *******************************************************************/
+static void hash_bytes(uint64_t& hash, const char* data, const size_t& size) {
+  for (size_t i = 0; i < size; ++i) {
+    hash ^= uint64_t(uint8_t(data[i]));
+    hash *= 0x100000001b3;
+  }
+}
+
+std::string openfpga_arch_cache_key(const char* arch_file_name) {
+  std::ifstream ifs(arch_file_name, std::ios::binary);
+  if (!ifs.is_open()) {
+    return std::string();
+  }
+
+  uint64_t hash = 0xcbf29ce484222325;
+  /* The data structures may change with any rebuild of the tool */
+  for (const char* tool_info :
+       {openfpga::VERSION, openfpga::VCS_REVISION, openfpga::BUILD_TIMESTAMP}) {
+    hash_bytes(hash, tool_info, std::char_traits<char>::length(tool_info) + 1);
+  }
+  hash_bytes(hash, reinterpret_cast<const char*>(&ARCH_CACHE_FORMAT_VERSION),
+             sizeof(ARCH_CACHE_FORMAT_VERSION));
+
+  char buf[65536];
+  while (ifs.read(buf, sizeof(buf)) || 0 < ifs.gcount()) {
+    hash_bytes(hash, buf, size_t(ifs.gcount()));
+  }
+  if (ifs.bad()) {
+    return std::string();
+  }
+
+  char key[17];
+  snprintf(key, sizeof(key), "%016llx", (unsigned long long)hash);
+  return std::string(key);
+}
+
+std::string openfpga_arch_cache_file_name(const std::string& cache_dir,
+                                          const std::string& cache_key) {
+  return openfpga::format_dir_path(cache_dir) + "openfpga_arch_" + cache_key +
+         ".bin";
+}
+
+/********************************************************************
+ * Read an architecture from a cache file
+ *******************************************************************/
+bool read_openfpga_arch_cache(const std::string& cache_file_name,
+                              const std::string& cache_key,
+                              openfpga::Arch& openfpga_arch) {
+  std::ifstream ifs(cache_file_name, std::ios::binary);
+  if (!ifs.is_open()) {
+    return false;
+  }
+
+  vtr::ScopedStartFinishTimer timer("Read OpenFPGA architecture cache");
+
+  openfpga::BinaryReader reader(ifs);
+  uint64_t magic = 0;
+  uint32_t format_version = 0;
+  std::string key;
+  reader(magic, format_version, key);
+  if (!reader.good() || ARCH_CACHE_MAGIC != magic ||
+      ARCH_CACHE_FORMAT_VERSION != format_version || cache_key != key) {
+    VTR_LOG_WARN("Architecture cache '%s' does not match! Skip it.\n",
+                 cache_file_name.c_str());
+    return false;
+  }
+
+  /* Only overwrite the architecture when the cache is fully read */
+  openfpga::Arch cached_arch;
+  reader(cached_arch, magic);
+  if (!reader.good() || ARCH_CACHE_MAGIC != magic ||
+      std::char_traits<char>::eof() != ifs.peek()) {
+    VTR_LOG_WARN("Architecture cache '%s' is incomplete! Skip it.\n",
+                 cache_file_name.c_str());
+    return false;
+  }
+
+  openfpga_arch = std::move(cached_arch);
+  return true;
+}
+
+/********************************************************************
+ * Write an architecture to a cache file
+ *******************************************************************/
+int write_openfpga_arch_cache(const std::string& cache_file_name,
+                              const std::string& cache_key,
+                              const openfpga::Arch& openfpga_arch) {
+  vtr::ScopedStartFinishTimer timer("Write OpenFPGA architecture cache");
+
+  openfpga::create_directory(openfpga::find_path_dir_name(cache_file_name),
+                             true, false);
+
+  /* Each writer uses its own temporary file */
+  char suffix[17];
+  snprintf(suffix, sizeof(suffix), "%08x%08x", std::random_device()(),
+           std::random_device()());
+  std::string tmp_file_name = cache_file_name + ".tmp" + std::string(suffix);
+
+  std::ofstream ofs(tmp_file_name, std::ios::binary | std::ios::trunc);
+  if (!ofs.is_open()) {
+    VTR_LOG_ERROR("Fail to create architecture cache '%s'!\n",
+                  tmp_file_name.c_str());
+    return openfpga::CMD_EXEC_FATAL_ERROR;
+  }
+
+  openfpga::BinaryWriter writer(ofs);
+  writer(ARCH_CACHE_MAGIC, ARCH_CACHE_FORMAT_VERSION, cache_key, openfpga_arch,
+         ARCH_CACHE_MAGIC);
+  ofs.close();
+
+  if (!writer.good() || ofs.fail() ||
+      0 != std::rename(tmp_file_name.c_str(), cache_file_name.c_str())) {
+    VTR_LOG_ERROR("Fail to write architecture cache '%s'!\n",
+                  cache_file_name.c_str());
+    std::remove(tmp_file_name.c_str());
+    return openfpga::CMD_EXEC_FATAL_ERROR;
+  }
+
+  return openfpga::CMD_EXEC_SUCCESS;
+}
@@ -0,0 +1,37 @@
+#ifndef OPENFPGA_ARCH_CACHE_H
+#define OPENFPGA_ARCH_CACHE_H
+
+/********************************************************************
+ * Include header files that are required by function declaration
+ *******************************************************************/
+#include <string>
+
+#include "openfpga_arch.h"
+
+/********************************************************************
+ * Function declaration
+ *******************************************************************/
+/* Build the key of the cache for an architecture file, which is a hash of
+ * the content of the file and the version of the tool. Any change on the
+ * architecture file or any rebuild of the tool leads to a different key.
+ * Return an empty key if the architecture file can not be read */
+std::string openfpga_arch_cache_key(const char* arch_file_name);
+
+/* Name the cache file of a key under a cache directory */
+std::string openfpga_arch_cache_file_name(const std::string& cache_dir,
+                                          const std::string& cache_key);
+
+/* Restore an architecture from a cache file. Return false and leave the
+ * architecture untouched if the cache file does not exist, was built for
+ * another key or is incomplete */
+bool read_openfpga_arch_cache(const std::string& cache_file_name,
+                              const std::string& cache_key,
+                              openfpga::Arch& openfpga_arch);
+
+/* Dump an architecture to a cache file. The file is renamed from a temporary
+ * file once completed, so that concurrent runs never read a partial cache */
+int write_openfpga_arch_cache(const std::string& cache_file_name,
+                              const std::string& cache_key,
+                              const openfpga::Arch& openfpga_arch);
+
+#endif
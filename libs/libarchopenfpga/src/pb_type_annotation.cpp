@@ -5,6 +5,7 @@
 
 #include <algorithm>
 
+#include "openfpga_binary_archive.h"
 #include "vtr_assert.h"
 #include "vtr_log.h"
 
@@ -286,4 +287,21 @@ void PbTypeAnnotation::add_interconnect_circuit_model_pair(
   interconnect_circuit_model_names_[interc_name] = circuit_model_name;
 }
 
+/************************************************************************
+ * Serialization
+ ***********************************************************************/
+template <class Archive>
+void PbTypeAnnotation::serialize(Archive& archive) {
+  archive(operating_pb_type_name_, operating_parent_pb_type_names_,
+          operating_parent_mode_names_, physical_pb_type_name_,
+          physical_parent_pb_type_names_, physical_parent_mode_names_,
+          physical_mode_name_, idle_mode_name_, mode_bits_,
+          circuit_model_name_, physical_pb_type_index_factor_,
+          physical_pb_type_index_offset_, operating_pb_type_ports_,
+          interconnect_circuit_model_names_);
+}
+
+template void PbTypeAnnotation::serialize(BinaryWriter& archive);
+template void PbTypeAnnotation::serialize(BinaryReader& archive);
+
 }  // namespace openfpga
@@ -84,6 +84,11 @@ class PbTypeAnnotation {
   void add_interconnect_circuit_model_pair(
     const std::string& interc_name, const std::string& circuit_model_name);
 
+ public: /* Serialization */
+  /* Read or write all the internal data with a binary archive */
+  template <class Archive>
+  void serialize(Archive& archive);
+
  private: /* Internal data */
   /* Binding between physical pb_type and operating pb_type
    * both operating and physial pb_type names contain the full names
@@ -1,5 +1,6 @@
 #include "ql_memory_bank_config_setting.h"
 
+#include "openfpga_binary_archive.h"
 #include "openfpga_tokenizer.h"
 #include "vtr_assert.h"
 #include "vtr_log.h"
@@ -32,3 +33,16 @@ void QLMemoryBankConfigSetting::add_pb_setting(const std::string& name,
   VTR_ASSERT(settings_.find(name) == settings_.end());
   settings_[name] = QLMemoryBankPBSetting(num_wl);
 }
+
+/************************************************************************
+ * Serialization
+ ***********************************************************************/
+template <class Archive>
+void QLMemoryBankConfigSetting::serialize(Archive& archive) {
+  archive(settings_);
+}
+
+template void QLMemoryBankConfigSetting::serialize(
+  openfpga::BinaryWriter& archive);
+template void QLMemoryBankConfigSetting::serialize(
+  openfpga::BinaryReader& archive);
@@ -7,6 +7,10 @@
 
 struct QLMemoryBankPBSetting {
   QLMemoryBankPBSetting(uint32_t n = 0) : num_wl(n) {}
+  template <class Archive>
+  void serialize(Archive& archive) {
+    archive(num_wl);
+  }
   uint32_t num_wl = 0;
 };
 
@@ -23,6 +27,11 @@ class QLMemoryBankConfigSetting {
  public: /* Public Mutators */
   void add_pb_setting(const std::string& name, uint32_t num_wl);
 
+ public: /* Serialization */
+  /* Read or write all the settings with a binary archive */
+  template <class Archive>
+  void serialize(Archive& archive);
+
  private: /* Internal data */
   std::map<std::string, QLMemoryBankPBSetting> settings_;
 };
@@ -1,5 +1,6 @@
 #include "technology_library.h"
 
+#include "openfpga_binary_archive.h"
 #include "vtr_assert.h"
 
 /************************************************************************
@@ -597,3 +598,22 @@ bool TechnologyLibrary::valid_variation_id(
   return (size_t(variation_id) < variation_ids_.size()) &&
          (variation_id == variation_ids_[variation_id]);
 }
+
+/************************************************************************
+ * Serialization
+ ***********************************************************************/
+template <class Archive>
+void TechnologyLibrary::serialize(Archive& archive) {
+  archive(model_ids_, model_names_, model_types_, model_lib_types_,
+          model_corners_, model_refs_, model_lib_paths_, model_vdds_,
+          model_pn_ratios_, transistor_model_names_,
+          transistor_model_chan_lengths_, transistor_model_min_widths_,
+          transistor_model_max_widths_, transistor_model_variation_names_,
+          transistor_model_variation_ids_, rram_resistances_,
+          rram_variation_names_, rram_variation_ids_, variation_ids_,
+          variation_names_, variation_abs_values_, variation_num_sigmas_,
+          model_name2ids_, variation_name2ids_);
+}
+
+template void TechnologyLibrary::serialize(openfpga::BinaryWriter& archive);
+template void TechnologyLibrary::serialize(openfpga::BinaryReader& archive);
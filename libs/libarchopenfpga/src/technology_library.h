@@ -189,6 +189,11 @@ class TechnologyLibrary {
   bool valid_model_id(const TechnologyModelId& model_id) const;
   bool valid_variation_id(const TechnologyVariationId& variation_id) const;
 
+ public: /* Serialization */
+  /* Read or write all the internal data with a binary archive */
+  template <class Archive>
+  void serialize(Archive& archive);
+
  private: /* Internal data */
   /* Transistor-related fundamental information */
   /* Unique identifier for each model
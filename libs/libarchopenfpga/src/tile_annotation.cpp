@@ -6,6 +6,7 @@
 #include <algorithm>
 
 #include "command_exit_codes.h"
+#include "openfpga_binary_archive.h"
 #include "vtr_assert.h"
 #include "vtr_log.h"
 
@@ -292,4 +293,20 @@ int TileAnnotation::set_physical_equivalent_site(
   return CMD_EXEC_SUCCESS;
 }
 
+/************************************************************************
+ * Serialization
+ ***********************************************************************/
+template <class Archive>
+void TileAnnotation::serialize(Archive& archive) {
+  archive(global_port_ids_, global_port_names_, global_port_tile_names_,
+          global_port_tile_coordinates_, global_port_tile_ports_,
+          global_port_is_clock_, global_port_clock_arch_tree_names_,
+          global_port_is_reset_, global_port_is_set_,
+          global_port_default_values_, global_port_name2ids_,
+          tile_ports_to_merge_, phy_equ_site_maps_);
+}
+
+template void TileAnnotation::serialize(BinaryWriter& archive);
+template void TileAnnotation::serialize(BinaryReader& archive);
+
 }  // namespace openfpga
@@ -108,6 +108,11 @@ class TileAnnotation {
   bool valid_global_port_attributes(
     const TileGlobalPortId& global_port_id) const;
 
+ public: /* Serialization */
+  /* Read or write all the internal data with a binary archive */
+  template <class Archive>
+  void serialize(Archive& archive);
+
  private: /* Internal data */
   /* Global port information for tiles */
   vtr::vector<TileGlobalPortId, TileGlobalPortId> global_port_ids_;
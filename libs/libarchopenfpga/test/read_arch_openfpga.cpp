@@ -3,15 +3,26 @@
  * 1. parser of data structures
  * 2. writer of data structures
  *******************************************************************/
+#include <fstream>
+#include <iterator>
+#include <string>
+
 /* Headers from vtrutils */
 #include "vtr_assert.h"
 #include "vtr_log.h"
 
 /* Headers from readarchopenfpga */
 #include "check_circuit_library.h"
+#include "openfpga_arch_cache.h"
 #include "read_xml_openfpga_arch.h"
 #include "write_xml_openfpga_arch.h"
 
+static std::string read_file_content(const std::string& fname) {
+  std::ifstream ifs(fname);
+  return std::string(std::istreambuf_iterator<char>(ifs),
+                     std::istreambuf_iterator<char>());
+}
+
 int main(int argc, const char** argv) {
   /* Ensure we have only one or two argument */
   VTR_ASSERT((2 == argc) || (3 == argc));
@@ -28,7 +39,28 @@ int main(int argc, const char** argv) {
    * This is optional only used when there is a second argument
    */
   if (3 <= argc) {
-    write_xml_openfpga_arch(argv[2], openfpga_arch);
-    VTR_LOG("Echo the OpenFPGA architecture to an XML file: %s.\n", argv[2]);
+    std::string out_fname(argv[2]);
+    /* A cache file is read back, and the restored architecture should be
+     * echoed to the same XML as the original one */
+    if (out_fname.size() > 4 &&
+        out_fname.substr(out_fname.size() - 4) == std::string(".bin")) {
+      std::string cache_key = openfpga_arch_cache_key(argv[1]);
+      VTR_ASSERT(!cache_key.empty());
+      int status =
+        write_openfpga_arch_cache(out_fname, cache_key, openfpga_arch);
+      VTR_ASSERT(0 == status);
+      VTR_LOG("Write the OpenFPGA architecture to a cache file: %s.\n",
+              argv[2]);
+      openfpga::Arch readback_arch;
+      VTR_ASSERT(read_openfpga_arch_cache(out_fname, cache_key, readback_arch));
+      write_xml_openfpga_arch((out_fname + ".orig.xml").c_str(), openfpga_arch);
+      write_xml_openfpga_arch((out_fname + ".xml").c_str(), readback_arch);
+      VTR_ASSERT(read_file_content(out_fname + ".orig.xml") ==
+                 read_file_content(out_fname + ".xml"));
+    } else {
+      write_xml_openfpga_arch(argv[2], openfpga_arch);
+      VTR_LOG("Echo the OpenFPGA architecture to an XML file: %s.\n",
+              argv[2]);
+    }
   }
 }
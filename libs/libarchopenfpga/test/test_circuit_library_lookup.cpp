@@ -0,0 +1,171 @@
+/********************************************************************
+ * Unit test for the fast look-ups of circuit models and their ports
+ * by names.
+ * The look-ups are checked against an exhaustive search on the names
+ * - when the name look-up is not built yet
+ * - after the name look-up is built by build_model_links()
+ * - after ports are added to and models/ports are renamed in a library
+ *   whose look-up was built
+ * - after the look-up is rebuilt
+ *
+ * Usage: test_circuit_library_lookup
+ *******************************************************************/
+#include <string>
+#include <vector>
+
+/* Headers from vtrutils */
+#include "vtr_log.h"
+
+/* Headers from readarchopenfpga */
+#include "circuit_library.h"
+
+/* The number of models and the number of ports per model in the library */
+constexpr size_t NUM_TEST_MODELS = 50;
+constexpr size_t NUM_TEST_PORTS = 6;
+
+/* Find a model by searching all the models one by one */
+static CircuitModelId find_model_exhaustively(
+  const CircuitLibrary& circuit_lib, const std::string& name) {
+  for (const CircuitModelId& model : circuit_lib.models()) {
+    if (name == circuit_lib.model_name(model)) {
+      return model;
+    }
+  }
+  return CircuitModelId::INVALID();
+}
+
+/* Find a port of a model by searching all the ports one by one */
+static CircuitPortId find_model_port_exhaustively(
+  const CircuitLibrary& circuit_lib, const CircuitModelId& model,
+  const std::string& name) {
+  for (const CircuitPortId& port : circuit_lib.model_ports(model)) {
+    if (name == circuit_lib.port_prefix(port)) {
+      return port;
+    }
+  }
+  return CircuitPortId::INVALID();
+}
+
+/* Compare the look-ups to the exhaustive search on a list of names,
+ * including the names which are not in the library.
+ * Return the number of mismatches */
+static int check_lookups(const CircuitLibrary& circuit_lib,
+                         const std::vector<std::string>& model_names,
+                         const std::vector<std::string>& port_names,
+                         const std::string& stage) {
+  int num_errors = 0;
+  for (const std::string& model_name : model_names) {
+    CircuitModelId model = circuit_lib.model(model_name);
+    if (model != find_model_exhaustively(circuit_lib, model_name)) {
+      VTR_LOG_ERROR("[%s] Mismatched look-up on model '%s'!\n", stage.c_str(),
+                    model_name.c_str());
+      ++num_errors;
+    }
+    if (CircuitModelId::INVALID() == model) {
+      continue;
+    }
+    for (const std::string& port_name : port_names) {
+      if (circuit_lib.model_port(model, port_name) !=
+          find_model_port_exhaustively(circuit_lib, model, port_name)) {
+        VTR_LOG_ERROR("[%s] Mismatched look-up on port '%s' of model '%s'!\n",
+                      stage.c_str(), port_name.c_str(), model_name.c_str());
+        ++num_errors;
+      }
+    }
+  }
+  return num_errors;
+}
+
+int main(int argc, char** argv) {
+  if (1 != argc) {
+    VTR_LOG("Usage: %s\n", argv[0]);
+    return 1;
+  }
+
+  CircuitLibrary circuit_lib;
+  std::vector<std::string> model_names;
+  std::vector<std::string> port_names;
+  for (size_t iport = 0; iport < NUM_TEST_PORTS + 1; ++iport) {
+    port_names.push_back("port" + std::to_string(iport));
+  }
+  port_names.push_back("");
+
+  for (size_t imodel = 0; imodel < NUM_TEST_MODELS; ++imodel) {
+    CircuitModelId model = circuit_lib.add_model(CIRCUIT_MODEL_INVBUF);
+    model_names.push_back("model" + std::to_string(imodel));
+    circuit_lib.set_model_name(model, model_names.back());
+    /* Models have different numbers of ports, so that some port names are
+     * only found in part of the models */
+    for (size_t iport = 0; iport < imodel % NUM_TEST_PORTS; ++iport) {
+      CircuitPortId port = circuit_lib.add_model_port(
+        model, 0 == iport % 2 ? CIRCUIT_MODEL_PORT_INPUT
+                              : CIRCUIT_MODEL_PORT_OUTPUT);
+      circuit_lib.set_port_prefix(port, port_names[iport]);
+    }
+  }
+  model_names.push_back("model_not_exist");
+
+  int num_errors = 0;
+  num_errors +=
+    check_lookups(circuit_lib, model_names, port_names, "without look-up");
+
+  circuit_lib.build_model_links();
+  num_errors +=
+    check_lookups(circuit_lib, model_names, port_names, "with look-up");
+
+  /* Add ports to the models whose look-up is built. The new ports should be
+   * found by names and be listed after the existing ports of the same type */
+  for (const CircuitModelId& model : circuit_lib.models()) {
+    size_t num_inputs =
+      circuit_lib.model_ports_by_type(model, CIRCUIT_MODEL_PORT_INPUT).size();
+    CircuitPortId port =
+      circuit_lib.add_model_port(model, CIRCUIT_MODEL_PORT_INPUT);
+    circuit_lib.set_port_prefix(port, port_names[NUM_TEST_PORTS]);
+    if (port != circuit_lib.model_port(model, port_names[NUM_TEST_PORTS])) {
+      VTR_LOG_ERROR("Port '%s' added to model '%s' is not found!\n",
+                    port_names[NUM_TEST_PORTS].c_str(),
+                    circuit_lib.model_name(model).c_str());
+      ++num_errors;
+    }
+    std::vector<CircuitPortId> inputs =
+      circuit_lib.model_ports_by_type(model, CIRCUIT_MODEL_PORT_INPUT);
+    if (num_inputs + 1 != inputs.size() || port != inputs.back()) {
+      VTR_LOG_ERROR("Port '%s' added to model '%s' is not the last input!\n",
+                    port_names[NUM_TEST_PORTS].c_str(),
+                    circuit_lib.model_name(model).c_str());
+      ++num_errors;
+    }
+  }
+  num_errors +=
+    check_lookups(circuit_lib, model_names, port_names, "after adding ports");
+
+  /* Rename a model and a port. The old names should not be found anymore */
+  CircuitModelId renamed_model = circuit_lib.model(model_names[1]);
+  circuit_lib.set_model_name(renamed_model, "model_renamed");
+  model_names.push_back("model_renamed");
+  CircuitPortId renamed_port =
+    circuit_lib.model_port(renamed_model, port_names[0]);
+  circuit_lib.set_port_prefix(renamed_port, "port_renamed");
+  port_names.push_back("port_renamed");
+  if (CircuitModelId::INVALID() != circuit_lib.model(model_names[1]) ||
+      renamed_port != circuit_lib.model_port(renamed_model, "port_renamed")) {
+    VTR_LOG_ERROR("Renamed model or port is found by its old name!\n");
+    ++num_errors;
+  }
+  num_errors +=
+    check_lookups(circuit_lib, model_names, port_names, "after renaming");
+
+  circuit_lib.build_model_links();
+  num_errors +=
+    check_lookups(circuit_lib, model_names, port_names, "with rebuilt look-up");
+
+  if (0 < num_errors) {
+    VTR_LOG_ERROR("%d look-ups on circuit models and ports are wrong!\n",
+                  num_errors);
+    return 1;
+  }
+  VTR_LOG("All the look-ups on %lu circuit models and ports are correct\n",
+          circuit_lib.models().size());
+
+  return 0;
+}
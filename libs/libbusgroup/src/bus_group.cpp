@@ -52,8 +52,7 @@ std::string BusGroup::pin_name(const BusPinId& pin_id) const {
 }
 
 BusGroupId BusGroup::find_pin_bus(const std::string& pin_name) const {
-  std::map<std::string, BusPinId>::const_iterator result =
-    pin_name2id_map_.find(pin_name);
+  auto result = pin_name2id_map_.find(pin_name);
   if (result == pin_name2id_map_.end()) {
     /* Not found, return an invalid id */
     return BusGroupId::INVALID();
@@ -64,8 +63,7 @@ BusGroupId BusGroup::find_pin_bus(const std::string& pin_name) const {
 }
 
 BusGroupId BusGroup::find_bus(const std::string& bus_name) const {
-  std::map<std::string, BusGroupId>::const_iterator result =
-    bus_name2id_map_.find(bus_name);
+  auto result = bus_name2id_map_.find(bus_name);
   if (result == bus_name2id_map_.end()) {
     /* Not found, return an invalid id */
     return BusGroupId::INVALID();
@@ -75,8 +73,7 @@ BusGroupId BusGroup::find_bus(const std::string& bus_name) const {
 }
 
 BusPinId BusGroup::find_pin(const std::string& pin_name) const {
-  std::map<std::string, BusPinId>::const_iterator result =
-    pin_name2id_map_.find(pin_name);
+  auto result = pin_name2id_map_.find(pin_name);
   if (result == pin_name2id_map_.end()) {
     /* Not found, return an invalid id */
     return BusPinId::INVALID();
@@ -95,6 +92,7 @@ void BusGroup::reserve_buses(const size_t& num_buses) {
   bus_ports_.reserve(num_buses);
   bus_big_endians_.reserve(num_buses);
   bus_pin_ids_.reserve(num_buses);
+  bus_name2id_map_.reserve(num_buses);
 }
 
 void BusGroup::reserve_pins(const size_t& num_pins) {
@@ -102,6 +100,7 @@ void BusGroup::reserve_pins(const size_t& num_pins) {
   pin_indices_.reserve(num_pins);
   pin_names_.reserve(num_pins);
   pin_parent_bus_ids_.reserve(num_pins);
+  pin_name2id_map_.reserve(num_pins);
 }
 
 BusGroupId BusGroup::create_bus(const openfpga::BasicPort& bus_port) {
@@ -5,7 +5,6 @@
  * This file include the declaration of pin constraints
  *******************************************************************/
 #include <array>
-#include <map>
 #include <string>
 
 /* Headers from vtrutil library */
@@ -14,6 +13,7 @@
 /* Headers from openfpgautil library */
 #include "bus_group_fwd.h"
 #include "openfpga_port.h"
+#include "openfpga_string_hash.h"
 
 namespace openfpga {  // Begin namespace openfpga
 
@@ -129,8 +129,8 @@ class BusGroup {
   vtr::vector<BusPinId, BusGroupId> pin_parent_bus_ids_;
 
   /* Fast look-up */
-  std::map<std::string, BusGroupId> bus_name2id_map_;
-  std::map<std::string, BusPinId> pin_name2id_map_;
+  StringMap<BusGroupId> bus_name2id_map_;
+  StringMap<BusPinId> pin_name2id_map_;
 };
 
 }  // End of namespace openfpga
@@ -67,21 +67,20 @@ std::vector<FabricKeyId> FabricKey::find_key_by_alias(
     VTR_LOG_WARN(
       "Empty alias is given! This may cause unexpected results, i.e., a whole "
       "data base is dumped!\n");
-  }
-  size_t num_found_keys = 0;
-  for (FabricKeyId key_id : key_ids_) {
-    if (key_alias(key_id) == alias) {
-      num_found_keys++;
+    /* Keys without alias are not in the lookup, so walk through all of them */
+    std::vector<FabricKeyId> found_keys;
+    for (FabricKeyId key_id : key_ids_) {
+      if (key_alias_[key_id].empty()) {
+        found_keys.push_back(key_id);
+      }
     }
+    return found_keys;
   }
-  std::vector<FabricKeyId> found_keys;
-  found_keys.reserve(num_found_keys);
-  for (FabricKeyId key_id : key_ids_) {
-    if (key_alias(key_id) == alias) {
-      found_keys.push_back(key_id);
-    }
+  auto result = alias2key_lookup_.find(alias);
+  if (result == alias2key_lookup_.end()) {
+    return std::vector<FabricKeyId>();
   }
-  return found_keys;
+  return result->second;
 }
 
 std::vector<FabricKeyId> FabricKey::region_keys(
@@ -193,14 +192,13 @@ void FabricKey::add_key_to_region(const FabricRegionId& region_id,
   /* validate the region_id */
   VTR_ASSERT(valid_region_id(region_id));
 
-  /* Check if the key is already in the region */
-  if (region_key_ids_[region_id].end() !=
-      std::find(region_key_ids_[region_id].begin(),
-                region_key_ids_[region_id].end(), key_id)) {
+  /* Check if the key is already in the region. A key is in the key list of
+   * a region if and only if it is affiliated to the region, so there is no
+   * need to search the list, which is slow for regions with many keys */
+  if (region_id == key_regions_[key_id]) {
     VTR_LOG_WARN(
       "Try to add a key '%s' which is already in the region '%lu'!\n",
       key_name(key_id).c_str(), size_t(region_id));
-    VTR_ASSERT(region_id == key_regions_[key_id]);
     return; /* Nothing to do but leave a warning! */
   }
 
@@ -263,7 +261,23 @@ void FabricKey::set_key_alias(const FabricKeyId& key_id,
   /* validate the key_id */
   VTR_ASSERT(valid_key_id(key_id));
 
+  /* Unregister the previous alias from the lookup */
+  if (!key_alias_[key_id].empty()) {
+    std::vector<FabricKeyId>& prev_keys =
+      alias2key_lookup_[key_alias_[key_id]];
+    prev_keys.erase(std::find(prev_keys.begin(), prev_keys.end(), key_id));
+    if (prev_keys.empty()) {
+      alias2key_lookup_.erase(key_alias_[key_id]);
+    }
+  }
+
   key_alias_[key_id] = alias;
+
+  /* Register in the lookup, keeping the keys in the ascending order */
+  if (!alias.empty()) {
+    std::vector<FabricKeyId>& keys = alias2key_lookup_[alias];
+    keys.insert(std::upper_bound(keys.begin(), keys.end(), key_id), key_id);
+  }
 }
 
 void FabricKey::set_key_coordinate(const FabricKeyId& key_id,
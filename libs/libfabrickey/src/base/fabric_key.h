@@ -7,6 +7,7 @@
 #include <array>
 #include <map>
 #include <string>
+#include <unordered_map>
 
 /* Headers from vtrutil library */
 #include "vtr_geometry.h"
@@ -91,7 +92,9 @@ class FabricKey {
   /** @brief Find valid key ids for a given alias. Note that you should NOT send
    * an empty alias which may cause a complete list of key ids to be returned
    * (extremely inefficent and NOT useful). Suggest to check if the existing
-   * fabric key contains valid alias for each key before calling this API!!! */
+   * fabric key contains valid alias for each key before calling this API!!!
+   * Non-empty aliases are found through a fast lookup. The keys are returned
+   * in the ascending order of their ids */
   std::vector<FabricKeyId> find_key_by_alias(const std::string& alias) const;
 
   /* Check if there are any keys */
@@ -208,6 +211,8 @@ class FabricKey {
   vtr::vector<FabricKeyId, FabricRegionId> key_regions_;
   /* Optional alias for each key, with which a key can also be represented */
   vtr::vector<FabricKeyId, std::string> key_alias_;
+  /* Fast lookup for the keys sharing a non-empty alias */
+  std::unordered_map<std::string, std::vector<FabricKeyId>> alias2key_lookup_;
 
   /* Unique ids for each BL shift register bank */
   vtr::vector<FabricRegionId,
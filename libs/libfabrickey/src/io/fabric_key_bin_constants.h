@@ -0,0 +1,29 @@
+#ifndef FABRIC_KEY_BIN_CONSTANTS_H
+#define FABRIC_KEY_BIN_CONSTANTS_H
+
+#include <cstdint>
+
+namespace openfpga {  // Begin namespace openfpga
+
+/* Constants required by binary parser
+ * A binary fabric key is a sequence of fields in the following order,
+ * which are dumped by openfpga::BinaryWriter. Sizes, values and key ids
+ * are 64-bit integers, strings and lists are prefixed by their sizes
+ * - file header: magic number and version
+ * - keys: number of keys, then name, value, alias and coordinate of each key
+ * - regions: number of regions, then for each region, the ids of its keys,
+ *   the data ports of its BL shift register banks and of its WL shift
+ *   register banks
+ * - modules: number of modules, then for each module, its name and the name,
+ *   value and alias of each sub key
+ */
+/* The magic number reads "OFPGAKEY" in a little-endian file */
+constexpr uint64_t BIN_FABRIC_KEY_MAGIC = 0x59454b414750464f;
+/* Increase the version whenever the layout is changed */
+constexpr uint64_t BIN_FABRIC_KEY_VERSION = 2;
+/* Fabric key files with this extension are in binary format */
+constexpr const char* BIN_FABRIC_KEY_FILE_EXTENSION = ".bin";
+
+}  // End of namespace openfpga
+
+#endif
@@ -0,0 +1,205 @@
+/********************************************************************
+ * This file includes the functions to read a fabric key from a binary
+ * file, which is written by write_bin_fabric_key()
+ * The file is read field by field by openfpga::BinaryReader without building
+ * any intermediate document, so that the memory footprint is only the fabric
+ * key itself
+ *******************************************************************/
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+/* Headers from vtr util library */
+#include "vtr_assert.h"
+#include "vtr_time.h"
+
+/* Headers from openfpga util library */
+#include "openfpga_binary_archive.h"
+
+/* Headers from libarchfpga */
+#include "arch_error.h"
+#include "fabric_key_bin_constants.h"
+#include "read_bin_fabric_key.h"
+#include "read_xml_fabric_key.h"
+
+namespace openfpga {  // Begin namespace openfpga
+
+/********************************************************************
+ * The reader stops at the end of the file or at the first corrupted
+ * field, so that a list with a corrupted size is never fully read
+ *******************************************************************/
+static void check_bin_fabric_key_reader(const BinaryReader& reader,
+                                        const char* key_fname) {
+  if (!reader.good()) {
+    archfpga_throw(key_fname, 0, "Unexpected end of binary fabric key!\n");
+  }
+}
+
+/********************************************************************
+ * Parse the keys and regions of the top-level module
+ *******************************************************************/
+static void read_bin_fabric_key_top_module(BinaryReader& reader,
+                                           const char* key_fname,
+                                           FabricKey& fabric_key) {
+  uint64_t num_keys = 0;
+  reader(num_keys);
+  for (uint64_t ikey = 0; ikey < num_keys; ++ikey) {
+    std::string name;
+    uint64_t value = 0;
+    std::string alias;
+    vtr::Point<int> coord(-1, -1);
+    reader(name, value, alias, coord);
+    check_bin_fabric_key_reader(reader, key_fname);
+
+    FabricKeyId key = fabric_key.create_key();
+    fabric_key.set_key_name(key, name);
+    fabric_key.set_key_value(key, value);
+    if (!alias.empty()) {
+      fabric_key.set_key_alias(key, alias);
+    }
+    if (fabric_key.valid_key_coordinate(coord)) {
+      fabric_key.set_key_coordinate(key, coord);
+    }
+  }
+
+  uint64_t num_regions = 0;
+  reader(num_regions);
+  for (uint64_t iregion = 0; iregion < num_regions; ++iregion) {
+    std::vector<FabricKeyId> region_keys;
+    reader(region_keys);
+    check_bin_fabric_key_reader(reader, key_fname);
+
+    FabricRegionId region = fabric_key.create_region();
+    fabric_key.reserve_region_keys(region, region_keys.size());
+    for (const FabricKeyId& key : region_keys) {
+      if (false == fabric_key.valid_key_id(key)) {
+        archfpga_throw(key_fname, 0,
+                       "Invalid key id '%lu' (in total %lu keys)!\n",
+                       size_t(key), fabric_key.num_keys());
+      }
+      fabric_key.add_key_to_region(region, key);
+    }
+
+    uint64_t num_bl_banks = 0;
+    reader(num_bl_banks);
+    for (uint64_t ibank = 0; ibank < num_bl_banks; ++ibank) {
+      std::vector<BasicPort> data_ports;
+      reader(data_ports);
+      check_bin_fabric_key_reader(reader, key_fname);
+      FabricBitLineBankId bank =
+        fabric_key.create_bl_shift_register_bank(region);
+      for (const BasicPort& data_port : data_ports) {
+        fabric_key.add_data_port_to_bl_shift_register_bank(region, bank,
+                                                           data_port);
+      }
+    }
+
+    uint64_t num_wl_banks = 0;
+    reader(num_wl_banks);
+    for (uint64_t ibank = 0; ibank < num_wl_banks; ++ibank) {
+      std::vector<BasicPort> data_ports;
+      reader(data_ports);
+      check_bin_fabric_key_reader(reader, key_fname);
+      FabricWordLineBankId bank =
+        fabric_key.create_wl_shift_register_bank(region);
+      for (const BasicPort& data_port : data_ports) {
+        fabric_key.add_data_port_to_wl_shift_register_bank(region, bank,
+                                                           data_port);
+      }
+    }
+  }
+  check_bin_fabric_key_reader(reader, key_fname);
+}
+
+/********************************************************************
+ * Parse the sub keys of regular modules
+ *******************************************************************/
+static void read_bin_fabric_key_modules(BinaryReader& reader,
+                                        const char* key_fname,
+                                        FabricKey& fabric_key) {
+  uint64_t num_modules = 0;
+  reader(num_modules);
+  for (uint64_t imodule = 0; imodule < num_modules; ++imodule) {
+    std::string name;
+    uint64_t num_sub_keys = 0;
+    reader(name, num_sub_keys);
+    check_bin_fabric_key_reader(reader, key_fname);
+    FabricKeyModuleId module_id = fabric_key.create_module(name);
+    if (false == fabric_key.valid_module_id(module_id)) {
+      archfpga_throw(key_fname, 0, "Duplicated module '%s'!\n", name.c_str());
+    }
+
+    for (uint64_t ikey = 0; ikey < num_sub_keys; ++ikey) {
+      std::string sub_key_name;
+      uint64_t value = 0;
+      std::string alias;
+      reader(sub_key_name, value, alias);
+      check_bin_fabric_key_reader(reader, key_fname);
+
+      FabricSubKeyId sub_key = fabric_key.create_module_key(module_id);
+      fabric_key.set_sub_key_name(sub_key, sub_key_name);
+      fabric_key.set_sub_key_value(sub_key, value);
+      if (!alias.empty()) {
+        fabric_key.set_sub_key_alias(sub_key, alias);
+      }
+    }
+  }
+  check_bin_fabric_key_reader(reader, key_fname);
+}
+
+/********************************************************************
+ * Parse a binary fabric key file to an object of FabricKey
+ *******************************************************************/
+FabricKey read_bin_fabric_key(const char* key_fname) {
+  vtr::ScopedStartFinishTimer timer("Read Fabric Key in binary format");
+
+  FabricKey fabric_key;
+
+  std::ifstream ifs(key_fname, std::ios::binary);
+  if (!ifs.is_open()) {
+    archfpga_throw(key_fname, 0, "Unable to open binary fabric key!\n");
+  }
+  BinaryReader reader(ifs);
+
+  /* Check the file header */
+  uint64_t magic = 0;
+  uint64_t version = 0;
+  reader(magic, version);
+  if (!reader.good() || BIN_FABRIC_KEY_MAGIC != magic) {
+    archfpga_throw(key_fname, 0, "Not a binary fabric key!\n");
+  }
+  if (BIN_FABRIC_KEY_VERSION != version) {
+    archfpga_throw(key_fname, 0,
+                   "Unsupported version '%lu' of binary fabric key (expect "
+                   "'%lu')!\n",
+                   size_t(version), size_t(BIN_FABRIC_KEY_VERSION));
+  }
+
+  read_bin_fabric_key_top_module(reader, key_fname, fabric_key);
+  read_bin_fabric_key_modules(reader, key_fname, fabric_key);
+
+  return fabric_key;
+}
+
+/********************************************************************
+ * Identify if a fabric key file is in binary format by its extension
+ *******************************************************************/
+bool is_bin_fabric_key_file(const std::string& key_fname) {
+  std::string ext(BIN_FABRIC_KEY_FILE_EXTENSION);
+  return key_fname.size() > ext.size() &&
+         0 == key_fname.compare(key_fname.size() - ext.size(), ext.size(),
+                                ext);
+}
+
+/********************************************************************
+ * Read a fabric key in the format indicated by the file extension
+ *******************************************************************/
+FabricKey read_fabric_key(const char* key_fname) {
+  if (is_bin_fabric_key_file(std::string(key_fname))) {
+    return read_bin_fabric_key(key_fname);
+  }
+  return read_xml_fabric_key(key_fname);
+}
+
+}  // End of namespace openfpga
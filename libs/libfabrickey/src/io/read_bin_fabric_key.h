@@ -0,0 +1,27 @@
+#ifndef READ_BIN_FABRIC_KEY_H
+#define READ_BIN_FABRIC_KEY_H
+
+/********************************************************************
+ * Include header files that are required by function declaration
+ *******************************************************************/
+#include <string>
+
+#include "fabric_key.h"
+
+/********************************************************************
+ * Function declaration
+ *******************************************************************/
+
+namespace openfpga {  // Begin namespace openfpga
+
+FabricKey read_bin_fabric_key(const char* key_fname);
+
+/* Identify if a fabric key file is in binary format by its extension */
+bool is_bin_fabric_key_file(const std::string& key_fname);
+
+/* Read a fabric key from either a binary file or an XML file */
+FabricKey read_fabric_key(const char* key_fname);
+
+}  // End of namespace openfpga
+
+#endif
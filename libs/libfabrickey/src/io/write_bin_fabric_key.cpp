@@ -0,0 +1,94 @@
+/********************************************************************
+ * This file includes functions that outputs a fabric key to a binary file
+ * The binary format is much faster to load than XML for fabric keys with
+ * millions of keys. See the layout in fabric_key_bin_constants.h
+ *******************************************************************/
+/* Headers from system goes first */
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+/* Headers from vtr util library */
+#include "vtr_log.h"
+#include "vtr_time.h"
+
+/* Headers from openfpga util library */
+#include "openfpga_binary_archive.h"
+#include "openfpga_digest.h"
+
+/* Headers from fabrickey library */
+#include "fabric_key_bin_constants.h"
+#include "write_bin_fabric_key.h"
+
+namespace openfpga {  // Begin namespace openfpga
+
+/********************************************************************
+ * A writer to output a fabric key to binary format
+ *
+ * Return 0 if successful
+ * Return 2 if fail when creating files
+ *******************************************************************/
+int write_bin_fabric_key(const char* fname, const FabricKey& fabric_key) {
+  vtr::ScopedStartFinishTimer timer("Write Fabric Key in binary format");
+
+  /* Create a file handler */
+  std::fstream fp;
+  /* Open the file stream */
+  fp.open(std::string(fname),
+          std::fstream::out | std::fstream::trunc | std::fstream::binary);
+
+  /* Validate the file stream */
+  openfpga::check_file_stream(fname, fp);
+
+  BinaryWriter writer(fp);
+
+  /* File header */
+  writer(BIN_FABRIC_KEY_MAGIC, BIN_FABRIC_KEY_VERSION);
+
+  /* Keys of the top-level module */
+  writer(uint64_t(fabric_key.num_keys()));
+  for (const FabricKeyId& key : fabric_key.keys()) {
+    writer(fabric_key.key_name(key), uint64_t(fabric_key.key_value(key)),
+           fabric_key.key_alias(key), fabric_key.key_coordinate(key));
+  }
+
+  /* Regions */
+  writer(uint64_t(fabric_key.num_regions()));
+  for (const FabricRegionId& region : fabric_key.regions()) {
+    writer(fabric_key.region_keys(region));
+
+    writer(uint64_t(fabric_key.bl_banks(region).size()));
+    for (const FabricBitLineBankId& bank : fabric_key.bl_banks(region)) {
+      writer(fabric_key.bl_bank_data_ports(region, bank));
+    }
+    writer(uint64_t(fabric_key.wl_banks(region).size()));
+    for (const FabricWordLineBankId& bank : fabric_key.wl_banks(region)) {
+      writer(fabric_key.wl_bank_data_ports(region, bank));
+    }
+  }
+
+  /* Regular modules */
+  writer(uint64_t(fabric_key.modules().size()));
+  for (const FabricKeyModuleId& module_id : fabric_key.modules()) {
+    std::vector<FabricSubKeyId> sub_keys = fabric_key.sub_keys(module_id);
+    writer(fabric_key.module_name(module_id), uint64_t(sub_keys.size()));
+    for (const FabricSubKeyId& sub_key : sub_keys) {
+      writer(fabric_key.sub_key_name(sub_key),
+             uint64_t(fabric_key.sub_key_value(sub_key)),
+             fabric_key.sub_key_alias(sub_key));
+    }
+  }
+
+  if (false == openfpga::valid_file_stream(fp)) {
+    VTR_LOG_ERROR("Fail to write fabric key to file '%s'!\n", fname);
+    return 2;
+  }
+
+  /* Close the file stream */
+  fp.close();
+
+  return 0;
+}
+
+}  // End of namespace openfpga
@@ -0,0 +1,19 @@
+#ifndef WRITE_BIN_FABRIC_KEY_H
+#define WRITE_BIN_FABRIC_KEY_H
+
+/********************************************************************
+ * Include header files that are required by function declaration
+ *******************************************************************/
+#include "fabric_key.h"
+
+/********************************************************************
+ * Function declaration
+ *******************************************************************/
+
+namespace openfpga {  // Begin namespace openfpga
+
+int write_bin_fabric_key(const char* fname, const FabricKey& fabric_key);
+
+}  // End of namespace openfpga
+
+#endif
@@ -25,58 +25,50 @@
 namespace openfpga {  // Begin namespace openfpga
 
 /********************************************************************
- * A writer to output a component sub key to XML format
- *
- * Return 0 if successful
- * Return 1 if there are more serious bugs in the architecture
- * Return 2 if fail when creating files
+ * Element writers which output a fabric key piece by piece
  *******************************************************************/
-static int write_xml_fabric_component_sub_key(
-  std::fstream& fp, const FabricKey& fabric_key,
-  const FabricSubKeyId& component_key, const size_t& key_idx,
-  const size_t& level) {
-  /* Validate the file stream */
-  if (false == openfpga::valid_file_stream(fp)) {
-    return 2;
-  }
-
+void write_xml_fabric_key_module_begin(std::fstream& fp,
+                                       const std::string& module_name,
+                                       const size_t& level) {
   openfpga::write_tab_to_file(fp, level);
-  fp << "<" << XML_FABRIC_KEY_KEY_NODE_NAME;
-
-  if (false == fabric_key.valid_sub_key_id(component_key)) {
-    return 1;
-  }
+  fp << "<" << XML_FABRIC_KEY_MODULE_NODE_NAME << " "
+     << XML_FABRIC_KEY_MODULE_ATTRIBUTE_NAME_NAME << "=\"" << module_name
+     << "\""
+     << ">\n";
+}
 
-  write_xml_attribute(fp, XML_FABRIC_KEY_KEY_ATTRIBUTE_ID_NAME, key_idx);
-  if (!fabric_key.sub_key_name(component_key).empty()) {
-    write_xml_attribute(fp, XML_FABRIC_KEY_KEY_ATTRIBUTE_NAME_NAME,
-                        fabric_key.sub_key_name(component_key).c_str());
-  }
-  write_xml_attribute(fp, XML_FABRIC_KEY_KEY_ATTRIBUTE_VALUE_NAME,
-                      fabric_key.sub_key_value(component_key));
+void write_xml_fabric_key_module_end(std::fstream& fp, const size_t& level) {
+  openfpga::write_tab_to_file(fp, level);
+  fp << "</" << XML_FABRIC_KEY_MODULE_NODE_NAME << ">\n";
+}
 
-  if (!fabric_key.sub_key_alias(component_key).empty()) {
-    write_xml_attribute(fp, XML_FABRIC_KEY_KEY_ATTRIBUTE_ALIAS_NAME,
-                        fabric_key.sub_key_alias(component_key).c_str());
-  }
+void write_xml_fabric_key_region_begin(std::fstream& fp,
+                                       const size_t& region_id,
+                                       const size_t& level) {
+  openfpga::write_tab_to_file(fp, level);
+  fp << "<" << XML_FABRIC_KEY_REGION_NODE_NAME << " "
+     << XML_FABRIC_KEY_REGION_ATTRIBUTE_ID_NAME << "=\"" << region_id << "\""
+     << ">\n";
+}
 
-  fp << "/>"
+void write_xml_fabric_key_region_end(std::fstream& fp, const size_t& level) {
+  openfpga::write_tab_to_file(fp, level);
+  fp << "</" << XML_FABRIC_KEY_REGION_NODE_NAME << ">"
      << "\n";
-
-  return 0;
 }
 
 /********************************************************************
- * A writer to output a component key to XML format
+ * A writer to output a key to XML format
+ * The coordinate is skipped if it is not a valid one, e.g., (-1, -1)
  *
  * Return 0 if successful
- * Return 1 if there are more serious bugs in the architecture
  * Return 2 if fail when creating files
  *******************************************************************/
-static int write_xml_fabric_component_key(std::fstream& fp,
-                                          const FabricKey& fabric_key,
-                                          const FabricKeyId& component_key,
-                                          const size_t& level) {
+int write_xml_fabric_key_key(std::fstream& fp, const size_t& key_id,
+                             const std::string& name, const size_t& value,
+                             const std::string& alias,
+                             const vtr::Point<int>& coord,
+                             const size_t& level) {
   /* Validate the file stream */
   if (false == openfpga::valid_file_stream(fp)) {
     return 2;
@@ -85,26 +77,19 @@ static int write_xml_fabric_component_key(std::fstream& fp,
   openfpga::write_tab_to_file(fp, level);
   fp << "<" << XML_FABRIC_KEY_KEY_NODE_NAME;
 
-  if (false == fabric_key.valid_key_id(component_key)) {
-    return 1;
-  }
-
-  write_xml_attribute(fp, XML_FABRIC_KEY_KEY_ATTRIBUTE_ID_NAME,
-                      size_t(component_key));
-  if (!fabric_key.key_name(component_key).empty()) {
+  write_xml_attribute(fp, XML_FABRIC_KEY_KEY_ATTRIBUTE_ID_NAME, key_id);
+  if (!name.empty()) {
     write_xml_attribute(fp, XML_FABRIC_KEY_KEY_ATTRIBUTE_NAME_NAME,
-                        fabric_key.key_name(component_key).c_str());
+                        name.c_str());
   }
-  write_xml_attribute(fp, XML_FABRIC_KEY_KEY_ATTRIBUTE_VALUE_NAME,
-                      fabric_key.key_value(component_key));
+  write_xml_attribute(fp, XML_FABRIC_KEY_KEY_ATTRIBUTE_VALUE_NAME, value);
 
-  if (!fabric_key.key_alias(component_key).empty()) {
+  if (!alias.empty()) {
     write_xml_attribute(fp, XML_FABRIC_KEY_KEY_ATTRIBUTE_ALIAS_NAME,
-                        fabric_key.key_alias(component_key).c_str());
+                        alias.c_str());
   }
 
-  vtr::Point<int> coord = fabric_key.key_coordinate(component_key);
-  if (fabric_key.valid_key_coordinate(coord)) {
+  if (coord.x() > -1 && coord.y() > -1) {
     write_xml_attribute(fp, XML_FABRIC_KEY_KEY_ATTRIBUTE_COLUMN_NAME,
                         coord.x());
     write_xml_attribute(fp, XML_FABRIC_KEY_KEY_ATTRIBUTE_ROW_NAME, coord.y());
@@ -117,14 +102,15 @@ static int write_xml_fabric_component_key(std::fstream& fp,
 }
 
 /********************************************************************
- * A writer to output a BL shift register bank description to XML format
+ * A writer to output the BL or WL shift register banks of a region to XML
+ * format. The node name is either the one of BL banks or WL banks
  *
  * Return 0 if successful
- * Return 1 if there are more serious bugs in the architecture
  * Return 2 if fail when creating files
  *******************************************************************/
-static int write_xml_fabric_bl_shift_register_banks(
-  std::fstream& fp, const FabricKey& fabric_key, const FabricRegionId& region,
+int write_xml_fabric_key_shift_register_banks(
+  std::fstream& fp, const char* node_name,
+  const std::vector<std::vector<BasicPort>>& bank_data_ports,
   const size_t& level) {
   /* Validate the file stream */
   if (false == openfpga::valid_file_stream(fp)) {
@@ -132,25 +118,24 @@ static int write_xml_fabric_bl_shift_register_banks(
   }
 
   /* If we have an empty bank, we just skip it */
-  if (0 == fabric_key.bl_banks(region).size()) {
+  if (0 == bank_data_ports.size()) {
     return 0;
   }
 
   /* Write the root node */
   openfpga::write_tab_to_file(fp, level);
-  fp << "<" << XML_FABRIC_KEY_BL_SHIFT_REGISTER_BANKS_NODE_NAME << ">"
+  fp << "<" << node_name << ">"
      << "\n";
 
-  for (const auto& bank : fabric_key.bl_banks(region)) {
+  for (size_t bank = 0; bank < bank_data_ports.size(); ++bank) {
     openfpga::write_tab_to_file(fp, level + 1);
     fp << "<" << XML_FABRIC_KEY_BLWL_SHIFT_REGISTER_BANK_NODE_NAME;
 
     write_xml_attribute(
-      fp, XML_FABRIC_KEY_BLWL_SHIFT_REGISTER_BANK_ATTRIBUTE_ID_NAME,
-      size_t(bank));
+      fp, XML_FABRIC_KEY_BLWL_SHIFT_REGISTER_BANK_ATTRIBUTE_ID_NAME, bank);
 
     std::string port_str;
-    for (const auto& port : fabric_key.bl_bank_data_ports(region, bank)) {
+    for (const auto& port : bank_data_ports[bank]) {
       port_str += generate_xml_port_name(port) + ",";
     }
     /* Chop the last comma */
@@ -166,66 +151,52 @@ static int write_xml_fabric_bl_shift_register_banks(
   }
 
   openfpga::write_tab_to_file(fp, level);
-  fp << "</" << XML_FABRIC_KEY_BL_SHIFT_REGISTER_BANKS_NODE_NAME << ">"
+  fp << "</" << node_name << ">"
      << "\n";
 
   return 0;
 }
 
 /********************************************************************
- * A writer to output a WL shift register bank description to XML format
+ * A writer to output a component sub key to XML format
  *
  * Return 0 if successful
  * Return 1 if there are more serious bugs in the architecture
  * Return 2 if fail when creating files
  *******************************************************************/
-static int write_xml_fabric_wl_shift_register_banks(
-  std::fstream& fp, const FabricKey& fabric_key, const FabricRegionId& region,
+static int write_xml_fabric_component_sub_key(
+  std::fstream& fp, const FabricKey& fabric_key,
+  const FabricSubKeyId& component_key, const size_t& key_idx,
   const size_t& level) {
-  /* Validate the file stream */
-  if (false == openfpga::valid_file_stream(fp)) {
-    return 2;
-  }
-
-  /* If we have an empty bank, we just skip it */
-  if (0 == fabric_key.wl_banks(region).size()) {
-    return 0;
+  if (false == fabric_key.valid_sub_key_id(component_key)) {
+    return 1;
   }
 
-  /* Write the root node */
-  openfpga::write_tab_to_file(fp, level);
-  fp << "<" << XML_FABRIC_KEY_WL_SHIFT_REGISTER_BANKS_NODE_NAME << ">"
-     << "\n";
-
-  for (const auto& bank : fabric_key.wl_banks(region)) {
-    openfpga::write_tab_to_file(fp, level + 1);
-    fp << "<" << XML_FABRIC_KEY_BLWL_SHIFT_REGISTER_BANK_NODE_NAME;
-
-    write_xml_attribute(
-      fp, XML_FABRIC_KEY_BLWL_SHIFT_REGISTER_BANK_ATTRIBUTE_ID_NAME,
-      size_t(bank));
-
-    std::string port_str;
-    for (const auto& port : fabric_key.wl_bank_data_ports(region, bank)) {
-      port_str += generate_xml_port_name(port) + ",";
-    }
-    /* Chop the last comma */
-    if (!port_str.empty()) {
-      port_str.pop_back();
-    }
-    write_xml_attribute(
-      fp, XML_FABRIC_KEY_BLWL_SHIFT_REGISTER_BANK_ATTRIBUTE_RANGE_NAME,
-      port_str.c_str());
+  return write_xml_fabric_key_key(
+    fp, key_idx, fabric_key.sub_key_name(component_key),
+    fabric_key.sub_key_value(component_key),
+    fabric_key.sub_key_alias(component_key), vtr::Point<int>(-1, -1), level);
+}
 
-    fp << "/>"
-       << "\n";
+/********************************************************************
+ * A writer to output a component key to XML format
+ *
+ * Return 0 if successful
+ * Return 1 if there are more serious bugs in the architecture
+ * Return 2 if fail when creating files
+ *******************************************************************/
+static int write_xml_fabric_component_key(std::fstream& fp,
+                                          const FabricKey& fabric_key,
+                                          const FabricKeyId& component_key,
+                                          const size_t& level) {
+  if (false == fabric_key.valid_key_id(component_key)) {
+    return 1;
   }
 
-  openfpga::write_tab_to_file(fp, level);
-  fp << "</" << XML_FABRIC_KEY_WL_SHIFT_REGISTER_BANKS_NODE_NAME << ">"
-     << "\n";
-
-  return 0;
+  return write_xml_fabric_key_key(
+    fp, size_t(component_key), fabric_key.key_name(component_key),
+    fabric_key.key_value(component_key), fabric_key.key_alias(component_key),
+    fabric_key.key_coordinate(component_key), level);
 }
 
 /* Write keys under the top-level module to a file */
@@ -234,23 +205,28 @@ static int write_xml_top_module_keys(std::fstream& fp,
                                      const size_t& level) {
   int err_code = 0;
   /* Write the module declaration */
-  openfpga::write_tab_to_file(fp, level);
-  fp << "<" << XML_FABRIC_KEY_MODULE_NODE_NAME << " "
-     << XML_FABRIC_KEY_MODULE_ATTRIBUTE_NAME_NAME << "=\""
-     << FPGA_TOP_MODULE_NAME << "\""
-     << ">\n";
+  write_xml_fabric_key_module_begin(fp, std::string(FPGA_TOP_MODULE_NAME),
+                                    level);
 
   /* Write region by region */
   for (const FabricRegionId& region : fabric_key.regions()) {
-    openfpga::write_tab_to_file(fp, level + 1);
-    fp << "<" << XML_FABRIC_KEY_REGION_NODE_NAME << " "
-       << XML_FABRIC_KEY_REGION_ATTRIBUTE_ID_NAME << "=\"" << size_t(region)
-       << "\""
-       << ">\n";
+    write_xml_fabric_key_region_begin(fp, size_t(region), level + 1);
 
     /* Write shift register banks */
-    write_xml_fabric_bl_shift_register_banks(fp, fabric_key, region, level + 2);
-    write_xml_fabric_wl_shift_register_banks(fp, fabric_key, region, level + 2);
+    std::vector<std::vector<BasicPort>> bl_bank_data_ports;
+    for (const auto& bank : fabric_key.bl_banks(region)) {
+      bl_bank_data_ports.push_back(fabric_key.bl_bank_data_ports(region, bank));
+    }
+    write_xml_fabric_key_shift_register_banks(
+      fp, XML_FABRIC_KEY_BL_SHIFT_REGISTER_BANKS_NODE_NAME, bl_bank_data_ports,
+      level + 2);
+    std::vector<std::vector<BasicPort>> wl_bank_data_ports;
+    for (const auto& bank : fabric_key.wl_banks(region)) {
+      wl_bank_data_ports.push_back(fabric_key.wl_bank_data_ports(region, bank));
+    }
+    write_xml_fabric_key_shift_register_banks(
+      fp, XML_FABRIC_KEY_WL_SHIFT_REGISTER_BANKS_NODE_NAME, wl_bank_data_ports,
+      level + 2);
 
     /* Write component by component */
     for (const FabricKeyId& key : fabric_key.region_keys(region)) {
@@ -260,13 +236,10 @@ static int write_xml_top_module_keys(std::fstream& fp,
       }
     }
 
-    openfpga::write_tab_to_file(fp, level + 1);
-    fp << "</" << XML_FABRIC_KEY_REGION_NODE_NAME << ">"
-       << "\n";
+    write_xml_fabric_key_region_end(fp, level + 1);
   }
 
-  openfpga::write_tab_to_file(fp, level);
-  fp << "</" << XML_FABRIC_KEY_MODULE_NODE_NAME << ">\n";
+  write_xml_fabric_key_module_end(fp, level);
 
   return err_code;
 }
@@ -277,11 +250,8 @@ static int write_xml_module_keys(std::fstream& fp, const FabricKey& fabric_key,
                                  const size_t& level) {
   int err_code = 0;
   /* Write the module declaration */
-  openfpga::write_tab_to_file(fp, level);
-  fp << "<" << XML_FABRIC_KEY_MODULE_NODE_NAME << " "
-     << XML_FABRIC_KEY_MODULE_ATTRIBUTE_NAME_NAME << "=\""
-     << fabric_key.module_name(module_id) << "\""
-     << ">\n";
+  write_xml_fabric_key_module_begin(fp, fabric_key.module_name(module_id),
+                                    level);
 
   /* Write component by component */
   size_t key_idx = 0;
@@ -294,8 +264,7 @@ static int write_xml_module_keys(std::fstream& fp, const FabricKey& fabric_key,
     key_idx++;
   }
 
-  openfpga::write_tab_to_file(fp, level);
-  fp << "</" << XML_FABRIC_KEY_MODULE_NODE_NAME << ">\n";
+  write_xml_fabric_key_module_end(fp, level);
 
   return err_code;
 }
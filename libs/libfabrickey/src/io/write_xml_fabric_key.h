@@ -5,6 +5,8 @@
  * Include header files that are required by function declaration
  *******************************************************************/
 #include <fstream>
+#include <string>
+#include <vector>
 
 #include "fabric_key.h"
 
@@ -16,6 +18,25 @@ namespace openfpga {  // Begin namespace openfpga
 
 int write_xml_fabric_key(const char* fname, const FabricKey& fabric_key);
 
+/* Writers of the elements of a fabric key. They can output a fabric key
+ * on the fly, e.g., from a module graph, without building a FabricKey */
+void write_xml_fabric_key_module_begin(std::fstream& fp,
+                                       const std::string& module_name,
+                                       const size_t& level);
+void write_xml_fabric_key_module_end(std::fstream& fp, const size_t& level);
+void write_xml_fabric_key_region_begin(std::fstream& fp,
+                                       const size_t& region_id,
+                                       const size_t& level);
+void write_xml_fabric_key_region_end(std::fstream& fp, const size_t& level);
+int write_xml_fabric_key_key(std::fstream& fp, const size_t& key_id,
+                             const std::string& name, const size_t& value,
+                             const std::string& alias,
+                             const vtr::Point<int>& coord, const size_t& level);
+int write_xml_fabric_key_shift_register_banks(
+  std::fstream& fp, const char* node_name,
+  const std::vector<std::vector<BasicPort>>& bank_data_ports,
+  const size_t& level);
+
 }  // End of namespace openfpga
 
 #endif
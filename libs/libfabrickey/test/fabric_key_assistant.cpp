@@ -13,7 +13,8 @@
 #include "command_exit_codes.h"
 #include "command_parser.h"
 #include "format_arg.h"
-#include "read_xml_fabric_key.h"
+#include "read_bin_fabric_key.h"
+#include "write_bin_fabric_key.h"
 #include "write_xml_fabric_key.h"
 
 /** @brief Checks to be done:
@@ -27,7 +28,6 @@ static int check_input_and_ref_key_alias_match(
   VTR_LOG(
     "Checking key alias matching between reference key and input keys...\n");
   for (openfpga::FabricKeyId key_id : ref_key.keys()) {
-    /* Note that this is slow. May consider to build a map first */
     std::string curr_alias = ref_key.key_alias(key_id);
     std::vector<openfpga::FabricKeyId> input_found_keys =
       input_key.find_key_by_alias(curr_alias);
@@ -58,7 +58,6 @@ static int check_input_and_ref_key_alias_match(
   if (num_errors) {
     size_t num_input_keys_checked = 0;
     for (openfpga::FabricKeyId key_id : input_key.keys()) {
-      /* Note that this is slow. May consider to build a map first */
       std::string curr_alias = input_key.key_alias(key_id);
       std::vector<openfpga::FabricKeyId> ref_found_keys =
         ref_key.find_key_by_alias(curr_alias);
@@ -143,7 +142,6 @@ static int update_input_key(openfpga::FabricKey& input_key,
   float progress = 0.;
   VTR_LOG("Pairing key alias between reference key and input keys...\n");
   for (openfpga::FabricKeyId key_id : input_key.keys()) {
-    /* Note that this is slow. May consider to build a map first */
     std::string curr_alias = input_key.key_alias(key_id);
     std::vector<openfpga::FabricKeyId> ref_found_keys =
       ref_key.find_key_by_alias(curr_alias);
@@ -227,16 +225,16 @@ int main(int argc, const char** argv) {
     print_command_context(cmd, cmd_ctx);
   }
 
-  /* Parse the fabric key from an XML file */
-  VTR_LOG("Read the reference fabric key from an XML file: %s.\n",
+  /* Parse the fabric key from an XML or a binary file */
+  VTR_LOG("Read the reference fabric key from file: %s.\n",
           cmd_ctx.option_value(cmd, opt_ref).c_str());
   openfpga::FabricKey ref_key =
-    openfpga::read_xml_fabric_key(cmd_ctx.option_value(cmd, opt_ref).c_str());
+    openfpga::read_fabric_key(cmd_ctx.option_value(cmd, opt_ref).c_str());
 
-  VTR_LOG("Read the hand-crafted fabric key from an XML file: %s.\n",
+  VTR_LOG("Read the hand-crafted fabric key from file: %s.\n",
           cmd_ctx.option_value(cmd, opt_input).c_str());
   openfpga::FabricKey input_key =
-    openfpga::read_xml_fabric_key(cmd_ctx.option_value(cmd, opt_input).c_str());
+    openfpga::read_fabric_key(cmd_ctx.option_value(cmd, opt_input).c_str());
 
   /* Check the input key */
   if (check_and_update_input_key(input_key, ref_key,
@@ -244,8 +242,13 @@ int main(int argc, const char** argv) {
     return openfpga::CMD_EXEC_FATAL_ERROR;
   }
 
-  VTR_LOG("Write the final fabric key to an XML file: %s.\n",
+  VTR_LOG("Write the final fabric key to file: %s.\n",
           cmd_ctx.option_value(cmd, opt_output).c_str());
+  if (openfpga::is_bin_fabric_key_file(
+        cmd_ctx.option_value(cmd, opt_output))) {
+    return openfpga::write_bin_fabric_key(
+      cmd_ctx.option_value(cmd, opt_output).c_str(), input_key);
+  }
   return openfpga::write_xml_fabric_key(
     cmd_ctx.option_value(cmd, opt_output).c_str(), input_key);
 }
@@ -8,22 +8,66 @@
 #include "vtr_log.h"
 
 /* Headers from fabric key */
+#include "read_bin_fabric_key.h"
 #include "read_xml_fabric_key.h"
+#include "write_bin_fabric_key.h"
 #include "write_xml_fabric_key.h"
 
+/********************************************************************
+ * Check that a fabric key is the same as a reference, including the keys
+ * found by alias
+ *******************************************************************/
+static void check_same_fabric_key(const openfpga::FabricKey& ref_key,
+                                  const openfpga::FabricKey& test_key) {
+  VTR_ASSERT(ref_key.num_keys() == test_key.num_keys());
+  VTR_ASSERT(ref_key.num_regions() == test_key.num_regions());
+  for (openfpga::FabricKeyId key : ref_key.keys()) {
+    VTR_ASSERT(ref_key.key_name(key) == test_key.key_name(key));
+    VTR_ASSERT(ref_key.key_value(key) == test_key.key_value(key));
+    VTR_ASSERT(ref_key.key_alias(key) == test_key.key_alias(key));
+    VTR_ASSERT(ref_key.key_coordinate(key) == test_key.key_coordinate(key));
+    if (!ref_key.key_alias(key).empty()) {
+      VTR_ASSERT(ref_key.find_key_by_alias(ref_key.key_alias(key)) ==
+                 test_key.find_key_by_alias(ref_key.key_alias(key)));
+    }
+  }
+  for (openfpga::FabricRegionId region : ref_key.regions()) {
+    VTR_ASSERT(ref_key.region_keys(region) == test_key.region_keys(region));
+    VTR_ASSERT(ref_key.bl_banks(region).size() ==
+               test_key.bl_banks(region).size());
+    VTR_ASSERT(ref_key.wl_banks(region).size() ==
+               test_key.wl_banks(region).size());
+  }
+  VTR_ASSERT(ref_key.modules().size() == test_key.modules().size());
+  for (openfpga::FabricKeyModuleId module_id : ref_key.modules()) {
+    VTR_ASSERT(ref_key.module_name(module_id) ==
+               test_key.module_name(module_id));
+    VTR_ASSERT(ref_key.sub_keys(module_id).size() ==
+               test_key.sub_keys(module_id).size());
+  }
+}
+
 int main(int argc, const char** argv) {
   /* Ensure we have only one or two argument */
   VTR_ASSERT((2 == argc) || (3 == argc));
 
-  /* Parse the fabric key from an XML file */
-  openfpga::FabricKey test_key = openfpga::read_xml_fabric_key(argv[1]);
-  VTR_LOG("Read the fabric key from an XML file: %s.\n", argv[1]);
+  /* Parse the fabric key from an XML or a binary file */
+  openfpga::FabricKey test_key = openfpga::read_fabric_key(argv[1]);
+  VTR_LOG("Read the fabric key from file: %s.\n", argv[1]);
 
-  /* Output the circuit library to an XML file
+  /* Output the circuit library to an XML or a binary file
    * This is optional only used when there is a second argument
+   * A binary file is read back to be compared with the original key
    */
   if (3 <= argc) {
-    openfpga::write_xml_fabric_key(argv[2], test_key);
-    VTR_LOG("Echo the fabric key to an XML file: %s.\n", argv[2]);
+    if (openfpga::is_bin_fabric_key_file(argv[2])) {
+      openfpga::write_bin_fabric_key(argv[2], test_key);
+      VTR_LOG("Echo the fabric key to a binary file: %s.\n", argv[2]);
+      check_same_fabric_key(test_key, openfpga::read_bin_fabric_key(argv[2]));
+      VTR_LOG("Read back the binary file and compared with the fabric key.\n");
+    } else {
+      openfpga::write_xml_fabric_key(argv[2], test_key);
+      VTR_LOG("Echo the fabric key to an XML file: %s.\n", argv[2]);
+    }
   }
 }
@@ -4,6 +4,9 @@
 #include "bitstream_manager.h"
 
 #include <algorithm>
+#include <functional>
+#include <limits>
+#include <numeric>
 
 #include "arch_error.h"
 #include "bitstream_manager_utils.h"
@@ -79,7 +82,7 @@ ConfigBlockId BitstreamManager::block_parent(
   return parent_block_ids_[block_id];
 }
 
-std::vector<ConfigBlockId> BitstreamManager::block_children(
+const std::vector<ConfigBlockId>& BitstreamManager::block_children(
   const ConfigBlockId& block_id) const {
   /* Ensure the input ids are valid */
   VTR_ASSERT(true == valid_block_id(block_id));
@@ -154,6 +157,154 @@ std::string BitstreamManager::block_output_net_ids(
   return block_output_net_ids_[block_id];
 }
 
+/******************************************************************************
+ * Public Accessors: subtree queries
+ ******************************************************************************/
+size_t BitstreamManager::block_depth(const ConfigBlockId& block_id) const {
+  /* Ensure the input ids are valid */
+  VTR_ASSERT(true == valid_block_id(block_id));
+  if (is_subtree_index_dirty_) {
+    build_block_subtree_index();
+  }
+  return block_depths_[block_id];
+}
+
+size_t BitstreamManager::block_sum_of_bits(
+  const ConfigBlockId& block_id) const {
+  size_t first = block_preorder_index(block_id);
+  size_t last = first + block_subtree_sizes_[block_id];
+  return preorder_bit_offsets_[last] - preorder_bit_offsets_[first];
+}
+
+size_t BitstreamManager::block_preorder_index(
+  const ConfigBlockId& block_id) const {
+  /* Ensure the input ids are valid */
+  VTR_ASSERT(true == valid_block_id(block_id));
+  if (is_subtree_index_dirty_) {
+    build_block_subtree_index();
+  }
+  /* Blocks which are not reachable from any top-level block, e.g., in a
+   * cycle, are not indexed */
+  VTR_ASSERT(block_preorder_indices_[block_id] < preorder_block_ids_.size());
+  return block_preorder_indices_[block_id];
+}
+
+size_t BitstreamManager::block_subtree_size(
+  const ConfigBlockId& block_id) const {
+  /* Ensure the input ids are valid */
+  VTR_ASSERT(true == valid_block_id(block_id));
+  if (is_subtree_index_dirty_) {
+    build_block_subtree_index();
+  }
+  return block_subtree_sizes_[block_id];
+}
+
+ConfigBlockId BitstreamManager::preorder_block(
+  const size_t& preorder_index) const {
+  if (is_subtree_index_dirty_) {
+    build_block_subtree_index();
+  }
+  VTR_ASSERT(preorder_index < preorder_block_ids_.size());
+  return preorder_block_ids_[preorder_index];
+}
+
+size_t BitstreamManager::block_subtree_bit_offset(
+  const ConfigBlockId& block_id) const {
+  return preorder_bit_offsets_[block_preorder_index(block_id)];
+}
+
+/********************************************************************
+ * Visit the block tree in preorder, starting from each top-level block.
+ * An explicit stack is used as the block tree can be deep.
+ * The subtree sizes are then accumulated from the leaves in the reverse
+ * preorder, where a child is always visited before its parent
+ *******************************************************************/
+void BitstreamManager::build_block_subtree_index() const {
+  size_t invalid_index = std::numeric_limits<size_t>::max();
+
+  preorder_block_ids_.clear();
+  preorder_block_ids_.reserve(num_blocks_);
+  block_preorder_indices_.assign(num_blocks_, invalid_index);
+  block_subtree_sizes_.assign(num_blocks_, 0);
+  block_depths_.assign(num_blocks_, 0);
+
+  std::vector<ConfigBlockId> block_stack;
+  for (const ConfigBlockId& top_block : blocks()) {
+    if (ConfigBlockId::INVALID() != parent_block_ids_[top_block]) {
+      continue;
+    }
+    block_stack.push_back(top_block);
+    while (!block_stack.empty()) {
+      ConfigBlockId curr_block = block_stack.back();
+      block_stack.pop_back();
+      block_preorder_indices_[curr_block] = preorder_block_ids_.size();
+      preorder_block_ids_.push_back(curr_block);
+      /* Push the children in reverse so that the first child pops first */
+      for (auto it = child_block_ids_[curr_block].rbegin();
+           it != child_block_ids_[curr_block].rend(); ++it) {
+        block_depths_[*it] = block_depths_[curr_block] + 1;
+        block_stack.push_back(*it);
+      }
+    }
+  }
+
+  for (auto it = preorder_block_ids_.rbegin(); it != preorder_block_ids_.rend();
+       ++it) {
+    block_subtree_sizes_[*it] += 1;
+    ConfigBlockId parent_block = parent_block_ids_[*it];
+    if (ConfigBlockId::INVALID() != parent_block) {
+      block_subtree_sizes_[parent_block] += block_subtree_sizes_[*it];
+    }
+  }
+
+  preorder_bit_offsets_.assign(preorder_block_ids_.size() + 1, 0);
+  for (size_t index = 0; index < preorder_block_ids_.size(); ++index) {
+    preorder_bit_offsets_[index + 1] =
+      preorder_bit_offsets_[index] +
+      block_bit_lengths_[preorder_block_ids_[index]];
+  }
+
+  is_subtree_index_dirty_ = false;
+}
+
+/******************************************************************************
+ * Internal Accessors
+ ******************************************************************************/
+size_t BitstreamManager::BlockNameKeyHash::operator()(
+  const std::pair<size_t, std::string>& key) const {
+  size_t seed = std::hash<std::string>()(key.second);
+  seed ^= std::hash<size_t>()(key.first) + 0x9e3779b9 + (seed << 6) +
+          (seed >> 2);
+  return seed;
+}
+
+ConfigBlockId BitstreamManager::find_indexed_child_block(
+  const ConfigBlockId& parent_block,
+  const std::string& child_block_name) const {
+  if (is_name_index_dirty_) {
+    build_block_name_index();
+  }
+  auto result = block_name_index_.find(
+    std::make_pair(size_t(parent_block), child_block_name));
+  if (result == block_name_index_.end()) {
+    return ConfigBlockId::INVALID();
+  }
+  return result->second;
+}
+
+void BitstreamManager::build_block_name_index() const {
+  block_name_index_.clear();
+  block_name_index_.reserve(num_blocks_);
+  for (const ConfigBlockId& block : blocks()) {
+    /* If sibling blocks share a name, keep the first one as a linear search
+     * would do */
+    block_name_index_.emplace(
+      std::make_pair(size_t(parent_block_ids_[block]), block_names_[block]),
+      block);
+  }
+  is_name_index_dirty_ = false;
+}
+
 /******************************************************************************
  * Public Mutators
  ******************************************************************************/
@@ -201,6 +352,9 @@ ConfigBlockId BitstreamManager::create_block() {
   parent_block_ids_.push_back(ConfigBlockId::INVALID());
   child_block_ids_.emplace_back();
 
+  is_subtree_index_dirty_ = true;
+  is_name_index_dirty_ = true;
+
   return block;
 }
 
@@ -226,6 +380,8 @@ void BitstreamManager::set_block_name(const ConfigBlockId& block_id,
   /* Ensure the input ids are valid */
   VTR_ASSERT(true == valid_block_id(block_id));
   block_names_[block_id] = block_name;
+
+  is_name_index_dirty_ = true;
 }
 
 void BitstreamManager::reserve_child_blocks(const ConfigBlockId& parent_block,
@@ -257,6 +413,9 @@ void BitstreamManager::add_child_block(const ConfigBlockId& parent_block,
   child_block_ids_[parent_block].push_back(child_block);
   /* Register the block in the parent of the block */
   parent_block_ids_[child_block] = parent_block;
+
+  is_subtree_index_dirty_ = true;
+  is_name_index_dirty_ = true;
 }
 
 void BitstreamManager::add_block_bits(
@@ -271,6 +430,8 @@ void BitstreamManager::add_block_bits(
   for (const bool& bit : block_bitstream) {
     add_bit(block, bit);
   }
+
+  is_subtree_index_dirty_ = true;
 }
 
 void BitstreamManager::add_path_id_to_block(const ConfigBlockId& block,
@@ -302,65 +463,104 @@ void BitstreamManager::add_output_net_id_to_block(
 
 void BitstreamManager::overwrite_bitstream(const std::string& path,
                                            const bool& value) {
-  PortParser port_parser(path, PORT_PARSER_SUPPORT_SINGLE_INDEX_FORMAT);
-  if (!port_parser.valid()) {
-    archfpga_throw(__FILE__, __LINE__,
-                   "overwrite_bitstream bit path '%s' does not match format "
-                   "<full path in the hierarchy of FPGA fabric>[bit index]",
-                   path.c_str());
-  } else {
+  overwrite_bitstreams(std::vector<std::string>(1, path),
+                       std::vector<bool>(1, value));
+}
+
+void BitstreamManager::overwrite_bitstreams(
+  const std::vector<std::string>& paths, const std::vector<bool>& values) {
+  VTR_ASSERT(paths.size() == values.size());
+
+  /* Split each path into the block names and the bit index */
+  std::vector<std::vector<std::string>> path_blocks(paths.size());
+  std::vector<size_t> path_bits(paths.size(), 0);
+  for (size_t ipath = 0; ipath < paths.size(); ++ipath) {
+    PortParser port_parser(paths[ipath],
+                           PORT_PARSER_SUPPORT_SINGLE_INDEX_FORMAT);
+    if (!port_parser.valid()) {
+      archfpga_throw(__FILE__, __LINE__,
+                     "overwrite_bitstream bit path '%s' does not match format "
+                     "<full path in the hierarchy of FPGA fabric>[bit index]",
+                     paths[ipath].c_str());
+    }
     BasicPort port = port_parser.port();
-    size_t bit = port.get_lsb();
+    path_bits[ipath] = port.get_lsb();
     StringToken tokenizer(port.get_name());
-    std::vector<std::string> blocks = tokenizer.split(".");
-    std::vector<ConfigBlockId> block_ids;
-    ConfigBlockId block_id = ConfigBlockId::INVALID();
-    size_t found = 0;
-    for (size_t i = 0; i < blocks.size(); i++) {
-      if (i == 0) {
-        block_ids = find_bitstream_manager_top_blocks(*this);
-      } else {
-        block_ids = block_children(block_id);
-      }
-      // Reset
-      block_id = ConfigBlockId::INVALID();
-      // Find the one from the list that match the name
-      for (auto id : block_ids) {
-        if (block_name(id) == blocks[i]) {
-          block_id = id;
-          break;
-        }
+    path_blocks[ipath] = tokenizer.split(".");
+  }
+
+  /* Visit the paths in lexical order, so that a path shares the longest
+   * prefix with the previous one. A stable sort keeps the original order
+   * among identical paths, so that the last value still wins */
+  std::vector<size_t> path_order(paths.size());
+  std::iota(path_order.begin(), path_order.end(), 0);
+  std::stable_sort(path_order.begin(), path_order.end(),
+                   [&path_blocks](const size_t& lhs, const size_t& rhs) {
+                     return path_blocks[lhs] < path_blocks[rhs];
+                   });
+
+  /* The bit found for each path, in the original order of the paths */
+  std::vector<ConfigBitId> path_bit_ids(paths.size(), ConfigBitId::INVALID());
+
+  /* The blocks resolved for the previous path */
+  std::vector<ConfigBlockId> resolved_blocks;
+  size_t prev_path = paths.size();
+  for (const size_t& ipath : path_order) {
+    const std::vector<std::string>& blocks = path_blocks[ipath];
+    /* Reuse the blocks of the common prefix */
+    size_t num_shared_blocks = 0;
+    if (prev_path < paths.size()) {
+      const std::vector<std::string>& prev_blocks = path_blocks[prev_path];
+      while (num_shared_blocks < resolved_blocks.size() &&
+             num_shared_blocks < blocks.size() &&
+             prev_blocks[num_shared_blocks] == blocks[num_shared_blocks]) {
+        num_shared_blocks++;
       }
-      if (block_id != ConfigBlockId::INVALID()) {
-        // Found one that match the name
-        found++;
-        if (found == blocks.size()) {
-          // Last one, no more child must end here
-          if (block_children(block_id).size() == 0) {
-            std::vector<ConfigBitId> ids = block_bits(block_id);
-            if (bit < ids.size()) {
-              VTR_ASSERT(valid_bit_id(ids[bit]));
-              bit_values_[ids[bit]] = value ? '1' : '0';
-            } else {
-              // No configuration bits at all or out of range, invalidate
-              found = 0;
-            }
-          } else {
-            // There are more child, hence the path still no end, invalidate
-            found = 0;
-          }
-        }
-      } else {
-        // Cannot match the name, just stop
+    }
+    resolved_blocks.resize(num_shared_blocks);
+    prev_path = ipath;
+    for (size_t iblk = num_shared_blocks; iblk < blocks.size(); ++iblk) {
+      ConfigBlockId parent_block = resolved_blocks.empty()
+                                     ? ConfigBlockId::INVALID()
+                                     : resolved_blocks.back();
+      ConfigBlockId block_id =
+        find_indexed_child_block(parent_block, blocks[iblk]);
+      if (!valid_block_id(block_id)) {
+        /* Cannot match the name, just stop */
         break;
       }
+      resolved_blocks.push_back(block_id);
+    }
+
+    /* The path must end at a block without any child, and the bit must be
+     * in the range of the bits of the block */
+    size_t bit = path_bits[ipath];
+    if (blocks.empty() || (resolved_blocks.size() != blocks.size()) ||
+        !block_children(resolved_blocks.back()).empty() ||
+        (bit >= size_t(block_bit_lengths_[resolved_blocks.back()]))) {
+      continue;
     }
-    if (found != blocks.size()) {
+    path_bit_ids[ipath] =
+      ConfigBitId(block_bit_id_lsbs_[resolved_blocks.back()] + bit);
+    VTR_ASSERT(valid_bit_id(path_bit_ids[ipath]));
+  }
+
+  /* Report the first path in the list which is not found, regardless of the
+   * sorted order. No bit is changed in such case */
+  for (size_t ipath = 0; ipath < paths.size(); ++ipath) {
+    if (ConfigBitId::INVALID() == path_bit_ids[ipath]) {
       archfpga_throw(__FILE__, __LINE__,
-                     "Failed to find path '%s' to overwrite bitstream",
-                     path.c_str());
+                     "Failed to find path '%s' (#%lu in the list) to "
+                     "overwrite bitstream",
+                     paths[ipath].c_str(), ipath);
     }
   }
+
+  /* Apply the values in the original order, so that the last value of a
+   * repeated path wins */
+  for (size_t ipath = 0; ipath < paths.size(); ++ipath) {
+    bit_values_[path_bit_ids[ipath]] = values[ipath] ? '1' : '0';
+  }
 }
 
 /******************************************************************************
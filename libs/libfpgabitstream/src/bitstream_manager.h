@@ -38,6 +38,7 @@
 #define BITSTREAM_MANAGER_H
 
 #include <map>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -156,7 +157,7 @@ class BitstreamManager {
   ConfigBlockId block_parent(const ConfigBlockId& block_id) const;
 
   /* Find the children of a block */
-  std::vector<ConfigBlockId> block_children(
+  const std::vector<ConfigBlockId>& block_children(
     const ConfigBlockId& block_id) const;
 
   /* Find all the bits that belong to a block */
@@ -175,6 +176,49 @@ class BitstreamManager {
   /* Find input net ids of a block */
   std::string block_output_net_ids(const ConfigBlockId& block_id) const;
 
+ public: /* Public Accessors: subtree queries
+          * All the queries below are answered in constant time by an index
+          * built in a preorder (depth-first) traversal of the block tree.
+          * The index is built on the first query after the block tree
+          * changes. */
+  /* Find the depth of a block in the tree, a top-level block has a depth of 0
+   */
+  size_t block_depth(const ConfigBlockId& block_id) const;
+
+  /* Find the total number of configuration bits under a block, including all
+   * the child blocks */
+  size_t block_sum_of_bits(const ConfigBlockId& block_id) const;
+
+  /* Find the position of a block in the preorder traversal. The blocks under
+   * a block, including itself, occupy the positions
+   * [block_preorder_index(), block_preorder_index() + block_subtree_size()) */
+  size_t block_preorder_index(const ConfigBlockId& block_id) const;
+  size_t block_subtree_size(const ConfigBlockId& block_id) const;
+
+  /* Find the block at a given position of the preorder traversal */
+  ConfigBlockId preorder_block(const size_t& preorder_index) const;
+
+  /* Find the offset of the first configuration bit under a block, when all
+   * the bits are serialized in the preorder of the blocks. The bits under the
+   * block occupy the range
+   * [block_subtree_bit_offset(), block_subtree_bit_offset() +
+   * block_sum_of_bits()) */
+  size_t block_subtree_bit_offset(const ConfigBlockId& block_id) const;
+
+  /* Build the index for the subtree queries. It is called by the subtree
+   * queries when needed. Call it explicitly before sharing the bitstream
+   * manager among threads */
+  void build_block_subtree_index() const;
+
+ private: /* Internal Accessors */
+  /* Find the child block with a given name through the name index. Top-level
+   * blocks are found with an invalid parent block */
+  ConfigBlockId find_indexed_child_block(
+    const ConfigBlockId& parent_block,
+    const std::string& child_block_name) const;
+
+  void build_block_name_index() const;
+
  public: /* Public Mutators */
   /* Add a new configuration bit to the bitstream manager */
   ConfigBitId add_bit(const ConfigBlockId& parent_block, const bool& bit_value);
@@ -226,6 +270,13 @@ class BitstreamManager {
   /* Set bit to the bitstream at the given path */
   void overwrite_bitstream(const std::string& path, const bool& value);
 
+  /* Set bits to the bitstream at a list of paths. The paths are sorted so that
+   * the blocks of a common prefix are resolved only once. When a path appears
+   * more than once, the last value in the list is applied. When any path is
+   * not found, the first one in the list is reported and no bit is changed */
+  void overwrite_bitstreams(const std::vector<std::string>& paths,
+                            const std::vector<bool>& values);
+
  public: /* Public Validators */
   bool valid_bit_id(const ConfigBitId& bit_id) const;
 
@@ -282,6 +333,30 @@ class BitstreamManager {
   /* value of a bit in the Bitstream */
   vtr::vector<ConfigBitId, char> bit_values_;
   vtr::vector<ConfigBitId, ConfigBlockId> bit_parent_blocks_;
+
+  /* Index of the block tree in preorder, see build_block_subtree_index() */
+  mutable std::vector<ConfigBlockId> preorder_block_ids_;
+  mutable vtr::vector<ConfigBlockId, size_t> block_preorder_indices_;
+  mutable vtr::vector<ConfigBlockId, size_t> block_subtree_sizes_;
+  mutable vtr::vector<ConfigBlockId, size_t> block_depths_;
+  /* Number of bits of the blocks before a position in preorder, the extra
+   * last element is the total number of bits */
+  mutable std::vector<size_t> preorder_bit_offsets_;
+
+  /* A flag to indicate that the block tree has been modified, the subtree
+   * index has to be updated */
+  mutable bool is_subtree_index_dirty_ = true;
+
+  /* Fast look-up from a pair of (parent block, name) to a child block, built
+   * on the first overwrite of bitstream after the block tree changes.
+   * Top-level blocks are indexed with an invalid parent block */
+  struct BlockNameKeyHash {
+    size_t operator()(const std::pair<size_t, std::string>& key) const;
+  };
+  mutable std::unordered_map<std::pair<size_t, std::string>, ConfigBlockId,
+                             BlockNameKeyHash>
+    block_name_index_;
+  mutable bool is_name_index_dirty_ = true;
 };
 
 } /* end namespace openfpga */
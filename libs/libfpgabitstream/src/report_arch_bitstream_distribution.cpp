@@ -44,7 +44,7 @@ static void rec_report_block_bitstream_distribution_to_xml_file(
     bitstream_manager.block_name(block).c_str());
   blk_node.append_attribute("number_of_bits")
     .set_value(static_cast<unsigned long long>(
-      rec_find_bitstream_manager_block_sum_of_bits(bitstream_manager, block)));
+      bitstream_manager.block_sum_of_bits(block)));
 
   /* Dive to child blocks if this block has any */
   for (const ConfigBlockId& child_block :
@@ -1,9 +1,16 @@
 /********************************************************************
  * Unit test functions to validate the correctness of
- * 1. parser of data structures
- * 2. writer of data structures
+ * 1. the subtree index and the name index of a bitstream manager
+ * 2. overwriting bits at a list of paths
+ * 3. parser of data structures
+ * 4. writer of data structures
+ * The first two are always tested on a small bitstream built in the test.
+ * The subtree index is also tested on the bitstream read from a file
  *******************************************************************/
+#include <exception>
 #include <fstream>
+#include <string>
+#include <vector>
 /* Headers from vtrutils */
 #include "vtr_assert.h"
 #include "vtr_log.h"
@@ -15,9 +22,215 @@
 #include "report_arch_bitstream_distribution.h"
 #include "write_xml_arch_bitstream.h"
 
+using namespace openfpga;
+
+/********************************************************************
+ * Compare the subtree index of a block and all its child blocks to a
+ * recursive traversal. Return the number of bits under the block
+ *******************************************************************/
+static size_t rec_check_block_subtree_index(const BitstreamManager& bitstream,
+                                            const ConfigBlockId& block,
+                                            const size_t& depth,
+                                            size_t& preorder_index,
+                                            size_t& bit_offset,
+                                            int& num_errors) {
+  size_t first_index = preorder_index;
+  size_t first_bit_offset = bit_offset;
+  if (depth != bitstream.block_depth(block) ||
+      first_index != bitstream.block_preorder_index(block) ||
+      block != bitstream.preorder_block(first_index) ||
+      first_bit_offset != bitstream.block_subtree_bit_offset(block)) {
+    VTR_LOG_ERROR("Mismatched depth or preorder position of block '%s'!\n",
+                  bitstream.block_name(block).c_str());
+    ++num_errors;
+  }
+  ++preorder_index;
+
+  size_t num_bits = bitstream.block_bits(block).size();
+  bit_offset += num_bits;
+  for (const ConfigBlockId& child : bitstream.block_children(block)) {
+    num_bits += rec_check_block_subtree_index(
+      bitstream, child, depth + 1, preorder_index, bit_offset, num_errors);
+  }
+
+  if (preorder_index - first_index != bitstream.block_subtree_size(block) ||
+      num_bits != bitstream.block_sum_of_bits(block)) {
+    VTR_LOG_ERROR("Mismatched subtree size or bits of block '%s'!\n",
+                  bitstream.block_name(block).c_str());
+    ++num_errors;
+  }
+  return num_bits;
+}
+
+static int check_block_subtree_index(const BitstreamManager& bitstream) {
+  int num_errors = 0;
+  size_t preorder_index = 0;
+  size_t bit_offset = 0;
+  for (const ConfigBlockId& block : bitstream.blocks()) {
+    if (ConfigBlockId::INVALID() == bitstream.block_parent(block)) {
+      rec_check_block_subtree_index(bitstream, block, 0, preorder_index,
+                                    bit_offset, num_errors);
+    }
+  }
+  return num_errors;
+}
+
+/* Build a block with bits under a parent block */
+static ConfigBlockId add_test_block(BitstreamManager& bitstream,
+                                    const ConfigBlockId& parent_block,
+                                    const std::string& name,
+                                    const std::vector<bool>& bits) {
+  ConfigBlockId block = bitstream.add_block(name);
+  if (ConfigBlockId::INVALID() != parent_block) {
+    bitstream.add_child_block(parent_block, block);
+  }
+  if (!bits.empty()) {
+    bitstream.add_block_bits(block, bits);
+  }
+  return block;
+}
+
+/* Read the bits of a block as a string, e.g., "0101" */
+static std::string block_bit_string(const BitstreamManager& bitstream,
+                                    const ConfigBlockId& block) {
+  std::string bits;
+  for (const ConfigBitId& bit : bitstream.block_bits(block)) {
+    bits.push_back(bitstream.bit_value(bit) ? '1' : '0');
+  }
+  return bits;
+}
+
+/* Overwrite bits, which is expected to fail on a given path */
+static int check_overwrite_failure(BitstreamManager& bitstream,
+                                   const std::vector<std::string>& paths,
+                                   const std::string& expected_path) {
+  try {
+    bitstream.overwrite_bitstreams(paths, std::vector<bool>(paths.size()));
+  } catch (const std::exception& e) {
+    if (std::string(e.what()).find("'" + expected_path + "'") ==
+        std::string::npos) {
+      VTR_LOG_ERROR("Overwriting should fail on path '%s' but got: %s\n",
+                    expected_path.c_str(), e.what());
+      return 1;
+    }
+    return 0;
+  }
+  VTR_LOG_ERROR("Overwriting should fail on path '%s'!\n",
+                expected_path.c_str());
+  return 1;
+}
+
+/********************************************************************
+ * Test the indices and overwriting on the following bitstream
+ *   fpga_top
+ *   +- grid_clb_1__1_
+ *   |  +- lut_a: 0101
+ *   |  +- lut_b: 11
+ *   +- grid_clb_2__1_
+ *   |  +- lut_a: 000
+ *   +- sb_1__1_: 1
+ *   fpga_io: 10
+ *******************************************************************/
+static int test_block_indices_and_overwrite() {
+  BitstreamManager bitstream;
+  ConfigBlockId top = add_test_block(bitstream, ConfigBlockId::INVALID(),
+                                     "fpga_top", std::vector<bool>());
+  ConfigBlockId clb_1 =
+    add_test_block(bitstream, top, "grid_clb_1__1_", std::vector<bool>());
+  ConfigBlockId lut_1a =
+    add_test_block(bitstream, clb_1, "lut_a", {false, true, false, true});
+  ConfigBlockId lut_1b =
+    add_test_block(bitstream, clb_1, "lut_b", {true, true});
+  ConfigBlockId clb_2 =
+    add_test_block(bitstream, top, "grid_clb_2__1_", std::vector<bool>());
+  ConfigBlockId lut_2a =
+    add_test_block(bitstream, clb_2, "lut_a", {false, false, false});
+  ConfigBlockId sb = add_test_block(bitstream, top, "sb_1__1_", {true});
+  ConfigBlockId io = add_test_block(bitstream, ConfigBlockId::INVALID(),
+                                    "fpga_io", {true, false});
+
+  int num_errors = check_block_subtree_index(bitstream);
+  if (10 != bitstream.block_sum_of_bits(top) ||
+      2 != bitstream.block_depth(lut_2a) ||
+      7 != bitstream.block_subtree_size(top)) {
+    VTR_LOG_ERROR("Wrong bits, depth or subtree size in the test bitstream!\n");
+    ++num_errors;
+  }
+
+  /* Paths are given out of the lexical order. The repeated path takes the
+   * last value, and the paths with the same prefix share the same blocks */
+  bitstream.overwrite_bitstreams(
+    {"fpga_top.grid_clb_2__1_.lut_a[2]", "fpga_top.grid_clb_1__1_.lut_a[0]",
+     "fpga_io[0]", "fpga_top.grid_clb_1__1_.lut_a[0]", "fpga_top.sb_1__1_[0]",
+     "fpga_top.grid_clb_1__1_.lut_b[1]"},
+    {true, false, false, true, false, false});
+  if ("1101" != block_bit_string(bitstream, lut_1a) ||
+      "10" != block_bit_string(bitstream, lut_1b) ||
+      "001" != block_bit_string(bitstream, lut_2a) ||
+      "0" != block_bit_string(bitstream, sb) ||
+      "00" != block_bit_string(bitstream, io)) {
+    VTR_LOG_ERROR("Wrong bits after overwriting a list of paths!\n");
+    ++num_errors;
+  }
+
+  /* The first path which is not found in the list is reported, rather than
+   * the first one in the lexical order, and no bit is changed */
+  num_errors += check_overwrite_failure(
+    bitstream,
+    {"fpga_top.grid_clb_1__1_.lut_a[1]", "fpga_top.sb_2__1_[0]",
+     "fpga_top.grid_clb_1__1_.lut_c[0]"},
+    "fpga_top.sb_2__1_[0]");
+  if ("1101" != block_bit_string(bitstream, lut_1a)) {
+    VTR_LOG_ERROR("Bits are changed by a failed overwriting!\n");
+    ++num_errors;
+  }
+  /* A path should end at a block without child blocks, and the bit should be
+   * in the range of the block */
+  num_errors += check_overwrite_failure(
+    bitstream, {"fpga_top.grid_clb_1__1_[0]"}, "fpga_top.grid_clb_1__1_[0]");
+  num_errors += check_overwrite_failure(
+    bitstream, {"fpga_top.grid_clb_1__1_.lut_b[2]"},
+    "fpga_top.grid_clb_1__1_.lut_b[2]");
+
+  /* The name index follows the renamed and new blocks */
+  bitstream.set_block_name(clb_2, "grid_clb_2__2_");
+  ConfigBlockId lut_2b = add_test_block(bitstream, clb_2, "lut_b", {false});
+  bitstream.overwrite_bitstreams(
+    {"fpga_top.grid_clb_2__2_.lut_a[0]", "fpga_top.grid_clb_2__2_.lut_b[0]"},
+    {true, true});
+  if ("101" != block_bit_string(bitstream, lut_2a) ||
+      "1" != block_bit_string(bitstream, lut_2b)) {
+    VTR_LOG_ERROR("Wrong bits after overwriting renamed and new blocks!\n");
+    ++num_errors;
+  }
+  num_errors += check_overwrite_failure(
+    bitstream, {"fpga_top.grid_clb_2__1_.lut_a[0]"},
+    "fpga_top.grid_clb_2__1_.lut_a[0]");
+
+  /* The subtree index follows the new blocks */
+  num_errors += check_block_subtree_index(bitstream);
+  if (11 != bitstream.block_sum_of_bits(top)) {
+    VTR_LOG_ERROR("Wrong bits in the test bitstream with a new block!\n");
+    ++num_errors;
+  }
+
+  return num_errors;
+}
+
 int main(int argc, const char** argv) {
-  /* Ensure we have only one or two or 3 argument */
-  VTR_ASSERT((2 == argc) || (3 == argc) || (4 == argc) || (5 == argc));
+  /* Ensure we have up to 4 arguments */
+  VTR_ASSERT((1 <= argc) && (argc <= 5));
+
+  int num_errors = test_block_indices_and_overwrite();
+  if (0 < num_errors) {
+    VTR_LOG_ERROR("%d errors in the indices or overwriting of bitstreams!\n",
+                  num_errors);
+    return 1;
+  }
+  VTR_LOG("Succeed to test the indices and overwriting of bitstreams.\n");
+  if (1 == argc) {
+    return 0;
+  }
 
   /* Parse the bitstream from an XML file */
   openfpga::BitstreamManager test_bitstream;
@@ -28,6 +241,13 @@ int main(int argc, const char** argv) {
   }
   VTR_LOG("Read the bitstream from an XML file: %s.\n", argv[1]);
 
+  num_errors = check_block_subtree_index(test_bitstream);
+  if (0 < num_errors) {
+    VTR_LOG_ERROR("%d errors in the subtree index of the bitstream!\n",
+                  num_errors);
+    return 1;
+  }
+
   /* Output the bitstream database to an XML file
    * This is optional only used when there is a second argument
    */
@@ -68,4 +288,5 @@ int main(int argc, const char** argv) {
     }
     return output_success ? 0 : 1;
   }
+  return 0;
 }
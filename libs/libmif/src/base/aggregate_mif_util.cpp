@@ -1,26 +1,17 @@
 #include "aggregate_mif_util.h"
 
+#include <algorithm>
+
+#include "mif_packed_bits.h"
 #include "vtr_log.h"
 
 namespace openfpga {
 
-/* Slice logical-word bits selected by XML src_mif_bits.
- * data is LSB-at-index-0; missing high bits are padded with '0'. */
-std::string extract_mif_bits(const std::string& data, const BasicPort& bits) {
-  std::string out(bits.get_width(), '0');
-  for (size_t i = 0; i < bits.get_width(); ++i) {
-    const size_t src = bits.get_lsb() + i;
-    if (src < data.size()) {
-      out[i] = data[src];
-    }
-  }
-  return out;
-}
-
-bool unpack_yosys_init_param(
-  const std::string& bits, size_t data_width, size_t depth,
-  std::vector<std::pair<uint64_t, std::string>>& words) {
-  words.clear();
+bool unpack_yosys_init_param(const std::string& bits, size_t data_width,
+                             size_t depth, std::vector<uint64_t>& addresses,
+                             std::vector<uint64_t>& word_chunks) {
+  addresses.clear();
+  word_chunks.clear();
   if (data_width == 0 || depth == 0 || bits.size() != data_width * depth) {
     VTR_LOG_ERROR(
       "mif_pipeline: INIT length %zu does not match depth %zu x width %zu\n",
@@ -28,16 +19,22 @@ bool unpack_yosys_init_param(
     return false;
   }
 
+  const size_t num_chunks = mif_num_packed_chunks(data_width);
+  std::vector<uint64_t> word(num_chunks, 0);
   for (size_t addr = 0; addr < depth; ++addr) {
-    const size_t end = bits.size() - addr * data_width;
-    const std::string word_bits_msb = bits.substr(end - data_width, data_width);
+    /* Word of address 0 is at the end of the string, MSB first */
+    const size_t word_msb_pos = bits.size() - (addr + 1) * data_width;
     bool all_undefined = true;
-    std::string word_bits_lsb(data_width, '0');
+    std::fill(word.begin(), word.end(), 0);
     for (size_t i = 0; i < data_width; ++i) {
-      const char bit = word_bits_msb[i];
+      const char bit = bits[word_msb_pos + i];
+      const size_t bit_index = data_width - 1 - i;
       if (bit == '0' || bit == '1') {
         all_undefined = false;
-        word_bits_lsb[data_width - 1 - i] = bit;
+        if (bit == '1') {
+          word[bit_index / MIF_PACKED_CHUNK_BITS] |=
+            uint64_t(1) << (bit_index % MIF_PACKED_CHUNK_BITS);
+        }
       } else if (bit != 'x' && bit != 'X' && bit != 'z' && bit != 'Z') {
         VTR_LOG_ERROR("mif_pipeline: invalid bit in INIT at address %zu\n",
                       addr);
@@ -45,55 +42,51 @@ bool unpack_yosys_init_param(
       }
     }
     if (!all_undefined) {
-      words.emplace_back(static_cast<uint64_t>(addr), word_bits_lsb);
+      addresses.push_back(static_cast<uint64_t>(addr));
+      word_chunks.insert(word_chunks.end(), word.begin(), word.end());
     }
   }
   return true;
 }
 
-bool remap_logical_word(uint64_t logical_addr, const std::string& logical_data,
-                        int des_addr_offset, const BasicPort& src_mif_bits,
-                        const BasicPort& des_mif_bits, size_t des_word_width,
-                        std::map<uint64_t, std::string>& phys_data_map,
-                        std::map<uint64_t, std::string>& phys_written_mask) {
+/* Slice the logical-word bits selected by XML src_mif_bits into the
+ * des_mif_bits of the destination word. Missing high bits of the logical
+ * word, or of a source slice narrower than the destination slice, are
+ * padded with '0'. */
+bool remap_logical_word(uint64_t logical_addr, const uint64_t* logical_chunks,
+                        size_t logical_width, int des_addr_offset,
+                        const BasicPort& src_mif_bits,
+                        const BasicPort& des_mif_bits,
+                        MifMemoryImage& phys_image) {
   const uint64_t des_addr =
     static_cast<uint64_t>(static_cast<int64_t>(logical_addr) + des_addr_offset);
-  const std::string extracted = extract_mif_bits(logical_data, src_mif_bits);
+  const size_t des_word_width = phys_image.word_width();
 
-  auto& des_data = phys_data_map[des_addr];
-  auto& des_written = phys_written_mask[des_addr];
-  if (des_data.empty()) {
-    des_data.assign(des_word_width, '0');
-  }
-  if (des_written.empty()) {
-    des_written.assign(des_word_width, '0');
-  }
-  if (des_data.size() != des_word_width ||
-      des_written.size() != des_word_width) {
-    VTR_LOG_ERROR("mif_pipeline: destination word width mismatch at addr %lu\n",
-                  static_cast<unsigned long>(des_addr));
+  if (des_mif_bits.get_width() > 0 &&
+      des_mif_bits.get_lsb() + des_mif_bits.get_width() > des_word_width) {
+    VTR_LOG_ERROR(
+      "mif_pipeline: des_mif_bits out of range for destination width %zu\n",
+      des_word_width);
     return false;
   }
 
-  for (size_t i = 0; i < des_mif_bits.get_width(); ++i) {
-    const size_t des_bit = des_mif_bits.get_lsb() + i;
-    if (des_bit >= des_word_width) {
-      VTR_LOG_ERROR(
-        "mif_pipeline: des_mif_bits out of range for destination width %zu\n",
-        des_word_width);
-      return false;
-    }
-    const char new_bit = (i < extracted.size()) ? extracted[i] : '0';
-    if (des_written[des_bit] == '1' && des_data[des_bit] != new_bit) {
-      VTR_LOG_ERROR(
-        "mif_pipeline: conflicting writes to des addr %lu bit %zu: "
-        "existing '%c' vs new '%c' (logical addr %lu)\n",
-        static_cast<unsigned long>(des_addr), des_bit, des_data[des_bit],
-        new_bit, static_cast<unsigned long>(logical_addr));
-      return false;
-    }
-    des_data[des_bit] = new_bit;
-    des_written[des_bit] = '1';
+  /* Source bits beyond the src_mif_bits slice are read as '0' */
+  const size_t src_num_bits = std::min(
+    logical_width, src_mif_bits.get_lsb() + src_mif_bits.get_width());
+  size_t conflict_bit = 0;
+  if (!phys_image.write_bits(des_addr, des_mif_bits.get_lsb(), logical_chunks,
+                             src_num_bits, src_mif_bits.get_lsb(),
+                             des_mif_bits.get_width(), conflict_bit)) {
+    const uint64_t* des_data = phys_image.word_data(des_addr);
+    const bool existing_bit =
+      read_mif_packed_bits(des_data, des_word_width, conflict_bit, 1);
+    VTR_LOG_ERROR(
+      "mif_pipeline: conflicting writes to des addr %lu bit %zu: "
+      "existing '%c' vs new '%c' (logical addr %lu)\n",
+      static_cast<unsigned long>(des_addr), conflict_bit,
+      existing_bit ? '1' : '0', existing_bit ? '0' : '1',
+      static_cast<unsigned long>(logical_addr));
+    return false;
   }
   return true;
 }
@@ -1,28 +1,28 @@
 #pragma once
 
 #include <cstdint>
-#include <map>
 #include <string>
-#include <utility>
 #include <vector>
 
-#include "mif_storage.h"
+#include "mif_memory_image.h"
 #include "openfpga_port.h"
 
 namespace openfpga {
 
-/* Copy bits [lsb:msb] from a logical MIF word (LSB at index 0). */
-std::string extract_mif_bits(const std::string& data, const BasicPort& bits);
+/* Unpack a yosys INIT parameter (MSB first) into packed words. Word i
+ * has address addresses[i] and occupies chunks
+ * [i * mif_num_packed_chunks(data_width), (i + 1) * ...) of word_chunks.
+ * Words whose bits are all undefined (x/z) are skipped. */
+bool unpack_yosys_init_param(const std::string& bits, size_t data_width,
+                             size_t depth, std::vector<uint64_t>& addresses,
+                             std::vector<uint64_t>& word_chunks);
 
-bool unpack_yosys_init_param(
-  const std::string& bits, size_t data_width, size_t depth,
-  std::vector<std::pair<uint64_t, std::string>>& words);
-
-/* Remap one logical word into destination physical addr/data maps. */
-bool remap_logical_word(uint64_t logical_addr, const std::string& logical_data,
-                        int des_addr_offset, const BasicPort& src_mif_bits,
-                        const BasicPort& des_mif_bits, size_t des_word_width,
-                        std::map<uint64_t, std::string>& phys_data_map,
-                        std::map<uint64_t, std::string>& phys_written_mask);
+/* Remap one packed logical word of logical_width bits into the destination
+ * physical memory image. */
+bool remap_logical_word(uint64_t logical_addr, const uint64_t* logical_chunks,
+                        size_t logical_width, int des_addr_offset,
+                        const BasicPort& src_mif_bits,
+                        const BasicPort& des_mif_bits,
+                        MifMemoryImage& phys_image);
 
 } /* namespace openfpga */
@@ -0,0 +1,162 @@
+#include "mif_memory_image.h"
+
+#include <algorithm>
+
+#include "mif_packed_bits.h"
+#include "vtr_assert.h"
+
+namespace openfpga {
+
+MifMemoryImage::MifMemoryImage() : MifMemoryImage(0) {}
+
+MifMemoryImage::MifMemoryImage(const size_t& word_width)
+  : word_width_(word_width),
+    num_chunks_(mif_num_packed_chunks(word_width)),
+    base_address_(0) {}
+
+size_t MifMemoryImage::word_width() const { return word_width_; }
+
+size_t MifMemoryImage::num_touched_words() const {
+  return std::count(touched_.begin(), touched_.end(), true);
+}
+
+std::vector<uint64_t> MifMemoryImage::touched_addresses() const {
+  std::vector<uint64_t> addresses;
+  for (size_t index = 0; index < touched_.size(); ++index) {
+    if (touched_[index]) {
+      addresses.push_back(base_address_ + index);
+    }
+  }
+  return addresses;
+}
+
+bool MifMemoryImage::touched(const uint64_t& address) const {
+  return (address >= base_address_) &&
+         (address - base_address_ < touched_.size()) &&
+         touched_[address - base_address_];
+}
+
+const uint64_t* MifMemoryImage::word_data(const uint64_t& address) const {
+  VTR_ASSERT(touched(address));
+  return data_chunks_.data() + (address - base_address_) * num_chunks_;
+}
+
+const uint64_t* MifMemoryImage::word_written_mask(
+  const uint64_t& address) const {
+  VTR_ASSERT(touched(address));
+  return written_chunks_.data() + (address - base_address_) * num_chunks_;
+}
+
+void MifMemoryImage::reserve_addresses(const uint64_t& lsb,
+                                       const uint64_t& msb) {
+  VTR_ASSERT(lsb <= msb);
+  cover_addresses(lsb, msb);
+}
+
+void MifMemoryImage::cover_addresses(const uint64_t& lsb,
+                                     const uint64_t& msb) {
+  if (touched_.empty()) {
+    base_address_ = lsb;
+  }
+  if (lsb < base_address_) {
+    /* Prepend words so that the lsb becomes the base. At least as many words
+     * as stored are prepended when possible, so that visiting addresses in
+     * descending order moves each word a constant number of times on
+     * average, like appending to a vector */
+    const size_t num_new_words =
+      std::max(base_address_ - lsb,
+               std::min(uint64_t(touched_.size()), base_address_));
+    data_chunks_.insert(data_chunks_.begin(), num_new_words * num_chunks_, 0);
+    written_chunks_.insert(written_chunks_.begin(), num_new_words * num_chunks_,
+                           0);
+    touched_.insert(touched_.begin(), num_new_words, false);
+    base_address_ -= num_new_words;
+  }
+  const size_t num_words = msb - base_address_ + 1;
+  if (num_words > touched_.size()) {
+    data_chunks_.resize(num_words * num_chunks_, 0);
+    written_chunks_.resize(num_words * num_chunks_, 0);
+    touched_.resize(num_words, false);
+  }
+}
+
+size_t MifMemoryImage::touch_address(const uint64_t& address) {
+  cover_addresses(address, address);
+  const size_t index = address - base_address_;
+  touched_[index] = true;
+  return index;
+}
+
+void MifMemoryImage::write_word(const uint64_t& address,
+                                const uint64_t* src_chunks,
+                                const size_t& src_num_bits) {
+  const size_t index = touch_address(address);
+  uint64_t* data = data_chunks_.data() + index * num_chunks_;
+  uint64_t* written = written_chunks_.data() + index * num_chunks_;
+  std::fill(data, data + num_chunks_, 0);
+  std::fill(written, written + num_chunks_, ~uint64_t(0));
+  copy_mif_packed_bits(data, 0, src_chunks, src_num_bits, 0, word_width_);
+  /* Keep the bits beyond the word width clear */
+  if (0 < num_chunks_ && 0 != word_width_ % MIF_PACKED_CHUNK_BITS) {
+    written[num_chunks_ - 1] =
+      (uint64_t(1) << (word_width_ % MIF_PACKED_CHUNK_BITS)) - 1;
+  }
+}
+
+bool MifMemoryImage::write_bits(const uint64_t& address, const size_t& des_lsb,
+                                const uint64_t* src_chunks,
+                                const size_t& src_num_bits,
+                                const size_t& src_lsb, const size_t& width,
+                                size_t& conflict_bit) {
+  VTR_ASSERT(des_lsb + width <= word_width_);
+  const size_t index = touch_address(address);
+  uint64_t* data = data_chunks_.data() + index * num_chunks_;
+  uint64_t* written = written_chunks_.data() + index * num_chunks_;
+
+  /* The bits are visited in pieces which stay inside a chunk of the word.
+   * The first pass only checks conflicts, so that the word is left
+   * unchanged on failure */
+  for (int pass = 0; pass < 2; ++pass) {
+    size_t num_visited = 0;
+    while (num_visited < width) {
+      const size_t des_bit = des_lsb + num_visited;
+      const size_t ichunk = des_bit / MIF_PACKED_CHUNK_BITS;
+      const size_t offset = des_bit % MIF_PACKED_CHUNK_BITS;
+      const size_t piece =
+        std::min(width - num_visited, MIF_PACKED_CHUNK_BITS - offset);
+      const uint64_t mask = (piece == MIF_PACKED_CHUNK_BITS)
+                              ? ~uint64_t(0)
+                              : (((uint64_t(1) << piece) - 1) << offset);
+      const uint64_t value =
+        read_mif_packed_bits(src_chunks, src_num_bits, src_lsb + num_visited,
+                             piece)
+        << offset;
+      if (0 == pass) {
+        const uint64_t conflict =
+          written[ichunk] & mask & (data[ichunk] ^ value);
+        if (0 != conflict) {
+          size_t conflict_offset = 0;
+          while (0 == ((conflict >> conflict_offset) & 1)) {
+            ++conflict_offset;
+          }
+          conflict_bit = ichunk * MIF_PACKED_CHUNK_BITS + conflict_offset;
+          return false;
+        }
+      } else {
+        data[ichunk] = (data[ichunk] & ~mask) | value;
+        written[ichunk] |= mask;
+      }
+      num_visited += piece;
+    }
+  }
+  return true;
+}
+
+void MifMemoryImage::clear() {
+  base_address_ = 0;
+  data_chunks_.clear();
+  written_chunks_.clear();
+  touched_.clear();
+}
+
+} /* namespace openfpga */
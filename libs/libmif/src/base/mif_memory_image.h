@@ -0,0 +1,80 @@
+#pragma once
+
+/********************************************************************
+ * Packed memory image of a physical memory, used to aggregate logical
+ * MIF words into the words of a destination pb_type.
+ *
+ * Words are stored densely around the lowest and the highest touched
+ * addresses, each word in mif_num_packed_chunks(word_width) chunks (see
+ * mif_packed_bits.h). A parallel mask records which bits have been
+ * written, so that writes and conflict checks are bitwise operations on
+ * whole chunks.
+ *
+ * Data members:
+ *   word_width_      - Number of bits per word
+ *   num_chunks_      - Number of uint64_t chunks per word
+ *   base_address_    - Address of the first word in the dense storage
+ *   data_chunks_     - Word data, num_chunks_ chunks per address
+ *   written_chunks_  - Written-bit mask, num_chunks_ chunks per address
+ *   touched_         - Per address, true if the word has been written
+ *                      (even by a zero-width write)
+ *******************************************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace openfpga {
+
+class MifMemoryImage {
+ public: /* Constructors */
+  MifMemoryImage();
+  explicit MifMemoryImage(const size_t& word_width);
+
+ public: /* Accessors */
+  size_t word_width() const;
+  size_t num_touched_words() const;
+  /* Addresses of all the touched words in ascending order */
+  std::vector<uint64_t> touched_addresses() const;
+  bool touched(const uint64_t& address) const;
+  /* Packed data and written mask of a touched word. Pointers are
+   * invalidated when new addresses are touched */
+  const uint64_t* word_data(const uint64_t& address) const;
+  const uint64_t* word_written_mask(const uint64_t& address) const;
+
+ public: /* Mutators */
+  /* Pre-allocate the words in an address range to avoid growing */
+  void reserve_addresses(const uint64_t& lsb, const uint64_t& msb);
+  /* Overwrite a whole word, all the bits are marked as written. The source
+   * has src_num_bits bits, missing high bits are written as 0 */
+  void write_word(const uint64_t& address, const uint64_t* src_chunks,
+                  const size_t& src_num_bits);
+  /* Write bits [src_lsb, src_lsb + width) of a source word of src_num_bits
+   * bits to bits [des_lsb, des_lsb + width) of a word. Source bits at or
+   * beyond src_num_bits are written as 0.
+   * Return false if a bit was already written with a different value. The
+   * first such bit is given in conflict_bit and the word is left unchanged
+   * Caller must ensure that des_lsb + width <= word_width() */
+  bool write_bits(const uint64_t& address, const size_t& des_lsb,
+                  const uint64_t* src_chunks, const size_t& src_num_bits,
+                  const size_t& src_lsb, const size_t& width,
+                  size_t& conflict_bit);
+  void clear();
+
+ private: /* Internal mutators */
+  /* Grow the dense storage to cover an address range */
+  void cover_addresses(const uint64_t& lsb, const uint64_t& msb);
+  /* Grow the dense storage to cover an address and mark it as touched,
+   * return its word index */
+  size_t touch_address(const uint64_t& address);
+
+ private: /* Internal data */
+  size_t word_width_;
+  size_t num_chunks_;
+  uint64_t base_address_;
+  std::vector<uint64_t> data_chunks_;
+  std::vector<uint64_t> written_chunks_;
+  std::vector<bool> touched_;
+};
+
+} /* namespace openfpga */
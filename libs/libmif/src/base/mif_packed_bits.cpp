@@ -0,0 +1,103 @@
+#include "mif_packed_bits.h"
+
+#include <algorithm>
+
+#include "openfpga_decode.h"
+
+namespace openfpga {
+
+/* Mask of the lowest width bits, width <= 64 */
+static uint64_t low_bit_mask(const size_t& width) {
+  return (width >= MIF_PACKED_CHUNK_BITS) ? ~uint64_t(0)
+                                          : ((uint64_t(1) << width) - 1);
+}
+
+size_t mif_num_packed_chunks(const size_t& num_bits) {
+  return (num_bits + MIF_PACKED_CHUNK_BITS - 1) / MIF_PACKED_CHUNK_BITS;
+}
+
+bool pack_mif_bit_string(const std::string& bits_lsb0,
+                         std::vector<uint64_t>& chunks) {
+  chunks.assign(mif_num_packed_chunks(bits_lsb0.size()), 0);
+  for (size_t i = 0; i < bits_lsb0.size(); ++i) {
+    if (bits_lsb0[i] == '1') {
+      chunks[i / MIF_PACKED_CHUNK_BITS] |= uint64_t(1)
+                                           << (i % MIF_PACKED_CHUNK_BITS);
+    } else if (bits_lsb0[i] != '0') {
+      return false;
+    }
+  }
+  return true;
+}
+
+std::string unpack_mif_bit_string(const uint64_t* chunks,
+                                  const size_t& num_bits) {
+  std::string bits(num_bits, '0');
+  for (size_t i = 0; i < num_bits; ++i) {
+    if ((chunks[i / MIF_PACKED_CHUNK_BITS] >> (i % MIF_PACKED_CHUNK_BITS)) &
+        1) {
+      bits[i] = '1';
+    }
+  }
+  return bits;
+}
+
+uint64_t read_mif_packed_bits(const uint64_t* chunks, const size_t& num_bits,
+                              const size_t& lsb, const size_t& width) {
+  if (lsb >= num_bits || 0 == width) {
+    return 0;
+  }
+  /* Clip the bits beyond the end of the word */
+  const size_t valid_width = std::min(width, num_bits - lsb);
+  const size_t chunk = lsb / MIF_PACKED_CHUNK_BITS;
+  const size_t offset = lsb % MIF_PACKED_CHUNK_BITS;
+  uint64_t value = chunks[chunk] >> offset;
+  /* The bits may span two chunks */
+  if (0 < offset && MIF_PACKED_CHUNK_BITS - offset < valid_width) {
+    value |= chunks[chunk + 1] << (MIF_PACKED_CHUNK_BITS - offset);
+  }
+  return value & low_bit_mask(valid_width);
+}
+
+void copy_mif_packed_bits(uint64_t* des_chunks, const size_t& des_lsb,
+                          const uint64_t* src_chunks,
+                          const size_t& src_num_bits, const size_t& src_lsb,
+                          const size_t& width) {
+  size_t num_copied = 0;
+  while (num_copied < width) {
+    /* Copy a piece which stays inside a destination chunk */
+    const size_t des_bit = des_lsb + num_copied;
+    const size_t offset = des_bit % MIF_PACKED_CHUNK_BITS;
+    const size_t piece =
+      std::min(width - num_copied, MIF_PACKED_CHUNK_BITS - offset);
+    const uint64_t mask = low_bit_mask(piece) << offset;
+    const uint64_t value =
+      read_mif_packed_bits(src_chunks, src_num_bits, src_lsb + num_copied,
+                           piece)
+      << offset;
+    uint64_t& des_chunk = des_chunks[des_bit / MIF_PACKED_CHUNK_BITS];
+    des_chunk = (des_chunk & ~mask) | value;
+    num_copied += piece;
+  }
+}
+
+std::string format_mif_packed_hex_word(const uint64_t* chunks,
+                                       const size_t& num_bits,
+                                       const int& width_bits) {
+  const size_t width =
+    width_bits > 0 ? static_cast<size_t>(width_bits) : num_bits;
+  const int nd = hex_digits_for_width(static_cast<int>(width));
+  if (nd <= 0) {
+    return std::string();
+  }
+
+  std::string hex(static_cast<size_t>(nd), '0');
+  for (int d = 0; d < nd; ++d) {
+    const uint64_t nibble =
+      read_mif_packed_bits(chunks, num_bits, static_cast<size_t>(d * 4), 4);
+    hex[static_cast<size_t>(nd - 1 - d)] = "0123456789ABCDEF"[nibble];
+  }
+  return hex;
+}
+
+} /* namespace openfpga */
@@ -0,0 +1,54 @@
+#pragma once
+
+/********************************************************************
+ * Helpers on packed MIF words.
+ *
+ * A word of N bits is stored in ceil(N / 64) uint64_t chunks, LSB first:
+ * bit i of the word is bit (i % 64) of chunk (i / 64). Bits beyond N in
+ * the last chunk are always 0.
+ *
+ * This is the binary counterpart of the '0'/'1' bit strings (LSB at
+ * index 0) used by the textual MIF API.
+ *******************************************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace openfpga {
+
+constexpr size_t MIF_PACKED_CHUNK_BITS = 64;
+
+/* Number of chunks to store a word of num_bits bits */
+size_t mif_num_packed_chunks(const size_t& num_bits);
+
+/* Pack a bit string (LSB at index 0). Return false if the string contains
+ * anything but '0' and '1'. */
+bool pack_mif_bit_string(const std::string& bits_lsb0,
+                         std::vector<uint64_t>& chunks);
+
+/* Unpack a word of num_bits bits to a bit string (LSB at index 0) */
+std::string unpack_mif_bit_string(const uint64_t* chunks,
+                                  const size_t& num_bits);
+
+/* Read up to 64 bits [lsb, lsb + width) of a word of num_bits bits.
+ * Bits at or beyond num_bits are read as 0. */
+uint64_t read_mif_packed_bits(const uint64_t* chunks, const size_t& num_bits,
+                              const size_t& lsb, const size_t& width);
+
+/* Copy bits [src_lsb, src_lsb + width) of a source word of src_num_bits
+ * bits to bits [des_lsb, des_lsb + width) of a destination word. Source
+ * bits at or beyond src_num_bits are copied as 0. */
+void copy_mif_packed_bits(uint64_t* des_chunks, const size_t& des_lsb,
+                          const uint64_t* src_chunks,
+                          const size_t& src_num_bits, const size_t& src_lsb,
+                          const size_t& width);
+
+/* Format a word of num_bits bits as zero-padded uppercase hex, same as
+ * format_hex_word() on the unpacked bit string */
+std::string format_mif_packed_hex_word(const uint64_t* chunks,
+                                       const size_t& num_bits,
+                                       const int& width_bits);
+
+} /* namespace openfpga */
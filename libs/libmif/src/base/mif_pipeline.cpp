@@ -3,11 +3,11 @@
 #include <cstdint>
 #include <map>
 #include <string>
-#include <utility>
 #include <vector>
 
 #include "aggregate_mif_util.h"
-#include "openfpga_decode.h"
+#include "mif_memory_image.h"
+#include "mif_packed_bits.h"
 #include "vtr_log.h"
 
 namespace openfpga {
@@ -90,8 +90,7 @@ int MifPipeline::decode_storage(
     if (storage.raw_data(segment_id).empty()) {
       for (const MifMemoryLineId& line_id :
            storage.segment_memory_lines(segment_id)) {
-        std::string data_bits = storage.memory_line_data(line_id);
-        if (!normalize_bit_string_width(data_bits, data_range.get_width())) {
+        if (!storage.resize_memory_line(line_id, data_range.get_width())) {
           VTR_LOG_ERROR(
             "mif_pipeline: cannot fit hex word at addr %lu into data_range "
             "width %zu for pb_type '%s'\n",
@@ -100,20 +99,22 @@ int MifPipeline::decode_storage(
             bitstream_setting.mif_source_pb_type(source_id).c_str());
           return CMD_EXEC_FATAL_ERROR;
         }
-        storage.set_memory_line_data(line_id, data_bits);
       }
       continue;
     }
 
-    std::vector<std::pair<uint64_t, std::string>> words;
+    std::vector<uint64_t> addresses;
+    std::vector<uint64_t> word_chunks;
     if (!unpack_yosys_init_param(storage.raw_data(segment_id),
                                  data_range.get_width(), addr_range.get_width(),
-                                 words)) {
+                                 addresses, word_chunks)) {
       return CMD_EXEC_FATAL_ERROR;
     }
-    for (const auto& word : words) {
-      storage.create_memory_line(segment_id, word.first + addr_range.get_lsb(),
-                                 word.second);
+    const size_t num_chunks = mif_num_packed_chunks(data_range.get_width());
+    for (size_t iword = 0; iword < addresses.size(); ++iword) {
+      storage.create_memory_line(
+        segment_id, addresses[iword] + addr_range.get_lsb(),
+        word_chunks.data() + iword * num_chunks, data_range.get_width());
     }
     storage.set_segment_raw_data(segment_id, std::string());
   }
@@ -131,17 +132,24 @@ int MifPipeline::aggregate_logical_into_physical(
     return CMD_EXEC_SUCCESS;
   }
 
-  std::map<std::string, std::map<uint64_t, std::string>> des_data_maps;
-  std::map<std::string, std::map<uint64_t, std::string>> des_written_masks;
+  /* Packed memory image of each destination pb_type */
+  std::map<std::string, MifMemoryImage> des_images;
 
   for (const MifSegmentId& dest_seg : dest.segments()) {
-    auto& phys_data_map = des_data_maps[dest.physical_pb(dest_seg)];
-    auto& phys_written_mask = des_written_masks[dest.physical_pb(dest_seg)];
+    auto result = des_images.emplace(
+      dest.physical_pb(dest_seg),
+      MifMemoryImage(static_cast<size_t>(dest.data_width(dest_seg))));
+    MifMemoryImage& phys_image = result.first->second;
     for (const MifMemoryLineId& line_id : dest.segment_memory_lines(dest_seg)) {
-      const std::string& bits = dest.memory_line_data(line_id);
-      phys_data_map[dest.memory_line_address(line_id)] = bits;
-      phys_written_mask[dest.memory_line_address(line_id)] =
-        std::string(bits.size(), '1');
+      if (dest.memory_line_width(line_id) != phys_image.word_width()) {
+        VTR_LOG_ERROR(
+          "mif_pipeline: destination word width mismatch at addr %lu\n",
+          static_cast<unsigned long>(dest.memory_line_address(line_id)));
+        return CMD_EXEC_FATAL_ERROR;
+      }
+      phys_image.write_word(dest.memory_line_address(line_id),
+                            dest.memory_line_chunks(line_id),
+                            dest.memory_line_width(line_id));
     }
   }
 
@@ -177,8 +185,24 @@ int MifPipeline::aggregate_logical_into_physical(
     const BasicPort& src_addr_range = logical.addr_range(segment_id);
     const size_t src_word_width =
       static_cast<size_t>(logical.data_width(segment_id));
-    auto& phys_data_map = des_data_maps[des_pb_type];
-    auto& phys_written_mask = des_written_masks[des_pb_type];
+    auto image_result =
+      des_images.emplace(des_pb_type, MifMemoryImage(des_word_width));
+    MifMemoryImage& phys_image = image_result.first->second;
+    if (phys_image.word_width() != des_word_width) {
+      VTR_LOG_ERROR(
+        "mif_pipeline: destination word width mismatch for des_pb_type "
+        "'%s'\n",
+        des_pb_type.c_str());
+      return CMD_EXEC_FATAL_ERROR;
+    }
+    if (image_result.second) {
+      const BasicPort des_addr_range =
+        bitstream_setting.mif_source_address_range(des_source_id);
+      if (des_addr_range.is_valid()) {
+        phys_image.reserve_addresses(des_addr_range.get_lsb(),
+                                     des_addr_range.get_msb());
+      }
+    }
 
     VTR_LOG("mif_pipeline: segment %zu bound src='%s' -> des='%s'\n",
             static_cast<size_t>(segment_id), src_pb_type.c_str(),
@@ -187,11 +211,10 @@ int MifPipeline::aggregate_logical_into_physical(
     for (const MifMemoryLineId& line_id :
          logical.segment_memory_lines(segment_id)) {
       const uint64_t logical_addr = logical.memory_line_address(line_id);
-      const std::string& logical_data = logical.memory_line_data(line_id);
       if (!src_addr_range.is_valid() ||
           logical_addr < src_addr_range.get_lsb() ||
           logical_addr > src_addr_range.get_msb() ||
-          logical_data.size() != src_word_width) {
+          logical.memory_line_width(line_id) != src_word_width) {
         VTR_LOG_ERROR(
           "mif_pipeline: invalid address/data in segment %zu for "
           "mif_source pb_type '%s'\n",
@@ -211,11 +234,12 @@ int MifPipeline::aggregate_logical_into_physical(
         }
         matched = true;
         if (!remap_logical_word(
-              logical_addr, logical_data,
+              logical_addr, logical.memory_line_chunks(line_id),
+              src_word_width,
               bitstream_setting.mif_address_map_rule_des_addr_offset(rule_id),
               bitstream_setting.mif_address_map_rule_src_mif_bits(rule_id),
               bitstream_setting.mif_address_map_rule_des_mif_bits(rule_id),
-              des_word_width, phys_data_map, phys_written_mask)) {
+              phys_image)) {
           return CMD_EXEC_FATAL_ERROR;
         }
       }
@@ -230,11 +254,13 @@ int MifPipeline::aggregate_logical_into_physical(
   }
 
   dest.clear();
-  for (const auto& des_data_map : des_data_maps) {
-    if (des_data_map.second.empty()) {
+  for (const auto& des_image : des_images) {
+    const MifMemoryImage& phys_image = des_image.second;
+    const std::vector<uint64_t> des_addrs = phys_image.touched_addresses();
+    if (des_addrs.empty()) {
       continue;
     }
-    const std::string& des_pb_type = des_data_map.first;
+    const std::string& des_pb_type = des_image.first;
     const MifSourceSettingId des_source_id =
       bitstream_setting.find_mif_source_by_pb_type(des_pb_type);
     if (!des_source_id.is_valid()) {
@@ -253,8 +279,9 @@ int MifPipeline::aggregate_logical_into_physical(
                                 static_cast<int>(des_data_range.get_width()));
     dest.set_segment_addr_range(out_seg, des_addr_range);
 
-    for (const auto& addr_data : des_data_map.second) {
-      dest.create_memory_line(out_seg, addr_data.first, addr_data.second);
+    for (const uint64_t& des_addr : des_addrs) {
+      dest.create_memory_line(out_seg, des_addr, phys_image.word_data(des_addr),
+                              phys_image.word_width());
     }
   }
 
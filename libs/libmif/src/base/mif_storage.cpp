@@ -1,5 +1,8 @@
 #include "mif_storage.h"
 
+#include <algorithm>
+
+#include "mif_packed_bits.h"
 #include "vtr_assert.h"
 
 namespace openfpga {
@@ -50,10 +53,22 @@ uint64_t MifStorage::memory_line_address(
   return memory_line_addresses_[memory_line_id];
 }
 
-const std::string& MifStorage::memory_line_data(
+size_t MifStorage::memory_line_width(
+  const MifMemoryLineId& memory_line_id) const {
+  VTR_ASSERT(valid_memory_line_id(memory_line_id));
+  return memory_line_widths_[memory_line_id];
+}
+
+const uint64_t* MifStorage::memory_line_chunks(
   const MifMemoryLineId& memory_line_id) const {
   VTR_ASSERT(valid_memory_line_id(memory_line_id));
-  return memory_line_data_[memory_line_id];
+  return memory_line_chunks_.data() + memory_line_offsets_[memory_line_id];
+}
+
+std::string MifStorage::memory_line_data(
+  const MifMemoryLineId& memory_line_id) const {
+  return unpack_mif_bit_string(memory_line_chunks(memory_line_id),
+                               memory_line_width(memory_line_id));
 }
 
 bool MifStorage::empty() const { return segment_ids_.empty(); }
@@ -83,7 +98,9 @@ void MifStorage::clear() {
   segment_memory_line_ids_.clear();
   memory_line_ids_.clear();
   memory_line_addresses_.clear();
-  memory_line_data_.clear();
+  memory_line_widths_.clear();
+  memory_line_offsets_.clear();
+  memory_line_chunks_.clear();
 }
 
 MifSegmentId MifStorage::create_segment() {
@@ -130,11 +147,25 @@ void MifStorage::clear_segment_memory_lines(const MifSegmentId& segment_id) {
 MifMemoryLineId MifStorage::create_memory_line(const MifSegmentId& segment_id,
                                                uint64_t address,
                                                const std::string& data_bits) {
+  std::vector<uint64_t> chunks;
+  const bool packed = pack_mif_bit_string(data_bits, chunks);
+  VTR_ASSERT(packed);
+  return create_memory_line(segment_id, address, chunks.data(),
+                            data_bits.size());
+}
+
+MifMemoryLineId MifStorage::create_memory_line(const MifSegmentId& segment_id,
+                                               uint64_t address,
+                                               const uint64_t* chunks,
+                                               const size_t& width) {
   VTR_ASSERT(valid_segment_id(segment_id));
   MifMemoryLineId memory_line_id(memory_line_ids_.size());
   memory_line_ids_.push_back(memory_line_id);
   memory_line_addresses_.push_back(address);
-  memory_line_data_.push_back(data_bits);
+  memory_line_widths_.push_back(width);
+  memory_line_offsets_.push_back(memory_line_chunks_.size());
+  memory_line_chunks_.insert(memory_line_chunks_.end(), chunks,
+                             chunks + mif_num_packed_chunks(width));
   segment_memory_line_ids_[segment_id].push_back(memory_line_id);
   return memory_line_id;
 }
@@ -142,7 +173,50 @@ MifMemoryLineId MifStorage::create_memory_line(const MifSegmentId& segment_id,
 void MifStorage::set_memory_line_data(const MifMemoryLineId& memory_line_id,
                                       const std::string& data_bits) {
   VTR_ASSERT(valid_memory_line_id(memory_line_id));
-  memory_line_data_[memory_line_id] = data_bits;
+  std::vector<uint64_t> chunks;
+  const bool packed = pack_mif_bit_string(data_bits, chunks);
+  VTR_ASSERT(packed);
+  /* Reuse the chunks of the line if the new data fits in, otherwise move the
+   * line to the end of the storage */
+  if (chunks.size() >
+      mif_num_packed_chunks(memory_line_widths_[memory_line_id])) {
+    memory_line_offsets_[memory_line_id] = memory_line_chunks_.size();
+    memory_line_chunks_.resize(memory_line_chunks_.size() + chunks.size());
+  }
+  std::copy(chunks.begin(), chunks.end(),
+            memory_line_chunks_.begin() + memory_line_offsets_[memory_line_id]);
+  memory_line_widths_[memory_line_id] = data_bits.size();
+}
+
+bool MifStorage::resize_memory_line(const MifMemoryLineId& memory_line_id,
+                                    const size_t& width) {
+  VTR_ASSERT(valid_memory_line_id(memory_line_id));
+  const size_t curr_width = memory_line_widths_[memory_line_id];
+  const size_t curr_num_chunks = mif_num_packed_chunks(curr_width);
+  const size_t num_chunks = mif_num_packed_chunks(width);
+  uint64_t* chunks =
+    memory_line_chunks_.data() + memory_line_offsets_[memory_line_id];
+
+  if (width < curr_width) {
+    /* Truncated bits must be 0 */
+    for (size_t bit = width; bit < curr_width;
+         bit += MIF_PACKED_CHUNK_BITS) {
+      if (0 != read_mif_packed_bits(chunks, curr_width, bit,
+                                    MIF_PACKED_CHUNK_BITS)) {
+        return false;
+      }
+    }
+  } else if (num_chunks > curr_num_chunks) {
+    /* Zero-extend: bits beyond the width are always 0 in the last chunk, so
+     * only new chunks are needed */
+    std::vector<uint64_t> new_chunks(chunks, chunks + curr_num_chunks);
+    new_chunks.resize(num_chunks, 0);
+    memory_line_offsets_[memory_line_id] = memory_line_chunks_.size();
+    memory_line_chunks_.insert(memory_line_chunks_.end(), new_chunks.begin(),
+                               new_chunks.end());
+  }
+  memory_line_widths_[memory_line_id] = width;
+  return true;
 }
 
 bool MifStorage::valid_segment_id(const MifSegmentId& segment_id) const {
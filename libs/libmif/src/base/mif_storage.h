@@ -35,7 +35,12 @@
  * Data members (indexed by MifMemoryLineId):
  *   memory_line_ids_         - Valid memory-line id list (StrongId table)
  *   memory_line_addresses_   - Word address of each memory line
- *   memory_line_data_        - Word data as bit string, LSB at index 0
+ *   memory_line_widths_      - Number of data bits of each memory line
+ *   memory_line_offsets_     - First chunk of each memory line in
+ *                              memory_line_chunks_
+ *
+ *   memory_line_chunks_      - Packed word data of all the memory lines,
+ *                              see mif_packed_bits.h
  *******************************************************************/
 namespace openfpga {
 
@@ -64,9 +69,13 @@ class MifStorage {
   const std::string& raw_data(const MifSegmentId& segment_id) const;
   bool has_physical_pb(const MifSegmentId& segment_id) const;
   uint64_t memory_line_address(const MifMemoryLineId& memory_line_id) const;
-  /* Bit string with LSB at index 0 ('0'/'1'). */
-  const std::string& memory_line_data(
+  size_t memory_line_width(const MifMemoryLineId& memory_line_id) const;
+  /* Packed word data, see mif_packed_bits.h. The pointer is invalidated
+   * when memory lines are created or resized. */
+  const uint64_t* memory_line_chunks(
     const MifMemoryLineId& memory_line_id) const;
+  /* Bit string with LSB at index 0 ('0'/'1'), unpacked on each call. */
+  std::string memory_line_data(const MifMemoryLineId& memory_line_id) const;
   bool empty() const;
 
  public: /* Mutators */
@@ -82,11 +91,20 @@ class MifStorage {
                             const std::string& raw_data);
   /* Drop decoded memory lines for a segment (e.g. before eblif overwrite). */
   void clear_segment_memory_lines(const MifSegmentId& segment_id);
+  /* data_bits must contain only '0'/'1', LSB at index 0. */
   MifMemoryLineId create_memory_line(const MifSegmentId& segment_id,
                                      uint64_t address,
                                      const std::string& data_bits);
+  /* Create a memory line of width bits from packed chunks. */
+  MifMemoryLineId create_memory_line(const MifSegmentId& segment_id,
+                                     uint64_t address, const uint64_t* chunks,
+                                     const size_t& width);
   void set_memory_line_data(const MifMemoryLineId& memory_line_id,
                             const std::string& data_bits);
+  /* Zero-extend, or truncate high bits which must be 0, to a new width.
+   * Return false (line unchanged) if a truncated bit is 1. */
+  bool resize_memory_line(const MifMemoryLineId& memory_line_id,
+                          const size_t& width);
 
  public: /* Validators */
   bool valid_segment_id(const MifSegmentId& segment_id) const;
@@ -105,7 +123,11 @@ class MifStorage {
   /* Per-memory-line tables (indexed by MifMemoryLineId) */
   vtr::vector<MifMemoryLineId, MifMemoryLineId> memory_line_ids_;
   vtr::vector<MifMemoryLineId, uint64_t> memory_line_addresses_;
-  vtr::vector<MifMemoryLineId, std::string> memory_line_data_;
+  vtr::vector<MifMemoryLineId, size_t> memory_line_widths_;
+  vtr::vector<MifMemoryLineId, size_t> memory_line_offsets_;
+
+  /* Packed data of all the memory lines */
+  std::vector<uint64_t> memory_line_chunks_;
 };
 
 } /* namespace openfpga */
@@ -4,8 +4,8 @@
 #include <ostream>
 #include <string>
 
+#include "mif_packed_bits.h"
 #include "mif_storage_fwd.h"
-#include "openfpga_decode.h"
 #include "openfpga_port.h"
 #include "vtr_log.h"
 
@@ -26,8 +26,10 @@ static void write_mif_segment(const MifStorage& storage,
   for (const MifMemoryLineId& memory_line_id :
        storage.segment_memory_lines(segment_id)) {
     os << "@" << storage.memory_line_address(memory_line_id) << " "
-       << format_hex_word(storage.memory_line_data(memory_line_id),
-                          storage.data_width(segment_id))
+       << format_mif_packed_hex_word(
+            storage.memory_line_chunks(memory_line_id),
+            storage.memory_line_width(memory_line_id),
+            storage.data_width(segment_id))
        << "\n";
   }
 }
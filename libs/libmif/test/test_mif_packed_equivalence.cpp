@@ -0,0 +1,360 @@
+/********************************************************************
+ * Unit test: compare the packed MIF words and memory images to the
+ * '0'/'1' bit strings (LSB at index 0) on randomized inputs.
+ * The reference functions below are the string implementations which
+ * the packed ones replace:
+ * - remapping slices of logical words into destination words, including
+ *   conflicting writes and addresses visited in descending order
+ * - unpacking yosys INIT parameters
+ * - formatting words as hex
+ *
+ * Usage:
+ *   test_mif_packed_equivalence [<seed>]
+ *******************************************************************/
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "aggregate_mif_util.h"
+#include "command_exit_codes.h"
+#include "mif_memory_image.h"
+#include "mif_packed_bits.h"
+#include "openfpga_decode.h"
+#include "vtr_log.h"
+
+using namespace openfpga;
+
+constexpr size_t NUM_REMAP_TRIALS = 2000;
+constexpr size_t NUM_REMAPS_PER_TRIAL = 24;
+constexpr size_t NUM_INIT_TRIALS = 500;
+constexpr size_t NUM_HEX_TRIALS = 2000;
+
+/* A memory image of bit strings, with a written-bit mask per word */
+struct StringMemoryImage {
+  std::map<uint64_t, std::string> data;
+  std::map<uint64_t, std::string> written;
+};
+
+/* Slice the logical-word bits selected by src_mif_bits. Missing high bits
+ * are padded with '0' */
+static std::string extract_string_bits(const std::string& data,
+                                       const BasicPort& bits) {
+  std::string out(bits.get_width(), '0');
+  for (size_t i = 0; i < bits.get_width(); ++i) {
+    const size_t src = bits.get_lsb() + i;
+    if (src < data.size()) {
+      out[i] = data[src];
+    }
+  }
+  return out;
+}
+
+static bool remap_string_word(uint64_t logical_addr,
+                              const std::string& logical_data,
+                              int des_addr_offset,
+                              const BasicPort& src_mif_bits,
+                              const BasicPort& des_mif_bits,
+                              size_t des_word_width,
+                              StringMemoryImage& image) {
+  const uint64_t des_addr =
+    static_cast<uint64_t>(static_cast<int64_t>(logical_addr) + des_addr_offset);
+  const std::string extracted = extract_string_bits(logical_data, src_mif_bits);
+
+  std::string& des_data = image.data[des_addr];
+  std::string& des_written = image.written[des_addr];
+  if (des_data.empty()) {
+    des_data.assign(des_word_width, '0');
+  }
+  if (des_written.empty()) {
+    des_written.assign(des_word_width, '0');
+  }
+  for (size_t i = 0; i < des_mif_bits.get_width(); ++i) {
+    const size_t des_bit = des_mif_bits.get_lsb() + i;
+    if (des_bit >= des_word_width) {
+      return false;
+    }
+    const char new_bit = (i < extracted.size()) ? extracted[i] : '0';
+    if (des_written[des_bit] == '1' && des_data[des_bit] != new_bit) {
+      return false;
+    }
+    des_data[des_bit] = new_bit;
+    des_written[des_bit] = '1';
+  }
+  return true;
+}
+
+static bool unpack_string_init_param(
+  const std::string& bits, size_t data_width, size_t depth,
+  std::vector<std::pair<uint64_t, std::string>>& words) {
+  words.clear();
+  if (data_width == 0 || depth == 0 || bits.size() != data_width * depth) {
+    return false;
+  }
+  for (size_t addr = 0; addr < depth; ++addr) {
+    const size_t end = bits.size() - addr * data_width;
+    const std::string word_bits_msb = bits.substr(end - data_width, data_width);
+    bool all_undefined = true;
+    std::string word_bits_lsb(data_width, '0');
+    for (size_t i = 0; i < data_width; ++i) {
+      const char bit = word_bits_msb[i];
+      if (bit == '0' || bit == '1') {
+        all_undefined = false;
+        word_bits_lsb[data_width - 1 - i] = bit;
+      } else if (bit != 'x' && bit != 'X' && bit != 'z' && bit != 'Z') {
+        return false;
+      }
+    }
+    if (!all_undefined) {
+      words.emplace_back(static_cast<uint64_t>(addr), word_bits_lsb);
+    }
+  }
+  return true;
+}
+
+static std::string random_bit_string(std::mt19937_64& rng, const size_t& size,
+                                     const std::string& alphabet) {
+  std::uniform_int_distribution<size_t> pick(0, alphabet.size() - 1);
+  std::string bits(size, '0');
+  for (char& bit : bits) {
+    bit = alphabet[pick(rng)];
+  }
+  return bits;
+}
+
+static size_t random_size(std::mt19937_64& rng, const size_t& lsb,
+                          const size_t& msb) {
+  return std::uniform_int_distribution<size_t>(lsb, msb)(rng);
+}
+
+/* Compare the touched words of a packed image to a string image */
+static bool same_memory_image(const MifMemoryImage& packed_image,
+                              const StringMemoryImage& string_image) {
+  const std::vector<uint64_t> addresses = packed_image.touched_addresses();
+  if (addresses.size() != string_image.data.size()) {
+    return false;
+  }
+  size_t index = 0;
+  for (const auto& addr_data : string_image.data) {
+    const uint64_t address = addresses[index++];
+    if (address != addr_data.first ||
+        unpack_mif_bit_string(packed_image.word_data(address),
+                              packed_image.word_width()) != addr_data.second ||
+        unpack_mif_bit_string(packed_image.word_written_mask(address),
+                              packed_image.word_width()) !=
+          string_image.written.at(address)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/********************************************************************
+ * Each trial remaps random logical words into an empty destination.
+ * The destination word is split into a few slices, so that most remaps
+ * write disjoint bits and some of them conflict. A trial ends at the
+ * first failed remap, after which the images are not compared since the
+ * pipeline errors out
+ *******************************************************************/
+static int test_remap_logical_words(std::mt19937_64& rng) {
+  int num_errors = 0;
+  for (size_t itrial = 0; itrial < NUM_REMAP_TRIALS; ++itrial) {
+    const size_t des_word_width = random_size(rng, 1, 200);
+    const size_t logical_width = random_size(rng, 1, 150);
+    MifMemoryImage packed_image(des_word_width);
+    StringMemoryImage string_image;
+    /* Pre-sizing the image should not change the touched words */
+    if (0 == itrial % 3) {
+      const uint64_t lsb = random_size(rng, 0, 32);
+      packed_image.reserve_addresses(lsb, lsb + random_size(rng, 0, 32));
+    }
+
+    bool all_succeeded = true;
+    for (size_t iremap = 0; iremap < NUM_REMAPS_PER_TRIAL; ++iremap) {
+      /* Odd trials spread words over more addresses with fewer conflicts */
+      const uint64_t logical_addr =
+        random_size(rng, 0, 0 == itrial % 2 ? 63 : 1023);
+      const int des_addr_offset =
+        static_cast<int>(random_size(rng, 0, 32)) -
+        static_cast<int>(std::min<uint64_t>(logical_addr, 16));
+      const std::string logical_data =
+        random_bit_string(rng, logical_width, "01");
+      std::vector<uint64_t> logical_chunks;
+      pack_mif_bit_string(logical_data, logical_chunks);
+
+      /* Slices rarely exceed the logical word or the destination */
+      const size_t num_slices = random_size(rng, 1, 4);
+      const size_t slice_width = (des_word_width + num_slices - 1) / num_slices;
+      const size_t des_lsb =
+        std::min(des_word_width - 1, random_size(rng, 0, num_slices - 1) *
+                                       slice_width);
+      size_t des_width = std::min(slice_width, des_word_width - des_lsb);
+      if (0 == random_size(rng, 0, 50)) {
+        des_width += random_size(rng, 1, 8);
+      }
+      const BasicPort des_mif_bits("des", des_lsb, des_lsb + des_width - 1);
+      size_t src_lsb = random_size(rng, 0, logical_width - 1);
+      size_t src_width = random_size(rng, 1, des_width);
+      if (0 == random_size(rng, 0, 50)) {
+        src_lsb += random_size(rng, 0, 8);
+        src_width += random_size(rng, 1, 8);
+      }
+      const BasicPort src_mif_bits("src", src_lsb, src_lsb + src_width - 1);
+
+      const bool packed_status = remap_logical_word(
+        logical_addr, logical_chunks.data(), logical_width, des_addr_offset,
+        src_mif_bits, des_mif_bits, packed_image);
+      const bool string_status = remap_string_word(
+        logical_addr, logical_data, des_addr_offset, src_mif_bits,
+        des_mif_bits, des_word_width, string_image);
+      if (packed_status != string_status) {
+        VTR_LOG_ERROR("Trial %zu: remap %zu is %s by packed words only\n",
+                      itrial, iremap,
+                      packed_status ? "accepted" : "rejected");
+        ++num_errors;
+      }
+      if (!packed_status || !string_status) {
+        all_succeeded = false;
+        break;
+      }
+    }
+    if (all_succeeded && !same_memory_image(packed_image, string_image)) {
+      VTR_LOG_ERROR("Trial %zu: packed and string memory images differ\n",
+                    itrial);
+      ++num_errors;
+    }
+  }
+  return num_errors;
+}
+
+/* The conflicting bit reported by a memory image is the lowest bit written
+ * with a different value, and the word is left unchanged */
+static int test_conflict_bits(std::mt19937_64& rng) {
+  int num_errors = 0;
+  for (size_t itrial = 0; itrial < NUM_REMAP_TRIALS; ++itrial) {
+    const size_t word_width = random_size(rng, 1, 200);
+    const std::string old_bits = random_bit_string(rng, word_width, "01");
+    const std::string new_bits = random_bit_string(rng, word_width, "01");
+    std::vector<uint64_t> old_chunks, new_chunks;
+    pack_mif_bit_string(old_bits, old_chunks);
+    pack_mif_bit_string(new_bits, new_chunks);
+
+    MifMemoryImage image(word_width);
+    const uint64_t address = random_size(rng, 0, 1000);
+    const size_t old_lsb = random_size(rng, 0, word_width - 1);
+    const size_t old_width = random_size(rng, 0, word_width - old_lsb);
+    size_t conflict_bit = 0;
+    image.write_bits(address, old_lsb, old_chunks.data(), word_width, old_lsb,
+                     old_width, conflict_bit);
+    const std::string written_data =
+      unpack_mif_bit_string(image.word_data(address), word_width);
+
+    const size_t new_lsb = random_size(rng, 0, word_width - 1);
+    const size_t new_width = random_size(rng, 0, word_width - new_lsb);
+    size_t expected_bit = word_width;
+    for (size_t bit = std::max(old_lsb, new_lsb);
+         bit < std::min(old_lsb + old_width, new_lsb + new_width); ++bit) {
+      if (old_bits[bit] != new_bits[bit]) {
+        expected_bit = bit;
+        break;
+      }
+    }
+    const bool status =
+      image.write_bits(address, new_lsb, new_chunks.data(), word_width,
+                       new_lsb, new_width, conflict_bit);
+    const bool unchanged =
+      written_data ==
+      unpack_mif_bit_string(image.word_data(address), word_width);
+    if (status != (word_width == expected_bit) ||
+        (!status && (conflict_bit != expected_bit || !unchanged))) {
+      VTR_LOG_ERROR("Trial %zu: wrong conflict on bit %zu (expected %zu)\n",
+                    itrial, status ? word_width : conflict_bit, expected_bit);
+      ++num_errors;
+    }
+  }
+  return num_errors;
+}
+
+static int test_unpack_init_params(std::mt19937_64& rng) {
+  int num_errors = 0;
+  for (size_t itrial = 0; itrial < NUM_INIT_TRIALS; ++itrial) {
+    const size_t data_width = random_size(rng, 1, 130);
+    const size_t depth = random_size(rng, 1, 16);
+    /* Mostly undefined bits, so that some words are skipped */
+    std::string bits = random_bit_string(
+      rng, data_width * depth, 0 == itrial % 2 ? "01xz" : "xxxxxxxxxxXZ1");
+    if (0 == itrial % 50) {
+      bits[random_size(rng, 0, bits.size() - 1)] = '2';
+    }
+
+    std::vector<uint64_t> addresses, word_chunks;
+    std::vector<std::pair<uint64_t, std::string>> words;
+    const bool packed_status =
+      unpack_yosys_init_param(bits, data_width, depth, addresses, word_chunks);
+    const bool string_status =
+      unpack_string_init_param(bits, data_width, depth, words);
+    bool same = (packed_status == string_status);
+    if (same && packed_status) {
+      const size_t num_chunks = mif_num_packed_chunks(data_width);
+      same = (addresses.size() == words.size());
+      for (size_t iword = 0; same && iword < words.size(); ++iword) {
+        same = (addresses[iword] == words[iword].first) &&
+               (unpack_mif_bit_string(
+                  word_chunks.data() + iword * num_chunks, data_width) ==
+                words[iword].second);
+      }
+    }
+    if (!same) {
+      VTR_LOG_ERROR("Trial %zu: packed and string INIT words differ\n",
+                    itrial);
+      ++num_errors;
+    }
+  }
+  return num_errors;
+}
+
+static int test_format_hex_words(std::mt19937_64& rng) {
+  int num_errors = 0;
+  for (size_t itrial = 0; itrial < NUM_HEX_TRIALS; ++itrial) {
+    const std::string bits =
+      random_bit_string(rng, random_size(rng, 1, 200), "01");
+    std::vector<uint64_t> chunks;
+    pack_mif_bit_string(bits, chunks);
+    const int width_bits = static_cast<int>(random_size(rng, 0, 210)) - 10;
+    if (format_mif_packed_hex_word(chunks.data(), bits.size(), width_bits) !=
+        format_hex_word(bits, width_bits)) {
+      VTR_LOG_ERROR("Trial %zu: hex words of %zu bits differ\n", itrial,
+                    bits.size());
+      ++num_errors;
+    }
+  }
+  return num_errors;
+}
+
+int main(int argc, const char** argv) {
+  if (argc > 2) {
+    VTR_LOG_ERROR("Usage: %s [<seed>]\n", argv[0]);
+    return CMD_EXEC_FATAL_ERROR;
+  }
+  const uint64_t seed = (2 == argc) ? std::stoull(argv[1]) : 20240229;
+  std::mt19937_64 rng(seed);
+  VTR_LOG("Compare packed MIF words to bit strings with seed %lu\n",
+          static_cast<unsigned long>(seed));
+
+  int num_errors = 0;
+  num_errors += test_remap_logical_words(rng);
+  num_errors += test_conflict_bits(rng);
+  num_errors += test_unpack_init_params(rng);
+  num_errors += test_format_hex_words(rng);
+  if (0 < num_errors) {
+    VTR_LOG_ERROR("%d mismatches between packed words and bit strings\n",
+                  num_errors);
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
+  VTR_LOG("Packed MIF words match bit strings.\n");
+  return CMD_EXEC_SUCCESS;
+}
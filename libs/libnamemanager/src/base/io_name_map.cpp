@@ -23,11 +23,19 @@ IoNameMap::IoNameMap() {
  * Public Accessors
  *************************************************/
 std::vector<BasicPort> IoNameMap::fpga_top_ports() const {
-  std::vector<BasicPort> ports;
-
+  std::vector<std::string> port_keys;
+  port_keys.reserve(top2core_io_name_map_.size());
   for (auto it = top2core_io_name_map_.begin();
        it != top2core_io_name_map_.end(); ++it) {
-    ports.push_back(str2port(it->first));
+    port_keys.push_back(it->first);
+  }
+  /* Sort the ports so that the outputs do not depend on the hash */
+  std::sort(port_keys.begin(), port_keys.end());
+
+  std::vector<BasicPort> ports;
+  ports.reserve(port_keys.size());
+  for (const std::string& port_key : port_keys) {
+    ports.push_back(str2port(port_key));
   }
 
   return ports;
@@ -164,7 +172,12 @@ bool IoNameMap::fpga_top_port_is_dummy(const BasicPort& fpga_top_port) const {
 
 IoNameMap::e_dummy_port_direction IoNameMap::fpga_top_dummy_port_direction(
   const BasicPort& fpga_top_port) const {
-  for (auto& kv : dummy_port_direction_) {
+  auto result = dummy_port_directions_.find(fpga_top_port.get_name());
+  if (result == dummy_port_directions_.end()) {
+    /* Return an invalid port type */
+    return IoNameMap::e_dummy_port_direction::NUM_TYPES;
+  }
+  for (auto& kv : result->second) {
     BasicPort cand = str2port(kv.first);
     if (cand.contained(fpga_top_port)) {
       return kv.second;
@@ -177,7 +190,7 @@ IoNameMap::e_dummy_port_direction IoNameMap::fpga_top_dummy_port_direction(
 bool IoNameMap::empty() const {
   return top2core_io_name_keys_.empty() && top2core_io_name_map_.empty() &&
          core2top_io_name_keys_.empty() && core2top_io_name_map_.empty() &&
-         dummy_port_direction_.empty();
+         dummy_port_directions_.empty();
 }
 
 int IoNameMap::set_io_pair(const BasicPort& fpga_top_port,
@@ -277,7 +290,9 @@ int IoNameMap::set_dummy_io(const BasicPort& fpga_top_port,
   }
   /* Add the direction list */
   bool dir_defined = false;
-  for (auto& kv : dummy_port_direction_) {
+  std::map<std::string, e_dummy_port_direction>& port_directions =
+    dummy_port_directions_[fpga_top_port.get_name()];
+  for (auto& kv : port_directions) {
     BasicPort cand = str2port(kv.first);
     if (cand.contained(fpga_top_port)) {
       if (kv.second != direction) {
@@ -293,7 +308,7 @@ int IoNameMap::set_dummy_io(const BasicPort& fpga_top_port,
     }
   }
   if (!dir_defined) {
-    dummy_port_direction_[top_port_str] = direction;
+    port_directions[top_port_str] = direction;
   }
   return CMD_EXEC_SUCCESS;
 }
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "openfpga_port.h"
+#include "openfpga_string_hash.h"
 
 /* Begin namespace openfpga */
 namespace openfpga {
@@ -36,7 +37,8 @@ class IoNameMap {
   IoNameMap();
 
  public: /* Public accessors */
-  /** @brief Get all the fpga top ports */
+  /** @brief Get all the fpga top ports, in the lexical order of their
+   * names */
   std::vector<BasicPort> fpga_top_ports() const;
   /** @brief With a given port at fpga_top, find the corresponding I/O at
    * fpga_core. Return an invalid port if not found */
@@ -96,13 +98,17 @@ class IoNameMap {
    * keys are then used to spot the fpga core ports in the io_name_map_. For
    * instance: "prog_clk[0:1]" -> pclk[0:1]
    */
-  std::map<std::string, std::vector<std::string>> top2core_io_name_keys_;
-  std::map<std::string, BasicPort> top2core_io_name_map_;
+  StringMap<std::vector<std::string>> top2core_io_name_keys_;
+  StringMap<BasicPort> top2core_io_name_map_;
 
-  std::map<std::string, std::vector<std::string>> core2top_io_name_keys_;
-  std::map<std::string, BasicPort> core2top_io_name_map_;
+  StringMap<std::vector<std::string>> core2top_io_name_keys_;
+  StringMap<BasicPort> core2top_io_name_map_;
 
-  std::map<std::string, e_dummy_port_direction> dummy_port_direction_;
+  /* Direction of dummy ports, grouped by the port name. For instance:
+   * dummy -> {"dummy[0:1]" -> input, "dummy[2:3]" -> output}. Only the ports
+   * with the same name can contain each other */
+  StringMap<std::map<std::string, e_dummy_port_direction>>
+    dummy_port_directions_;
 
   /* Constants */
   std::array<const char*, size_t(e_dummy_port_direction::NUM_TYPES)>
@@ -49,12 +49,17 @@ bool ModuleNameMap::tag_exist(const std::string& name) const {
 
 std::vector<std::string> ModuleNameMap::tags() const {
   std::vector<std::string> keys;
+  keys.reserve(tag2names_.size());
   for (auto const& element : tag2names_) {
     keys.push_back(element.first);
   }
+  /* Sort the keys so that the outputs do not depend on the hash */
+  std::sort(keys.begin(), keys.end());
   return keys;
 }
 
+size_t ModuleNameMap::num_tags() const { return tag2names_.size(); }
+
 int ModuleNameMap::set_tag_to_name_pair(const std::string& tag,
                                         const std::string& name) {
   /*  tagA <--x--> nameA
@@ -81,6 +86,11 @@ int ModuleNameMap::set_tag_to_name_pair(const std::string& tag,
   return CMD_EXEC_SUCCESS;
 }
 
+void ModuleNameMap::reserve_tags(const size_t& num_tags) {
+  tag2names_.reserve(num_tags);
+  name2tags_.reserve(num_tags);
+}
+
 void ModuleNameMap::clear() {
   tag2names_.clear();
   name2tags_.clear();
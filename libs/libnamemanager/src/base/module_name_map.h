@@ -4,10 +4,11 @@
 /********************************************************************
  * Include header files required by the data structure definition
  *******************************************************************/
-#include <map>
 #include <string>
 #include <vector>
 
+#include "openfpga_string_hash.h"
+
 /* Begin namespace openfpga */
 namespace openfpga {
 
@@ -28,13 +29,17 @@ class ModuleNameMap {
   /** @brief Get tag with a given name */
   std::string tag(const std::string& name) const;
 
-  /** @brief return a list of all the current keys */
+  /** @brief return a list of all the current keys, in lexical order */
   std::vector<std::string> tags() const;
+  /** @brief Get the number of tag-to-name pairs */
+  size_t num_tags() const;
 
  public: /* Public mutators */
   /** @brief Create the one-on-one mapping between an built-in name and a
    * customized name. Return 0 for success, return 1 for fail */
   int set_tag_to_name_pair(const std::string& tag, const std::string& name);
+  /** @brief Reserve memory for a number of tag-to-name pairs */
+  void reserve_tags(const size_t& num_tags);
   /** @brief Reset to empty status. Clear all the storage */
   void clear();
 
@@ -43,8 +48,8 @@ class ModuleNameMap {
    * Create a double link to check any customized name is mapped to more than 1
    * built-in name!
    */
-  std::map<std::string, std::string> tag2names_;
-  std::map<std::string, std::string> name2tags_;
+  StringMap<std::string> tag2names_;
+  StringMap<std::string> name2tags_;
 };
 
 } /* End namespace openfpga*/
@@ -0,0 +1,31 @@
+#ifndef NAME_MAP_BIN_CONSTANTS_H
+#define NAME_MAP_BIN_CONSTANTS_H
+
+#include <cstdint>
+
+namespace openfpga {  // Begin namespace openfpga
+
+/* Constants required by binary parsers
+ * A binary name map is a sequence of fields in the following order,
+ * which are dumped by openfpga::BinaryWriter. Sizes and flags are 64-bit
+ * integers, strings are prefixed by their sizes, ports are a name followed
+ * by the lsb, the msb and the original width
+ * - file header: magic number and version
+ * - module name map: number of bindings, then the built-in name and the
+ *   given name of each binding
+ * - I/O name map: number of fpga_top ports, then for each port, the
+ *   fpga_top port, a dummy flag, and either the direction of the dummy port
+ *   or the fpga_core port
+ */
+/* The magic numbers read "OFPGAMNM" and "OFPGAIOM" in little-endian files.
+ * Increase the versions whenever the layouts are changed */
+constexpr uint64_t BIN_MODULE_NAME_MAP_MAGIC = 0x4d4e4d414750464f;
+constexpr uint64_t BIN_MODULE_NAME_MAP_VERSION = 2;
+constexpr uint64_t BIN_IO_NAME_MAP_MAGIC = 0x4d4f49414750464f;
+constexpr uint64_t BIN_IO_NAME_MAP_VERSION = 2;
+/* Name map files with this extension are in binary format */
+constexpr const char* BIN_NAME_MAP_FILE_EXTENSION = ".bin";
+
+}  // End of namespace openfpga
+
+#endif
@@ -0,0 +1,52 @@
+/********************************************************************
+ * This file includes the functions shared by the readers and writers of
+ * name maps in binary format, which are dumped by openfpga::BinaryWriter.
+ * See the layout in name_map_bin_constants.h
+ *******************************************************************/
+#include "name_map_bin_utils.h"
+
+/* Headers from libarchfpga */
+#include "arch_error.h"
+#include "name_map_bin_constants.h"
+
+namespace openfpga {  // Begin namespace openfpga
+
+/********************************************************************
+ * Identify if a name map file is in binary format by its extension
+ *******************************************************************/
+bool is_bin_name_map_file(const std::string& fname) {
+  std::string ext(BIN_NAME_MAP_FILE_EXTENSION);
+  return fname.size() > ext.size() &&
+         0 == fname.compare(fname.size() - ext.size(), ext.size(), ext);
+}
+
+/********************************************************************
+ * Check the magic number and the version of a binary name map
+ *******************************************************************/
+void read_bin_name_map_header(BinaryReader& reader, const char* fname,
+                              const uint64_t& magic, const uint64_t& version) {
+  uint64_t file_magic = 0;
+  uint64_t file_version = 0;
+  reader(file_magic, file_version);
+  if (!reader.good() || magic != file_magic) {
+    archfpga_throw(fname, 0, "Not a binary name map of the expected type!\n");
+  }
+  if (version != file_version) {
+    archfpga_throw(fname, 0,
+                   "Unsupported version '%lu' of binary name map (expect "
+                   "'%lu')!\n",
+                   size_t(file_version), size_t(version));
+  }
+}
+
+/********************************************************************
+ * The reader stops at the end of the file or at the first corrupted
+ * field, so that a list with a corrupted size is never fully read
+ *******************************************************************/
+void check_bin_name_map_reader(const BinaryReader& reader, const char* fname) {
+  if (!reader.good()) {
+    archfpga_throw(fname, 0, "Unexpected end of binary name map!\n");
+  }
+}
+
+}  // End of namespace openfpga
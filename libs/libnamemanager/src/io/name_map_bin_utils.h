@@ -0,0 +1,30 @@
+#ifndef NAME_MAP_BIN_UTILS_H
+#define NAME_MAP_BIN_UTILS_H
+
+/********************************************************************
+ * Include header files that are required by function declaration
+ *******************************************************************/
+#include <cstdint>
+#include <string>
+
+#include "openfpga_binary_archive.h"
+
+/********************************************************************
+ * Function declaration
+ *******************************************************************/
+
+namespace openfpga {  // Begin namespace openfpga
+
+/* Identify if a name map file is in binary format by its extension */
+bool is_bin_name_map_file(const std::string& fname);
+
+/* Check the header of a binary name map */
+void read_bin_name_map_header(BinaryReader& reader, const char* fname,
+                              const uint64_t& magic, const uint64_t& version);
+
+/* Error out if a binary name map ends or is corrupted before a field */
+void check_bin_name_map_reader(const BinaryReader& reader, const char* fname);
+
+}  // End of namespace openfpga
+
+#endif
@@ -0,0 +1,80 @@
+/********************************************************************
+ * This file includes the functions to read I/O naming rules from a
+ * binary file, which is written by write_bin_io_name_map()
+ *******************************************************************/
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+/* Headers from vtr util library */
+#include "vtr_time.h"
+
+/* Headers from libarchfpga */
+#include "arch_error.h"
+#include "command_exit_codes.h"
+#include "name_map_bin_constants.h"
+#include "name_map_bin_utils.h"
+#include "read_bin_io_name_map.h"
+#include "read_xml_io_name_map.h"
+
+namespace openfpga {  // Begin namespace openfpga
+
+/********************************************************************
+ * Parse a binary file to an object of IoNameMap
+ *******************************************************************/
+int read_bin_io_name_map(const char* fname, IoNameMap& io_name_map) {
+  vtr::ScopedStartFinishTimer timer("Read I/O naming rules in binary");
+
+  std::ifstream ifs(fname, std::ios::binary);
+  if (!ifs.is_open()) {
+    archfpga_throw(fname, 0, "Unable to open binary name map!\n");
+  }
+  BinaryReader reader(ifs);
+  read_bin_name_map_header(reader, fname, BIN_IO_NAME_MAP_MAGIC,
+                           BIN_IO_NAME_MAP_VERSION);
+
+  uint64_t num_ports = 0;
+  reader(num_ports);
+  for (uint64_t iport = 0; iport < num_ports; ++iport) {
+    BasicPort top_port;
+    uint64_t is_dummy = 0;
+    reader(top_port, is_dummy);
+    check_bin_name_map_reader(reader, fname);
+    int status = CMD_EXEC_SUCCESS;
+    if (0 != is_dummy) {
+      uint64_t dir = 0;
+      reader(dir);
+      check_bin_name_map_reader(reader, fname);
+      if (dir >= uint64_t(IoNameMap::e_dummy_port_direction::NUM_TYPES)) {
+        archfpga_throw(fname, 0,
+                       "Invalid direction '%lu' of dummy port '%s'!\n",
+                       size_t(dir), top_port.to_verilog_string().c_str());
+      }
+      status = io_name_map.set_dummy_io(
+        top_port, static_cast<IoNameMap::e_dummy_port_direction>(dir));
+    } else {
+      BasicPort core_port;
+      reader(core_port);
+      check_bin_name_map_reader(reader, fname);
+      status = io_name_map.set_io_pair(top_port, core_port);
+    }
+    if (status != CMD_EXEC_SUCCESS) {
+      return CMD_EXEC_FATAL_ERROR;
+    }
+  }
+  check_bin_name_map_reader(reader, fname);
+
+  return CMD_EXEC_SUCCESS;
+}
+
+/********************************************************************
+ * Read I/O naming rules in the format indicated by the file extension
+ *******************************************************************/
+int read_io_name_map(const char* fname, IoNameMap& io_name_map) {
+  if (is_bin_name_map_file(std::string(fname))) {
+    return read_bin_io_name_map(fname, io_name_map);
+  }
+  return read_xml_io_name_map(fname, io_name_map);
+}
+
+}  // End of namespace openfpga
@@ -0,0 +1,22 @@
+#ifndef READ_BIN_IO_NAME_MAP_H
+#define READ_BIN_IO_NAME_MAP_H
+
+/********************************************************************
+ * Include header files that are required by function declaration
+ *******************************************************************/
+#include "io_name_map.h"
+
+/********************************************************************
+ * Function declaration
+ *******************************************************************/
+
+namespace openfpga {  // Begin namespace openfpga
+
+int read_bin_io_name_map(const char* fname, IoNameMap& io_name_map);
+
+/* Read an I/O name map from either a binary file or an XML file */
+int read_io_name_map(const char* fname, IoNameMap& io_name_map);
+
+}  // End of namespace openfpga
+
+#endif
@@ -0,0 +1,64 @@
+/********************************************************************
+ * This file includes the functions to read module naming rules from a
+ * binary file, which is written by write_bin_module_name_map()
+ *******************************************************************/
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+/* Headers from vtr util library */
+#include "vtr_time.h"
+
+/* Headers from libarchfpga */
+#include "arch_error.h"
+#include "command_exit_codes.h"
+#include "name_map_bin_constants.h"
+#include "name_map_bin_utils.h"
+#include "read_bin_module_name_map.h"
+#include "read_xml_module_name_map.h"
+
+namespace openfpga {  // Begin namespace openfpga
+
+/********************************************************************
+ * Parse a binary file to an object of ModuleNameMap
+ *******************************************************************/
+int read_bin_module_name_map(const char* fname,
+                             ModuleNameMap& module_name_map) {
+  vtr::ScopedStartFinishTimer timer("Read module rename rules in binary");
+
+  std::ifstream ifs(fname, std::ios::binary);
+  if (!ifs.is_open()) {
+    archfpga_throw(fname, 0, "Unable to open binary name map!\n");
+  }
+  BinaryReader reader(ifs);
+  read_bin_name_map_header(reader, fname, BIN_MODULE_NAME_MAP_MAGIC,
+                           BIN_MODULE_NAME_MAP_VERSION);
+
+  uint64_t num_bindings = 0;
+  reader(num_bindings);
+  for (uint64_t ibinding = 0; ibinding < num_bindings; ++ibinding) {
+    std::string default_name;
+    std::string given_name;
+    reader(default_name, given_name);
+    check_bin_name_map_reader(reader, fname);
+    int status = module_name_map.set_tag_to_name_pair(default_name, given_name);
+    if (status != CMD_EXEC_SUCCESS) {
+      return CMD_EXEC_FATAL_ERROR;
+    }
+  }
+  check_bin_name_map_reader(reader, fname);
+
+  return CMD_EXEC_SUCCESS;
+}
+
+/********************************************************************
+ * Read module naming rules in the format indicated by the file extension
+ *******************************************************************/
+int read_module_name_map(const char* fname, ModuleNameMap& module_name_map) {
+  if (is_bin_name_map_file(std::string(fname))) {
+    return read_bin_module_name_map(fname, module_name_map);
+  }
+  return read_xml_module_name_map(fname, module_name_map);
+}
+
+}  // End of namespace openfpga
@@ -0,0 +1,23 @@
+#ifndef READ_BIN_MODULE_NAME_MAP_H
+#define READ_BIN_MODULE_NAME_MAP_H
+
+/********************************************************************
+ * Include header files that are required by function declaration
+ *******************************************************************/
+#include "module_name_map.h"
+
+/********************************************************************
+ * Function declaration
+ *******************************************************************/
+
+namespace openfpga {  // Begin namespace openfpga
+
+int read_bin_module_name_map(const char* fname,
+                             ModuleNameMap& module_name_map);
+
+/* Read a module name map from either a binary file or an XML file */
+int read_module_name_map(const char* fname, ModuleNameMap& module_name_map);
+
+}  // End of namespace openfpga
+
+#endif
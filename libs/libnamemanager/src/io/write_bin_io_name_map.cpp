@@ -0,0 +1,81 @@
+/********************************************************************
+ * This file includes functions that outputs I/O naming rules to a
+ * binary file. See the layout in name_map_bin_constants.h
+ *******************************************************************/
+/* Headers from system goes first */
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+/* Headers from vtr util library */
+#include "vtr_log.h"
+#include "vtr_time.h"
+
+/* Headers from openfpga util library */
+#include "openfpga_binary_archive.h"
+#include "openfpga_digest.h"
+
+/* Headers from name manager library */
+#include "name_map_bin_constants.h"
+#include "name_map_bin_utils.h"
+#include "write_bin_io_name_map.h"
+#include "write_xml_io_name_map.h"
+
+namespace openfpga {  // Begin namespace openfpga
+
+/********************************************************************
+ * A writer to output I/O naming rules to binary format
+ *
+ * Return 0 if successful
+ * Return 2 if fail when creating files
+ *******************************************************************/
+int write_bin_io_name_map(const char* fname, const IoNameMap& io_name_map) {
+  vtr::ScopedStartFinishTimer timer("Write I/O naming rules in binary");
+
+  /* Create a file handler */
+  std::fstream fp;
+  /* Open the file stream */
+  fp.open(std::string(fname),
+          std::fstream::out | std::fstream::trunc | std::fstream::binary);
+
+  /* Validate the file stream */
+  openfpga::check_file_stream(fname, fp);
+
+  BinaryWriter writer(fp);
+  writer(BIN_IO_NAME_MAP_MAGIC, BIN_IO_NAME_MAP_VERSION);
+
+  std::vector<BasicPort> fpga_top_ports = io_name_map.fpga_top_ports();
+  writer(uint64_t(fpga_top_ports.size()));
+  for (const BasicPort& fpga_top_port : fpga_top_ports) {
+    if (io_name_map.fpga_top_port_is_dummy(fpga_top_port)) {
+      writer(
+        fpga_top_port, uint64_t(1),
+        uint64_t(io_name_map.fpga_top_dummy_port_direction(fpga_top_port)));
+    } else {
+      writer(fpga_top_port, uint64_t(0),
+             io_name_map.fpga_core_port(fpga_top_port));
+    }
+  }
+
+  if (false == openfpga::valid_file_stream(fp)) {
+    VTR_LOG_ERROR("Fail to write I/O naming rules to file '%s'!\n", fname);
+    return 2;
+  }
+
+  /* Close the file stream */
+  fp.close();
+
+  return 0;
+}
+
+/********************************************************************
+ * Write I/O naming rules in the format indicated by the file extension
+ *******************************************************************/
+int write_io_name_map(const char* fname, const IoNameMap& io_name_map) {
+  if (is_bin_name_map_file(std::string(fname))) {
+    return write_bin_io_name_map(fname, io_name_map);
+  }
+  return write_xml_io_name_map(fname, io_name_map);
+}
+
+}  // End of namespace openfpga
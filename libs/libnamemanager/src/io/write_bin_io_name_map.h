@@ -0,0 +1,21 @@
+#ifndef WRITE_BIN_IO_NAME_MAP_H
+#define WRITE_BIN_IO_NAME_MAP_H
+
+/********************************************************************
+ * Include header files that are required by function declaration
+ *******************************************************************/
+#include "io_name_map.h"
+
+/********************************************************************
+ * Function declaration
+ *******************************************************************/
+namespace openfpga {  // Begin namespace openfpga
+
+int write_bin_io_name_map(const char* fname, const IoNameMap& io_name_map);
+
+/* Write an I/O name map to either a binary file or an XML file */
+int write_io_name_map(const char* fname, const IoNameMap& io_name_map);
+
+}  // End of namespace openfpga
+
+#endif
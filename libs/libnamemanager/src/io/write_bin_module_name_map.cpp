@@ -0,0 +1,89 @@
+/********************************************************************
+ * This file includes functions that outputs module naming rules to a
+ * binary file. See the layout in name_map_bin_constants.h
+ *******************************************************************/
+/* Headers from system goes first */
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+/* Headers from vtr util library */
+#include "vtr_log.h"
+#include "vtr_time.h"
+
+/* Headers from openfpga util library */
+#include "openfpga_binary_archive.h"
+#include "openfpga_digest.h"
+
+/* Headers from name manager library */
+#include "name_map_bin_constants.h"
+#include "name_map_bin_utils.h"
+#include "write_bin_module_name_map.h"
+#include "write_xml_module_name_map.h"
+
+namespace openfpga {  // Begin namespace openfpga
+
+/********************************************************************
+ * A writer to output module naming rules to binary format
+ *
+ * Return 0 if successful
+ * Return 1 if there are more serious bugs in the architecture
+ * Return 2 if fail when creating files
+ *******************************************************************/
+int write_bin_module_name_map(const char* fname,
+                              const ModuleNameMap& module_name_map,
+                              const bool& verbose) {
+  vtr::ScopedStartFinishTimer timer("Write module renaming rules in binary");
+
+  /* Create a file handler */
+  std::fstream fp;
+  /* Open the file stream */
+  fp.open(std::string(fname),
+          std::fstream::out | std::fstream::trunc | std::fstream::binary);
+
+  /* Validate the file stream */
+  openfpga::check_file_stream(fname, fp);
+
+  BinaryWriter writer(fp);
+  writer(BIN_MODULE_NAME_MAP_MAGIC, BIN_MODULE_NAME_MAP_VERSION);
+
+  std::vector<std::string> built_in_names = module_name_map.tags();
+  writer(uint64_t(built_in_names.size()));
+  for (const std::string& built_in_name : built_in_names) {
+    std::string given_name = module_name_map.name(built_in_name);
+    if (given_name.empty()) {
+      VTR_LOG_ERROR("Default name '%s' is not mapped to any given name!\n",
+                    built_in_name.c_str());
+      return 1;
+    }
+    writer(built_in_name, given_name);
+  }
+
+  if (false == openfpga::valid_file_stream(fp)) {
+    VTR_LOG_ERROR("Fail to write module renaming rules to file '%s'!\n",
+                  fname);
+    return 2;
+  }
+
+  /* Close the file stream */
+  fp.close();
+
+  VTR_LOGV(verbose, "Outputted %lu naming rules.\n", built_in_names.size());
+
+  return 0;
+}
+
+/********************************************************************
+ * Write module naming rules in the format indicated by the file extension
+ *******************************************************************/
+int write_module_name_map(const char* fname,
+                          const ModuleNameMap& module_name_map,
+                          const bool& include_time_stamp, const bool& verbose) {
+  if (is_bin_name_map_file(std::string(fname))) {
+    return write_bin_module_name_map(fname, module_name_map, verbose);
+  }
+  return write_xml_module_name_map(fname, module_name_map, include_time_stamp,
+                                   verbose);
+}
+
+}  // End of namespace openfpga
@@ -0,0 +1,25 @@
+#ifndef WRITE_BIN_MODULE_NAME_MAP_H
+#define WRITE_BIN_MODULE_NAME_MAP_H
+
+/********************************************************************
+ * Include header files that are required by function declaration
+ *******************************************************************/
+#include "module_name_map.h"
+
+/********************************************************************
+ * Function declaration
+ *******************************************************************/
+namespace openfpga {  // Begin namespace openfpga
+
+int write_bin_module_name_map(const char* fname,
+                              const ModuleNameMap& module_name_map,
+                              const bool& verbose);
+
+/* Write a module name map to either a binary file or an XML file */
+int write_module_name_map(const char* fname,
+                          const ModuleNameMap& module_name_map,
+                          const bool& include_time_stamp, const bool& verbose);
+
+}  // End of namespace openfpga
+
+#endif
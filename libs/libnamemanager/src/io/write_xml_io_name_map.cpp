@@ -53,7 +53,7 @@ static int write_xml_io_map_port(std::fstream& fp, const IoNameMap& io_name_map,
     write_xml_attribute(fp, XML_IO_NAME_MAP_ATTRIBUTE_CORE_NAME,
                         generate_xml_port_name(fpga_core_port).c_str());
   }
-  fp << ">"
+  fp << "/>"
      << "\n";
 
   return 0;
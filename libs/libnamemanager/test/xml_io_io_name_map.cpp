@@ -8,8 +8,9 @@
 #include "vtr_log.h"
 
 /* Headers from readarchopenfpga */
-#include "read_xml_io_name_map.h"
-#include "write_xml_io_name_map.h"
+#include "name_map_bin_utils.h"
+#include "read_bin_io_name_map.h"
+#include "write_bin_io_name_map.h"
 
 int main(int argc, const char** argv) {
   /* Ensure we have only one or two argument */
@@ -17,21 +18,35 @@ int main(int argc, const char** argv) {
 
   int status = 0;
 
-  /* Parse the circuit library from an XML file */
+  /* Parse the circuit library from an XML or a binary file */
   openfpga::IoNameMap io_name_map;
-  status = openfpga::read_xml_io_name_map(argv[1], io_name_map);
+  status = openfpga::read_io_name_map(argv[1], io_name_map);
   if (status != 0) {
     return status;
   }
-  VTR_LOG("Parsed %lu fpga top ports from XML.\n",
+  VTR_LOG("Parsed %lu fpga top ports from file.\n",
           io_name_map.fpga_top_ports().size());
 
-  /* Output the bus group to an XML file
+  /* Output the bus group to an XML or a binary file
    * This is optional only used when there is a second argument
+   * A binary file is read back to be compared with the original rules
    */
   if (3 <= argc) {
-    status = openfpga::write_xml_io_name_map(argv[2], io_name_map);
-    VTR_LOG("Write the I/O name mapping to an XML file: %s.\n", argv[2]);
+    status = openfpga::write_io_name_map(argv[2], io_name_map);
+    VTR_LOG("Write the I/O name mapping to a file: %s.\n", argv[2]);
+    if (0 == status && openfpga::is_bin_name_map_file(argv[2])) {
+      openfpga::IoNameMap readback_name_map;
+      status = openfpga::read_io_name_map(argv[2], readback_name_map);
+      std::vector<openfpga::BasicPort> top_ports = io_name_map.fpga_top_ports();
+      VTR_ASSERT(readback_name_map.fpga_top_ports() == top_ports);
+      for (const openfpga::BasicPort& top_port : top_ports) {
+        VTR_ASSERT(readback_name_map.fpga_core_port(top_port) ==
+                   io_name_map.fpga_core_port(top_port));
+        VTR_ASSERT(readback_name_map.fpga_top_dummy_port_direction(top_port) ==
+                   io_name_map.fpga_top_dummy_port_direction(top_port));
+      }
+      VTR_LOG("Read back the binary file and compared with the rules.\n");
+    }
   }
 
   return status;
@@ -8,8 +8,9 @@
 #include "vtr_log.h"
 
 /* Headers from readarchopenfpga */
-#include "read_xml_module_name_map.h"
-#include "write_xml_module_name_map.h"
+#include "name_map_bin_utils.h"
+#include "read_bin_module_name_map.h"
+#include "write_bin_module_name_map.h"
 
 int main(int argc, const char** argv) {
   /* Ensure we have only one or two argument */
@@ -17,22 +18,32 @@ int main(int argc, const char** argv) {
 
   int status = 0;
 
-  /* Parse the circuit library from an XML file */
+  /* Parse the circuit library from an XML or a binary file */
   openfpga::ModuleNameMap module_name_map;
-  status = openfpga::read_xml_module_name_map(argv[1], module_name_map);
+  status = openfpga::read_module_name_map(argv[1], module_name_map);
   if (status != 0) {
     return status;
   }
-  VTR_LOG("Parsed %lu default names from XML.\n",
+  VTR_LOG("Parsed %lu default names from file.\n",
           module_name_map.tags().size());
 
-  /* Output the bus group to an XML file
+  /* Output the bus group to an XML or a binary file
    * This is optional only used when there is a second argument
+   * A binary file is read back to be compared with the original rules
    */
   if (3 <= argc) {
     status =
-      openfpga::write_xml_module_name_map(argv[2], module_name_map, true, true);
-    VTR_LOG("Write the module name mapping to an XML file: %s.\n", argv[2]);
+      openfpga::write_module_name_map(argv[2], module_name_map, true, true);
+    VTR_LOG("Write the module name mapping to a file: %s.\n", argv[2]);
+    if (0 == status && openfpga::is_bin_name_map_file(argv[2])) {
+      openfpga::ModuleNameMap readback_name_map;
+      status = openfpga::read_module_name_map(argv[2], readback_name_map);
+      VTR_ASSERT(readback_name_map.tags() == module_name_map.tags());
+      for (const std::string& tag : module_name_map.tags()) {
+        VTR_ASSERT(readback_name_map.name(tag) == module_name_map.name(tag));
+      }
+      VTR_LOG("Read back the binary file and compared with the rules.\n");
+    }
   }
 
   return status;
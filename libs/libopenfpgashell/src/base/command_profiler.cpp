@@ -0,0 +1,336 @@
+/*********************************************************************
+ * Member functions for class CommandProfiler
+ ********************************************************************/
+#include "command_profiler.h"
+
+#include <fstream>
+#include <string>
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+#include "command_exit_codes.h"
+#include "vtr_assert.h"
+#include "vtr_log.h"
+#include "vtr_rusage.h"
+
+/* Begin namespace openfpga */
+namespace openfpga {
+
+/*********************************************************************
+ * Internal helpers
+ ********************************************************************/
+/* Find the current resident memory of the process in bytes.
+ * Only available on Linux, 0 is returned on other platforms */
+static size_t get_current_rss() {
+  size_t rss = 0;
+#if defined(__linux__)
+  std::ifstream fp("/proc/self/statm");
+  size_t num_pages = 0;
+  size_t num_resident_pages = 0;
+  if (fp >> num_pages >> num_resident_pages) {
+    rss = num_resident_pages * size_t(sysconf(_SC_PAGESIZE));
+  }
+#endif
+  return rss;
+}
+
+static double cpu_seconds(const std::clock_t& start) {
+  return double(std::clock() - start) / double(CLOCKS_PER_SEC);
+}
+
+static double wall_seconds(
+  const CommandProfiler::wall_clock::time_point& start) {
+  return std::chrono::duration<double>(CommandProfiler::wall_clock::now() -
+                                       start)
+    .count();
+}
+
+static std::string status_to_string(const int& status) {
+  switch (status) {
+    case CMD_EXEC_SUCCESS:
+      return std::string("success");
+    case CMD_EXEC_FATAL_ERROR:
+      return std::string("fatal_error");
+    case CMD_EXEC_MINOR_ERROR:
+      return std::string("minor_error");
+    default:
+      return std::string("running");
+  }
+}
+
+/* Escape a string to be put in a quoted JSON value */
+static std::string escape_json_string(const std::string& str) {
+  std::string escaped;
+  for (const char& c : str) {
+    if (('\"' == c) || ('\\' == c)) {
+      escaped.push_back('\\');
+      escaped.push_back(c);
+    } else if ('\t' == c) {
+      escaped += std::string("\\t");
+    } else if (('\n' == c) || ('\r' == c)) {
+      escaped += std::string("\\n");
+    } else {
+      escaped.push_back(c);
+    }
+  }
+  return escaped;
+}
+
+/* Escape a string to be put in a quoted CSV field */
+static std::string escape_csv_string(const std::string& str) {
+  std::string escaped;
+  for (const char& c : str) {
+    if ('\"' == c) {
+      escaped.push_back('\"');
+    }
+    escaped.push_back(c);
+  }
+  return escaped;
+}
+
+/*********************************************************************
+ * Public constructor
+ ********************************************************************/
+CommandProfiler::CommandProfiler() { reset_flow_timer(); }
+
+/*********************************************************************
+ * Public accessors
+ ********************************************************************/
+CommandProfiler::profile_range CommandProfiler::profiles() const {
+  return vtr::make_range(profile_ids_.begin(), profile_ids_.end());
+}
+
+std::string CommandProfiler::command_name(
+  const CommandProfileId& profile_id) const {
+  VTR_ASSERT(valid_profile_id(profile_id));
+  return command_names_[profile_id];
+}
+
+std::string CommandProfiler::command_line(
+  const CommandProfileId& profile_id) const {
+  VTR_ASSERT(valid_profile_id(profile_id));
+  return command_lines_[profile_id];
+}
+
+CommandProfileId CommandProfiler::parent(
+  const CommandProfileId& profile_id) const {
+  VTR_ASSERT(valid_profile_id(profile_id));
+  return parents_[profile_id];
+}
+
+size_t CommandProfiler::depth(const CommandProfileId& profile_id) const {
+  VTR_ASSERT(valid_profile_id(profile_id));
+  return depths_[profile_id];
+}
+
+bool CommandProfiler::finished(const CommandProfileId& profile_id) const {
+  VTR_ASSERT(valid_profile_id(profile_id));
+  return CMD_EXEC_NONE != statuses_[profile_id];
+}
+
+int CommandProfiler::status(const CommandProfileId& profile_id) const {
+  VTR_ASSERT(valid_profile_id(profile_id));
+  return statuses_[profile_id];
+}
+
+double CommandProfiler::wall_time(const CommandProfileId& profile_id) const {
+  if (!finished(profile_id)) {
+    return wall_seconds(wall_starts_[profile_id]);
+  }
+  return wall_times_[profile_id];
+}
+
+double CommandProfiler::cpu_time(const CommandProfileId& profile_id) const {
+  if (!finished(profile_id)) {
+    return cpu_seconds(cpu_starts_[profile_id]);
+  }
+  return cpu_times_[profile_id];
+}
+
+size_t CommandProfiler::peak_rss(const CommandProfileId& profile_id) const {
+  if (!finished(profile_id)) {
+    return vtr::get_max_rss();
+  }
+  return peak_rss_[profile_id];
+}
+
+long long CommandProfiler::delta_rss(const CommandProfileId& profile_id) const {
+  if (!finished(profile_id)) {
+    return (long long)get_current_rss() - (long long)rss_starts_[profile_id];
+  }
+  return delta_rss_[profile_id];
+}
+
+double CommandProfiler::flow_wall_time() const {
+  return wall_seconds(flow_wall_start_);
+}
+
+double CommandProfiler::flow_cpu_time() const {
+  return cpu_seconds(flow_cpu_start_);
+}
+
+std::string CommandProfiler::output_file() const { return output_file_; }
+
+/*********************************************************************
+ * Public mutators
+ ********************************************************************/
+CommandProfileId CommandProfiler::start(const std::string& cmd_name,
+                                        const std::string& cmd_line) {
+  CommandProfileId profile_id = CommandProfileId(profile_ids_.size());
+  profile_ids_.push_back(profile_id);
+  command_names_.push_back(cmd_name);
+  command_lines_.push_back(cmd_line);
+  if (active_profiles_.empty()) {
+    parents_.push_back(CommandProfileId::INVALID());
+  } else {
+    parents_.push_back(active_profiles_.back());
+  }
+  depths_.push_back(active_profiles_.size());
+  statuses_.push_back(CMD_EXEC_NONE);
+
+  wall_times_.push_back(0.);
+  cpu_times_.push_back(0.);
+  peak_rss_.push_back(0);
+  delta_rss_.push_back(0);
+
+  active_profiles_.push_back(profile_id);
+
+  /* Sample the clocks in the end so that the bookkeeping is not counted */
+  rss_starts_.push_back(get_current_rss());
+  cpu_starts_.push_back(std::clock());
+  wall_starts_.push_back(wall_clock::now());
+
+  return profile_id;
+}
+
+void CommandProfiler::finish(const CommandProfileId& profile_id,
+                             const int& status) {
+  VTR_ASSERT(valid_profile_id(profile_id));
+  VTR_ASSERT(!active_profiles_.empty());
+  VTR_ASSERT(profile_id == active_profiles_.back());
+
+  wall_times_[profile_id] = wall_seconds(wall_starts_[profile_id]);
+  cpu_times_[profile_id] = cpu_seconds(cpu_starts_[profile_id]);
+  peak_rss_[profile_id] = vtr::get_max_rss();
+  delta_rss_[profile_id] =
+    (long long)get_current_rss() - (long long)rss_starts_[profile_id];
+  statuses_[profile_id] = status;
+
+  active_profiles_.pop_back();
+}
+
+void CommandProfiler::reset_flow_timer() {
+  flow_wall_start_ = wall_clock::now();
+  flow_cpu_start_ = std::clock();
+}
+
+void CommandProfiler::set_output_file(const std::string& fname) {
+  output_file_ = fname;
+}
+
+/*********************************************************************
+ * Public writers
+ ********************************************************************/
+void CommandProfiler::print_report() const {
+  constexpr double MB = 1024. * 1024.;
+
+  VTR_LOG("Profile of %lu commands:\n", profile_ids_.size());
+  VTR_LOG("%-40s %12s %12s %14s %15s %12s\n", "Command", "Wall (s)",
+          "CPU (s)", "Peak RSS (MB)", "Delta RSS (MB)", "Status");
+  for (const CommandProfileId& profile_id : profiles()) {
+    /* Nested commands are indented under their callers */
+    std::string name = std::string(2 * depth(profile_id), ' ') +
+                       command_name(profile_id);
+    VTR_LOG("%-40s %12.3f %12.3f %14.1f %15.1f %12s\n", name.c_str(),
+            wall_time(profile_id), cpu_time(profile_id),
+            peak_rss(profile_id) / MB, delta_rss(profile_id) / MB,
+            status_to_string(status(profile_id)).c_str());
+  }
+  VTR_LOG("Total: %g seconds (wall clock), %g seconds (CPU)\n",
+          flow_wall_time(), flow_cpu_time());
+}
+
+int CommandProfiler::write_to_file(const std::string& fname) const {
+  std::fstream fp;
+  fp.open(fname, std::fstream::out | std::fstream::trunc);
+  if (!fp.is_open()) {
+    VTR_LOG_ERROR("Fail to open file '%s' to output command profiles!\n",
+                  fname.c_str());
+    return 1;
+  }
+
+  std::string::size_type ext_pos = fname.find_last_of('.');
+  if ((std::string::npos != ext_pos) &&
+      (std::string(".csv") == fname.substr(ext_pos))) {
+    write_csv(fp);
+  } else {
+    write_json(fp);
+  }
+  fp.close();
+
+  VTR_LOG("Output %lu command profiles to file '%s'\n", profile_ids_.size(),
+          fname.c_str());
+  return 0;
+}
+
+/*********************************************************************
+ * Internal writers
+ ********************************************************************/
+void CommandProfiler::write_csv(std::ostream& fp) const {
+  fp << "id,parent,depth,command,command_line,wall_time_sec,cpu_time_sec,"
+     << "peak_rss_bytes,delta_rss_bytes,status\n";
+  for (const CommandProfileId& profile_id : profiles()) {
+    fp << size_t(profile_id) << ",";
+    if (parent(profile_id)) {
+      fp << size_t(parent(profile_id));
+    }
+    fp << "," << depth(profile_id) << "," << command_name(profile_id) << ",\""
+       << escape_csv_string(command_line(profile_id)) << "\","
+       << wall_time(profile_id) << "," << cpu_time(profile_id) << ","
+       << peak_rss(profile_id) << "," << delta_rss(profile_id) << ","
+       << status_to_string(status(profile_id)) << "\n";
+  }
+}
+
+void CommandProfiler::write_json(std::ostream& fp) const {
+  fp << "{\n";
+  fp << "  \"wall_time_sec\": " << flow_wall_time() << ",\n";
+  fp << "  \"cpu_time_sec\": " << flow_cpu_time() << ",\n";
+  fp << "  \"commands\": [";
+  bool first = true;
+  for (const CommandProfileId& profile_id : profiles()) {
+    fp << (first ? "\n" : ",\n");
+    first = false;
+    fp << "    {\"id\": " << size_t(profile_id) << ", \"parent\": ";
+    if (parent(profile_id)) {
+      fp << size_t(parent(profile_id));
+    } else {
+      fp << "null";
+    }
+    fp << ", \"depth\": " << depth(profile_id) << ", \"command\": \""
+       << escape_json_string(command_name(profile_id))
+       << "\", \"command_line\": \""
+       << escape_json_string(command_line(profile_id))
+       << "\", \"wall_time_sec\": " << wall_time(profile_id)
+       << ", \"cpu_time_sec\": " << cpu_time(profile_id)
+       << ", \"peak_rss_bytes\": " << peak_rss(profile_id)
+       << ", \"delta_rss_bytes\": " << delta_rss(profile_id)
+       << ", \"status\": \"" << status_to_string(status(profile_id))
+       << "\"}";
+  }
+  fp << "\n  ]\n";
+  fp << "}\n";
+}
+
+/*********************************************************************
+ * Public validators
+ ********************************************************************/
+bool CommandProfiler::valid_profile_id(
+  const CommandProfileId& profile_id) const {
+  return (size_t(profile_id) < profile_ids_.size()) &&
+         (profile_id == profile_ids_[profile_id]);
+}
+
+} /* End namespace openfpga */
@@ -0,0 +1,119 @@
+#ifndef COMMAND_PROFILER_H
+#define COMMAND_PROFILER_H
+
+#include <chrono>
+#include <ctime>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "shell_fwd.h"
+#include "vtr_range.h"
+#include "vtr_vector.h"
+
+/* Begin namespace openfpga */
+namespace openfpga {
+
+/*********************************************************************
+ * Data structure to record the runtime and memory usage of the commands
+ * executed in a shell
+ *
+ * - Each execution of a command creates a profile. A command executed
+ *   several times has several profiles
+ * - A command executed by another command, e.g., through 'source', is
+ *   nested under the caller. The parent of a top-level profile is invalid
+ * - Both the wall-clock time and the CPU time are recorded. The peak RSS
+ *   is the high-water mark of the process when the command finishes, while
+ *   the delta RSS is the change of the resident memory during the command
+ * - A profile which is not finished yet, e.g., the caller of the current
+ *   command, reports the time and memory up to now
+ ********************************************************************/
+class CommandProfiler {
+ public: /* Types */
+  typedef vtr::vector<CommandProfileId, CommandProfileId>::const_iterator
+    profile_iterator;
+  typedef vtr::Range<profile_iterator> profile_range;
+  typedef std::chrono::steady_clock wall_clock;
+
+ public: /* Constructor */
+  CommandProfiler();
+
+ public: /* Public accessors */
+  profile_range profiles() const;
+  std::string command_name(const CommandProfileId& profile_id) const;
+  std::string command_line(const CommandProfileId& profile_id) const;
+  CommandProfileId parent(const CommandProfileId& profile_id) const;
+  size_t depth(const CommandProfileId& profile_id) const;
+  bool finished(const CommandProfileId& profile_id) const;
+  /* Exit code of the command, CMD_EXEC_NONE if not finished */
+  int status(const CommandProfileId& profile_id) const;
+  /* Runtime in seconds */
+  double wall_time(const CommandProfileId& profile_id) const;
+  double cpu_time(const CommandProfileId& profile_id) const;
+  /* Memory usage in bytes */
+  size_t peak_rss(const CommandProfileId& profile_id) const;
+  long long delta_rss(const CommandProfileId& profile_id) const;
+  /* Runtime in seconds since the timer of the flow is reset */
+  double flow_wall_time() const;
+  double flow_cpu_time() const;
+  /* File to output the profiles when the shell finishes */
+  std::string output_file() const;
+
+ public: /* Public mutators */
+  /* Start profiling a command, return the id of the new profile */
+  CommandProfileId start(const std::string& cmd_name,
+                         const std::string& cmd_line);
+  /* Finish profiling a command with its exit code. The profile must be the
+   * latest started one which is not finished yet */
+  void finish(const CommandProfileId& profile_id, const int& status);
+  /* Reset the timer of the whole flow */
+  void reset_flow_timer();
+  void set_output_file(const std::string& fname);
+
+ public: /* Public writers */
+  /* Print all the profiles in a table */
+  void print_report() const;
+  /* Output all the profiles to a file. The format is CSV if the file
+   * extension is '.csv', otherwise JSON. Return 0 when succeed */
+  int write_to_file(const std::string& fname) const;
+
+ public: /* Public validators */
+  bool valid_profile_id(const CommandProfileId& profile_id) const;
+
+ private: /* Internal writers */
+  void write_csv(std::ostream& fp) const;
+  void write_json(std::ostream& fp) const;
+
+ private: /* Internal data */
+  vtr::vector<CommandProfileId, CommandProfileId> profile_ids_;
+  vtr::vector<CommandProfileId, std::string> command_names_;
+  vtr::vector<CommandProfileId, std::string> command_lines_;
+  vtr::vector<CommandProfileId, CommandProfileId> parents_;
+  vtr::vector<CommandProfileId, size_t> depths_;
+  vtr::vector<CommandProfileId, int> statuses_;
+
+  /* Time and memory when a command starts */
+  vtr::vector<CommandProfileId, wall_clock::time_point> wall_starts_;
+  vtr::vector<CommandProfileId, std::clock_t> cpu_starts_;
+  vtr::vector<CommandProfileId, size_t> rss_starts_;
+
+  /* Time and memory when a command finishes */
+  vtr::vector<CommandProfileId, double> wall_times_;
+  vtr::vector<CommandProfileId, double> cpu_times_;
+  vtr::vector<CommandProfileId, size_t> peak_rss_;
+  vtr::vector<CommandProfileId, long long> delta_rss_;
+
+  /* Profiles which are started but not finished yet, the last one is the
+   * innermost command */
+  std::vector<CommandProfileId> active_profiles_;
+
+  /* Timer of the whole flow */
+  wall_clock::time_point flow_wall_start_;
+  std::clock_t flow_cpu_start_;
+
+  std::string output_file_;
+};
+
+} /* End namespace openfpga */
+
+#endif
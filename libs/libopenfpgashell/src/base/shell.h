@@ -1,14 +1,15 @@
 #pragma once
 
-#include <ctime>
 #include <functional>
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "command.h"
 #include "command_context.h"
 #include "command_exit_codes.h"
+#include "command_profiler.h"
 #include "shell_fwd.h"
 #include "vtr_range.h"
 #include "vtr_vector.h"
@@ -104,6 +105,8 @@ class Shell {
     const ShellCommandId& cmd_id) const;
   std::vector<ShellCommandId> commands_by_class(
     const ShellCommandClassId& cmd_class_id) const;
+  /* Runtime and memory usage of the commands executed so far */
+  const CommandProfiler& profiler() const;
 
  public: /* Public mutators */
   void set_name(const char* name);
@@ -183,6 +186,8 @@ class Shell {
     const ShellCommandId& cmd_id,
     const std::vector<ShellCommandId>& cmd_dependency);
   ShellCommandClassId add_command_class(const char* name);
+  /* Output the command profiles to a file when the shell finishes */
+  void set_profile_output(const std::string& fname);
 
  public: /* Public validators */
   bool valid_command_id(const ShellCommandId& cmd_id) const;
@@ -192,18 +197,31 @@ class Shell {
   /* Start the interactive mode, where users will type-in command by command */
   void run_interactive_mode(T& context, const bool& quiet_mode = false);
   /* Start the script mode, where users provide a file which includes all the
-   * commands to run */
-  void run_script_mode(const char* script_file_name, T& context,
-                       const bool& batch_mode = false);
+   * commands to run. Return CMD_EXEC_FATAL_ERROR if the script file can not
+   * be opened or a command has fatal errors, otherwise CMD_EXEC_SUCCESS */
+  int run_script_mode(const char* script_file_name, T& context,
+                      const bool& batch_mode = false);
   /* Start the execute mode, where users provide command lines separated by
    * ';' and the shell executes them sequentially */
   void run_execute_mode(const char* command_lines, T& context);
+  /* Start the fork mode, where the common script is executed once and each of
+   * the design scripts is then executed in a child process forked from the
+   * shell. The children start from a copy-on-write snapshot of the context
+   * built by the common script, so that the design-independent data is not
+   * rebuilt for every design. At most num_jobs children run at the same time.
+   * Return the number of design scripts which fail */
+  size_t run_fork_mode(const char* common_script_file_name,
+                       const std::vector<std::string>& design_script_file_names,
+                       T& context, const size_t& num_jobs = 1);
   /* Print all the commands by their classes. This is actually the help desk */
   void print_commands(const bool& show_hidden = false) const;
   /* Find the exit code (assume quit shell now) */
   int exit_code() const;
   /* Show statistics of errors during command execution */
   int execution_errors() const;
+  /* Output the command profiles to the file set by set_profile_output(), if
+   * any. Return 0 when succeed */
+  int write_profile() const;
   /* Quit the shell */
   void exit(const int& init_err = 0) const;
   /* Execute a command, the command line is the user's input to launch a command
@@ -214,6 +232,13 @@ class Shell {
   int execute_command(const char* cmd_line, T& common_context,
                       const bool& allow_hidden_command = true);
 
+ private: /* Private executors */
+  /* Parse the options of a command and execute it. The command line has been
+   * split into tokens, where the first token is the command name */
+  int execute_command_tokens(const ShellCommandId& cmd_id,
+                             const std::vector<std::string>& tokens,
+                             T& common_context);
+
  private: /* Internal data */
   /* Name of the shell, this will appear in the interactive mode */
   std::string name_;
@@ -298,8 +323,11 @@ class Shell {
     commands_by_classes_;
   std::vector<std::string> commands4autocomplete_;
 
-  /* Timer */
-  std::clock_t time_start_;
+  /* Runtime and memory usage of each executed command, including the timer
+   * of the whole flow. It is shared by the copies of the shell, because
+   * built-in commands like 'exit' and 'help' capture a snapshot of the shell
+   */
+  std::shared_ptr<CommandProfiler> profiler_;
 };
 
 } /* End namespace openfpga */
@@ -3,8 +3,16 @@
  ********************************************************************/
 #include <fstream>
 #include <algorithm>
+#include <cerrno>
+#include <cstdio>
 #include <cstring>
 
+#if !(defined(_WIN32) || defined(WIN32))
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 /* Headers from vtrutil library */
 #include "vtr_log.h"
 #include "vtr_assert.h"
@@ -28,7 +36,7 @@ namespace openfpga {
 template<class T>
 Shell<T>::Shell() {
   name_ = std::string("shell_no_name");
-  time_start_ = 0;
+  profiler_ = std::make_shared<CommandProfiler>();
 }
 
 /************************************************************************
@@ -101,6 +109,11 @@ std::vector<ShellCommandId> Shell<T>::commands_by_class(const ShellCommandClassI
   return commands_by_classes_[cmd_class_id];
 }
 
+template<class T>
+const CommandProfiler& Shell<T>::profiler() const {
+  return *profiler_;
+}
+
 /************************************************************************
  * Public mutators
  ***********************************************************************/
@@ -263,6 +276,11 @@ ShellCommandClassId Shell<T>::add_command_class(const char* name) {
   return cmd_class;
 } 
 
+template<class T>
+void Shell<T>::set_profile_output(const std::string& fname) {
+  profiler_->set_output_file(fname);
+}
+
 /************************************************************************
  * Public executors
  ***********************************************************************/
@@ -270,7 +288,7 @@ template <class T>
 void Shell<T>::run_interactive_mode(T& context, const bool& quiet_mode) {
   if (false == quiet_mode) {
     /* Reset timer since it does not come from another mode */
-    time_start_ = std::clock();
+    profiler_->reset_flow_timer();
 
     VTR_LOG("Start interactive mode of %s...\n",
             name().c_str());
@@ -298,11 +316,11 @@ void Shell<T>::run_interactive_mode(T& context, const bool& quiet_mode) {
 }
 
 template <class T>
-void Shell<T>::run_script_mode(const char* script_file_name,
-                               T& context,
-                               const bool& batch_mode) {
+int Shell<T>::run_script_mode(const char* script_file_name,
+                              T& context,
+                              const bool& batch_mode) {
 
-  time_start_ = std::clock();
+  profiler_->reset_flow_timer();
 
   VTR_LOG("Reading script file %s...\n", script_file_name);
 
@@ -318,9 +336,10 @@ void Shell<T>::run_script_mode(const char* script_file_name,
 
   if (!fp.is_open()) {
     /* Fail to open the file, ask user to check */
-    VTR_LOG("Fail to open the script file: %s! Please check its location\n",
-            script_file_name);
-    return; 
+    VTR_LOG_ERROR(
+      "Fail to open the script file: %s! Please check its location\n",
+      script_file_name);
+    return CMD_EXEC_FATAL_ERROR;
   }
 
   /* Consider that each line may not end due to the continued line charactor 
@@ -328,6 +347,8 @@ void Shell<T>::run_script_mode(const char* script_file_name,
    */
   std::string cmd_line;
 
+  int script_status = CMD_EXEC_SUCCESS;
+
   /* Read line by line */
   while (getline(fp, line)) {
     /* Skip empty line */
@@ -389,6 +410,7 @@ void Shell<T>::run_script_mode(const char* script_file_name,
        * if fatal error happened, we should abort immediately 
        */
       if (CMD_EXEC_FATAL_ERROR == status) {
+        script_status = CMD_EXEC_FATAL_ERROR;
         VTR_LOG("Fatal error occurred!\n");
         /* If in the batch mode, we will exit with errors */ 
         VTR_LOGV(batch_mode, "%s Abort\n", name_.c_str());
@@ -407,11 +429,13 @@ void Shell<T>::run_script_mode(const char* script_file_name,
   if (!batch_mode) {
     run_interactive_mode(context, true); 
   }
+
+  return script_status;
 }
 
 template <class T>
 void Shell<T>::run_execute_mode(const char* command_lines, T& context) {
-  time_start_ = std::clock();
+  profiler_->reset_flow_timer();
 
   /* Print the title of the shell */
   if (!title().empty()) {
@@ -451,6 +475,156 @@ void Shell<T>::run_execute_mode(const char* command_lines, T& context) {
   }
 }
 
+template <class T>
+size_t Shell<T>::run_fork_mode(
+  const char* common_script_file_name,
+  const std::vector<std::string>& design_script_file_names, T& context,
+  const size_t& num_jobs) {
+  /* Build the design-independent data once in the shell process. Any fatal
+   * error here aborts the shell, as the batch mode does. A missing common
+   * script is not a command error, so its status is checked as well */
+  int common_status = run_script_mode(common_script_file_name, context, true);
+  if ((CMD_EXEC_SUCCESS != common_status) || (0 != exit_code())) {
+    VTR_LOG_ERROR(
+      "Common script '%s' has errors! Skip all the %lu design scripts\n",
+      common_script_file_name, design_script_file_names.size());
+    return design_script_file_names.size();
+  }
+
+#if defined(_WIN32) || defined(WIN32)
+  VTR_LOG_ERROR("Fork mode is not supported on this platform!\n");
+  return design_script_file_names.size();
+#else
+  size_t num_workers = std::max(num_jobs, size_t(1));
+  /* Map from the running child processes to their design scripts */
+  std::map<pid_t, size_t> running_children;
+  size_t num_failures = 0;
+  size_t next_design = 0;
+
+  /* The outputs of each child are buffered in a temporary file, and printed
+   * in the order of the design scripts once the child finishes, so that the
+   * outputs of concurrent children do not interleave */
+  std::vector<std::FILE*> child_logs(design_script_file_names.size(), nullptr);
+  std::vector<bool> design_finished(design_script_file_names.size(), false);
+  std::vector<bool> design_succeeded(design_script_file_names.size(), false);
+  size_t next_design_to_print = 0;
+  auto print_finished_designs = [&]() {
+    while ((next_design_to_print < design_script_file_names.size()) &&
+           (design_finished[next_design_to_print])) {
+      const std::string& design_script =
+        design_script_file_names[next_design_to_print];
+      std::FILE* child_log = child_logs[next_design_to_print];
+      if (nullptr != child_log) {
+        VTR_LOG("\n===== Outputs of design script '%s' =====\n",
+                design_script.c_str());
+        std::rewind(child_log);
+        char buffer[4096];
+        size_t num_read = 0;
+        while (0 < (num_read = std::fread(buffer, 1, sizeof(buffer) - 1,
+                                          child_log))) {
+          buffer[num_read] = '\0';
+          VTR_LOG("%s", buffer);
+        }
+        std::fclose(child_log);
+        child_logs[next_design_to_print] = nullptr;
+      }
+      if (design_succeeded[next_design_to_print]) {
+        VTR_LOG("Design script '%s' succeeded\n", design_script.c_str());
+      } else {
+        VTR_LOG_ERROR("Design script '%s' failed\n", design_script.c_str());
+      }
+      next_design_to_print++;
+    }
+  };
+
+  while ((next_design < design_script_file_names.size()) ||
+         (!running_children.empty())) {
+    /* Launch as many children as allowed */
+    while ((next_design < design_script_file_names.size()) &&
+           (running_children.size() < num_workers)) {
+      const size_t curr_design = next_design;
+      const std::string& design_script = design_script_file_names[curr_design];
+      next_design++;
+      if (!std::ifstream(design_script).is_open()) {
+        VTR_LOG_ERROR("Fail to open the design script file: %s!\n",
+                      design_script.c_str());
+        num_failures++;
+        design_finished[curr_design] = true;
+        continue;
+      }
+      /* The file is removed automatically when it is closed */
+      child_logs[curr_design] = std::tmpfile();
+      if (nullptr == child_logs[curr_design]) {
+        VTR_LOG_ERROR("Fail to buffer the outputs of design script '%s': %s\n",
+                      design_script.c_str(), std::strerror(errno));
+        num_failures++;
+        design_finished[curr_design] = true;
+        continue;
+      }
+      /* Flush the buffered outputs, otherwise they are printed by both the
+       * shell and the child */
+      std::fflush(nullptr);
+      pid_t pid = fork();
+      if (0 == pid) {
+        /* Child process: the profile file belongs to the shell process */
+        profiler_->set_output_file(std::string());
+        int child_log_fd = fileno(child_logs[curr_design]);
+        dup2(child_log_fd, STDOUT_FILENO);
+        dup2(child_log_fd, STDERR_FILENO);
+        exit(run_script_mode(design_script.c_str(), context, true));
+      }
+      if (pid < 0) {
+        VTR_LOG_ERROR("Fail to fork a process for design script '%s': %s\n",
+                      design_script.c_str(), std::strerror(errno));
+        num_failures++;
+        design_finished[curr_design] = true;
+      } else {
+        VTR_LOG("Launched process %d for design script '%s'\n", int(pid),
+                design_script.c_str());
+        running_children[pid] = curr_design;
+      }
+    }
+
+    print_finished_designs();
+    if (running_children.empty()) {
+      continue;
+    }
+
+    /* Wait for any of the children to finish */
+    int child_status = 0;
+    pid_t pid = waitpid(-1, &child_status, 0);
+    if (pid < 0) {
+      if (EINTR == errno) {
+        continue;
+      }
+      VTR_LOG_ERROR("Fail to wait for the child processes: %s\n",
+                    std::strerror(errno));
+      num_failures += running_children.size();
+      for (const auto& child : running_children) {
+        design_finished[child.second] = true;
+      }
+      break;
+    }
+    auto child = running_children.find(pid);
+    if (child == running_children.end()) {
+      continue;
+    }
+    design_finished[child->second] = true;
+    if (WIFEXITED(child_status) && (0 == WEXITSTATUS(child_status))) {
+      design_succeeded[child->second] = true;
+    } else {
+      num_failures++;
+    }
+    running_children.erase(child);
+  }
+  print_finished_designs();
+
+  VTR_LOG("\nExecuted %lu design scripts with %lu failures\n",
+          design_script_file_names.size(), num_failures);
+  return num_failures;
+#endif
+}
+
 template <class T>
 void Shell<T>::print_commands(const bool& show_hidden) const {
   /* Print the commands by their classes */
@@ -522,6 +696,14 @@ int Shell<T>::execution_errors() const {
   return num_err;
 }
 
+template <class T>
+int Shell<T>::write_profile() const {
+  if (profiler_->output_file().empty()) {
+    return 0;
+  }
+  return profiler_->write_to_file(profiler_->output_file());
+}
+
 template <class T>
 void Shell<T>::exit(const int& init_err) const {
   /* Check all the command status, if we see fatal errors or minor errors, we drop an error code */
@@ -537,9 +719,12 @@ void Shell<T>::exit(const int& init_err) const {
   VTR_LOG("\nFinish execution with %d errors\n",
             num_err);
 
-  VTR_LOG("\nThe entire %s flow took %g seconds\n",
+  VTR_LOG("\nThe entire %s flow took %g seconds (wall clock), %g seconds (CPU)\n",
           name_.c_str(),
-          (double)(std::clock() - time_start_) / (double)CLOCKS_PER_SEC);
+          profiler_->flow_wall_time(),
+          profiler_->flow_cpu_time());
+
+  write_profile();
 
   VTR_LOG("\nThank you for using %s!\n",
           name().c_str());
@@ -604,6 +789,18 @@ int Shell<T>::execute_command(const char* cmd_line,
     } 
   }
 
+  /* Profile the command, including the parsing of its options */
+  CommandProfileId profile_id = profiler_->start(commands_[cmd_id].name(), std::string(cmd_line));
+  int status = execute_command_tokens(cmd_id, tokens, common_context);
+  profiler_->finish(profile_id, status);
+
+  return status;
+}
+
+template <class T>
+int Shell<T>::execute_command_tokens(const ShellCommandId& cmd_id,
+                                     const std::vector<std::string>& tokens,
+                                     T& common_context) {
   /* Find the command! Parse the options 
    * Note:
    * Macro command will not be parsed! It will be directly executed
@@ -11,9 +11,11 @@ namespace openfpga {
  ********************************************************************/
 struct shell_command_id_tag;
 struct shell_command_class_id_tag;
+struct command_profile_id_tag;
 
 typedef vtr::StrongId<shell_command_id_tag> ShellCommandId;
 typedef vtr::StrongId<shell_command_class_id_tag> ShellCommandClassId;
+typedef vtr::StrongId<command_profile_id_tag> CommandProfileId;
 
 } /* End namespace openfpga */
 
@@ -0,0 +1,173 @@
+/********************************************************************
+ * Test the command profiler of the shell by executing a few commands
+ * and checking that each of them is reported by 'report_profile'
+ *
+ * Usage: test_command_profiler <profile_file>
+ * The profile file is in CSV format if its extension is '.csv',
+ * otherwise in JSON format
+ *******************************************************************/
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "command_exit_codes.h"
+#include "shell.h"
+#include "vtr_log.h"
+
+using namespace openfpga;
+
+class ShellContext {
+ public:
+  int a;
+};
+
+static int shell_execute_set(ShellContext& context, const Command& cmd,
+                             const CommandContext& cmd_context) {
+  CommandOptionId opt_id = cmd.option("value");
+  context.a = std::atoi(cmd_context.option_value(cmd, opt_id).c_str());
+
+  return CMD_EXEC_SUCCESS;
+}
+
+static int shell_execute_print(ShellContext& context) {
+  VTR_LOG("a=%d\n", context.a);
+
+  return CMD_EXEC_SUCCESS;
+}
+
+static int shell_execute_report_profile(Shell<ShellContext>* shell,
+                                        ShellContext& /*context*/,
+                                        const Command& cmd,
+                                        const CommandContext& cmd_context) {
+  CommandOptionId opt_file = cmd.option("file");
+  if (cmd_context.option_enable(cmd, opt_file)) {
+    return shell->profiler().write_to_file(
+      cmd_context.option_value(cmd, opt_file));
+  }
+  shell->profiler().print_report();
+
+  return CMD_EXEC_SUCCESS;
+}
+
+/********************************************************************
+ * Count the finished profiles of a command in the profiler
+ *******************************************************************/
+static size_t count_finished_profiles(const CommandProfiler& profiler,
+                                      const std::string& cmd_name) {
+  size_t num_profiles = 0;
+  for (const CommandProfileId& profile_id : profiler.profiles()) {
+    if (cmd_name == profiler.command_name(profile_id) &&
+        profiler.finished(profile_id) &&
+        CMD_EXEC_SUCCESS == profiler.status(profile_id)) {
+      ++num_profiles;
+    }
+  }
+  return num_profiles;
+}
+
+/********************************************************************
+ * Count the rows of a command in a profile file
+ *******************************************************************/
+static size_t count_profile_file_rows(const std::string& fname,
+                                      const std::string& cmd_name) {
+  std::ifstream fp(fname);
+  std::string pattern;
+  if (fname.size() >= 4 && fname.substr(fname.size() - 4) == ".csv") {
+    pattern = "," + cmd_name + ",";
+  } else {
+    pattern = "\"command\": \"" + cmd_name + "\"";
+  }
+
+  size_t num_rows = 0;
+  std::string line;
+  while (std::getline(fp, line)) {
+    if (std::string::npos != line.find(pattern)) {
+      ++num_rows;
+    }
+  }
+  return num_rows;
+}
+
+int main(int argc, char** argv) {
+  if (2 != argc) {
+    VTR_LOG("Usage: %s <profile_file>\n", argv[0]);
+    return 1;
+  }
+  std::string profile_fname(argv[1]);
+
+  Shell<ShellContext> shell;
+  shell.set_name("test_command_profiler");
+
+  ShellCommandClassId cmd_class = shell.add_command_class("Basic");
+
+  Command shell_cmd_set("set");
+  CommandOptionId set_opt_value =
+    shell_cmd_set.add_option("value", true, "value of variable");
+  shell_cmd_set.set_option_require_value(set_opt_value, OPT_STRING);
+  ShellCommandId shell_cmd_set_id =
+    shell.add_command(shell_cmd_set, "Set a value to internal variable 'a'");
+  shell.set_command_class(shell_cmd_set_id, cmd_class);
+  shell.set_command_execute_function(shell_cmd_set_id, shell_execute_set);
+
+  Command shell_cmd_print("print");
+  ShellCommandId shell_cmd_print_id = shell.add_command(
+    shell_cmd_print, "Print the value of internal variable 'a'");
+  shell.set_command_class(shell_cmd_print_id, cmd_class);
+  shell.set_command_execute_function(shell_cmd_print_id, shell_execute_print);
+  shell.set_command_dependency(
+    shell_cmd_print_id, std::vector<ShellCommandId>(1, shell_cmd_set_id));
+
+  Command shell_cmd_report_profile("report_profile");
+  CommandOptionId report_profile_opt_file = shell_cmd_report_profile.add_option(
+    "file", false, "output the profiles to a CSV or JSON file");
+  shell_cmd_report_profile.set_option_require_value(report_profile_opt_file,
+                                                    OPT_STRING);
+  ShellCommandId shell_cmd_report_profile_id = shell.add_command(
+    shell_cmd_report_profile, "Report the runtime of executed commands");
+  shell.set_command_class(shell_cmd_report_profile_id, cmd_class);
+  shell.set_command_execute_function(shell_cmd_report_profile_id,
+                                     shell_execute_report_profile);
+
+  ShellContext shell_context;
+
+  /* Execute 'set' twice and 'print' once, then report the profiles */
+  std::vector<std::string> cmd_lines = {
+    "set --value 1", "set --value 2", "print",
+    "report_profile --file " + profile_fname};
+  for (const std::string& cmd_line : cmd_lines) {
+    if (CMD_EXEC_SUCCESS !=
+        shell.execute_command(cmd_line.c_str(), shell_context)) {
+      VTR_LOG_ERROR("Fail to execute command '%s'!\n", cmd_line.c_str());
+      return 1;
+    }
+  }
+
+  /* Each executed command should have a profile, both in the profiler and in
+   * the report. 'report_profile' itself is reported while running */
+  int num_errors = 0;
+  std::vector<std::pair<std::string, size_t>> expected_profiles = {
+    {"set", 2}, {"print", 1}};
+  for (const auto& expected : expected_profiles) {
+    size_t num_profiles =
+      count_finished_profiles(shell.profiler(), expected.first);
+    size_t num_rows = count_profile_file_rows(profile_fname, expected.first);
+    VTR_LOG("Command '%s': %lu profiles, %lu rows in report (expect %lu)\n",
+            expected.first.c_str(), num_profiles, num_rows, expected.second);
+    if (expected.second != num_profiles || expected.second != num_rows) {
+      ++num_errors;
+    }
+  }
+  if (1 != count_profile_file_rows(profile_fname, "report_profile")) {
+    VTR_LOG_ERROR("Command 'report_profile' is not in the report!\n");
+    ++num_errors;
+  }
+
+  if (0 < num_errors) {
+    VTR_LOG_ERROR("Command profiles do not match the executed commands!\n");
+    return 1;
+  }
+  VTR_LOG("Command profiles match the executed commands\n");
+
+  return 0;
+}
@@ -0,0 +1,246 @@
+#ifndef OPENFPGA_BINARY_ARCHIVE_H
+#define OPENFPGA_BINARY_ARCHIVE_H
+
+/********************************************************************
+ * Include header files that are required by data structure declaration
+ *******************************************************************/
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "openfpga_port.h"
+#include "vtr_geometry.h"
+#include "vtr_strong_id.h"
+
+/* namespace openfpga begins */
+namespace openfpga {
+
+/************************************************************************
+ * A pair of archives to dump data structures to a binary stream and to
+ * restore them from the stream, e.g., for caching data which is expensive
+ * to build.
+ *
+ * Both archives are called with a list of values, so that a data structure
+ * only needs a single member function to list its internal data for both
+ * directions:
+ *
+ *   template <class Archive>
+ *   void Foo::serialize(Archive& archive) {
+ *     archive(foo_ids_, foo_names_, foo_lookup_);
+ *   }
+ *
+ * The following types are supported:
+ * - arithmetic and enum types, which are stored as raw bytes
+ * - std::string, BasicPort, vtr::Point and vtr::StrongId
+ * - std::array and std::pair of supported types
+ * - sequences (std::vector, vtr::vector) of supported types
+ * - maps (std::map, std::unordered_map) of supported types
+ * - classes with a serialize(Archive&) member function
+ *
+ * The binary layout depends on the platform and the data structures, which
+ * is fine for caches. Readers should check the header of a stream and
+ * whether the reader is still good() at the end of the stream.
+ ***********************************************************************/
+namespace binary_archive_detail {
+
+template <class T>
+struct is_std_array : std::false_type {};
+template <class T, size_t N>
+struct is_std_array<std::array<T, N>> : std::true_type {};
+
+template <class T>
+struct is_std_pair : std::false_type {};
+template <class T1, class T2>
+struct is_std_pair<std::pair<T1, T2>> : std::true_type {};
+
+template <class T>
+struct is_vtr_point : std::false_type {};
+template <class T>
+struct is_vtr_point<vtr::Point<T>> : std::true_type {};
+
+template <class T>
+struct is_strong_id : std::false_type {};
+template <class Tag, class T, T sentinel>
+struct is_strong_id<vtr::StrongId<Tag, T, sentinel>> : std::true_type {};
+
+/* Maps have mapped types, while sequences can be appended */
+template <class T, class = void>
+struct is_map : std::false_type {};
+template <class T>
+struct is_map<T, std::void_t<typename T::key_type, typename T::mapped_type>>
+  : std::true_type {};
+
+template <class T, class = void>
+struct is_sequence : std::false_type {};
+template <class T>
+struct is_sequence<
+  T, std::void_t<typename T::value_type,
+                 decltype(std::declval<T&>().push_back(
+                   std::declval<typename T::value_type>()))>>
+  : std::true_type {};
+
+}  // namespace binary_archive_detail
+
+class BinaryWriter {
+ public: /* Constructors */
+  explicit BinaryWriter(std::ostream& os) : os_(os) {}
+
+ public: /* Public writers */
+  template <class... Ts>
+  void operator()(const Ts&... values) {
+    (write(values), ...);
+  }
+
+  bool good() const { return os_.good(); }
+
+ private: /* Internal writers */
+  /* Only the data listed by serialize() is archived. Whenever a data member
+   * is added to a serialized class, it must be added to its serialize() too,
+   * otherwise it is silently lost when restored from an archive, e.g., an
+   * architecture cache. Also bump the format version of the archive file */
+  template <class T>
+  void write(const T& value) {
+    using namespace binary_archive_detail;
+    if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>) {
+      os_.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    } else if constexpr (std::is_same_v<T, std::string>) {
+      write(uint64_t(value.size()));
+      os_.write(value.data(), value.size());
+    } else if constexpr (std::is_same_v<T, BasicPort>) {
+      write(value.get_name());
+      write(value.get_lsb());
+      write(value.get_msb());
+      write(value.get_origin_port_width());
+    } else if constexpr (is_vtr_point<T>::value) {
+      write(value.x());
+      write(value.y());
+    } else if constexpr (is_strong_id<T>::value) {
+      write(uint64_t(size_t(value)));
+    } else if constexpr (is_std_array<T>::value) {
+      for (const auto& elem : value) {
+        write(elem);
+      }
+    } else if constexpr (is_std_pair<T>::value) {
+      write(value.first);
+      write(value.second);
+    } else if constexpr (is_map<T>::value) {
+      write(uint64_t(value.size()));
+      for (const auto& pair : value) {
+        write(pair.first);
+        write(pair.second);
+      }
+    } else if constexpr (is_sequence<T>::value) {
+      write(uint64_t(value.size()));
+      /* Convert the elements explicitly for the proxies of vector<bool> */
+      for (const auto& elem : value) {
+        write(static_cast<const typename T::value_type&>(elem));
+      }
+    } else {
+      /* The serialize() of a class is shared by reading and writing */
+      const_cast<T&>(value).serialize(*this);
+    }
+  }
+
+ private: /* Internal data */
+  std::ostream& os_;
+};
+
+class BinaryReader {
+ public: /* Constructors */
+  explicit BinaryReader(std::istream& is) : is_(is) {}
+
+ public: /* Public readers */
+  template <class... Ts>
+  void operator()(Ts&... values) {
+    (read(values), ...);
+  }
+
+  bool good() const { return is_.good(); }
+
+ private: /* Internal readers */
+  /* Containers are filled element by element rather than allocated by the
+   * size in the stream, so that a corrupted stream only fails the reader */
+  size_t read_size() {
+    uint64_t size = 0;
+    read(size);
+    return is_.good() ? size_t(size) : 0;
+  }
+
+  template <class T>
+  void read(T& value) {
+    using namespace binary_archive_detail;
+    if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>) {
+      is_.read(reinterpret_cast<char*>(&value), sizeof(T));
+    } else if constexpr (std::is_same_v<T, std::string>) {
+      value.clear();
+      char buf[4096];
+      for (size_t size = read_size(); 0 < size && is_.good();) {
+        size_t num_chars = std::min(size, sizeof(buf));
+        is_.read(buf, num_chars);
+        value.append(buf, num_chars);
+        size -= num_chars;
+      }
+    } else if constexpr (std::is_same_v<T, BasicPort>) {
+      std::string name;
+      size_t lsb, msb, origin_port_width;
+      read(name);
+      read(lsb);
+      read(msb);
+      read(origin_port_width);
+      /* Restore the fields as they are, including invalid ports */
+      value.set_name(name);
+      value.set_lsb(lsb);
+      value.set_msb(msb);
+      value.set_origin_port_width(origin_port_width);
+    } else if constexpr (is_vtr_point<T>::value) {
+      std::decay_t<decltype(value.x())> x, y;
+      read(x);
+      read(y);
+      value = T(x, y);
+    } else if constexpr (is_strong_id<T>::value) {
+      uint64_t id;
+      read(id);
+      value = T(size_t(id));
+    } else if constexpr (is_std_array<T>::value) {
+      for (auto& elem : value) {
+        read(elem);
+      }
+    } else if constexpr (is_std_pair<T>::value) {
+      read(value.first);
+      read(value.second);
+    } else if constexpr (is_map<T>::value) {
+      value.clear();
+      size_t size = read_size();
+      for (size_t i = 0; i < size && is_.good(); ++i) {
+        typename T::key_type key;
+        typename T::mapped_type mapped;
+        read(key);
+        read(mapped);
+        /* Elements are written in order, so ordered maps are appended */
+        value.emplace_hint(value.end(), std::move(key), std::move(mapped));
+      }
+    } else if constexpr (is_sequence<T>::value) {
+      value.clear();
+      size_t size = read_size();
+      for (size_t i = 0; i < size && is_.good(); ++i) {
+        typename T::value_type elem;
+        read(elem);
+        value.push_back(std::move(elem));
+      }
+    } else {
+      value.serialize(*this);
+    }
+  }
+
+ private: /* Internal data */
+  std::istream& is_;
+};
+
+}  // namespace openfpga
+
+#endif
@@ -43,6 +43,18 @@ void check_file_mmostream(const char* fname, mmostream& fp) {
   }
 }
 
+/********************************************************************
+ * Close a file stream and error out if any of the bytes can not be
+ * written, e.g., the last buffered bytes when the disk is full
+ *******************************************************************/
+void close_file_mmostream(const char* fname, mmostream& fp) {
+  fp.close();
+  if (fp.bad()) {
+    VTR_LOG_ERROR("Fail to write file: %s\n", fname);
+    exit(1);
+  }
+}
+
 /********************************************************************
  * A most utilized function to validate the file stream
  * This function will return true or false for a valid/invalid file stream
@@ -56,6 +68,12 @@ bool valid_file_stream(std::fstream& fp) {
   return true;
 }
 
+/********************************************************************
+ * Validate a generic output stream, e.g., an in-memory string stream
+ * which is not bound to any file
+ *******************************************************************/
+bool valid_file_stream(std::ostream& fp) { return fp.good(); }
+
 /********************************************************************
  * A most utilized function to validate the file stream
  * This function will error out for a valid/invalid file stream
@@ -280,6 +298,21 @@ bool write_space_to_file(std::fstream& fp, const size_t& num_space) {
   return true;
 }
 
+/********************************************************************
+ * Write a number of space to a file
+ ********************************************************************/
+bool write_space_to_file(mmostream& fp, const size_t& num_space) {
+  if (false == valid_file_mmostream(fp)) {
+    return false;
+  }
+
+  for (size_t i = 0; i < num_space; ++i) {
+    fp << " ";
+  }
+
+  return true;
+}
+
 /********************************************************************
  * Write a number of tab to a file
  ********************************************************************/
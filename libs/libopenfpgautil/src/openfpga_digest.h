@@ -15,12 +15,16 @@ namespace openfpga {
 
 bool valid_file_stream(std::fstream& fp);
 
+bool valid_file_stream(std::ostream& fp);
+
 void check_file_stream(const char* fname, std::fstream& fp);
 
 bool valid_file_mmostream(mmostream& fp);
 
 void check_file_mmostream(const char* fname, mmostream& fp);
 
+void close_file_mmostream(const char* fname, mmostream& fp);
+
 std::string format_dir_path(const std::string& dir_path_to_format);
 
 std::string find_path_file_name(const std::string& file_name);
@@ -34,6 +38,8 @@ void create_directory(const std::string& dir_path, const bool& recursive,
 
 bool write_space_to_file(std::fstream& fp, const size_t& num_space);
 
+bool write_space_to_file(mmostream& fp, const size_t& num_space);
+
 bool write_tab_to_file(std::fstream& fp, const size_t& num_tab);
 
 bool write_tab_to_file(mmostream& fp, const size_t& num_tab);
@@ -11,6 +11,10 @@
 
 namespace openfpga {
 
+/* Default size of the in-memory buffer before bytes are handed over to the
+ * file (or to zlib) */
+constexpr size_t MMOSTREAM_DEFAULT_BUFFER_SIZE = 1024;
+
 class dynamic_streambuf : public std::streambuf {
  private:
   std::string base_filename;
@@ -40,7 +44,7 @@ class dynamic_streambuf : public std::streambuf {
 
  public:
   dynamic_streambuf(const std::string& filename, bool initial_compress,
-                    size_t buf_size = 1024)
+                    size_t buf_size = MMOSTREAM_DEFAULT_BUFFER_SIZE)
     : base_filename(filename),
       is_compressed(initial_compress),
       buffer(buf_size) {
@@ -50,25 +54,31 @@ class dynamic_streambuf : public std::streambuf {
 
   ~dynamic_streambuf() override { close(); }
 
-  void close() {
-    flush_buffer();
+  /* Return false if the buffered bytes can not be written or the file can
+   * not be closed properly */
+  bool close() {
+    bool success = flush_buffer();
     if (gz_file) {
-      gzclose(gz_file);
+      success = (Z_OK == gzclose(gz_file)) && success;
       gz_file = nullptr;
     }
     if (raw_file.is_open()) {
       raw_file.close();
+      success = !raw_file.fail() && success;
     }
+    return success;
   }
 
-  void set_compression(bool compress) {
-    flush_buffer();
+  /* Return false if the bytes written so far are lost or the new file can
+   * not be opened */
+  bool set_compression(bool compress) {
+    bool success = flush_buffer();
 
     if (compress == is_compressed && (gz_file || raw_file.is_open())) {
-      return;
+      return success;
     }
 
-    close();
+    success = close() && success;
     is_compressed = compress;
 
     if (is_compressed) {
@@ -77,6 +87,7 @@ class dynamic_streambuf : public std::streambuf {
     } else {
       raw_file.open(base_filename, std::ios::out | std::ios::binary);
     }
+    return success && is_open();
   }
 
   bool is_open() const {
@@ -101,9 +112,11 @@ class mmostream : public std::ostream {
   std::unique_ptr<dynamic_streambuf> sbuf;
 
  public:
-  mmostream(const std::string& filename, bool initial_compress = false)
+  mmostream(const std::string& filename, bool initial_compress = false,
+            size_t buf_size = MMOSTREAM_DEFAULT_BUFFER_SIZE)
     : std::ostream(nullptr) {
-    sbuf = std::make_unique<dynamic_streambuf>(filename, initial_compress);
+    sbuf = std::make_unique<dynamic_streambuf>(filename, initial_compress,
+                                               buf_size);
     init(sbuf.get());
 
     if (!sbuf->is_open()) {
@@ -112,15 +125,15 @@ class mmostream : public std::ostream {
   }
 
   void set_compression(bool compress) {
-    sbuf->set_compression(compress);
-    if (!sbuf->is_open()) {
+    if (!sbuf->set_compression(compress)) {
       setstate(std::ios_base::badbit);
     }
   }
 
+  /* A failure on writing the last buffered bytes flags the stream as bad */
   void close() {
-    if (sbuf) {
-      sbuf->close();
+    if (sbuf && !sbuf->close()) {
+      setstate(std::ios_base::badbit);
     }
   }
 
@@ -141,15 +154,11 @@ class mmostream : public std::ostream {
     return *this;
   }
 
+  // Values are only buffered here. Any failure when the buffer is handed
+  // over to the file is reported by overflow(), which flags the stream as bad
   template <typename T>
   mmostream& operator<<(const T& val) {
     static_cast<std::ostream&>(*this) << val;
-    if (this->bad() || this->fail()) {
-      // State already flagged
-    } else if (sbuf &&
-               sbuf->pubsync() != 0) {  // FIXED: Use pubsync() from streambuf
-      setstate(std::ios_base::badbit);
-    }
     return *this;
   }
 };
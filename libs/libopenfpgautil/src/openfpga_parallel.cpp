@@ -0,0 +1,108 @@
+/********************************************************************
+ * This file includes functions to dispatch independent tasks
+ * over a group of worker threads
+ *******************************************************************/
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/* Headers from openfpgautil library */
+#include "openfpga_parallel.h"
+
+/* namespace openfpga begins */
+namespace openfpga {
+
+/********************************************************************
+ * Find the number of worker threads to launch
+ *******************************************************************/
+size_t find_num_worker_threads(const size_t& num_threads_requested,
+                               const size_t& num_tasks) {
+  size_t num_threads = num_threads_requested;
+  if (0 == num_threads) {
+    num_threads = std::thread::hardware_concurrency();
+  }
+  /* hardware_concurrency() may return 0 when not computable */
+  num_threads = std::max(num_threads, size_t(1));
+  return std::max(std::min(num_threads, num_tasks), size_t(1));
+}
+
+/********************************************************************
+ * Dispatch tasks over worker threads
+ * Each worker keeps fetching the next unvisited task id until all the
+ * tasks are consumed. This balances well when task sizes are uneven,
+ * e.g., a large CLB netlist versus a tiny I/O netlist.
+ *******************************************************************/
+void parallel_for_each_task(
+  const size_t& num_tasks, const size_t& num_threads,
+  const std::function<void(const size_t& task_id)>& task_func) {
+  size_t num_workers = find_num_worker_threads(num_threads, num_tasks);
+
+  /* Serial mode: keep the exact behavior of a plain loop */
+  if (1 == num_workers) {
+    for (size_t itask = 0; itask < num_tasks; ++itask) {
+      task_func(itask);
+    }
+    return;
+  }
+
+  std::atomic<size_t> next_task(0);
+  std::exception_ptr first_error = nullptr;
+  std::mutex error_mutex;
+
+  auto worker = [&]() {
+    while (true) {
+      size_t itask = next_task.fetch_add(1);
+      if (itask >= num_tasks) {
+        return;
+      }
+      try {
+        task_func(itask);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(error_mutex);
+        if (nullptr == first_error) {
+          first_error = std::current_exception();
+        }
+        /* Drain the remaining tasks so that other workers stop early */
+        next_task = num_tasks;
+        return;
+      }
+    }
+  };
+
+  std::vector<std::thread> workers;
+  workers.reserve(num_workers - 1);
+  for (size_t iworker = 1; iworker < num_workers; ++iworker) {
+    workers.emplace_back(worker);
+  }
+  /* The caller thread also works */
+  worker();
+  for (std::thread& thread : workers) {
+    thread.join();
+  }
+
+  if (nullptr != first_error) {
+    std::rethrow_exception(first_error);
+  }
+}
+
+/********************************************************************
+ * Parse a thread count from a string
+ *******************************************************************/
+bool parse_num_threads(const std::string& str, size_t& num_threads) {
+  if (str.empty()) {
+    return false;
+  }
+  for (const char& c : str) {
+    if (!std::isdigit(static_cast<unsigned char>(c))) {
+      return false;
+    }
+  }
+  num_threads = std::stoul(str);
+  return true;
+}
+
+}  // namespace openfpga
@@ -0,0 +1,40 @@
+#ifndef OPENFPGA_PARALLEL_H
+#define OPENFPGA_PARALLEL_H
+
+/********************************************************************
+ * Include header files that are required by function declaration
+ *******************************************************************/
+#include <functional>
+#include <string>
+
+/********************************************************************
+ * Function declaration
+ *******************************************************************/
+/* namespace openfpga begins */
+namespace openfpga {
+
+/* Translate a thread count requested by users to the number of worker
+ * threads to launch:
+ * - 0 means using all the hardware threads
+ * - never more threads than tasks to run */
+size_t find_num_worker_threads(const size_t& num_threads_requested,
+                               const size_t& num_tasks);
+
+/* Run the task function for each task id in [0, num_tasks) over a group of
+ * worker threads. Tasks are dispatched dynamically, so no assumption can be
+ * made on the execution order. Each task should only write to the data that
+ * is private to its task id. When only one thread is requested, tasks are
+ * executed in the caller thread in the ascending order of task ids.
+ * The first exception thrown by any task is rethrown in the caller thread
+ * once all the workers are joined */
+void parallel_for_each_task(
+  const size_t& num_tasks, const size_t& num_threads,
+  const std::function<void(const size_t& task_id)>& task_func);
+
+/* Parse the value of a '--threads' option. Return false if the string is
+ * not a valid non-negative number */
+bool parse_num_threads(const std::string& str, size_t& num_threads);
+
+}  // namespace openfpga
+
+#endif
@@ -4,6 +4,7 @@
 
 /* Headers from vtrutil library */
 #include "openfpga_port.h"
+#include "openfpga_string_interner.h"
 #include "vtr_assert.h"
 
 /* namespace openfpga begins */
@@ -18,6 +19,7 @@ namespace openfpga {
  ***********************************************************************/
 /* Default constructor */
 BasicPort::BasicPort() {
+  name_ = &current_string_interner().empty_string();
   /* By default we set an invalid port, which size is 0 */
   lsb_ = 1;
   msb_ = 0;
@@ -69,7 +71,7 @@ size_t BasicPort::get_msb() const { return msb_; }
 size_t BasicPort::get_lsb() const { return lsb_; }
 
 /* get the name */
-std::string BasicPort::get_name() const { return name_; }
+const std::string& BasicPort::get_name() const { return *name_; }
 
 /* Make a range of the pin indices */
 std::vector<size_t> BasicPort::pins() const {
@@ -92,7 +94,7 @@ std::vector<size_t> BasicPort::pins() const {
 /* Check if a port can be merged with this port: their name should be the same
  */
 bool BasicPort::mergeable(const BasicPort& portA) const {
-  return (0 == this->get_name().compare(portA.get_name()));
+  return same_name(portA);
 }
 
 /* Check if a port is contained by this port:
@@ -146,18 +148,16 @@ size_t BasicPort::find_ipin(const BasicPort& ref_port) const {
  * 3. MSBs are the same
  */
 bool BasicPort::operator==(const BasicPort& portA) const {
-  if ((0 == this->get_name().compare(portA.get_name())) &&
-      (this->get_lsb() == portA.get_lsb()) &&
-      (this->get_msb() == portA.get_msb())) {
+  if ((this->get_lsb() == portA.get_lsb()) &&
+      (this->get_msb() == portA.get_msb()) && same_name(portA)) {
     return true;
   }
   return false;
 }
 
 bool BasicPort::operator<(const BasicPort& portA) const {
-  if ((0 == this->get_name().compare(portA.get_name())) &&
-      (this->get_lsb() < portA.get_lsb()) &&
-      (this->get_msb() < portA.get_msb())) {
+  if ((this->get_lsb() < portA.get_lsb()) &&
+      (this->get_msb() < portA.get_msb()) && same_name(portA)) {
     return true;
   }
   return false;
@@ -168,7 +168,7 @@ bool BasicPort::operator<(const BasicPort& portA) const {
  ***********************************************************************/
 /* copy */
 void BasicPort::set(const BasicPort& basic_port) {
-  name_ = basic_port.get_name();
+  name_ = basic_port.name_;
   lsb_ = basic_port.get_lsb();
   msb_ = basic_port.get_msb();
   origin_port_width_ = basic_port.get_origin_port_width();
@@ -178,7 +178,7 @@ void BasicPort::set(const BasicPort& basic_port) {
 
 /* set the port LSB and MSB */
 void BasicPort::set_name(const std::string& name) {
-  name_ = name;
+  name_ = &current_string_interner().intern(name);
   return;
 }
 
@@ -340,6 +340,13 @@ void BasicPort::make_invalid() {
   return;
 }
 
+/* Names interned in the same pool are the same only when they share the
+ * same address, which is the common case. Names from different pools are
+ * compared by their contents */
+bool BasicPort::same_name(const BasicPort& portA) const {
+  return (name_ == portA.name_) || (*name_ == *portA.name_);
+}
+
 /* check if port size is valid > 0 */
 bool BasicPort::is_valid() const {
   /* msb should be equal or greater than lsb, if this is a valid port */
@@ -23,13 +23,13 @@ class BasicPort {
   bool operator==(const BasicPort& portA) const;
   bool operator<(const BasicPort& portA) const;
 
- public:                            /* Accessors */
-  size_t get_width() const;         /* get the port width */
-  size_t get_msb() const;           /* get the LSB */
-  size_t get_lsb() const;           /* get the LSB */
-  std::string get_name() const;     /* get the name */
-  bool is_valid() const;            /* check if port size is valid > 0 */
-  std::vector<size_t> pins() const; /* Make a range of the pin indices */
+ public:                               /* Accessors */
+  size_t get_width() const;            /* get the port width */
+  size_t get_msb() const;              /* get the LSB */
+  size_t get_lsb() const;              /* get the LSB */
+  const std::string& get_name() const; /* get the name */
+  bool is_valid() const;               /* check if port size is valid > 0 */
+  std::vector<size_t> pins() const;    /* Make a range of the pin indices */
   bool mergeable(const BasicPort& portA)
     const; /* Check if a port can be merged with this port */
   bool contained(const BasicPort& portA)
@@ -65,8 +65,11 @@ class BasicPort {
 
  private:                    /* internal functions */
   void make_invalid();       /* Make a port invalid */
+  bool same_name(const BasicPort& portA) const; /* Compare port names */
  private:                    /* Internal Data */
-  std::string name_;         /* Name of this port */
+  /* Name of this port, pointing to the current string pool so that copying
+   * and comparing ports do not allocate */
+  const std::string* name_;
   size_t msb_;               /* Most Significant Bit of this port */
   size_t lsb_;               /* Least Significant Bit of this port */
   size_t origin_port_width_; /* Original port width of a port, used by traceback
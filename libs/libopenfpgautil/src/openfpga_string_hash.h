@@ -0,0 +1,39 @@
+#ifndef OPENFPGA_STRING_HASH_H
+#define OPENFPGA_STRING_HASH_H
+
+/********************************************************************
+ * Include header files that are required by data structure declaration
+ *******************************************************************/
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+/* namespace openfpga begins */
+namespace openfpga {
+
+/************************************************************************
+ * A transparent hash for strings, so that a hash map keyed by strings can
+ * be searched with a std::string, a std::string_view or a C string without
+ * creating a temporary std::string
+ *
+ * Example:
+ *   StringMap<int> name2ids;
+ *   auto result = name2ids.find(std::string_view("clk"));
+ *
+ ***********************************************************************/
+struct StringHash {
+  using is_transparent = void;
+  size_t operator()(std::string_view str) const {
+    return std::hash<std::string_view>()(str);
+  }
+};
+
+/* A hash map keyed by strings with heterogeneous look-up */
+template <class T>
+using StringMap =
+  std::unordered_map<std::string, T, StringHash, std::equal_to<>>;
+
+}  // namespace openfpga
+
+#endif
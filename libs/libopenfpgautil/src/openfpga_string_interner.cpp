@@ -0,0 +1,124 @@
+/********************************************************************
+ * This file includes the pools of unique strings, which are shared by
+ * the data structures storing many copies of the same names, e.g., ports
+ *******************************************************************/
+#include <atomic>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+
+/* Headers from vtrutil library */
+#include "vtr_assert.h"
+
+/* Headers from openfpgautil library */
+#include "openfpga_string_interner.h"
+
+/* namespace openfpga begins */
+namespace openfpga {
+
+/********************************************************************
+ * The strings found by a thread in the pool it used last time.
+ * The keys are views on the strings of the pool, which are only valid
+ * when the pool is the same, so the cache is emptied before switching
+ * to another pool
+ *******************************************************************/
+struct StringInternerCache {
+  size_t interner_id = 0;
+  std::unordered_map<std::string_view, const std::string*> strings;
+};
+
+static thread_local StringInternerCache interner_cache;
+
+/* Id 0 is reserved for empty caches */
+static std::atomic<size_t> num_created_interners(0);
+
+/************************************************************************
+ * Member functions for StringInterner class
+ ***********************************************************************/
+StringInterner::StringInterner() : id_(++num_created_interners) {
+  empty_string_ = &*strings_.insert(std::string()).first;
+}
+
+StringInterner::~StringInterner() = default;
+
+const std::string& StringInterner::empty_string() const {
+  return *empty_string_;
+}
+
+size_t StringInterner::size() const {
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return strings_.size();
+}
+
+/********************************************************************
+ * Most lookups hit a string which is already cached by the thread and
+ * take no lock. Otherwise, the pool is searched under a shared lock and
+ * only an insertion takes the exclusive lock
+ *******************************************************************/
+const std::string& StringInterner::intern(const std::string& str) {
+  StringInternerCache& cache = interner_cache;
+  if (cache.interner_id != id_) {
+    cache.strings.clear();
+    cache.interner_id = id_;
+  }
+  auto cached = cache.strings.find(std::string_view(str));
+  if (cached != cache.strings.end()) {
+    return *cached->second;
+  }
+
+  const std::string* interned = nullptr;
+  {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto result = strings_.find(str);
+    if (result != strings_.end()) {
+      interned = &*result;
+    }
+  }
+  if (nullptr == interned) {
+    /* Another thread may have inserted the string in between, which is fine
+     * since insert() returns the existing element in that case */
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    interned = &*strings_.insert(str).first;
+  }
+  cache.strings.emplace(std::string_view(*interned), interned);
+  return *interned;
+}
+
+/************************************************************************
+ * The current pool. Function-local statics avoid any dependency on the
+ * initialization order of other global objects
+ ***********************************************************************/
+static StringInterner& process_string_interner() {
+  static StringInterner interner;
+  return interner;
+}
+
+static std::atomic<StringInterner*>& scoped_string_interner() {
+  static std::atomic<StringInterner*> interner(nullptr);
+  return interner;
+}
+
+StringInterner& current_string_interner() {
+  StringInterner* interner =
+    scoped_string_interner().load(std::memory_order_acquire);
+  if (nullptr == interner) {
+    return process_string_interner();
+  }
+  return *interner;
+}
+
+/************************************************************************
+ * Member functions for StringInternerScope class
+ ***********************************************************************/
+StringInternerScope::StringInternerScope()
+  : parent_interner_(scoped_string_interner().load()) {
+  scoped_string_interner().store(&interner_, std::memory_order_release);
+}
+
+StringInternerScope::~StringInternerScope() {
+  /* Only the innermost scope can be closed */
+  VTR_ASSERT(&interner_ == scoped_string_interner().load());
+  scoped_string_interner().store(parent_interner_, std::memory_order_release);
+}
+
+}  // namespace openfpga
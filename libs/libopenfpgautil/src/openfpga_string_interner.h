@@ -0,0 +1,79 @@
+#ifndef OPENFPGA_STRING_INTERNER_H
+#define OPENFPGA_STRING_INTERNER_H
+
+/********************************************************************
+ * Include header files that are required by data structure declaration
+ *******************************************************************/
+#include <shared_mutex>
+#include <string>
+#include <unordered_set>
+
+/* namespace openfpga begins */
+namespace openfpga {
+
+/********************************************************************
+ * A pool of unique strings, which is shared by the data structures
+ * storing many copies of the same names, e.g., ports
+ * - Equal strings interned in the same pool return the same reference, so
+ *   that they can be compared by their addresses
+ * - The returned references remain valid until the pool is destroyed
+ * - Safe to be called by concurrent threads. Each thread caches the strings
+ *   it has found, so that looking up a known string does not take any lock.
+ *   Only the strings which are new to a thread take the lock of the pool
+ *******************************************************************/
+class StringInterner {
+ public: /* Constructors */
+  StringInterner();
+  ~StringInterner();
+  StringInterner(const StringInterner&) = delete;
+  StringInterner& operator=(const StringInterner&) = delete;
+
+ public: /* Public accessors */
+  /* The interned empty string */
+  const std::string& empty_string() const;
+  /* Number of unique strings in the pool */
+  size_t size() const;
+
+ public: /* Public mutators */
+  /* Find the unique copy of a string in the pool, and add it to the pool if
+   * not found yet */
+  const std::string& intern(const std::string& str);
+
+ private: /* Internal data */
+  /* Unique among all the pools ever created, so that the cache of a thread
+   * can tell a new pool from a destroyed one at the same address */
+  size_t id_;
+  /* A node-based set, so that the address of a string never changes when
+   * the pool grows */
+  std::unordered_set<std::string> strings_;
+  mutable std::shared_mutex mutex_;
+  const std::string* empty_string_;
+};
+
+/********************************************************************
+ * The pool where the names of ports are interned.
+ * A scope creates a pool and makes it the current one until the scope ends,
+ * when all the strings of the pool are released. Therefore, data structures
+ * interning strings should not outlive the scope, e.g., a scope is owned by
+ * the shell which owns the OpenFPGA context.
+ * Scopes should be nested and be created and destroyed when no other thread
+ * is interning strings. Outside any scope, a process-wide pool is used.
+ *******************************************************************/
+class StringInternerScope {
+ public: /* Constructors */
+  StringInternerScope();
+  ~StringInternerScope();
+  StringInternerScope(const StringInternerScope&) = delete;
+  StringInternerScope& operator=(const StringInternerScope&) = delete;
+
+ private: /* Internal data */
+  StringInterner interner_;
+  StringInterner* parent_interner_;
+};
+
+/* The pool of the innermost scope, or the process-wide pool */
+StringInterner& current_string_interner();
+
+}  // namespace openfpga
+
+#endif
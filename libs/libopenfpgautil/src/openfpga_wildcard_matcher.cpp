@@ -0,0 +1,83 @@
+/************************************************************************
+ * Member functions for WildCardMatcher class
+ ***********************************************************************/
+#include "openfpga_wildcard_matcher.h"
+
+#include <cstring>
+
+/* namespace openfpga begins */
+namespace openfpga {
+
+/* Special characters of regular expression, except '*' and '?' which are
+ * wildcards */
+static const char* REGEX_SPECIAL_CHARS = ".^$|()[]{}+\\";
+
+/************************************************************************
+ * Constructors
+ ***********************************************************************/
+WildCardMatcher::WildCardMatcher(const std::string& pattern)
+  : pattern_(pattern) {
+  use_regex_ = (std::string::npos !=
+                pattern_.find_first_of(std::string(REGEX_SPECIAL_CHARS)));
+  if (!use_regex_) {
+    return;
+  }
+  /* Translate the wildcards to regular expression */
+  std::string regex_pattern;
+  for (const char& c : pattern_) {
+    if ('*' == c) {
+      regex_pattern += ".*";
+    } else if ('?' == c) {
+      regex_pattern.push_back('.');
+    } else {
+      regex_pattern.push_back(c);
+    }
+  }
+  regex_ = std::regex(regex_pattern);
+}
+
+/************************************************************************
+ * Public Accessors
+ ***********************************************************************/
+std::string WildCardMatcher::pattern() const { return pattern_; }
+
+bool WildCardMatcher::match(const std::string& str) const {
+  if (use_regex_) {
+    return std::regex_match(str, regex_);
+  }
+  return glob_match(str);
+}
+
+/************************************************************************
+ * Private Accessors
+ ***********************************************************************/
+/* Match with the wildcards only. When a mismatch occurs, only the last '*'
+ * is extended, since any earlier '*' can not lead to a different result */
+bool WildCardMatcher::glob_match(const std::string& str) const {
+  size_t ipat = 0;
+  size_t istr = 0;
+  size_t star_pat = std::string::npos;
+  size_t star_str = 0;
+  while (istr < str.size()) {
+    if ((ipat < pattern_.size()) &&
+        (('?' == pattern_[ipat]) || (pattern_[ipat] == str[istr]))) {
+      ipat++;
+      istr++;
+    } else if ((ipat < pattern_.size()) && ('*' == pattern_[ipat])) {
+      star_pat = ipat++;
+      star_str = istr;
+    } else if (std::string::npos != star_pat) {
+      ipat = star_pat + 1;
+      istr = ++star_str;
+    } else {
+      return false;
+    }
+  }
+  /* Only '*' can remain in the pattern */
+  while ((ipat < pattern_.size()) && ('*' == pattern_[ipat])) {
+    ipat++;
+  }
+  return ipat == pattern_.size();
+}
+
+}  // namespace openfpga
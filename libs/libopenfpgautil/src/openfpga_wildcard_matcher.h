@@ -0,0 +1,49 @@
+#ifndef OPENFPGA_WILDCARD_MATCHER_H
+#define OPENFPGA_WILDCARD_MATCHER_H
+
+/********************************************************************
+ * Include header files that are required by data structure declaration
+ *******************************************************************/
+#include <regex>
+#include <string>
+
+/* namespace openfpga begins */
+namespace openfpga {
+
+/************************************************************************
+ * This file includes an object which matches strings against a pattern
+ * given by users, where '*' matches any sequence of characters and '?'
+ * matches any single character. The other characters follow the syntax
+ * of regular expression.
+ * The pattern is compiled once when the object is created:
+ * - A pattern without any special character of regular expression is
+ *   matched directly by a glob matcher, which is much faster than regex
+ * - Otherwise, the pattern is translated to a regular expression
+ *
+ * Example:
+ *   WildCardMatcher matcher("grid_*");
+ *   bool is_match = matcher.match(std::string("grid_clb"));
+ *
+ ***********************************************************************/
+class WildCardMatcher {
+ public: /* Constructors*/
+  WildCardMatcher(const std::string& pattern);
+
+ public: /* Public Accessors */
+  std::string pattern() const;
+  /* Return true if the full string matches the pattern */
+  bool match(const std::string& str) const;
+
+ private: /* Private Accessors */
+  bool glob_match(const std::string& str) const;
+
+ private: /* Internal data */
+  std::string pattern_;
+  /* True if the pattern requires a regular expression */
+  bool use_regex_;
+  std::regex regex_;
+};
+
+}  // namespace openfpga
+
+#endif
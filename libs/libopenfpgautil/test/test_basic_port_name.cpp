@@ -0,0 +1,172 @@
+/********************************************************************
+ * Test the names of ports, which are interned in string pools
+ * - Ports with the same name share the same string in a pool, while
+ *   ports with different names do not
+ * - Comparisons of ports, i.e., equality, ordering and mergeability,
+ *   depend on the contents of names, even for ports whose names are from
+ *   different pools
+ * - Concurrent threads find the same strings in a pool
+ * - A scoped pool is released when the scope ends, and a new pool never
+ *   reuses the strings cached for a released pool
+ *
+ * Usage: test_basic_port_name
+ *******************************************************************/
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "openfpga_port.h"
+#include "openfpga_string_interner.h"
+#include "vtr_log.h"
+
+using namespace openfpga;
+
+constexpr size_t NUM_TEST_THREADS = 8;
+constexpr size_t NUM_TEST_NAMES = 1000;
+
+static int num_errors = 0;
+
+static void check(const bool& condition, const char* description) {
+  if (!condition) {
+    VTR_LOG_ERROR("Failed check: %s!\n", description);
+    ++num_errors;
+  }
+}
+
+/* Ports with the same name share the same string */
+static void test_identity() {
+  std::string name("clk");
+  BasicPort port_a(name, 1);
+  BasicPort port_b(std::string("cl") + "k", 0, 3);
+  BasicPort port_c("clk_n", 1);
+  check(&port_a.get_name() == &port_b.get_name(),
+        "Ports with the same name share the same string");
+  check(&port_a.get_name() != &port_c.get_name(),
+        "Ports with different names do not share the same string");
+  check(&port_a.get_name() != &name,
+        "A port does not refer to the string it is created from");
+
+  BasicPort copied_port(port_c);
+  check(&copied_port.get_name() == &port_c.get_name(),
+        "A copied port shares the string of its origin");
+  copied_port.set(port_a);
+  check(&copied_port.get_name() == &port_a.get_name(),
+        "A port set from another port shares the string of the other");
+  copied_port.set_name(port_c.get_name());
+  check(&copied_port.get_name() == &port_c.get_name(),
+        "A renamed port shares the string of the ports of the new name");
+
+  check(&BasicPort().get_name() == &BasicPort().get_name() &&
+          BasicPort().get_name().empty(),
+        "Default ports share the same empty name");
+  check(&BasicPort("", 1).get_name() == &BasicPort().get_name(),
+        "Ports with empty names share the same string");
+}
+
+/* Comparisons depend on the names, widths and the positions of pins */
+static void test_equality() {
+  BasicPort port("in", 0, 3);
+  check(port == BasicPort("in", 0, 3), "Same ports are equal");
+  check(!(port == BasicPort("in", 1, 3)), "Ports of different LSBs differ");
+  check(!(port == BasicPort("in", 0, 2)), "Ports of different MSBs differ");
+  check(!(port == BasicPort("out", 0, 3)), "Ports of different names differ");
+  check(!(port == BasicPort("in_", 0, 3)),
+        "Ports of names with the same prefix differ");
+  check(port.mergeable(BasicPort("in", 5, 7)),
+        "Ports with the same name are mergeable");
+  check(!port.mergeable(BasicPort("out", 0, 3)),
+        "Ports with different names are not mergeable");
+  check(BasicPort("in", 0, 1) < BasicPort("in", 2, 3),
+        "Port of lower pins is smaller");
+  check(!(BasicPort("in", 0, 1) < BasicPort("out", 2, 3)),
+        "Ports of different names are not ordered");
+
+  BasicPort renamed_port(port);
+  renamed_port.set_name("out");
+  check(!(renamed_port == port) && renamed_port == BasicPort("out", 0, 3),
+        "A renamed port equals the ports of the new name");
+  check(0 == port.find_ipin(BasicPort("in", 0, 0)) &&
+          port.get_width() == port.find_ipin(BasicPort("out", 0, 0)),
+        "Pins are only found in the port with the same name");
+}
+
+/* Threads interning the same names at the same time find the same strings */
+static void test_concurrency() {
+  std::vector<std::vector<const std::string*>> thread_names(NUM_TEST_THREADS);
+  std::vector<std::thread> threads;
+  for (size_t ithread = 0; ithread < NUM_TEST_THREADS; ++ithread) {
+    threads.emplace_back([&thread_names, ithread]() {
+      /* Each thread starts from a different name */
+      std::vector<const std::string*>& names = thread_names[ithread];
+      names.resize(NUM_TEST_NAMES);
+      for (size_t iname = 0; iname < NUM_TEST_NAMES; ++iname) {
+        size_t name_id =
+          (iname + ithread * NUM_TEST_NAMES / NUM_TEST_THREADS) %
+          NUM_TEST_NAMES;
+        BasicPort port("port_" + std::to_string(name_id), 1);
+        names[name_id] = &port.get_name();
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  for (size_t iname = 0; iname < NUM_TEST_NAMES; ++iname) {
+    BasicPort port("port_" + std::to_string(iname), 1);
+    for (size_t ithread = 0; ithread < NUM_TEST_THREADS; ++ithread) {
+      if (thread_names[ithread][iname] != &port.get_name()) {
+        VTR_LOG_ERROR("Thread %lu found another string for '%s'!\n", ithread,
+                      port.get_name().c_str());
+        ++num_errors;
+      }
+    }
+  }
+}
+
+/* Names are interned in the pool of the innermost scope */
+static void test_scope() {
+  BasicPort outer_port("data", 0, 7);
+  size_t num_outer_strings = current_string_interner().size();
+
+  for (size_t iscope = 0; iscope < 2; ++iscope) {
+    /* The pool of each scope is created at the same address. The second one
+     * should not reuse the strings cached for the first one */
+    StringInternerScope scope;
+    check(1 == current_string_interner().size(),
+          "A scoped pool only contains the empty string");
+    BasicPort inner_port("data", 0, 7);
+    check(2 == current_string_interner().size(),
+          "A name is interned in the scoped pool");
+    check(&inner_port.get_name() != &outer_port.get_name(),
+          "A name is interned in the scoped pool rather than the outer pool");
+    check(inner_port == outer_port && inner_port.mergeable(outer_port),
+          "Ports whose names are from different pools are equal");
+    check(!(inner_port == BasicPort("data_n", 0, 7)),
+          "Ports whose names are in the scoped pool differ");
+  }
+
+  check(num_outer_strings == current_string_interner().size(),
+        "Names in a scope are not interned in the outer pool");
+  check(&BasicPort("data", 1).get_name() == &outer_port.get_name(),
+        "The outer pool is used again when the scope ends");
+}
+
+int main(int argc, char** argv) {
+  if (1 != argc) {
+    VTR_LOG("Usage: %s\n", argv[0]);
+    return 1;
+  }
+
+  test_identity();
+  test_equality();
+  test_concurrency();
+  test_scope();
+
+  if (0 < num_errors) {
+    VTR_LOG_ERROR("%d checks on port names failed!\n", num_errors);
+    return 1;
+  }
+  VTR_LOG("All the checks on port names passed\n");
+
+  return 0;
+}
@@ -0,0 +1,113 @@
+/********************************************************************
+ * Test the wildcard matcher on a list of patterns and strings.
+ * - Patterns with '*', '?' and literal characters only are matched by
+ *   the glob matcher
+ * - Patterns with any other special character of regular expression are
+ *   matched by the regex fallback
+ * The last cases are the patterns of write_fabric_hierarchy, which
+ * selects the root modules by '--module' and filters the child modules by
+ * '--filter' with the same matcher
+ *
+ * Usage: test_wildcard_matcher
+ *******************************************************************/
+#include <string>
+#include <vector>
+
+#include "openfpga_wildcard_matcher.h"
+#include "vtr_log.h"
+
+using namespace openfpga;
+
+struct WildCardTestCase {
+  std::string pattern;
+  std::string str;
+  bool expect_match;
+};
+
+int main(int argc, char** argv) {
+  if (1 != argc) {
+    VTR_LOG("Usage: %s\n", argv[0]);
+    return 1;
+  }
+
+  std::vector<WildCardTestCase> test_cases = {
+    /* Literal patterns */
+    {"grid_clb", "grid_clb", true},
+    {"grid_clb", "grid_clb_1", false},
+    {"grid_clb", "grid_cl", false},
+    {"", "", true},
+    {"", "a", false},
+    /* '*' matches any sequence, including an empty one */
+    {"*", "", true},
+    {"*", "sb_0__0_", true},
+    {"grid_*", "grid_", true},
+    {"grid_*", "grid_io_top", true},
+    {"grid_*", "cbx_1__0_", false},
+    {"*_mem", "mux_tree_size2_mem", true},
+    {"*_mem", "mux_tree_size2_mem_0", false},
+    {"*mux*_size*", "mux_tree_tapbuf_size10", true},
+    {"*mux*_size*", "lut4_mux_size16_mem", true},
+    {"*mux*_size*", "mux_tree_tapbuf_basis", false},
+    /* The last '*' is extended on mismatches */
+    {"a*b*c", "aXbYbZc", true},
+    {"a*b*c", "aXbYcZ", false},
+    {"**a", "bba", true},
+    /* '?' matches exactly one character */
+    {"sb_?__?_", "sb_0__1_", true},
+    {"sb_?__?_", "sb_10__1_", false},
+    {"sb_?__?_", "sb___1_", false},
+    {"?*", "", false},
+    {"?*", "x", true},
+    /* Regex fallback, where the wildcards are translated */
+    {"cb[xy]_*", "cbx_1__0_", true},
+    {"cb[xy]_*", "cby_0__1_", true},
+    {"cb[xy]_*", "cbz_0__1_", false},
+    {"grid_io_(top|bottom)", "grid_io_top", true},
+    {"grid_io_(top|bottom)", "grid_io_left", false},
+    {"lut?.mem", "lut4_mem", true},
+    {"lut?.mem", "lut4_mem_0", false},
+    {"size[0-9]+", "size12", true},
+    {"size[0-9]+", "size", false},
+    /* Patterns of write_fabric_hierarchy in the regression tests */
+    {"(grid|cbx|cby|sb)*", "grid_clb", true},
+    {"(grid|cbx|cby|sb)*", "sb_1__1_", true},
+    {"(grid|cbx|cby|sb)*", "fpga_top", false},
+    {"*mux*_size([0-9]+)", "mux_tree_tapbuf_size10", true},
+    {"*mux*_size([0-9]+)", "mux_tree_tapbuf_size10_mem", false},
+    {"*mux*_size([0-9]+)", "const1", false},
+    {"*config_group_mem*", "grid_clb_config_group_mem_size40", true},
+    {"*config_group_mem*", "grid_clb_mode_default__fle", false}};
+
+  int num_errors = 0;
+  for (const WildCardTestCase& test_case : test_cases) {
+    WildCardMatcher matcher(test_case.pattern);
+    if (test_case.expect_match != matcher.match(test_case.str)) {
+      VTR_LOG_ERROR("Pattern '%s' should%s match '%s'!\n",
+                    test_case.pattern.c_str(),
+                    test_case.expect_match ? "" : " not",
+                    test_case.str.c_str());
+      ++num_errors;
+    }
+  }
+
+  /* A matcher is shared among all the modules, so the outcome should not
+   * depend on the previous strings */
+  WildCardMatcher shared_matcher("*mux*_size([0-9]+)");
+  for (size_t i = 0; i < 2; ++i) {
+    if (!shared_matcher.match("mux_tree_size2") ||
+        shared_matcher.match("mux_tree_size2_mem")) {
+      VTR_LOG_ERROR("Pattern '%s' does not match consistently!\n",
+                    shared_matcher.pattern().c_str());
+      ++num_errors;
+    }
+  }
+
+  if (0 < num_errors) {
+    VTR_LOG_ERROR("%d wildcard matches are wrong among %lu cases!\n",
+                  num_errors, test_cases.size());
+    return 1;
+  }
+  VTR_LOG("All the %lu wildcard matches are correct\n", test_cases.size());
+
+  return 0;
+}
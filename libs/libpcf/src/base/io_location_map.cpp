@@ -41,36 +41,30 @@ size_t IoLocationMap::io_index(const size_t& x, const size_t& y,
 }
 
 size_t IoLocationMap::io_x(const BasicPort& io_port) const {
-  for (auto pair : io_indices_) {
-    for (const BasicPort& candidate : pair.second) {
-      if (candidate == io_port) {
-        return pair.first[0];
-      }
-    }
-  }
-  return size_t(-1);
+  return io_coordinate(io_port)[0];
 }
 
 size_t IoLocationMap::io_y(const BasicPort& io_port) const {
-  for (auto pair : io_indices_) {
-    for (const BasicPort& candidate : pair.second) {
-      if (candidate == io_port) {
-        return pair.first[1];
-      }
-    }
-  }
-  return size_t(-1);
+  return io_coordinate(io_port)[1];
 }
 
 size_t IoLocationMap::io_z(const BasicPort& io_port) const {
-  for (auto pair : io_indices_) {
-    for (const BasicPort& candidate : pair.second) {
-      if (candidate == io_port) {
-        return pair.first[2];
-      }
-    }
+  return io_coordinate(io_port)[2];
+}
+
+std::array<size_t, 3> IoLocationMap::io_coordinate(
+  const BasicPort& io_port) const {
+  std::array<size_t, 3> invalid_coord = {size_t(-1), size_t(-1), size_t(-1)};
+  /* Only single-bit I/Os are stored */
+  if (1 != io_port.get_width()) {
+    return invalid_coord;
   }
-  return size_t(-1);
+  auto result = io_coords_.find(io_port.get_name());
+  if (result == io_coords_.end() ||
+      io_port.get_lsb() >= result->second.size()) {
+    return invalid_coord;
+  }
+  return result->second[io_port.get_lsb()];
 }
 
 void IoLocationMap::set_io_index(const size_t& x, const size_t& y,
@@ -92,6 +86,16 @@ void IoLocationMap::set_io_index(const size_t& x, const size_t& y,
   }
 
   io_indices_[coord].push_back(port_to_add);
+
+  /* Update the reverse lookup */
+  std::vector<std::array<size_t, 3>>& port_coords = io_coords_[io_port_name];
+  if (io_index >= port_coords.size()) {
+    port_coords.resize(io_index + 1, {size_t(-1), size_t(-1), size_t(-1)});
+  }
+  if (size_t(-1) == port_coords[io_index][0] ||
+      coord < port_coords[io_index]) {
+    port_coords[io_index] = coord;
+  }
 }
 
 int IoLocationMap::write_to_xml_file(const std::string& fname,
@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "openfpga_port.h"
+#include "openfpga_string_hash.h"
 
 /* Begin namespace openfpga */
 namespace openfpga {
@@ -39,6 +40,9 @@ class IoLocationMap {
   size_t io_x(const BasicPort& io_port) const;
   size_t io_y(const BasicPort& io_port) const;
   size_t io_z(const BasicPort& io_port) const;
+  /* Find the [x][y][z] coordinate of an I/O port by a single look-up.
+   * Return size_t(-1) for each dimension if the I/O is not found */
+  std::array<size_t, 3> io_coordinate(const BasicPort& io_port) const;
 
  public: /* Public mutators */
   void set_io_index(const size_t& x, const size_t& y, const size_t& z,
@@ -55,6 +59,12 @@ class IoLocationMap {
    * Note that multiple I/Os may be assigned to the same coordinate!
    */
   std::map<std::array<size_t, 3>, std::vector<BasicPort>> io_indices_;
+  /* Coordinate fast lookup by [io_port_name][io_index], which is the
+   * reverse of io_indices_. When an I/O is assigned to multiple coordinates,
+   * the lowest coordinate is kept, which is the first one found by walking
+   * through io_indices_
+   */
+  StringMap<std::vector<std::array<size_t, 3>>> io_coords_;
 };
 
 } /* End namespace openfpga*/
@@ -55,7 +55,11 @@ IoPinTable::e_io_direction IoPinTable::pin_direction(
 std::vector<IoPinTableId> IoPinTable::find_internal_pin(
   const BasicPort& ext_pin, const e_io_direction& pin_direction) const {
   std::vector<IoPinTableId> int_pin_ids;
-  for (auto pin_id : pin_ids_) {
+  auto result = external_pin_lookup_.find(ext_pin.get_name());
+  if (result == external_pin_lookup_.end()) {
+    return int_pin_ids;
+  }
+  for (auto pin_id : result->second) {
     if ((external_pins_[pin_id] == ext_pin) &&
         (pin_directions_[pin_id] == pin_direction)) {
       int_pin_ids.push_back(pin_id);
@@ -67,7 +71,11 @@ std::vector<IoPinTableId> IoPinTable::find_internal_pin(
 std::vector<IoPinTableId> IoPinTable::find_internal_pin_by_name_only(
   const BasicPort& ext_pin) const {
   std::vector<IoPinTableId> int_pin_ids;
-  for (auto pin_id : pin_ids_) {
+  auto result = external_pin_lookup_.find(ext_pin.get_name());
+  if (result == external_pin_lookup_.end()) {
+    return int_pin_ids;
+  }
+  for (auto pin_id : result->second) {
     if (external_pins_[pin_id] == ext_pin) {
       int_pin_ids.push_back(pin_id);
     }
@@ -110,7 +118,19 @@ void IoPinTable::set_internal_pin(const IoPinTableId& pin_id,
 void IoPinTable::set_external_pin(const IoPinTableId& pin_id,
                                   const BasicPort& pin) {
   VTR_ASSERT(valid_pin_id(pin_id));
+  /* Remove the pin from the lookup of its previous name */
+  if (!external_pins_[pin_id].get_name().empty()) {
+    std::vector<IoPinTableId>& prev_pin_ids =
+      external_pin_lookup_[external_pins_[pin_id].get_name()];
+    prev_pin_ids.erase(
+      std::remove(prev_pin_ids.begin(), prev_pin_ids.end(), pin_id),
+      prev_pin_ids.end());
+  }
   external_pins_[pin_id] = pin;
+  /* Keep the pins in the order of their ids, as in the table */
+  std::vector<IoPinTableId>& pin_ids = external_pin_lookup_[pin.get_name()];
+  pin_ids.insert(std::lower_bound(pin_ids.begin(), pin_ids.end(), pin_id),
+                 pin_id);
 }
 
 void IoPinTable::set_pin_side(const IoPinTableId& pin_id, const e_side& side) {
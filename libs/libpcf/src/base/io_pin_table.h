@@ -18,6 +18,7 @@
 /* Headers from openfpgautil library */
 #include "io_pin_table_fwd.h"
 #include "openfpga_port.h"
+#include "openfpga_string_hash.h"
 
 /* begin namespace openfpga */
 namespace openfpga {
@@ -113,6 +114,10 @@ class IoPinTable {
   vtr::vector<IoPinTableId, BasicPort> external_pins_;
   vtr::vector<IoPinTableId, e_side> pin_sides_;
   vtr::vector<IoPinTableId, e_io_direction> pin_directions_;
+
+  /* Fast lookup from the name of an external pin to the pins, so that
+   * finding the internal pins does not walk through the whole table */
+  StringMap<std::vector<IoPinTableId>> external_pin_lookup_;
 };
 
 } /* end namespace openfpga */
@@ -2,6 +2,7 @@
  * Inspired from https://github.com/genbtc/VerilogPCFparser
  ******************************************************************************/
 #include <sstream>
+#include <unordered_set>
 
 /* Headers from vtrutil library */
 #include "vtr_assert.h"
@@ -44,6 +45,13 @@ int pcf2place(const PcfData& pcf_data,
     VTR_LOG("PCF basic check passed\n");
   }
 
+  /* Hash the nets from the blif, so that the direction of each net in pcf
+   * is found without walking through the lists */
+  std::unordered_set<std::string> input_net_set(input_nets.begin(),
+                                                input_nets.end());
+  std::unordered_set<std::string> output_net_set(output_nets.begin(),
+                                                 output_nets.end());
+
   /* Map from location to net */
   std::map<std::array<size_t, 3>, std::string> net_map;
   /* Build the I/O place */
@@ -54,11 +62,9 @@ int pcf2place(const PcfData& pcf_data,
     BasicPort ext_pin = pcf_data.io_pin(io_id);
     /* Find the pin direction from blif reader */
     IoPinTable::e_io_direction pin_direction = IoPinTable::NUM_IO_DIRECTIONS;
-    if (input_nets.end() !=
-        std::find(input_nets.begin(), input_nets.end(), net)) {
+    if (input_net_set.end() != input_net_set.find(net)) {
       pin_direction = IoPinTable::INPUT;
-    } else if (output_nets.end() !=
-               std::find(output_nets.begin(), output_nets.end(), net)) {
+    } else if (output_net_set.end() != output_net_set.find(net)) {
       pin_direction = IoPinTable::OUTPUT;
     } else {
       /* Cannot find the pin, error out! */
@@ -94,9 +100,10 @@ int pcf2place(const PcfData& pcf_data,
     VTR_ASSERT(1 == int_pin_ids.size());
     BasicPort int_pin = io_pin_table.internal_pin(int_pin_ids[0]);
     /* Find the coordinate from io location map */
-    size_t x = io_location_map.io_x(int_pin);
-    size_t y = io_location_map.io_y(int_pin);
-    size_t z = io_location_map.io_z(int_pin);
+    std::array<size_t, 3> io_coord = io_location_map.io_coordinate(int_pin);
+    size_t x = io_coord[0];
+    size_t y = io_coord[1];
+    size_t z = io_coord[2];
     /* Sanity check */
     if (size_t(-1) == x || size_t(-1) == y || size_t(-1) == z) {
       VTR_LOG_ERROR(
@@ -2,6 +2,9 @@
 
 #include <cassert>
 #include <cstdio>
+#include <fstream>
+
+#include "vtr_util.h"
 
 namespace blifparse {
 
@@ -14,15 +17,25 @@ void BlifHeadReader::finish_parse() {
 }
 
 void BlifHeadReader::begin_model(std::string model_name) {
-  // Pass
+  ++num_models_;
 }
 
 void BlifHeadReader::inputs(std::vector<std::string> input_conns) {
-  input_pins_ = input_conns;
+  /* Only the pins of the first model, i.e., the top module, are kept.
+   * A model may declare its inputs in multiple statements */
+  if (1 < num_models_) {
+    return;
+  }
+  input_pins_.insert(input_pins_.end(), input_conns.begin(),
+                     input_conns.end());
 }
 
 void BlifHeadReader::outputs(std::vector<std::string> output_conns) {
-  output_pins_ = output_conns;
+  if (1 < num_models_) {
+    return;
+  }
+  output_pins_.insert(output_pins_.end(), output_conns.begin(),
+                      output_conns.end());
 }
 
 void BlifHeadReader::names(std::vector<std::string> nets,
@@ -73,4 +86,70 @@ void BlifHeadReader::lineno(int line_num) {
   // Pass
 }
 
+void blif_parse_head_filename(const char* filename, Callback& callback) {
+  callback.start_parse();
+  callback.filename(filename);
+
+  std::ifstream ifs(filename);
+  if (!ifs.is_open()) {
+    callback.parse_error(0, std::string(filename), "Could not open file");
+    callback.finish_parse();
+    return;
+  }
+
+  bool in_model = false;
+  int line_num = 0;
+  int statement_line_num = 0;
+  std::string line;
+  std::string statement;
+  while (std::getline(ifs, line)) {
+    ++line_num;
+    if (statement.empty()) {
+      statement_line_num = line_num;
+    }
+    // Strip comments and trailing spaces (including '\r' of DOS files)
+    size_t comment_pos = line.find('#');
+    if (std::string::npos != comment_pos) {
+      line.erase(comment_pos);
+    }
+    size_t last_pos = line.find_last_not_of(" \t\r");
+    line.erase(std::string::npos == last_pos ? 0 : last_pos + 1);
+    // A statement may continue on the next line
+    if (!line.empty() && '\\' == line.back()) {
+      line.back() = ' ';
+      statement += line;
+      continue;
+    }
+    statement += line;
+
+    std::vector<std::string> tokens = vtr::split(statement, " \t");
+    statement.clear();
+    if (tokens.empty()) {
+      continue;
+    }
+    callback.lineno(statement_line_num);
+    std::vector<std::string> nets(tokens.begin() + 1, tokens.end());
+    if (".model" == tokens[0]) {
+      // The head of the first model ends at the next model
+      if (in_model) {
+        break;
+      }
+      in_model = true;
+      callback.begin_model(nets.empty() ? std::string() : nets[0]);
+    } else if (".inputs" == tokens[0]) {
+      callback.inputs(nets);
+    } else if (".outputs" == tokens[0]) {
+      callback.outputs(nets);
+    } else if (".clock" == tokens[0]) {
+      // Clocks are also part of the head, but not used here
+      continue;
+    } else {
+      // Any other statement starts the body of the model
+      break;
+    }
+  }
+
+  callback.finish_parse();
+}
+
 }  // namespace blifparse
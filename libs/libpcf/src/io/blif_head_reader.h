@@ -53,8 +53,16 @@ class BlifHeadReader : public Callback {
  private:
   std::vector<std::string> input_pins_;
   std::vector<std::string> output_pins_;
+  size_t num_models_ = 0;
   bool had_error_ = false;
 };
 
+// Parse only the head of the first model in a BLIF file, i.e., the .model,
+// .inputs and .outputs statements. The file is read line by line and the
+// parsing stops at the first statement of the netlist body, so that the rest
+// of the netlist is never read. The callback receives the same events as
+// blif_parse_filename() for the statements being parsed
+void blif_parse_head_filename(const char* filename, Callback& callback);
+
 }  // namespace blifparse
 #endif
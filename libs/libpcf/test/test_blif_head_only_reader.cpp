@@ -0,0 +1,60 @@
+/********************************************************************
+ * Unit test functions to validate the correctness of
+ * 1. parser which only reads the head of a blif file
+ * 2. consistency of the head-only parser with the full parser, i.e.,
+ *    both parsers should find the same input and output pins
+ *******************************************************************/
+/* Headers from vtrutils */
+#include "vtr_assert.h"
+#include "vtr_log.h"
+
+/* Headers from fabric key */
+#include "blif_head_reader.h"
+
+int main(int argc, const char** argv) {
+  /* Ensure we have only one argument */
+  VTR_ASSERT(2 == argc);
+
+  /* Parse the head of the blif */
+  blifparse::BlifHeadReader head_callback;
+  blifparse::blif_parse_head_filename(argv[1], head_callback);
+  VTR_LOG("Read the head of the blif from a file: %s.\n", argv[1]);
+
+  if (head_callback.had_error()) {
+    VTR_LOG("Read the head of the blif ends with errors\n");
+    return 1;
+  }
+
+  /* Parse the full blif as a reference */
+  blifparse::BlifHeadReader full_callback;
+  blifparse::blif_parse_filename(argv[1], full_callback);
+  if (full_callback.had_error()) {
+    VTR_LOG("Read the full blif ends with errors\n");
+    return 1;
+  }
+
+  /* Output */
+  VTR_LOG("Input pins: \n");
+  for (const std::string& pin : head_callback.input_pins()) {
+    VTR_LOG("%s\n", pin.c_str());
+  }
+  VTR_LOG("Output pins: \n");
+  for (const std::string& pin : head_callback.output_pins()) {
+    VTR_LOG("%s\n", pin.c_str());
+  }
+
+  /* Both parsers should find the same pins in the same order */
+  if (head_callback.input_pins() != full_callback.input_pins()) {
+    VTR_LOG_ERROR(
+      "Input pins of the blif head differ from those of the full blif!\n");
+    return 1;
+  }
+  if (head_callback.output_pins() != full_callback.output_pins()) {
+    VTR_LOG_ERROR(
+      "Output pins of the blif head differ from those of the full blif!\n");
+    return 1;
+  }
+  VTR_LOG("Pins of the blif head are the same as those of the full blif\n");
+
+  return 0;
+}
@@ -0,0 +1,573 @@
+/********************************************************************
+ * Micro-benchmarks for the core data structures and writers of OpenFPGA
+ *
+ * All the benchmarks run on synthetic fabrics whose size is controlled by
+ * the option '--size', so that neither an architecture file nor a VPR run
+ * is required. The synthetic fabric is a 2D array of <size> x <size> tiles,
+ * where each tile is driven by its left neighbor and carries a fixed number
+ * of configuration bits.
+ *
+ * Each benchmark builds its input data outside of the timed region and is
+ * repeated several times. The fastest run is reported in a CSV format:
+ *   benchmark,size,num_items,runtime_sec,items_per_sec,peak_rss_mb
+ * Note that peak_rss_mb is the high-water mark of the whole process when a
+ * benchmark finishes. To measure the peak memory of a single benchmark, run
+ * it alone with the option '--benchmark'.
+ *
+ * Usage:
+ *   openfpga_bench [--size <int>] [--repeat <int>] [--benchmark <name>]
+ *                  [--output <csv file>] [--work_dir <dir>]
+ *******************************************************************/
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/* Headers from vtrutil library */
+#include "vtr_assert.h"
+#include "vtr_log.h"
+#include "vtr_rusage.h"
+
+/* Headers from openfpgautil library */
+#include "openfpga_digest.h"
+#include "openfpga_mmfstream.h"
+#include "openfpga_port.h"
+
+/* Headers from archopenfpga library */
+#include "circuit_library.h"
+
+/* Headers from fpgabitstream library */
+#include "bitstream_manager.h"
+#include "write_xml_arch_bitstream.h"
+
+/* Headers from openfpga library */
+#include "fabric_bitstream.h"
+#include "fabric_bitstream_utils.h"
+#include "fabric_verilog_options.h"
+#include "module_manager.h"
+#include "mux_graph.h"
+#include "verilog_module_writer.h"
+
+using namespace openfpga;
+
+/********************************************************************
+ * Parameters of the synthetic fabric
+ *******************************************************************/
+/* Width of the data input and output ports of each tile */
+constexpr size_t BENCH_NUM_TILE_PINS = 32;
+/* Number of configurable blocks in each tile */
+constexpr size_t BENCH_NUM_TILE_BLOCKS = 8;
+/* Number of configuration bits in each configurable block */
+constexpr size_t BENCH_NUM_BLOCK_BITS = 32;
+/* Number of configuration regions of the fabric bitstream */
+constexpr size_t BENCH_NUM_REGIONS = 4;
+
+/********************************************************************
+ * Options and results of benchmarks
+ *******************************************************************/
+struct BenchOption {
+  size_t size = 32;
+  size_t repeat = 3;
+  std::string benchmark;
+  std::string output;
+  std::string work_dir = ".";
+};
+
+/* A benchmark builds its own input data, runs the kernel under test and
+ * returns the runtime of the kernel in seconds. The number of items
+ * processed by the kernel, e.g., nets or bits, is returned by reference */
+typedef std::function<double(const BenchOption& option, size_t& num_items)>
+  BenchFunc;
+
+struct BenchCase {
+  std::string name;
+  BenchFunc func;
+};
+
+typedef std::chrono::steady_clock BenchClock;
+
+static double elapsed_seconds(const BenchClock::time_point& start) {
+  return std::chrono::duration<double>(BenchClock::now() - start).count();
+}
+
+/* Find the minimum number of bits to encode a number of addresses */
+static size_t find_num_address_bits(const size_t& num_addresses) {
+  size_t num_bits = 1;
+  while ((size_t(1) << num_bits) < num_addresses) {
+    num_bits++;
+  }
+  return num_bits;
+}
+
+/* Encode an index into a binary address, MSB first */
+static std::vector<char> encode_bench_address(const size_t& index,
+                                              const size_t& num_bits) {
+  std::vector<char> address(num_bits, '0');
+  for (size_t ibit = 0; ibit < num_bits; ++ibit) {
+    if (0 != (index & (size_t(1) << ibit))) {
+      address[num_bits - 1 - ibit] = '1';
+    }
+  }
+  return address;
+}
+
+/********************************************************************
+ * Build a synthetic top-level module in the module manager:
+ * - A tile module with a data input port, a data output port and a clock
+ * - A top module with <size> x <size> tile instances
+ * - Each row of tiles is chained: the top-level input drives the first
+ *   tile, each tile drives its right neighbor and the last tile drives the
+ *   top-level output
+ * - The clock of the top module drives all the tiles
+ * Return the id of the top module
+ *******************************************************************/
+static ModuleId build_bench_module_graph(ModuleManager& module_manager,
+                                         const size_t& size) {
+  ModuleId tile_module = module_manager.add_module("bench_tile");
+  ModulePortId tile_in = module_manager.add_port(
+    tile_module, BasicPort("in", BENCH_NUM_TILE_PINS),
+    ModuleManager::MODULE_INPUT_PORT);
+  ModulePortId tile_out = module_manager.add_port(
+    tile_module, BasicPort("out", BENCH_NUM_TILE_PINS),
+    ModuleManager::MODULE_OUTPUT_PORT);
+  ModulePortId tile_clk = module_manager.add_port(
+    tile_module, BasicPort("clk", 1), ModuleManager::MODULE_CLOCK_PORT);
+
+  ModuleId top_module = module_manager.add_module("fpga_top");
+  ModulePortId top_in = module_manager.add_port(
+    top_module, BasicPort("in", size * BENCH_NUM_TILE_PINS),
+    ModuleManager::MODULE_INPUT_PORT);
+  ModulePortId top_out = module_manager.add_port(
+    top_module, BasicPort("out", size * BENCH_NUM_TILE_PINS),
+    ModuleManager::MODULE_OUTPUT_PORT);
+  ModulePortId top_clk = module_manager.add_port(
+    top_module, BasicPort("clk", 1), ModuleManager::MODULE_CLOCK_PORT);
+
+  /* Tile (x, y) is the instance (y * size + x) */
+  for (size_t itile = 0; itile < size * size; ++itile) {
+    module_manager.add_child_module(top_module, tile_module);
+  }
+
+  module_manager.reserve_module_nets(
+    top_module,
+    size * size * BENCH_NUM_TILE_PINS + size * BENCH_NUM_TILE_PINS + 1);
+
+  /* Clock network */
+  ModuleNetId clk_net = module_manager.create_module_net(top_module);
+  module_manager.add_module_net_source(top_module, clk_net, top_module, 0,
+                                       top_clk, 0);
+  module_manager.reserve_module_net_sinks(top_module, clk_net, size * size);
+  for (size_t itile = 0; itile < size * size; ++itile) {
+    module_manager.add_module_net_sink(top_module, clk_net, tile_module, itile,
+                                       tile_clk, 0);
+  }
+
+  /* Data path of each row */
+  for (size_t iy = 0; iy < size; ++iy) {
+    for (size_t ipin = 0; ipin < BENCH_NUM_TILE_PINS; ++ipin) {
+      size_t top_pin = iy * BENCH_NUM_TILE_PINS + ipin;
+      ModuleNetId net = module_manager.create_module_net(top_module);
+      module_manager.add_module_net_source(top_module, net, top_module, 0,
+                                           top_in, top_pin);
+      module_manager.add_module_net_sink(top_module, net, tile_module,
+                                         iy * size, tile_in, ipin);
+      for (size_t ix = 0; ix < size; ++ix) {
+        net = module_manager.create_module_net(top_module);
+        module_manager.add_module_net_source(top_module, net, tile_module,
+                                             iy * size + ix, tile_out, ipin);
+        if (ix == size - 1) {
+          module_manager.add_module_net_sink(top_module, net, top_module, 0,
+                                             top_out, top_pin);
+        } else {
+          module_manager.add_module_net_sink(top_module, net, tile_module,
+                                             iy * size + ix + 1, tile_in, ipin);
+        }
+      }
+    }
+  }
+
+  return top_module;
+}
+
+/********************************************************************
+ * Build a synthetic bitstream database:
+ * the top block contains one block per tile, each of which contains a
+ * number of configurable blocks with a fixed number of bits
+ *******************************************************************/
+static void build_bench_bitstream(BitstreamManager& bitstream_manager,
+                                  const size_t& size) {
+  size_t num_tiles = size * size;
+  bitstream_manager.reserve_blocks(1 + num_tiles +
+                                   num_tiles * BENCH_NUM_TILE_BLOCKS);
+  bitstream_manager.reserve_bits(num_tiles * BENCH_NUM_TILE_BLOCKS *
+                                 BENCH_NUM_BLOCK_BITS);
+
+  ConfigBlockId top_block = bitstream_manager.add_block("fpga_top");
+  bitstream_manager.reserve_child_blocks(top_block, num_tiles);
+  for (size_t itile = 0; itile < num_tiles; ++itile) {
+    ConfigBlockId tile_block =
+      bitstream_manager.add_block("bench_tile_" + std::to_string(itile));
+    bitstream_manager.add_child_block(top_block, tile_block);
+    bitstream_manager.reserve_child_blocks(tile_block, BENCH_NUM_TILE_BLOCKS);
+    for (size_t iblk = 0; iblk < BENCH_NUM_TILE_BLOCKS; ++iblk) {
+      ConfigBlockId mem_block =
+        bitstream_manager.add_block("mem_" + std::to_string(iblk));
+      bitstream_manager.add_child_block(tile_block, mem_block);
+      /* A pseudo-random pattern, so that both values are present */
+      std::vector<bool> block_bits(BENCH_NUM_BLOCK_BITS);
+      for (size_t ibit = 0; ibit < BENCH_NUM_BLOCK_BITS; ++ibit) {
+        block_bits[ibit] = (0 != ((itile + iblk + ibit) % 3));
+      }
+      bitstream_manager.add_block_bits(mem_block, block_bits);
+    }
+  }
+}
+
+/********************************************************************
+ * Build a synthetic fabric bitstream from a bitstream database
+ * Configuration bits are evenly split into regions.
+ * - For frame-based protocol, each bit is addressed by its index in the
+ *   region
+ * - For memory bank protocol, the bits of each region are placed in a
+ *   square array, addressed by a BL and a WL
+ *******************************************************************/
+static void build_bench_fabric_bitstream(
+  FabricBitstream& fabric_bitstream, const BitstreamManager& bitstream_manager,
+  const bool& memory_bank) {
+  size_t num_region_bits =
+    (bitstream_manager.num_bits() + BENCH_NUM_REGIONS - 1) / BENCH_NUM_REGIONS;
+  size_t num_bls = 1;
+  while (num_bls * num_bls < num_region_bits) {
+    num_bls++;
+  }
+  size_t addr_size =
+    find_num_address_bits(memory_bank ? num_bls : num_region_bits);
+
+  fabric_bitstream.set_use_address(true);
+  fabric_bitstream.set_address_length(addr_size);
+  fabric_bitstream.set_use_wl_address(memory_bank);
+  fabric_bitstream.set_wl_address_length(addr_size);
+  fabric_bitstream.reserve_bits(bitstream_manager.num_bits());
+  fabric_bitstream.reserve_regions(BENCH_NUM_REGIONS);
+  for (size_t iregion = 0; iregion < BENCH_NUM_REGIONS; ++iregion) {
+    fabric_bitstream.add_region();
+  }
+
+  size_t bit_index = 0;
+  for (const ConfigBitId& config_bit : bitstream_manager.bits()) {
+    FabricBitRegionId region =
+      FabricBitRegionId(bit_index / num_region_bits);
+    size_t region_index = bit_index % num_region_bits;
+    FabricBitId fabric_bit = fabric_bitstream.add_bit(config_bit);
+    if (memory_bank) {
+      fabric_bitstream.set_bit_bl_address(
+        fabric_bit, encode_bench_address(region_index % num_bls, addr_size));
+      fabric_bitstream.set_bit_wl_address(
+        fabric_bit, encode_bench_address(region_index / num_bls, addr_size));
+    } else {
+      fabric_bitstream.set_bit_address(
+        fabric_bit, encode_bench_address(region_index, addr_size));
+    }
+    fabric_bitstream.set_bit_din(fabric_bit,
+                                 bitstream_manager.bit_value(config_bit));
+    fabric_bitstream.add_bit_to_region(region, fabric_bit);
+    bit_index++;
+  }
+}
+
+/********************************************************************
+ * Build a synthetic circuit library with one multiplexer model per
+ * structure, all of which use a transmission gate
+ *******************************************************************/
+static CircuitLibrary build_bench_circuit_library() {
+  CircuitLibrary circuit_lib;
+
+  CircuitModelId tgate = circuit_lib.add_model(CIRCUIT_MODEL_PASSGATE);
+  circuit_lib.set_model_name(tgate, "TGATE");
+  circuit_lib.set_pass_gate_logic_type(tgate,
+                                       CIRCUIT_MODEL_PASS_GATE_TRANSMISSION);
+
+  std::vector<e_circuit_model_structure> structures = {
+    CIRCUIT_MODEL_STRUCTURE_TREE, CIRCUIT_MODEL_STRUCTURE_ONELEVEL,
+    CIRCUIT_MODEL_STRUCTURE_MULTILEVEL};
+  for (const e_circuit_model_structure& structure : structures) {
+    CircuitModelId mux = circuit_lib.add_model(CIRCUIT_MODEL_MUX);
+    std::string mux_name =
+      std::string("mux_") + CIRCUIT_MODEL_STRUCTURE_TYPE_STRING[structure];
+    circuit_lib.set_model_name(mux, mux_name);
+    circuit_lib.set_mux_structure(mux, structure);
+    if (CIRCUIT_MODEL_STRUCTURE_MULTILEVEL == structure) {
+      circuit_lib.set_mux_num_levels(mux, 2);
+    }
+    circuit_lib.set_model_pass_gate_logic(mux, "TGATE");
+  }
+  circuit_lib.build_model_links();
+
+  return circuit_lib;
+}
+
+/********************************************************************
+ * Benchmarks
+ *******************************************************************/
+/* Create modules, ports, instances and nets */
+static double bench_module_manager_build(const BenchOption& option,
+                                         size_t& num_items) {
+  BenchClock::time_point start = BenchClock::now();
+  ModuleManager module_manager;
+  ModuleId top_module = build_bench_module_graph(module_manager, option.size);
+  double runtime = elapsed_seconds(start);
+
+  num_items = module_manager.module_nets(top_module).size();
+  return runtime;
+}
+
+/* Find the net of each input pin of each tile instance */
+static double bench_module_instance_port_net(const BenchOption& option,
+                                             size_t& num_items) {
+  ModuleManager module_manager;
+  ModuleId top_module = build_bench_module_graph(module_manager, option.size);
+  ModuleId tile_module = module_manager.find_module("bench_tile");
+  ModulePortId tile_in = module_manager.find_module_port(tile_module, "in");
+
+  BenchClock::time_point start = BenchClock::now();
+  num_items = 0;
+  size_t num_found = 0;
+  for (const size_t& inst :
+       module_manager.child_module_instances(top_module, tile_module)) {
+    for (size_t ipin = 0; ipin < BENCH_NUM_TILE_PINS; ++ipin) {
+      ModuleNetId net = module_manager.module_instance_port_net(
+        top_module, tile_module, inst, tile_in, ipin);
+      if (module_manager.valid_module_net_id(top_module, net)) {
+        num_found++;
+      }
+      num_items++;
+    }
+  }
+  double runtime = elapsed_seconds(start);
+
+  /* Each input pin is driven, this also keeps the loop from being skipped */
+  VTR_ASSERT(num_found == num_items);
+  return runtime;
+}
+
+/* Build the bitstream database */
+static double bench_bitstream_manager_build(const BenchOption& option,
+                                            size_t& num_items) {
+  BenchClock::time_point start = BenchClock::now();
+  BitstreamManager bitstream_manager;
+  build_bench_bitstream(bitstream_manager, option.size);
+  double runtime = elapsed_seconds(start);
+
+  num_items = bitstream_manager.num_bits();
+  return runtime;
+}
+
+/* Build a fabric bitstream for frame-based protocol */
+static double bench_fabric_bitstream_build(const BenchOption& option,
+                                           size_t& num_items) {
+  BitstreamManager bitstream_manager;
+  build_bench_bitstream(bitstream_manager, option.size);
+
+  BenchClock::time_point start = BenchClock::now();
+  FabricBitstream fabric_bitstream;
+  build_bench_fabric_bitstream(fabric_bitstream, bitstream_manager, false);
+  double runtime = elapsed_seconds(start);
+
+  num_items = fabric_bitstream.num_bits();
+  return runtime;
+}
+
+/* Reorganize a fabric bitstream by frame addresses */
+static double bench_frame_bitstream_by_address(const BenchOption& option,
+                                               size_t& num_items) {
+  BitstreamManager bitstream_manager;
+  build_bench_bitstream(bitstream_manager, option.size);
+  FabricBitstream fabric_bitstream;
+  build_bench_fabric_bitstream(fabric_bitstream, bitstream_manager, false);
+
+  BenchClock::time_point start = BenchClock::now();
+  FrameFabricBitstream frame_bitstream =
+    build_frame_based_fabric_bitstream_by_address(fabric_bitstream);
+  double runtime = elapsed_seconds(start);
+
+  VTR_ASSERT(!frame_bitstream.empty());
+  num_items = fabric_bitstream.num_bits();
+  return runtime;
+}
+
+/* Reorganize a fabric bitstream by BL/WL addresses */
+static double bench_memory_bank_bitstream_by_address(const BenchOption& option,
+                                                     size_t& num_items) {
+  BitstreamManager bitstream_manager;
+  build_bench_bitstream(bitstream_manager, option.size);
+  FabricBitstream fabric_bitstream;
+  build_bench_fabric_bitstream(fabric_bitstream, bitstream_manager, true);
+
+  BenchClock::time_point start = BenchClock::now();
+  MemoryBankFabricBitstream memory_bank_bitstream =
+    build_memory_bank_fabric_bitstream_by_address(fabric_bitstream);
+  double runtime = elapsed_seconds(start);
+
+  VTR_ASSERT(!memory_bank_bitstream.empty());
+  num_items = fabric_bitstream.num_bits();
+  return runtime;
+}
+
+/* Build multiplexer graphs of all the structures, from size 2 to
+ * (2 * size) */
+static double bench_mux_graph_build(const BenchOption& option,
+                                    size_t& num_items) {
+  CircuitLibrary circuit_lib = build_bench_circuit_library();
+
+  BenchClock::time_point start = BenchClock::now();
+  num_items = 0;
+  for (const CircuitModelId& mux :
+       circuit_lib.models_by_type(CIRCUIT_MODEL_MUX)) {
+    for (size_t mux_size = 2; mux_size <= 2 * option.size; ++mux_size) {
+      MuxGraph mux_graph(circuit_lib, mux, mux_size);
+      num_items += mux_graph.num_memory_bits();
+    }
+  }
+  return elapsed_seconds(start);
+}
+
+/* Output the top module to a Verilog netlist */
+static double bench_verilog_module_writer(const BenchOption& option,
+                                          size_t& num_items) {
+  ModuleManager module_manager;
+  ModuleId top_module = build_bench_module_graph(module_manager, option.size);
+  FabricVerilogOption verilog_option;
+  std::string fname =
+    format_dir_path(option.work_dir) + std::string("openfpga_bench_top.v");
+
+  BenchClock::time_point start = BenchClock::now();
+  mmostream fp(fname);
+  check_file_mmostream(fname.c_str(), fp);
+  write_verilog_module_to_file(fp, module_manager, top_module, verilog_option);
+  fp.close();
+  double runtime = elapsed_seconds(start);
+
+  num_items = module_manager.module_nets(top_module).size();
+  return runtime;
+}
+
+/* Output the bitstream database to an XML file */
+static double bench_arch_bitstream_writer(const BenchOption& option,
+                                          size_t& num_items) {
+  BitstreamManager bitstream_manager;
+  build_bench_bitstream(bitstream_manager, option.size);
+  std::string fname =
+    format_dir_path(option.work_dir) + std::string("openfpga_bench_bits.xml");
+
+  BenchClock::time_point start = BenchClock::now();
+  int status =
+    write_xml_architecture_bitstream(bitstream_manager, fname, false);
+  double runtime = elapsed_seconds(start);
+
+  VTR_ASSERT(0 == status);
+  num_items = bitstream_manager.num_bits();
+  return runtime;
+}
+
+/********************************************************************
+ * Parse the command-line options. Return false if any is invalid
+ *******************************************************************/
+static bool parse_bench_option(const int& argc, const char** argv,
+                               BenchOption& option) {
+  for (int iarg = 1; iarg < argc; ++iarg) {
+    std::string arg(argv[iarg]);
+    if (iarg + 1 == argc) {
+      VTR_LOG_ERROR("Option '%s' requires a value!\n", arg.c_str());
+      return false;
+    }
+    std::string value(argv[++iarg]);
+    if (arg == "--size" || arg == "--repeat") {
+      size_t number = 0;
+      if ((value.find_first_not_of("0123456789") != std::string::npos) ||
+          (value.empty()) || (0 == (number = std::stoul(value)))) {
+        VTR_LOG_ERROR("Option '%s' expects a positive number but got '%s'!\n",
+                      arg.c_str(), value.c_str());
+        return false;
+      }
+      if (arg == "--size") {
+        option.size = number;
+      } else {
+        option.repeat = number;
+      }
+    } else if (arg == "--benchmark") {
+      option.benchmark = value;
+    } else if (arg == "--output") {
+      option.output = value;
+    } else if (arg == "--work_dir") {
+      option.work_dir = value;
+    } else {
+      VTR_LOG_ERROR("Unknown option '%s'!\n", arg.c_str());
+      return false;
+    }
+  }
+  return true;
+}
+
+int main(int argc, const char** argv) {
+  BenchOption option;
+  if (!parse_bench_option(argc, argv, option)) {
+    VTR_LOG(
+      "Usage: %s [--size <int>] [--repeat <int>] [--benchmark <name>] "
+      "[--output <csv file>] [--work_dir <dir>]\n",
+      argv[0]);
+    return 1;
+  }
+
+  std::vector<BenchCase> bench_cases = {
+    {"module_manager_build", bench_module_manager_build},
+    {"module_instance_port_net", bench_module_instance_port_net},
+    {"bitstream_manager_build", bench_bitstream_manager_build},
+    {"fabric_bitstream_build", bench_fabric_bitstream_build},
+    {"frame_bitstream_by_address", bench_frame_bitstream_by_address},
+    {"memory_bank_bitstream_by_address",
+     bench_memory_bank_bitstream_by_address},
+    {"mux_graph_build", bench_mux_graph_build},
+    {"verilog_module_writer", bench_verilog_module_writer},
+    {"arch_bitstream_writer", bench_arch_bitstream_writer}};
+
+  std::fstream csv_file;
+  if (!option.output.empty()) {
+    csv_file.open(option.output, std::ios::out | std::ios::trunc);
+    check_file_stream(option.output.c_str(), csv_file);
+  }
+  std::ostream& csv = option.output.empty() ? std::cout : csv_file;
+  csv << "benchmark,size,num_items,runtime_sec,items_per_sec,peak_rss_mb\n";
+
+  size_t num_run = 0;
+  for (const BenchCase& bench_case : bench_cases) {
+    if (!option.benchmark.empty() && option.benchmark != bench_case.name) {
+      continue;
+    }
+    double best_runtime = -1.;
+    size_t num_items = 0;
+    for (size_t irun = 0; irun < option.repeat; ++irun) {
+      double runtime = bench_case.func(option, num_items);
+      if ((best_runtime < 0.) || (runtime < best_runtime)) {
+        best_runtime = runtime;
+      }
+    }
+    double items_per_sec = 0.;
+    if (best_runtime > 0.) {
+      items_per_sec = num_items / best_runtime;
+    }
+    double peak_rss_mb = vtr::get_max_rss() / 1024. / 1024.;
+    csv << bench_case.name << "," << option.size << "," << num_items << ","
+        << best_runtime << "," << items_per_sec << "," << peak_rss_mb
+        << std::endl;
+    num_run++;
+  }
+
+  if (0 == num_run) {
+    VTR_LOG_ERROR("Unknown benchmark '%s'!\n", option.benchmark.c_str());
+    return 1;
+  }
+  return 0;
+}
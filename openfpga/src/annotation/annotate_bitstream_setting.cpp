@@ -15,6 +15,7 @@
 #include "annotate_bitstream_setting.h"
 #include "openfpga_pb_parser.h"
 #include "openfpga_tokenizer.h"
+#include "pb_type_path_index.h"
 #include "pb_type_utils.h"
 
 /* begin namespace openfpga */
@@ -22,12 +23,12 @@ namespace openfpga {
 
 /********************************************************************
  * Annotate mif_source setting based on VPR device information
- *  - Find the pb_type with the same path walker as other bitstream settings
+ *  - Find the pb_type with the same path index as other bitstream settings
  *  - Bind a pb_graph_node of that type (instance 0; instances are placement)
  *******************************************************************/
 static int annotate_mif_source_setting(
   const BitstreamSetting& bitstream_setting,
-  const DeviceContext& vpr_device_ctx,
+  const PbTypePathIndex& pb_type_path_index,
   VprBitstreamAnnotation& vpr_bitstream_annotation) {
   vpr_bitstream_annotation.clear_mif_sources();
   for (const MifSourceSettingId& source_id :
@@ -39,46 +40,17 @@ static int annotate_mif_source_setting(
     const std::vector<std::string> target_pb_mode_names = parser.modes();
 
     bool link_success = false;
-    for (const t_logical_block_type& lb_type :
-         vpr_device_ctx.logical_block_types) {
-      if (nullptr == lb_type.pb_type || nullptr == lb_type.pb_graph_head) {
-        continue;
-      }
-      if (target_pb_type_names[0] != std::string(lb_type.pb_type->name)) {
-        continue;
-      }
-      t_pb_type* target_pb_type = try_find_pb_type_with_given_path(
-        lb_type.pb_type, target_pb_type_names, target_pb_mode_names);
-      if (nullptr == target_pb_type) {
-        continue;
-      }
-
-      /* try_find_* returns the type; descend the graph at instance 0. */
-      t_pb_graph_node* pb_graph_node = lb_type.pb_graph_head;
-      bool walk_ok = true;
-      for (size_t i = 0; i < target_pb_mode_names.size(); ++i) {
-        t_mode* mode = find_pb_type_mode(pb_graph_node->pb_type,
-                                         target_pb_mode_names[i].c_str());
-        t_pb_type* child_type =
-          (nullptr == mode) ? nullptr
-                            : find_mode_child_pb_type(
-                                mode, target_pb_type_names[i + 1].c_str());
-        if (nullptr == mode || nullptr == child_type ||
-            child_type->num_pb < 1) {
-          walk_ok = false;
-          break;
-        }
-        const int child_idx =
-          static_cast<int>(child_type - mode->pb_type_children);
-        pb_graph_node =
-          &(pb_graph_node->child_pb_graph_nodes[mode->index][child_idx][0]);
-      }
-      if (false == walk_ok || pb_graph_node->pb_type != target_pb_type) {
+    for (const PbTypePathIndex::t_pb_type_entry& target_entry :
+         pb_type_path_index.find_pb_types(target_pb_type_names,
+                                          target_pb_mode_names)) {
+      /* The index keeps the pb_graph_node of instance 0 along the path */
+      if (nullptr == target_entry.pb_graph_node) {
         continue;
       }
 
       vpr_bitstream_annotation.add_mif_source(
-        pb_graph_node, bitstream_setting.mif_source_source(source_id),
+        target_entry.pb_graph_node,
+        bitstream_setting.mif_source_source(source_id),
         bitstream_setting.mif_source_content(source_id));
       link_success = true;
       break;
@@ -102,7 +74,7 @@ static int annotate_mif_source_setting(
  *******************************************************************/
 static int annotate_bitstream_pb_type_setting(
   const BitstreamSetting& bitstream_setting,
-  const DeviceContext& vpr_device_ctx,
+  const PbTypePathIndex& pb_type_path_index,
   VprBitstreamAnnotation& vpr_bitstream_annotation) {
   for (const auto& bitstream_pb_type_setting_id :
        bitstream_setting.pb_type_settings()) {
@@ -118,29 +90,15 @@ static int annotate_bitstream_pb_type_setting(
       bitstream_setting.parent_mode_names(bitstream_pb_type_setting_id);
 
     /* Pb type information are located at the logic_block_types in the device
-     * context of VPR We iterate over the vectors and find the pb_type matches
-     * the parent_pb_type_name
+     * context of VPR. The path index finds all the pb_types matching the
+     * full path
      */
     bool link_success = false;
 
-    for (const t_logical_block_type& lb_type :
-         vpr_device_ctx.logical_block_types) {
-      /* By pass nullptr for pb_type head */
-      if (nullptr == lb_type.pb_type) {
-        continue;
-      }
-      /* Check the name of the top-level pb_type, if it does not match, we can
-       * bypass */
-      if (target_pb_type_names[0] != std::string(lb_type.pb_type->name)) {
-        continue;
-      }
-      /* Match the name in the top-level, we go further to search the pb_type in
-       * the graph */
-      t_pb_type* target_pb_type = try_find_pb_type_with_given_path(
-        lb_type.pb_type, target_pb_type_names, target_pb_mode_names);
-      if (nullptr == target_pb_type) {
-        continue;
-      }
+    for (const PbTypePathIndex::t_pb_type_entry& target_entry :
+         pb_type_path_index.find_pb_types(target_pb_type_names,
+                                          target_pb_mode_names)) {
+      t_pb_type* target_pb_type = target_entry.pb_type;
 
       /* Found one, build annotation */
       if (std::string("eblif") != bitstream_setting.pb_type_bitstream_source(
@@ -207,7 +165,7 @@ static int annotate_bitstream_pb_type_setting(
  *******************************************************************/
 static int annotate_bitstream_default_mode_setting(
   const BitstreamSetting& bitstream_setting,
-  const DeviceContext& vpr_device_ctx,
+  const PbTypePathIndex& pb_type_path_index,
   VprDeviceAnnotation& vpr_device_annotation) {
   for (const auto& bitstream_default_mode_setting_id :
        bitstream_setting.default_mode_settings()) {
@@ -226,29 +184,15 @@ static int annotate_bitstream_default_mode_setting(
       bitstream_setting.default_mode_bits(bitstream_default_mode_setting_id);
 
     /* Pb type information are located at the logic_block_types in the device
-     * context of VPR We iterate over the vectors and find the pb_type matches
-     * the parent_pb_type_name
+     * context of VPR. The path index finds all the pb_types matching the
+     * full path
      */
     bool link_success = false;
 
-    for (const t_logical_block_type& lb_type :
-         vpr_device_ctx.logical_block_types) {
-      /* By pass nullptr for pb_type head */
-      if (nullptr == lb_type.pb_type) {
-        continue;
-      }
-      /* Check the name of the top-level pb_type, if it does not match, we can
-       * bypass */
-      if (target_pb_type_names[0] != std::string(lb_type.pb_type->name)) {
-        continue;
-      }
-      /* Match the name in the top-level, we go further to search the pb_type in
-       * the graph */
-      t_pb_type* target_pb_type = try_find_pb_type_with_given_path(
-        lb_type.pb_type, target_pb_type_names, target_pb_mode_names);
-      if (nullptr == target_pb_type) {
-        continue;
-      }
+    for (const PbTypePathIndex::t_pb_type_entry& target_entry :
+         pb_type_path_index.find_pb_types(target_pb_type_names,
+                                          target_pb_mode_names)) {
+      t_pb_type* target_pb_type = target_entry.pb_type;
 
       /* Found one, pre-check and build annotation */
       if (vpr_device_annotation.pb_type_mode_bits(target_pb_type).size() !=
@@ -290,7 +234,7 @@ static int annotate_bitstream_default_mode_setting(
  *******************************************************************/
 static int annotate_bitstream_pcf_mode_setting(
   const BitstreamSetting& bitstream_setting,
-  const DeviceContext& vpr_device_ctx,
+  const PbTypePathIndex& pb_type_path_index,
   VprBitstreamAnnotation& vpr_bitstream_annotation,
   const VprDeviceAnnotation& vpr_device_annotation) {
   for (const auto& bitstream_pcf_mode_setting_id :
@@ -313,29 +257,15 @@ static int annotate_bitstream_pcf_mode_setting(
     int offset = bitstream_setting.pcf_mode_bitstream_offset(
       bitstream_pcf_mode_setting_id);
     /* Pb type information are located at the logic_block_types in the device
-     * context of VPR We iterate over the vectors and find the pb_type matches
-     * the parent_pb_type_name
+     * context of VPR. The path index finds all the pb_types matching the
+     * full path
      */
     bool link_success = false;
 
-    for (const t_logical_block_type& lb_type :
-         vpr_device_ctx.logical_block_types) {
-      /* By pass nullptr for pb_type head */
-      if (nullptr == lb_type.pb_type) {
-        continue;
-      }
-      /* Check the name of the top-level pb_type, if it does not match, we can
-       * bypass */
-      if (target_pb_type_names[0] != std::string(lb_type.pb_type->name)) {
-        continue;
-      }
-      /* Match the name in the top-level, we go further to search the pb_type in
-       * the graph */
-      t_pb_type* target_pb_type = try_find_pb_type_with_given_path(
-        lb_type.pb_type, target_pb_type_names, target_pb_mode_names);
-      if (nullptr == target_pb_type) {
-        continue;
-      }
+    for (const PbTypePathIndex::t_pb_type_entry& target_entry :
+         pb_type_path_index.find_pb_types(target_pb_type_names,
+                                          target_pb_mode_names)) {
+      t_pb_type* target_pb_type = target_entry.pb_type;
 
       /* Found one, pre-check and build annotation */
       if (vpr_device_annotation.pb_type_mode_bits(target_pb_type).size() -
@@ -454,7 +384,7 @@ static int annotate_bitstream_clock_routing_setting(
  *******************************************************************/
 static int annotate_bitstream_interconnect_setting(
   const BitstreamSetting& bitstream_setting,
-  const DeviceContext& vpr_device_ctx,
+  const PbTypePathIndex& pb_type_path_index,
   const VprDeviceAnnotation& vpr_device_annotation,
   VprBitstreamAnnotation& vpr_bitstream_annotation) {
   for (const auto& bitstream_interc_setting_id :
@@ -467,8 +397,8 @@ static int annotate_bitstream_interconnect_setting(
       bitstream_setting.parent_pb_type_names(bitstream_interc_setting_id);
     target_pb_mode_names =
       bitstream_setting.parent_mode_names(bitstream_interc_setting_id);
-    /* Kick out the last mode so that we can use an existing function search the
-     * pb_type in graph */
+    /* Kick out the last mode so that we can search the pb_type in the path
+     * index */
     std::string expected_physical_mode_name = target_pb_mode_names.back();
     target_pb_mode_names.pop_back();
 
@@ -478,29 +408,15 @@ static int annotate_bitstream_interconnect_setting(
       bitstream_setting.default_path(bitstream_interc_setting_id);
 
     /* Pb type information are located at the logic_block_types in the device
-     * context of VPR We iterate over the vectors and find the pb_type matches
-     * the parent_pb_type_name
+     * context of VPR. The path index finds all the pb_types matching the
+     * full path
      */
     bool link_success = false;
 
-    for (const t_logical_block_type& lb_type :
-         vpr_device_ctx.logical_block_types) {
-      /* By pass nullptr for pb_type head */
-      if (nullptr == lb_type.pb_type) {
-        continue;
-      }
-      /* Check the name of the top-level pb_type, if it does not match, we can
-       * bypass */
-      if (target_pb_type_names[0] != std::string(lb_type.pb_type->name)) {
-        continue;
-      }
-      /* Match the name in the top-level, we go further to search the pb_type in
-       * the graph */
-      t_pb_type* target_pb_type = try_find_pb_type_with_given_path(
-        lb_type.pb_type, target_pb_type_names, target_pb_mode_names);
-      if (nullptr == target_pb_type) {
-        continue;
-      }
+    for (const PbTypePathIndex::t_pb_type_entry& target_entry :
+         pb_type_path_index.find_pb_types(target_pb_type_names,
+                                          target_pb_mode_names)) {
+      t_pb_type* target_pb_type = target_entry.pb_type;
 
       /* Found one, build annotation */
       t_mode* physical_mode =
@@ -519,8 +435,16 @@ static int annotate_bitstream_interconnect_setting(
 
       /* Find the interconnect name under the physical mode of a physical
        * pb_type */
-      t_interconnect* pb_interc =
-        find_pb_mode_interconnect(physical_mode, interconnect_name.c_str());
+      t_interconnect* pb_interc = nullptr;
+      std::vector<std::string> interc_mode_names = target_pb_mode_names;
+      interc_mode_names.push_back(expected_physical_mode_name);
+      for (t_interconnect* cand_interc : pb_type_path_index.find_interconnects(
+             target_pb_type_names, interc_mode_names, interconnect_name)) {
+        if (physical_mode == cand_interc->parent_mode) {
+          pb_interc = cand_interc;
+          break;
+        }
+      }
 
       if (nullptr == pb_interc) {
         VTR_LOG_ERROR(
@@ -583,14 +507,17 @@ int annotate_bitstream_setting(
   VprBitstreamAnnotation& vpr_bitstream_annotation) {
   int status = CMD_EXEC_SUCCESS;
 
-  status = annotate_mif_source_setting(bitstream_setting, vpr_device_ctx,
+  /* Index all the pb_type paths once, which are shared by all the settings */
+  PbTypePathIndex pb_type_path_index(vpr_device_ctx.logical_block_types);
+
+  status = annotate_mif_source_setting(bitstream_setting, pb_type_path_index,
                                        vpr_bitstream_annotation);
   if (status == CMD_EXEC_FATAL_ERROR) {
     return status;
   }
 
-  status = annotate_bitstream_pb_type_setting(bitstream_setting, vpr_device_ctx,
-                                              vpr_bitstream_annotation);
+  status = annotate_bitstream_pb_type_setting(
+    bitstream_setting, pb_type_path_index, vpr_bitstream_annotation);
   if (status == CMD_EXEC_FATAL_ERROR) {
     return status;
   }
@@ -602,20 +529,20 @@ int annotate_bitstream_setting(
   }
 
   status = annotate_bitstream_default_mode_setting(
-    bitstream_setting, vpr_device_ctx, vpr_device_annotation);
+    bitstream_setting, pb_type_path_index, vpr_device_annotation);
   if (status == CMD_EXEC_FATAL_ERROR) {
     return status;
   }
 
   status = annotate_bitstream_pcf_mode_setting(
-    bitstream_setting, vpr_device_ctx, vpr_bitstream_annotation,
+    bitstream_setting, pb_type_path_index, vpr_bitstream_annotation,
     vpr_device_annotation);
   if (status == CMD_EXEC_FATAL_ERROR) {
     return status;
   }
 
   status = annotate_bitstream_interconnect_setting(
-    bitstream_setting, vpr_device_ctx, vpr_device_annotation,
+    bitstream_setting, pb_type_path_index, vpr_device_annotation,
     vpr_bitstream_annotation);
 
   return status;
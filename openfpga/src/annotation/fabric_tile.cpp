@@ -3,6 +3,8 @@
  ***********************************************************************/
 #include "fabric_tile.h"
 
+#include <functional>
+
 #include "build_top_module_utils.h"
 #include "command_exit_codes.h"
 #include "vtr_assert.h"
@@ -11,6 +13,18 @@
 /* namespace openfpga begins */
 namespace openfpga {
 
+/* Hash of a tile signature, combined in the same way as boost::hash_combine */
+struct TileSignatureHash {
+  size_t operator()(const std::vector<size_t>& signature) const {
+    size_t seed = signature.size();
+    for (const size_t& value : signature) {
+      seed ^= std::hash<size_t>()(value) + 0x9e3779b9 + (seed << 6) +
+              (seed >> 2);
+    }
+    return seed;
+  }
+};
+
 vtr::Point<size_t> FabricTile::tile_coordinate(
   const FabricTileId& tile_id) const {
   VTR_ASSERT(valid_tile_id(tile_id));
@@ -672,34 +686,98 @@ bool FabricTile::equivalent_tile(const FabricTileId& tile_a,
   return true;
 }
 
+std::vector<size_t> FabricTile::tile_signature(
+  const FabricTileId& tile_id, const DeviceGrid& grids,
+  const DeviceRRGSB& device_rr_gsb,
+  std::unordered_map<std::string, size_t>& pb_name_ids) const {
+  std::vector<size_t> signature;
+  signature.reserve(5 + pb_coords_[tile_id].size() +
+                    cbx_coords_[tile_id].size() + cby_coords_[tile_id].size() +
+                    sb_coords_[tile_id].size());
+  signature.push_back(pb_coords_[tile_id].size());
+  signature.push_back(pb_gsb_coords_[tile_id].size());
+  signature.push_back(cbx_coords_[tile_id].size());
+  signature.push_back(cby_coords_[tile_id].size());
+  signature.push_back(sb_coords_[tile_id].size());
+  for (const vtr::Rect<size_t>& pb_coord : pb_coords_[tile_id]) {
+    std::string pb_name = generate_grid_block_module_name_in_top_module(
+      std::string(), grids, pb_coord.bottom_left());
+    auto result = pb_name_ids.emplace(pb_name, pb_name_ids.size());
+    signature.push_back(result.first->second);
+  }
+  for (const vtr::Point<size_t>& cbx_coord : cbx_coords_[tile_id]) {
+    signature.push_back(
+      device_rr_gsb.get_cb_unique_module_index(e_rr_type::CHANX, cbx_coord));
+  }
+  for (const vtr::Point<size_t>& cby_coord : cby_coords_[tile_id]) {
+    signature.push_back(
+      device_rr_gsb.get_cb_unique_module_index(e_rr_type::CHANY, cby_coord));
+  }
+  for (const vtr::Point<size_t>& sb_coord : sb_coords_[tile_id]) {
+    signature.push_back(device_rr_gsb.get_sb_unique_module_index(sb_coord));
+  }
+  return signature;
+}
+
+bool FabricTile::verify_unique_tiles(const DeviceGrid& grids,
+                                     const DeviceRRGSB& device_rr_gsb) const {
+  for (const FabricTileId& tile_id : ids_) {
+    FabricTileId unique_tile_id = find_unique_tile(tile_id);
+    if (!equivalent_tile(tile_id, unique_tile_id, grids, device_rr_gsb)) {
+      VTR_LOG_ERROR(
+        "Tile[%lu][%lu] is not equivalent to its unique tile[%lu][%lu]!\n",
+        tile_coordinate(tile_id).x(), tile_coordinate(tile_id).y(),
+        tile_coordinate(unique_tile_id).x(),
+        tile_coordinate(unique_tile_id).y());
+      return false;
+    }
+  }
+  for (size_t itile = 0; itile < unique_tile_ids_.size(); ++itile) {
+    for (size_t jtile = itile + 1; jtile < unique_tile_ids_.size(); ++jtile) {
+      if (equivalent_tile(unique_tile_ids_[itile], unique_tile_ids_[jtile],
+                          grids, device_rr_gsb)) {
+        VTR_LOG_ERROR(
+          "Unique tile[%lu][%lu] and tile[%lu][%lu] are equivalent!\n",
+          tile_coordinate(unique_tile_ids_[itile]).x(),
+          tile_coordinate(unique_tile_ids_[itile]).y(),
+          tile_coordinate(unique_tile_ids_[jtile]).x(),
+          tile_coordinate(unique_tile_ids_[jtile]).y());
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
 int FabricTile::build_unique_tiles(const DeviceGrid& grids,
                                    const DeviceRRGSB& device_rr_gsb,
                                    const bool& verbose) {
+  /* Tiles with the same signature are equivalent, so that each tile is only
+   * visited once rather than compared to all the unique tiles found so far */
+  std::unordered_map<std::string, size_t> pb_name_ids;
+  std::unordered_map<std::vector<size_t>, FabricTileId, TileSignatureHash>
+    signature2unique_tile;
   for (size_t ix = 0; ix < grids.width(); ++ix) {
     for (size_t iy = 0; iy < grids.height(); ++iy) {
-      if (!valid_tile_id(tile_coord2id_lookup_[ix][iy])) {
+      FabricTileId tile_id = tile_coord2id_lookup_[ix][iy];
+      if (!valid_tile_id(tile_id)) {
         continue; /* Skip invalid tile (which does not exist) */
       }
-      bool is_unique_tile = true;
-      for (FabricTileId unique_tile_id : unique_tile_ids_) {
-        if (equivalent_tile(tile_coord2id_lookup_[ix][iy], unique_tile_id,
-                            grids, device_rr_gsb)) {
-          VTR_LOGV(verbose,
-                   "Tile[%lu][%lu] is a mirror to the unique tile[%lu][%lu]\n",
-                   ix, iy, tile_coordinate(unique_tile_id).x(),
-                   tile_coordinate(unique_tile_id).y());
-          is_unique_tile = false;
-          tile_coord2unique_tile_ids_[ix][iy] = unique_tile_id;
-          break;
-        }
-      }
+      auto result = signature2unique_tile.emplace(
+        tile_signature(tile_id, grids, device_rr_gsb, pb_name_ids), tile_id);
+      FabricTileId unique_tile_id = result.first->second;
       /* Update list if this is a unique tile */
-      if (is_unique_tile) {
+      if (result.second) {
         VTR_LOGV(verbose, "Tile[%lu][%lu] is added as a new unique tile\n", ix,
                  iy);
-        unique_tile_ids_.push_back(tile_coord2id_lookup_[ix][iy]);
-        tile_coord2unique_tile_ids_[ix][iy] = tile_coord2id_lookup_[ix][iy];
+        unique_tile_ids_.push_back(tile_id);
+      } else {
+        VTR_LOGV(verbose,
+                 "Tile[%lu][%lu] is a mirror to the unique tile[%lu][%lu]\n",
+                 ix, iy, tile_coordinate(unique_tile_id).x(),
+                 tile_coordinate(unique_tile_id).y());
       }
+      tile_coord2unique_tile_ids_[ix][iy] = unique_tile_id;
     }
   }
   return 0;
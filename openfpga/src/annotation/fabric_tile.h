@@ -4,6 +4,8 @@
 /********************************************************************
  * Include header files required by the data structure definition
  *******************************************************************/
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "device_grid.h"
@@ -145,8 +147,22 @@ class FabricTile {
   bool equivalent_tile(const FabricTileId& tile_a, const FabricTileId& tile_b,
                        const DeviceGrid& grids,
                        const DeviceRRGSB& device_rr_gsb) const;
+  /** @brief Cross-check the unique tiles against the pairwise comparison
+   * equivalent_tile(). Return true if the unique tiles are consistent */
+  bool verify_unique_tiles(const DeviceGrid& grids,
+                           const DeviceRRGSB& device_rr_gsb) const;
 
  private: /* Internal builders */
+  /** @brief Build the signature of a tile, which is the sizes of the block
+   * lists, the ids of the pb module names and the unique module indices of
+   * the cbx, cby and sb. Two tiles are equivalent if and only if their
+   * signatures are the same. The pb module names are assigned with ids in
+   * pb_name_ids on the fly */
+  std::vector<size_t> tile_signature(
+    const FabricTileId& tile_id, const DeviceGrid& grids,
+    const DeviceRRGSB& device_rr_gsb,
+    std::unordered_map<std::string, size_t>& pb_name_ids) const;
+
   void invalidate_tile_in_lookup(const vtr::Point<size_t>& coord);
   void invalidate_pb_in_lookup(const vtr::Point<size_t>& coord);
   void invalidate_cbx_in_lookup(const vtr::Point<size_t>& coord);
@@ -95,7 +95,7 @@ static void write_rr_gsb_ipin_connection_to_xml(pugi::xml_node& parent,
       xml_rr_node.append_attribute("node_id").set_value(
         static_cast<unsigned long long>(size_t(cur_rr_node)));
     }
-    const std::vector<RREdgeId>& driver_rr_edges =
+    std::span<const RREdgeId> driver_rr_edges =
       gsb_edges.get_ipin_node_in_edges(rr_gsb, in_edges, gsb_side, inode);
     xml_rr_node.append_attribute("mux_size")
       .set_value(static_cast<unsigned long long>(driver_rr_edges.size()));
@@ -175,7 +175,7 @@ static void write_rr_gsb_chan_connection_to_xml(
     }
     /* Output drivers */
     const RRNodeId& cur_rr_node = rr_gsb.get_chan_node(gsb_side, inode);
-    std::vector<RREdgeId> driver_rr_edges =
+    std::span<const RREdgeId> driver_rr_edges =
       gsb_edges.get_chan_node_in_edges(rr_gsb, in_edges, gsb_side, inode);
 
     /* Output node information: location, index, side */
@@ -185,7 +185,7 @@ static void write_rr_gsb_chan_connection_to_xml(
     /* Check if this node is directly connected to the node on the opposite side
      */
     if (true == rr_gsb.is_sb_node_passing_wire(rr_graph, gsb_side, inode)) {
-      driver_rr_edges.clear();
+      driver_rr_edges = std::span<const RREdgeId>();
     }
 
     e_rr_type cur_node_type = rr_graph.node_type(cur_rr_node);
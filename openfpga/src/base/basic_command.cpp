@@ -2,6 +2,7 @@
  * Add basic commands to the OpenFPGA shell interface, including:
  * - exit
  * - version
+ * - report_profile
  * - help
  *******************************************************************/
 #include "basic_command.h"
@@ -80,6 +81,38 @@ static ShellCommandId add_openfpga_source_command(
   return shell_cmd_id;
 }
 
+/********************************************************************
+ * - Add a command to Shell environment: report_profile
+ * - Add associated options
+ * - Add command dependency
+ *******************************************************************/
+static ShellCommandId add_openfpga_report_profile_command(
+  openfpga::Shell<OpenfpgaContext>& shell,
+  const ShellCommandClassId& cmd_class_id,
+  const std::vector<ShellCommandId>& dependent_cmds) {
+  Command shell_cmd("report_profile");
+
+  /* Add an option '--file' */
+  CommandOptionId opt_file = shell_cmd.add_option(
+    "file", false,
+    "Output the profiles to a file instead of the screen. The file is in CSV "
+    "format if its extension is '.csv', otherwise in JSON format");
+  shell_cmd.set_option_short_name(opt_file, "f");
+  shell_cmd.set_option_require_value(opt_file, openfpga::OPT_STRING);
+
+  /* Add command to the Shell */
+  ShellCommandId shell_cmd_id = shell.add_command(
+    shell_cmd,
+    "Report the runtime and memory usage of each command executed so far");
+  shell.set_command_class(shell_cmd_id, cmd_class_id);
+  shell.set_command_execute_function(shell_cmd_id, report_command_profile);
+
+  /* Add command dependency to the Shell */
+  shell.set_command_dependency(shell_cmd_id, dependent_cmds);
+
+  return shell_cmd_id;
+}
+
 void add_basic_commands(openfpga::Shell<OpenfpgaContext>& shell) {
   /* Add a new class of commands */
   ShellCommandClassId basic_cmd_class = shell.add_command_class("Basic");
@@ -115,6 +148,10 @@ void add_basic_commands(openfpga::Shell<OpenfpgaContext>& shell) {
   add_openfpga_ext_exec_command(shell, basic_cmd_class,
                                 std::vector<ShellCommandId>());
 
+  /* Add 'report_profile' command which shows the runtime of each command */
+  add_openfpga_report_profile_command(shell, basic_cmd_class,
+                                      std::vector<ShellCommandId>());
+
   /* Note:
    * help MUST be the last to add because the linking to execute function will
    * do a snapshot on the shell
@@ -1,11 +1,15 @@
 #include "build_mif.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <map>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "bitstream_setting_xml_constants.h"
 #include "command_exit_codes.h"
+#include "mif_packed_bits.h"
 #include "pb_type_utils.h"
 #include "physical_pb.h"
 #include "physical_pb_utils.h"
@@ -294,9 +298,25 @@ int aggregate_unified_mif(const BitstreamSetting& bitstream_setting,
     top_mif.set_segment_data_width(out_seg, static_cast<int>(total_width));
     top_mif.set_segment_addr_range(out_seg, addr_range);
 
+    /* Index the memory lines of each slice by address, the first line
+     * wins if an address appears several times */
+    std::map<t_pl_loc, std::unordered_map<uint64_t, MifMemoryLineId>>
+      loc_to_lines;
+    for (const auto& loc_entry : loc_to_storage) {
+      const MifStorage& physical = *loc_entry.second;
+      auto& addr_to_line = loc_to_lines[loc_entry.first];
+      for (const MifSegmentId& segment_id : physical.segments()) {
+        for (const MifMemoryLineId& line_id :
+             physical.segment_memory_lines(segment_id)) {
+          addr_to_line.emplace(physical.memory_line_address(line_id), line_id);
+        }
+      }
+    }
+
+    std::vector<uint64_t> word(mif_num_packed_chunks(total_width), 0);
     for (size_t addr = addr_range.get_lsb(); addr <= addr_range.get_msb();
          ++addr) {
-      std::string word(total_width, '0');
+      std::fill(word.begin(), word.end(), 0);
       for (const auto& loc_entry : loc_map) {
         const auto storage_it = loc_to_storage.find(loc_entry.first);
         if (storage_it == loc_to_storage.end()) {
@@ -308,28 +328,19 @@ int aggregate_unified_mif(const BitstreamSetting& bitstream_setting,
           continue;
         }
         const MifStorage& physical = *storage_it->second;
-        bool copied = false;
-        for (const MifSegmentId& segment_id : physical.segments()) {
-          for (const MifMemoryLineId& line_id :
-               physical.segment_memory_lines(segment_id)) {
-            if (physical.memory_line_address(line_id) !=
-                static_cast<uint64_t>(addr)) {
-              continue;
-            }
-            const std::string& src = physical.memory_line_data(line_id);
-            const size_t copy_width = std::min(slice.data_width, src.size());
-            for (size_t i = 0; i < copy_width; ++i) {
-              word[slice.data_offset + i] = src[i];
-            }
-            copied = true;
-            break;
-          }
-          if (copied) {
-            break;
-          }
+        const auto& addr_to_line = loc_to_lines[loc_entry.first];
+        const auto line_it = addr_to_line.find(static_cast<uint64_t>(addr));
+        if (line_it == addr_to_line.end()) {
+          continue;
         }
+        const size_t src_width = physical.memory_line_width(line_it->second);
+        const size_t copy_width = std::min(slice.data_width, src_width);
+        copy_mif_packed_bits(word.data(), slice.data_offset,
+                             physical.memory_line_chunks(line_it->second),
+                             src_width, 0, copy_width);
       }
-      top_mif.create_memory_line(out_seg, static_cast<uint64_t>(addr), word);
+      top_mif.create_memory_line(out_seg, static_cast<uint64_t>(addr),
+                                 word.data(), total_width);
     }
   }
 
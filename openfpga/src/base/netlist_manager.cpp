@@ -200,6 +200,23 @@ void NetlistManager::add_netlist_preprocessing_flag(
   }
 }
 
+/* Append the netlists of another netlist manager */
+void NetlistManager::merge(const NetlistManager& other) {
+  for (const NetlistId& other_netlist : other.netlists()) {
+    NetlistId netlist = add_netlist(other.netlist_name(other_netlist));
+    /* Name conflicts are not expected: each netlist is a unique file */
+    VTR_ASSERT(NetlistId::INVALID() != netlist);
+    set_netlist_type(netlist, other.netlist_type(other_netlist));
+    for (const ModuleId& module : other.netlist_modules(other_netlist)) {
+      add_netlist_module(netlist, module);
+    }
+    for (const std::string& flag :
+         other.netlist_preprocessing_flags(other_netlist)) {
+      add_netlist_preprocessing_flag(netlist, flag);
+    }
+  }
+}
+
 /******************************************************************************
  * Public validators/invalidators
  ******************************************************************************/
@@ -82,6 +82,10 @@ class NetlistManager {
   /* Add a pre-processing flag to a netlist */
   void add_netlist_preprocessing_flag(const NetlistId& netlist,
                                       const std::string& preprocessing_flag);
+  /* Append all the netlists of another netlist manager, in their original
+   * order. Typically used to collect netlists registered by writers which
+   * run concurrently on their own netlist managers */
+  void merge(const NetlistManager& other);
   /* Reset everything */
   void clear();
 
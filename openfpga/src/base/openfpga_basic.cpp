@@ -42,8 +42,12 @@ int source_existing_command(openfpga::Shell<OpenfpgaContext>* shell,
 
   /* If a file is specified, run script mode of the shell, otherwise,  */
   if (is_cmd_file) {
-    shell->run_script_mode(cmd_ss.c_str(), openfpga_ctx,
-                           cmd_context.option_enable(cmd, opt_batch_mode));
+    status =
+      shell->run_script_mode(cmd_ss.c_str(), openfpga_ctx,
+                             cmd_context.option_enable(cmd, opt_batch_mode));
+    if (CMD_EXEC_FATAL_ERROR == status) {
+      return CMD_EXEC_FATAL_ERROR;
+    }
   } else {
     /* Split the string with ';' and run each command */
     /* Remove the space at the end of the line
@@ -109,4 +113,23 @@ int call_external_command(const Command& cmd,
   return CMD_EXEC_FATAL_ERROR;
 }
 
+/** Report the runtime and memory usage of the commands executed so far */
+int report_command_profile(openfpga::Shell<OpenfpgaContext>* shell,
+                           OpenfpgaContext& /*openfpga_ctx*/,
+                           const Command& cmd,
+                           const CommandContext& cmd_context) {
+  CommandOptionId opt_file = cmd.option("file");
+
+  if (!cmd_context.option_enable(cmd, opt_file)) {
+    shell->profiler().print_report();
+    return CMD_EXEC_SUCCESS;
+  }
+
+  std::string fname = cmd_context.option_value(cmd, opt_file);
+  if (0 != shell->profiler().write_to_file(fname)) {
+    return CMD_EXEC_FATAL_ERROR;
+  }
+  return CMD_EXEC_SUCCESS;
+}
+
 } /* end namespace openfpga */
@@ -17,23 +17,25 @@
 #include "fabric_key_writer.h"
 #include "globals.h"
 #include "openfpga_naming.h"
+#include "openfpga_parallel.h"
+#include "read_bin_fabric_key.h"
+#include "read_bin_io_name_map.h"
+#include "read_bin_module_name_map.h"
 #include "read_csv_io_pin_table.h"
 #include "read_unique_blocks_bin.h"
 #include "read_unique_blocks_xml.h"
-#include "read_xml_fabric_key.h"
-#include "read_xml_io_name_map.h"
-#include "read_xml_module_name_map.h"
 #include "read_xml_tile_config.h"
 #include "rename_modules.h"
 #include "report_reference.h"
 #include "rr_graph_in_edges.h"
 #include "vtr_log.h"
 #include "vtr_time.h"
+#include "write_bin_io_name_map.h"
+#include "write_bin_module_name_map.h"
 #include "write_unique_blocks_bin.h"
 #include "write_unique_blocks_xml.h"
 #include "write_xml_boundary_timing.h"
 #include "write_xml_fabric_pin_physical_location.h"
-#include "write_xml_module_name_map.h"
 /* begin namespace openfpga */
 namespace openfpga {
 
@@ -111,18 +113,33 @@ int build_fabric_template(T& openfpga_ctx, const Command& cmd,
                           const CommandContext& cmd_context) {
   CommandOptionId opt_frame_view = cmd.option("frame_view");
   CommandOptionId opt_compress_routing = cmd.option("compress_routing");
+  CommandOptionId opt_flyweight_routing = cmd.option("flyweight_routing");
   CommandOptionId opt_duplicate_grid_pin = cmd.option("duplicate_grid_pin");
   CommandOptionId opt_gen_random_fabric_key =
     cmd.option("generate_random_fabric_key");
   CommandOptionId opt_write_fabric_key = cmd.option("write_fabric_key");
   CommandOptionId opt_load_fabric_key = cmd.option("load_fabric_key");
   CommandOptionId opt_group_tile = cmd.option("group_tile");
+  CommandOptionId opt_verify_unique_tiles = cmd.option("verify_unique_tiles");
   CommandOptionId opt_group_config_block = cmd.option("group_config_block");
   CommandOptionId opt_group_routing = cmd.option("group_routing");
   CommandOptionId opt_name_module_using_index =
     cmd.option("name_module_using_index");
+  CommandOptionId opt_threads = cmd.option("threads");
   CommandOptionId opt_verbose = cmd.option("verbose");
 
+  size_t num_threads = 1;
+  if (true == cmd_context.option_enable(cmd, opt_threads)) {
+    if (false == parse_num_threads(cmd_context.option_value(cmd, opt_threads),
+                                   num_threads)) {
+      VTR_LOG_ERROR(
+        "Invalid number of threads '%s' which should be 0 or a positive "
+        "number!\n",
+        cmd_context.option_value(cmd, opt_threads).c_str());
+      return CMD_EXEC_FATAL_ERROR;
+    }
+  }
+
   /* Report conflicts with options:
    * - group tile does not support duplicate_grid_pin
    * - group tile requires compress_routing to be enabled
@@ -178,7 +195,7 @@ int build_fabric_template(T& openfpga_ctx, const Command& cmd,
   if (true == cmd_context.option_enable(cmd, opt_load_fabric_key)) {
     std::string fkey_fname = cmd_context.option_value(cmd, opt_load_fabric_key);
     VTR_ASSERT(false == fkey_fname.empty());
-    predefined_fabric_key = read_xml_fabric_key(fkey_fname.c_str());
+    predefined_fabric_key = read_fabric_key(fkey_fname.c_str());
   }
 
   VTR_LOG("\n");
@@ -200,6 +217,12 @@ int build_fabric_template(T& openfpga_ctx, const Command& cmd,
     if (CMD_EXEC_SUCCESS != curr_status) {
       return CMD_EXEC_FATAL_ERROR;
     }
+  } else if (cmd_context.option_enable(cmd, opt_verify_unique_tiles)) {
+    VTR_LOG_ERROR(
+      "Option '%s' is applicable only when option '%s' is enabled!\n",
+      cmd.option_name(opt_verify_unique_tiles).c_str(),
+      cmd.option_name(opt_group_tile).c_str());
+    return CMD_EXEC_FATAL_ERROR;
   }
 
   curr_status = build_device_module_graph(
@@ -209,12 +232,14 @@ int build_fabric_template(T& openfpga_ctx, const Command& cmd,
     const_cast<const T&>(openfpga_ctx), g_vpr_ctx.device(),
     cmd_context.option_enable(cmd, opt_frame_view),
     openfpga_ctx.device_rr_gsb().is_compressed(),
+    cmd_context.option_enable(cmd, opt_flyweight_routing),
     cmd_context.option_enable(cmd, opt_duplicate_grid_pin),
     predefined_fabric_key, tile_config,
+    cmd_context.option_enable(cmd, opt_verify_unique_tiles),
     cmd_context.option_enable(cmd, opt_group_config_block),
     cmd_context.option_enable(cmd, opt_group_routing),
     cmd_context.option_enable(cmd, opt_name_module_using_index),
-    cmd_context.option_enable(cmd, opt_gen_random_fabric_key),
+    cmd_context.option_enable(cmd, opt_gen_random_fabric_key), num_threads,
     cmd_context.option_enable(cmd, opt_verbose));
 
   /* If there is any error, final status cannot be overwritten by a success flag
@@ -223,6 +248,9 @@ int build_fabric_template(T& openfpga_ctx, const Command& cmd,
     final_status = curr_status;
   }
 
+  /* The module graph is complete. Compact the nets for the writers */
+  openfpga_ctx.mutable_module_graph().freeze();
+
   /* Build I/O location map */
   openfpga_ctx.mutable_io_location_map() = build_fabric_io_location_map(
     openfpga_ctx.module_graph(), g_vpr_ctx.device().grid,
@@ -236,20 +264,18 @@ int build_fabric_template(T& openfpga_ctx, const Command& cmd,
     cmd_context.option_enable(cmd, opt_group_tile));
 
   /* update vpr bitstream annotation with io location map */
-  const auto io_location_map = openfpga_ctx.io_location_map();
+  const auto& io_location_map = openfpga_ctx.io_location_map();
   auto& bitstream_annotation = openfpga_ctx.mutable_vpr_bitstream_annotation();
   for (const auto& [pb_type, int_pin] :
        bitstream_annotation.pb_type_pcf_pins()) {
-    size_t x = io_location_map.io_x(int_pin);
-    size_t y = io_location_map.io_y(int_pin);
-    size_t z = io_location_map.io_z(int_pin);
-    bool pin_valid = io_location_map.is_valid_coord(x, y, z);
+    std::array<size_t, 3> coord = io_location_map.io_coordinate(int_pin);
+    bool pin_valid =
+      io_location_map.is_valid_coord(coord[0], coord[1], coord[2]);
     if (!pin_valid) {
       VTR_LOG_ERROR("Pin %s defined in pcf command is invalid! \n",
                     int_pin.to_verilog_string().c_str());
       return CMD_EXEC_FATAL_ERROR;
     }
-    std::array<size_t, 3> coord = {x, y, z};
     bitstream_annotation.add_pcf_coord_pb_type(coord, pb_type);
   }
 
@@ -264,7 +290,7 @@ int build_fabric_template(T& openfpga_ctx, const Command& cmd,
     std::string fkey_fname =
       cmd_context.option_value(cmd, opt_write_fabric_key);
     VTR_ASSERT(false == fkey_fname.empty());
-    curr_status = write_fabric_key_to_xml_file(
+    curr_status = write_fabric_key_to_file(
       openfpga_ctx.module_graph(), fkey_fname,
       openfpga_ctx.arch().config_protocol,
       openfpga_ctx.blwl_shift_register_banks(), false,
@@ -297,7 +323,7 @@ int write_fabric_key_template(const T& openfpga_ctx, const Command& cmd,
   VTR_ASSERT(false == cmd_context.option_value(cmd, opt_file).empty());
 
   /* Write fabric key to a file */
-  return write_fabric_key_to_xml_file(
+  return write_fabric_key_to_file(
     openfpga_ctx.module_graph(), cmd_context.option_value(cmd, opt_file),
     openfpga_ctx.arch().config_protocol,
     openfpga_ctx.blwl_shift_register_banks(),
@@ -476,8 +502,8 @@ int add_fpga_core_to_fabric_template(T& openfpga_ctx, const Command& cmd,
   /* Handle I/O naming rules if defined */
   CommandOptionId opt_io_naming = cmd.option("io_naming");
   if (true == cmd_context.option_enable(cmd, opt_io_naming)) {
-    read_xml_io_name_map(cmd_context.option_value(cmd, opt_io_naming).c_str(),
-                         openfpga_ctx.mutable_io_name_map());
+    read_io_name_map(cmd_context.option_value(cmd, opt_io_naming).c_str(),
+                     openfpga_ctx.mutable_io_name_map());
   }
 
   return add_fpga_core_to_device_module_graph(
@@ -505,7 +531,7 @@ int rename_modules_template(T& openfpga_ctx, const Command& cmd,
 
   int status = CMD_EXEC_SUCCESS;
   ModuleNameMap user_module_name_map;
-  status = read_xml_module_name_map(file_name.c_str(), user_module_name_map);
+  status = read_module_name_map(file_name.c_str(), user_module_name_map);
   if (status != CMD_EXEC_SUCCESS) {
     return CMD_EXEC_FATAL_ERROR;
   }
@@ -545,12 +571,38 @@ int write_module_naming_rules_template(const T& openfpga_ctx,
   std::string file_name = cmd_context.option_value(cmd, opt_file);
 
   /* Write hierarchy to a file */
-  return write_xml_module_name_map(
+  return write_module_name_map(
     file_name.c_str(), openfpga_ctx.module_name_map(),
     !cmd_context.option_enable(cmd, opt_no_time_stamp),
     cmd_context.option_enable(cmd, opt_verbose));
 }
 
+/********************************************************************
+ * Write I/O naming rules to a file
+ *******************************************************************/
+template <class T>
+int write_io_naming_rules_template(const T& openfpga_ctx, const Command& cmd,
+                                   const CommandContext& cmd_context) {
+  CommandOptionId opt_verbose = cmd.option("verbose");
+
+  /* Check the option '--file' is enabled or not
+   * Actually, it must be enabled as the shell interface will check
+   * before reaching this fuction
+   */
+  CommandOptionId opt_file = cmd.option("file");
+  VTR_ASSERT(true == cmd_context.option_enable(cmd, opt_file));
+  VTR_ASSERT(false == cmd_context.option_value(cmd, opt_file).empty());
+
+  std::string file_name = cmd_context.option_value(cmd, opt_file);
+
+  VTR_LOGV(cmd_context.option_enable(cmd, opt_verbose),
+           "Write %lu I/O naming rules to file '%s'\n",
+           openfpga_ctx.io_name_map().fpga_top_ports().size(),
+           file_name.c_str());
+
+  return write_io_name_map(file_name.c_str(), openfpga_ctx.io_name_map());
+}
+
 /********************************************************************
  * Write fabric pin physical location to a file
  *******************************************************************/
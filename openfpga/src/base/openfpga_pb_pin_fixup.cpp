@@ -2,10 +2,15 @@
  * This file includes functions to fix up the pb pin mapping results
  * after routing optimization
  *******************************************************************/
+#include <algorithm>
+#include <map>
+#include <numeric>
+
 /* Headers from vtrutil library */
 #include "vtr_assert.h"
 #include "vtr_log.h"
 #include "vtr_time.h"
+#include "vtr_util.h"
 
 /* Headers from openfpgashell library */
 #include "command_exit_codes.h"
@@ -15,6 +20,7 @@
 
 /* Headers from openfpgautil library */
 #include "openfpga_device_grid_utils.h"
+#include "openfpga_parallel.h"
 #include "openfpga_pb_pin_fixup.h"
 #include "openfpga_physical_tile_utils.h"
 #include "pb_type_utils.h"
@@ -24,6 +30,79 @@
 /* begin namespace openfpga */
 namespace openfpga {
 
+/********************************************************************
+ * Fix-up results of a clustered block.
+ * The fix-up of a block only reads and writes the net remapping of the block
+ * itself. The results are recorded here by a worker thread, including the
+ * log messages, and then applied to the clustering annotation in the same
+ * order as a serial run, so that outputs do not depend on the number of
+ * threads.
+ *******************************************************************/
+class PbPinFixupRecord {
+ public: /* Public accessors, the same as the clustering annotation */
+  bool is_net_renamed(const int& pin_index) const {
+    return net_remaps_.end() != net_remaps_.find(pin_index);
+  }
+  ClusterNetId net(const int& pin_index) const {
+    VTR_ASSERT(true == is_net_renamed(pin_index));
+    return net_remaps_.at(pin_index);
+  }
+
+ public: /* Public mutators */
+  void rename_net(const int& pin_index, const ClusterNetId& net_id) {
+    net_remaps_[pin_index] = net_id;
+    events_.push_back({e_event_type::RENAME_NET, pin_index, net_id, ""});
+  }
+  void log(const std::string& msg) {
+    events_.push_back({e_event_type::LOG, -1, ClusterNetId::INVALID(), msg});
+  }
+  void log_error(const std::string& msg) {
+    events_.push_back(
+      {e_event_type::LOG_ERROR, -1, ClusterNetId::INVALID(), msg});
+  }
+
+  /* Replay the log messages and net remapping in their creation order */
+  void apply(const ClusterBlockId& blk_id,
+             VprClusteringAnnotation& clustering_annotation) const {
+    for (const t_event& event : events_) {
+      switch (event.type) {
+        case e_event_type::RENAME_NET:
+          clustering_annotation.rename_net(blk_id, event.pin_index,
+                                           event.net_id);
+          break;
+        case e_event_type::LOG:
+          VTR_LOG("%s", event.msg.c_str());
+          break;
+        case e_event_type::LOG_ERROR:
+          VTR_LOG_ERROR("%s", event.msg.c_str());
+          break;
+      }
+    }
+  }
+
+ public: /* Public data */
+  size_t num_fixup = 0;
+  int status = CMD_EXEC_SUCCESS;
+
+ private: /* Internal data */
+  enum class e_event_type { RENAME_NET, LOG, LOG_ERROR };
+  struct t_event {
+    e_event_type type;
+    int pin_index;
+    ClusterNetId net_id;
+    std::string msg;
+  };
+  std::map<int, ClusterNetId> net_remaps_;
+  std::vector<t_event> events_;
+};
+
+/* A grid location where a clustered block is visited by the fix-up */
+struct t_pb_pin_fixup_visit {
+  vtr::Point<size_t> grid_coord;
+  e_side border_side;
+  size_t z;
+};
+
 /********************************************************************
  * For global net which was remapped during routing, no tracking can be found.
  *Packer only keeps an out-of-date record on its pin mapping. Router does not
@@ -31,10 +110,9 @@ namespace openfpga {
  *to find the first unused pin in the same port as it was mapped by the packer.
  *******************************************************************/
 static int update_cluster_pin_global_net_with_post_routing_results(
-  const ClusteringContext& clustering_ctx,
-  VprClusteringAnnotation& clustering_annotation, const ClusterBlockId& blk_id,
-  t_logical_block_type_ptr logical_block, const bool& map_gnet2msb,
-  size_t& num_fixup, const bool& verbose) {
+  const ClusteringContext& clustering_ctx, PbPinFixupRecord& record,
+  const ClusterBlockId& blk_id, t_logical_block_type_ptr logical_block,
+  const bool& map_gnet2msb, const bool& verbose) {
   /* Reassign global nets to unused pins in the same port where they were mapped
    * NO optimization is done here!!! First find first fit
    */
@@ -66,17 +144,17 @@ static int update_cluster_pin_global_net_with_post_routing_results(
       continue;
     }
     /* Skip this pin: it is consistent in pre- and post- routing results */
-    if (!clustering_annotation.is_net_renamed(blk_id, pb_type_pin)) {
+    if (!record.is_net_renamed(pb_type_pin)) {
       continue;
     }
     /* This net has been remapped, find the first unused pin in the same port
      * Get the offset of the pin index in the port, based on which we can infer
      * the pin index in the context of logical block
      */
-    VTR_LOG(
+    record.log(vtr::string_fmt(
       "Searching for a candidate pin to accomodate global net '%s' was lost "
       "during routing optimization\n",
-      clustering_ctx.clb_nlist.net_name(global_net_id).c_str());
+      clustering_ctx.clb_nlist.net_name(global_net_id).c_str()));
     size_t cand_pin_start = pb_type_pin - pb_graph_pin->pin_number;
     std::vector<size_t> cand_pins(pb_graph_pin->port->num_pins);
     std::iota(cand_pins.begin(), cand_pins.end(), cand_pin_start);
@@ -89,37 +167,40 @@ static int update_cluster_pin_global_net_with_post_routing_results(
         clustering_ctx.clb_nlist.block_net(blk_id, cand_pin);
       const t_pb_graph_pin* cand_pb_graph_pin =
         get_pb_graph_node_pin_from_block_pin(blk_id, cand_pin);
-      if (clustering_annotation.is_net_renamed(blk_id, cand_pin)) {
-        cand_pin_net_id = clustering_annotation.net(blk_id, cand_pin);
+      if (record.is_net_renamed(cand_pin)) {
+        cand_pin_net_id = record.net(cand_pin);
       }
       if (clustering_ctx.clb_nlist.valid_net_id(cand_pin_net_id)) {
-        VTR_LOG("Candidate pin '%s' is already mapped to net '%s'\n",
-                cand_pb_graph_pin->to_string().c_str(),
-                clustering_ctx.clb_nlist.net_name(cand_pin_net_id).c_str());
+        record.log(vtr::string_fmt(
+          "Candidate pin '%s' is already mapped to net '%s'\n",
+          cand_pb_graph_pin->to_string().c_str(),
+          clustering_ctx.clb_nlist.net_name(cand_pin_net_id).c_str()));
         continue;
       }
       /* Add to net modification */
-      clustering_annotation.rename_net(blk_id, cand_pin, global_net_id);
-      VTR_LOGV(verbose,
-               "Remap clustered block '%s' global net '%s' to pin '%s'\n",
-               clustering_ctx.clb_nlist.block_pb(blk_id)->name,
-               clustering_ctx.clb_nlist.net_name(global_net_id).c_str(),
-               cand_pb_graph_pin->to_string().c_str());
+      record.rename_net(cand_pin, global_net_id);
+      if (verbose) {
+        record.log(vtr::string_fmt(
+          "Remap clustered block '%s' global net '%s' to pin '%s'\n",
+          clustering_ctx.clb_nlist.block_pb(blk_id)->name,
+          clustering_ctx.clb_nlist.net_name(global_net_id).c_str(),
+          cand_pb_graph_pin->to_string().c_str()));
+      }
       found_cand = true;
       break;
     }
     /* Error out if no candidates are found */
     if (!found_cand) {
-      VTR_LOG_ERROR(
+      record.log_error(vtr::string_fmt(
         "Failed to find any unused pin in the same port to remap clustered "
         "block '%s' global net '%s' (was mapped to pin '%s').\n",
         clustering_ctx.clb_nlist.block_pb(blk_id)->name,
         clustering_ctx.clb_nlist.net_name(global_net_id).c_str(),
-        pb_graph_pin->to_string().c_str());
+        pb_graph_pin->to_string().c_str()));
       return CMD_EXEC_FATAL_ERROR;
     }
     /* Update fixup counter */
-    num_fixup++;
+    record.num_fixup++;
   }
   return CMD_EXEC_SUCCESS;
 }
@@ -139,11 +220,10 @@ static int update_cluster_pin_global_net_with_post_routing_results(
  *******************************************************************/
 static int update_cluster_pin_with_post_routing_results(
   const DeviceContext& device_ctx, const ClusteringContext& clustering_ctx,
-  const VprRoutingAnnotation& vpr_routing_annotation,
-  VprClusteringAnnotation& vpr_clustering_annotation, const size_t& layer,
-  const vtr::Point<size_t>& grid_coord, const ClusterBlockId& blk_id,
-  const e_side& border_side, const size_t& z, const bool& perimeter_cb,
-  const bool& map_gnet2msb, size_t& num_fixup, const bool& verbose) {
+  const VprRoutingAnnotation& vpr_routing_annotation, PbPinFixupRecord& record,
+  const size_t& layer, const vtr::Point<size_t>& grid_coord,
+  const ClusterBlockId& blk_id, const e_side& border_side, const size_t& z,
+  const bool& perimeter_cb, const bool& map_gnet2msb, const bool& verbose) {
   int status = CMD_EXEC_SUCCESS;
   /* Handle each pin */
   auto logical_block = clustering_ctx.clb_nlist.block_type(blk_id);
@@ -183,16 +263,17 @@ static int update_cluster_pin_with_post_routing_results(
     e_side pin_side = NUM_2D_SIDES;
     if (NUM_2D_SIDES == border_side) {
       if (1 != pin_sides.size()) {
-        VTR_LOG_ERROR(
+        record.log_error(vtr::string_fmt(
           "For tile '%s', found pin '%s' on %lu sides. Expect only 1. "
           "Following info is for debugging:\n",
           physical_tile->name.c_str(),
           get_pb_graph_node_pin_from_block_pin(blk_id, physical_pin)
             ->to_string()
             .c_str(),
-          pin_sides.size());
+          pin_sides.size()));
         for (e_side curr_side : pin_sides) {
-          VTR_LOG_ERROR("\t%s\n", SideManager(curr_side).c_str());
+          record.log_error(
+            vtr::string_fmt("\t%s\n", SideManager(curr_side).c_str()));
         }
         return CMD_EXEC_FATAL_ERROR;
       }
@@ -202,27 +283,28 @@ static int update_cluster_pin_with_post_routing_results(
        * side but the border side */
       if (pin_sides.end() !=
           std::find(pin_sides.begin(), pin_sides.end(), border_side)) {
-        VTR_LOG_ERROR(
+        record.log_error(vtr::string_fmt(
           "For tile '%s', found pin '%s' on the boundary side '%s', which is "
           "not physically possible.\n",
           physical_tile->name.c_str(),
           get_pb_graph_node_pin_from_block_pin(blk_id, physical_pin)
             ->to_string()
             .c_str(),
-          SideManager(border_side).c_str());
+          SideManager(border_side).c_str()));
         return CMD_EXEC_FATAL_ERROR;
       }
       if (1 != pin_sides.size()) {
-        VTR_LOG_ERROR(
+        record.log_error(vtr::string_fmt(
           "For tile '%s', found pin '%s' on %lu sides. Expect only 1. "
           "Following info is for debugging:\n",
           physical_tile->name.c_str(),
           get_pb_graph_node_pin_from_block_pin(blk_id, physical_pin)
             ->to_string()
             .c_str(),
-          pin_sides.size());
+          pin_sides.size()));
         for (e_side curr_side : pin_sides) {
-          VTR_LOG_ERROR("\t%s\n", SideManager(curr_side).c_str());
+          record.log_error(
+            vtr::string_fmt("\t%s\n", SideManager(curr_side).c_str()));
         }
         return CMD_EXEC_FATAL_ERROR;
       }
@@ -231,16 +313,17 @@ static int update_cluster_pin_with_post_routing_results(
       SideManager side_manager(border_side);
       if (pin_sides.end() == std::find(pin_sides.begin(), pin_sides.end(),
                                        side_manager.get_opposite())) {
-        VTR_LOG_ERROR(
+        record.log_error(vtr::string_fmt(
           "For boundary tile '%s', expect pin '%s' only on the side '%s' but "
           "found on the following sides:\n",
           physical_tile->name.c_str(),
           get_pb_graph_node_pin_from_block_pin(blk_id, physical_pin)
             ->to_string()
             .c_str(),
-          SideManager(side_manager.get_opposite()).c_str());
+          SideManager(side_manager.get_opposite()).c_str()));
         for (e_side curr_side : pin_sides) {
-          VTR_LOG_ERROR("\t%s\n", SideManager(curr_side).c_str());
+          record.log_error(
+            vtr::string_fmt("\t%s\n", SideManager(curr_side).c_str()));
         }
         return CMD_EXEC_FATAL_ERROR;
       }
@@ -276,46 +359,52 @@ static int update_cluster_pin_with_post_routing_results(
     if ((ClusterNetId::INVALID() != cluster_net_id) &&
         (ClusterNetId::INVALID() == routing_net_id) &&
         (true == clustering_ctx.clb_nlist.net_is_ignored(cluster_net_id))) {
-      VTR_LOGV(verbose,
-               "Bypass net at clustered block '%s' pin 'grid[%ld][%ld].%s' as "
-               "it is not routed\n",
-               clustering_ctx.clb_nlist.block_pb(blk_id)->name, grid_coord.x(),
-               grid_coord.y(),
-               get_pb_graph_node_pin_from_block_pin(blk_id, physical_pin)
-                 ->to_string()
-                 .c_str());
+      if (verbose) {
+        record.log(vtr::string_fmt(
+          "Bypass net at clustered block '%s' pin 'grid[%ld][%ld].%s' as "
+          "it is not routed\n",
+          clustering_ctx.clb_nlist.block_pb(blk_id)->name, grid_coord.x(),
+          grid_coord.y(),
+          get_pb_graph_node_pin_from_block_pin(blk_id, physical_pin)
+            ->to_string()
+            .c_str()));
+      }
       continue;
     }
 
     /* Ignore used in local cluster only, reserved one CLB pin */
     if ((ClusterNetId::INVALID() != cluster_net_id) &&
         (0 == clustering_ctx.clb_nlist.net_sinks(cluster_net_id).size())) {
-      VTR_LOGV(verbose,
-               "Bypass net at clustered block '%s' pin 'grid[%ld][%ld].%s' as "
-               "it is a local net inside the cluster\n",
-               clustering_ctx.clb_nlist.block_pb(blk_id)->name, grid_coord.x(),
-               grid_coord.y(),
-               get_pb_graph_node_pin_from_block_pin(blk_id, physical_pin)
-                 ->to_string()
-                 .c_str());
+      if (verbose) {
+        record.log(vtr::string_fmt(
+          "Bypass net at clustered block '%s' pin 'grid[%ld][%ld].%s' as "
+          "it is a local net inside the cluster\n",
+          clustering_ctx.clb_nlist.block_pb(blk_id)->name, grid_coord.x(),
+          grid_coord.y(),
+          get_pb_graph_node_pin_from_block_pin(blk_id, physical_pin)
+            ->to_string()
+            .c_str()));
+      }
       continue;
     }
 
     /* If matched, we finish here */
     if (routing_net_id == cluster_net_id) {
-      VTR_LOGV(verbose,
-               "Bypass net at clustered block '%s' pin 'grid[%ld][%ld].%s' as "
-               "it matches cluster routing\n",
-               clustering_ctx.clb_nlist.block_pb(blk_id)->name, grid_coord.x(),
-               grid_coord.y(),
-               get_pb_graph_node_pin_from_block_pin(blk_id, physical_pin)
-                 ->to_string()
-                 .c_str());
+      if (verbose) {
+        record.log(vtr::string_fmt(
+          "Bypass net at clustered block '%s' pin 'grid[%ld][%ld].%s' as "
+          "it matches cluster routing\n",
+          clustering_ctx.clb_nlist.block_pb(blk_id)->name, grid_coord.x(),
+          grid_coord.y(),
+          get_pb_graph_node_pin_from_block_pin(blk_id, physical_pin)
+            ->to_string()
+            .c_str()));
+      }
       continue;
     }
 
     /* Add to net modification */
-    vpr_clustering_annotation.rename_net(blk_id, j, routing_net_id);
+    record.rename_net(j, routing_net_id);
 
     std::string routing_net_name("unmapped");
     if (ClusterNetId::INVALID() != routing_net_id) {
@@ -327,36 +416,40 @@ static int update_cluster_pin_with_post_routing_results(
       cluster_net_name = clustering_ctx.clb_nlist.net_name(cluster_net_id);
     }
 
-    VTR_LOGV(verbose,
-             "Fixed up net '%s' mapping mismatch at clustered block '%s' pin "
-             "'grid[%ld][%ld].%s' (was net '%s')\n",
-             routing_net_name.c_str(),
-             clustering_ctx.clb_nlist.block_pb(blk_id)->name, grid_coord.x(),
-             grid_coord.y(),
-             get_pb_graph_node_pin_from_block_pin(blk_id, physical_pin)
-               ->to_string()
-               .c_str(),
-             cluster_net_name.c_str());
-    num_fixup++;
+    if (verbose) {
+      record.log(vtr::string_fmt(
+        "Fixed up net '%s' mapping mismatch at clustered block '%s' pin "
+        "'grid[%ld][%ld].%s' (was net '%s')\n",
+        routing_net_name.c_str(),
+        clustering_ctx.clb_nlist.block_pb(blk_id)->name, grid_coord.x(),
+        grid_coord.y(),
+        get_pb_graph_node_pin_from_block_pin(blk_id, physical_pin)
+          ->to_string()
+          .c_str(),
+        cluster_net_name.c_str()));
+    }
+    record.num_fixup++;
   }
   /* 2nd round of fixup: focus on global nets */
   status = update_cluster_pin_global_net_with_post_routing_results(
-    clustering_ctx, vpr_clustering_annotation, blk_id, logical_block,
-    map_gnet2msb, num_fixup, verbose);
+    clustering_ctx, record, blk_id, logical_block, map_gnet2msb, verbose);
   return status;
 }
 
 /********************************************************************
  * Main function to fix up the pb pin mapping results
  * This function will walk through each grid
+ * The clustered blocks are collected in the order of a grid walk and then
+ * fixed up by a group of worker threads. Results are applied block by block
+ * in the collected order, so that the annotation and the log are the same
+ * for any number of threads
  *******************************************************************/
 int update_pb_pin_with_post_routing_results(
   const DeviceContext& device_ctx, const ClusteringContext& clustering_ctx,
   const PlacementContext& placement_ctx,
   const VprRoutingAnnotation& vpr_routing_annotation,
   VprClusteringAnnotation& vpr_clustering_annotation, const bool& perimeter_cb,
-  const bool& map_gnet2msb, const bool& verbose) {
-  int status = CMD_EXEC_SUCCESS;
+  const bool& map_gnet2msb, const size_t& num_threads, const bool& verbose) {
   size_t num_fixup = 0;
   /* Confirm options */
   VTR_LOGV(verbose && map_gnet2msb,
@@ -365,6 +458,22 @@ int update_pb_pin_with_post_routing_results(
    * post-routing clustering result sync-up */
   vpr_clustering_annotation.clear_net_remapping();
 
+  /* Each clustered block is a task. A block may be visited more than once,
+   * which are kept in the same task in the visiting order */
+  std::vector<ClusterBlockId> task_blocks;
+  std::vector<std::vector<t_pb_pin_fixup_visit>> task_visits;
+  std::map<ClusterBlockId, size_t> block_task_ids;
+  auto add_visit = [&](const ClusterBlockId& blk_id,
+                       const t_pb_pin_fixup_visit& visit) {
+    auto result = block_task_ids.find(blk_id);
+    if (block_task_ids.end() == result) {
+      result = block_task_ids.emplace(blk_id, task_blocks.size()).first;
+      task_blocks.push_back(blk_id);
+      task_visits.emplace_back();
+    }
+    task_visits[result->second].push_back(visit);
+  };
+
   size_t layer = 0;
   /* Update the core logic (center blocks of the FPGA) */
   for (size_t x = 1; x < device_ctx.grid.width() - 1; ++x) {
@@ -386,15 +495,10 @@ int update_pb_pin_with_post_routing_results(
         }
         /* We know the entrance to grid info and mapping results, do the fix-up
          * for this block */
-        vtr::Point<size_t> grid_coord(x, y);
-        status = update_cluster_pin_with_post_routing_results(
-          device_ctx, clustering_ctx, vpr_routing_annotation,
-          vpr_clustering_annotation, layer, grid_coord, cluster_blk_id,
-          NUM_2D_SIDES, placement_ctx.block_locs()[cluster_blk_id].loc.sub_tile,
-          perimeter_cb, map_gnet2msb, num_fixup, verbose);
-        if (status != CMD_EXEC_SUCCESS) {
-          return CMD_EXEC_FATAL_ERROR;
-        }
+        add_visit(
+          cluster_blk_id,
+          {vtr::Point<size_t>(x, y), NUM_2D_SIDES,
+           (size_t)placement_ctx.block_locs()[cluster_blk_id].loc.sub_tile});
       }
     }
   }
@@ -422,19 +526,43 @@ int update_pb_pin_with_post_routing_results(
           continue;
         }
         /* Update on I/O grid */
-        status = update_cluster_pin_with_post_routing_results(
-          device_ctx, clustering_ctx, vpr_routing_annotation,
-          vpr_clustering_annotation, layer, io_coord, cluster_blk_id, io_side,
-          placement_ctx.block_locs()[cluster_blk_id].loc.sub_tile, perimeter_cb,
-          map_gnet2msb, num_fixup, verbose);
-        if (status != CMD_EXEC_SUCCESS) {
-          return CMD_EXEC_FATAL_ERROR;
+        add_visit(
+          cluster_blk_id,
+          {io_coord, io_side,
+           (size_t)placement_ctx.block_locs()[cluster_blk_id].loc.sub_tile});
+      }
+    }
+  }
+
+  /* Fix up each block. A worker only touches the record of its own task */
+  size_t num_tasks = task_blocks.size();
+  std::vector<PbPinFixupRecord> task_records(num_tasks);
+  parallel_for_each_task(
+    num_tasks, find_num_worker_threads(num_threads, num_tasks),
+    [&](const size_t& task_id) {
+      PbPinFixupRecord& record = task_records[task_id];
+      for (const t_pb_pin_fixup_visit& visit : task_visits[task_id]) {
+        record.status = update_cluster_pin_with_post_routing_results(
+          device_ctx, clustering_ctx, vpr_routing_annotation, record, layer,
+          visit.grid_coord, task_blocks[task_id], visit.border_side, visit.z,
+          perimeter_cb, map_gnet2msb, verbose);
+        if (record.status != CMD_EXEC_SUCCESS) {
+          return;
         }
       }
+    });
+
+  /* Apply the results in the task order and stop at the first failure */
+  for (size_t task_id = 0; task_id < num_tasks; ++task_id) {
+    const PbPinFixupRecord& record = task_records[task_id];
+    record.apply(task_blocks[task_id], vpr_clustering_annotation);
+    if (record.status != CMD_EXEC_SUCCESS) {
+      return CMD_EXEC_FATAL_ERROR;
     }
+    num_fixup += record.num_fixup;
   }
   VTR_LOG("In total %lu fixup have been applied\n", num_fixup);
-  return status;
+  return CMD_EXEC_SUCCESS;
 }
 
 } /* end namespace openfpga */
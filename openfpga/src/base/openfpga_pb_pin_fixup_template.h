@@ -8,7 +8,9 @@
 #include "command_context.h"
 #include "command_exit_codes.h"
 #include "globals.h"
+#include "openfpga_parallel.h"
 #include "openfpga_pb_pin_fixup.h"
+#include "vtr_log.h"
 #include "vtr_time.h"
 
 /********************************************************************
@@ -36,15 +38,28 @@ int pb_pin_fixup_template(T& openfpga_context, const Command& cmd,
     "Fix up pb pin mapping results after routing optimization");
 
   CommandOptionId opt_map_gnet2msb = cmd.option("map_global_net_to_msb");
+  CommandOptionId opt_threads = cmd.option("threads");
   CommandOptionId opt_verbose = cmd.option("verbose");
 
+  size_t num_threads = 1;
+  if (true == cmd_context.option_enable(cmd, opt_threads)) {
+    if (false == parse_num_threads(cmd_context.option_value(cmd, opt_threads),
+                                   num_threads)) {
+      VTR_LOG_ERROR(
+        "Invalid number of threads '%s' which should be 0 or a positive "
+        "number!\n",
+        cmd_context.option_value(cmd, opt_threads).c_str());
+      return CMD_EXEC_FATAL_ERROR;
+    }
+  }
+
   /* Apply fix-up to each grid */
   return update_pb_pin_with_post_routing_results(
     g_vpr_ctx.device(), g_vpr_ctx.clustering(), g_vpr_ctx.placement(),
     openfpga_context.vpr_routing_annotation(),
     openfpga_context.mutable_vpr_clustering_annotation(),
     g_vpr_ctx.device().arch->perimeter_cb,
-    cmd_context.option_enable(cmd, opt_map_gnet2msb),
+    cmd_context.option_enable(cmd, opt_map_gnet2msb), num_threads,
     cmd_context.option_enable(cmd, opt_verbose));
 }
 
@@ -162,7 +162,7 @@ int pcf2place_wrapper_template(const Command& cmd,
           pcf_fname.c_str());
 
   blifparse::BlifHeadReader callback;
-  blifparse::blif_parse_filename(blif_fname.c_str(), callback);
+  blifparse::blif_parse_head_filename(blif_fname.c_str(), callback);
   VTR_LOG("Read the blif from a file: %s.\n", blif_fname.c_str());
   if (callback.had_error()) {
     VTR_LOG_ERROR("Read the blif ends with errors\n");
@@ -13,6 +13,7 @@
 #include "command_context.h"
 #include "command_exit_codes.h"
 #include "globals.h"
+#include "openfpga_arch_cache.h"
 #include "read_xml_clock_network.h"
 #include "read_xml_openfpga_arch.h"
 #include "vtr_log.h"
@@ -42,9 +43,34 @@ int read_openfpga_arch_template(T& openfpga_context, const Command& cmd,
 
   std::string arch_file_name = cmd_context.option_value(cmd, opt_file);
 
-  VTR_LOG("Reading XML architecture '%s'...\n", arch_file_name.c_str());
-  openfpga_context.mutable_arch() =
-    read_xml_openfpga_arch(arch_file_name.c_str());
+  /* Restore the architecture from a cache if there is any matching one */
+  CommandOptionId opt_cache = cmd.option("cache");
+  std::string cache_key;
+  std::string cache_file_name;
+  bool cache_hit = false;
+  if (true == cmd_context.option_enable(cmd, opt_cache)) {
+    cache_key = openfpga_arch_cache_key(arch_file_name.c_str());
+    if (!cache_key.empty()) {
+      cache_file_name = openfpga_arch_cache_file_name(
+        cmd_context.option_value(cmd, opt_cache), cache_key);
+      cache_hit = read_openfpga_arch_cache(cache_file_name, cache_key,
+                                           openfpga_context.mutable_arch());
+    }
+  }
+
+  if (cache_hit) {
+    VTR_LOG("Restored architecture '%s' from cache '%s'.\n",
+            arch_file_name.c_str(), cache_file_name.c_str());
+  } else {
+    VTR_LOG("Reading XML architecture '%s'...\n", arch_file_name.c_str());
+    openfpga_context.mutable_arch() =
+      read_xml_openfpga_arch(arch_file_name.c_str());
+    /* A failure on caching does not affect the architecture just read */
+    if (!cache_file_name.empty()) {
+      write_openfpga_arch_cache(cache_file_name, cache_key,
+                                openfpga_context.arch());
+    }
+  }
 
   /* Check the architecture:
    * 1. Circuit library
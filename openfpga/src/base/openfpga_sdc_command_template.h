@@ -97,6 +97,13 @@ ShellCommandId add_write_pnr_sdc_command_template(
   shell_cmd.add_option("no_time_stamp", false,
                        "Do not print time stamp in output files");
 
+  /* Add an option '--threads' */
+  CommandOptionId threads_opt = shell_cmd.add_option(
+    "threads", false,
+    "Specify the number of threads to write SDC files. By default, it is 1. "
+    "When set to 0, all the hardware threads are used");
+  shell_cmd.set_option_require_value(threads_opt, openfpga::OPT_INT);
+
   /* Add an option '--verbose' */
   shell_cmd.add_option("verbose", false, "Enable verbose output");
 
@@ -245,6 +252,13 @@ ShellCommandId add_write_analysis_sdc_command_template(
   shell_cmd.add_option("no_time_stamp", false,
                        "Do not print time stamp in output files");
 
+  /* Add an option '--threads' */
+  CommandOptionId threads_opt = shell_cmd.add_option(
+    "threads", false,
+    "Specify the number of threads to build the SDC file. By default, it is "
+    "1. When set to 0, all the hardware threads are used");
+  shell_cmd.set_option_require_value(threads_opt, openfpga::OPT_INT);
+
   /* Add command 'write_fabric_verilog' to the Shell */
   ShellCommandId shell_cmd_id =
     shell.add_command(shell_cmd,
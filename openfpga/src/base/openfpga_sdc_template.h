@@ -12,6 +12,7 @@
 #include "configure_port_sdc_writer.h"
 #include "globals.h"
 #include "openfpga_digest.h"
+#include "openfpga_parallel.h"
 #include "openfpga_scale.h"
 #include "pnr_sdc_writer.h"
 #include "vtr_log.h"
@@ -47,6 +48,7 @@ int write_pnr_sdc_template(const T& openfpga_ctx, const Command& cmd,
   CommandOptionId opt_constrain_zero_delay_paths =
     cmd.option("constrain_zero_delay_paths");
   CommandOptionId opt_no_time_stamp = cmd.option("no_time_stamp");
+  CommandOptionId opt_threads = cmd.option("threads");
 
   /* This is an intermediate data structure which is designed to modularize the
    * FPGA-SDC Keep it independent from any other outside data structures
@@ -59,6 +61,19 @@ int write_pnr_sdc_template(const T& openfpga_ctx, const Command& cmd,
 
   PnrSdcOption options(sdc_dir_path);
 
+  if (true == cmd_context.option_enable(cmd, opt_threads)) {
+    size_t num_threads = 1;
+    if (false == parse_num_threads(cmd_context.option_value(cmd, opt_threads),
+                                   num_threads)) {
+      VTR_LOG_ERROR(
+        "Invalid number of threads '%s' which should be 0 or a positive "
+        "number!\n",
+        cmd_context.option_value(cmd, opt_threads).c_str());
+      return CMD_EXEC_FATAL_ERROR;
+    }
+    options.set_num_threads(num_threads);
+  }
+
   options.set_flatten_names(cmd_context.option_enable(cmd, opt_flatten_names));
   options.set_hierarchical(cmd_context.option_enable(cmd, opt_hierarchical));
 
@@ -194,6 +209,7 @@ int write_analysis_sdc_template(const T& openfpga_ctx, const Command& cmd,
   CommandOptionId opt_flatten_names = cmd.option("flatten_names");
   CommandOptionId opt_time_unit = cmd.option("time_unit");
   CommandOptionId opt_no_time_stamp = cmd.option("no_time_stamp");
+  CommandOptionId opt_threads = cmd.option("threads");
 
   /* This is an intermediate data structure which is designed to modularize the
    * FPGA-SDC Keep it independent from any other outside data structures
@@ -205,6 +221,19 @@ int write_analysis_sdc_template(const T& openfpga_ctx, const Command& cmd,
   create_directory(sdc_dir_path, true, true);
 
   AnalysisSdcOption options(sdc_dir_path);
+
+  if (true == cmd_context.option_enable(cmd, opt_threads)) {
+    size_t num_threads = 1;
+    if (false == parse_num_threads(cmd_context.option_value(cmd, opt_threads),
+                                   num_threads)) {
+      VTR_LOG_ERROR(
+        "Invalid number of threads '%s' which should be 0 or a positive "
+        "number!\n",
+        cmd_context.option_value(cmd, opt_threads).c_str());
+      return CMD_EXEC_FATAL_ERROR;
+    }
+    options.set_num_threads(num_threads);
+  }
   options.set_generate_sdc_analysis(true);
   options.set_flatten_names(cmd_context.option_enable(cmd, opt_flatten_names));
   options.set_time_stamp(!cmd_context.option_enable(cmd, opt_no_time_stamp));
@@ -215,14 +244,13 @@ int write_analysis_sdc_template(const T& openfpga_ctx, const Command& cmd,
   }
 
   if (true == options.generate_sdc_analysis()) {
-    print_analysis_sdc(
+    return print_analysis_sdc(
       options,
       1. /
         openfpga_ctx.simulation_setting().default_operating_clock_frequency(),
       g_vpr_ctx, openfpga_ctx, openfpga_ctx.flow_manager().compress_routing());
   }
 
-  /* TODO: should identify the error code from internal function execution */
   return CMD_EXEC_SUCCESS;
 }
 
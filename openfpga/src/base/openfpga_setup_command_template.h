@@ -39,6 +39,14 @@ ShellCommandId add_read_openfpga_arch_command_template(
   shell_cmd.set_option_short_name(opt_arch_file, "f");
   shell_cmd.set_option_require_value(opt_arch_file, openfpga::OPT_STRING);
 
+  /* Add an option '--cache' */
+  CommandOptionId opt_cache = shell_cmd.add_option(
+    "cache", false,
+    "directory of architecture caches. The architecture is restored from "
+    "the cache matching the architecture file if any, otherwise it is "
+    "parsed and cached");
+  shell_cmd.set_option_require_value(opt_cache, openfpga::OPT_STRING);
+
   /* Add command 'read_openfpga_arch' to the Shell */
   ShellCommandId shell_cmd_id =
     shell.add_command(shell_cmd, "read OpenFPGA architecture file", hidden);
@@ -352,6 +360,12 @@ ShellCommandId add_pb_pin_fixup_command_template(
     "to a best-fit Most Significant Bit (MSB) of input ports of programmable "
     "blocks. If not specified, a best-fit Least Significant Bit (LSB) will be "
     "the default choice");
+  /* Add an option '--threads' */
+  CommandOptionId opt_threads = shell_cmd.add_option(
+    "threads", false,
+    "Specify the number of threads to fix up clustered blocks. By default, it "
+    "is 1. When set to 0, all the hardware threads are used");
+  shell_cmd.set_option_require_value(opt_threads, openfpga::OPT_INT);
   /* Add an option '--verbose' */
   shell_cmd.add_option("verbose", false, "Show verbose outputs");
 
@@ -419,6 +433,12 @@ ShellCommandId add_build_fabric_command_template(
                        "Compress the number of unique routing modules by "
                        "identifying the unique GSBs");
 
+  /* Add an option '--flyweight_routing' */
+  shell_cmd.add_option(
+    "flyweight_routing", false,
+    "Share one module body among identical routing blocks when routing is "
+    "not compressed. Netlists still output a module per routing block");
+
   /* Add an option '--duplicate_grid_pin' */
   shell_cmd.add_option("duplicate_grid_pin", false,
                        "Duplicate the pins on the same side of a grid");
@@ -445,6 +465,12 @@ ShellCommandId add_build_fabric_command_template(
     "reduce the number of blocks at top-level");
   shell_cmd.set_option_require_value(opt_group_tile, openfpga::OPT_STRING);
 
+  /* Add an option '--verify_unique_tiles' */
+  shell_cmd.add_option(
+    "verify_unique_tiles", false,
+    "check the unique tiles against a pairwise comparison of all the tiles. "
+    "Only applicable when '--group_tile' is enabled");
+
   /* Add an option '--group_config_block' */
   shell_cmd.add_option("group_config_block", false,
                        "group configuration memory blocks under CLB/SB/CB "
@@ -461,6 +487,13 @@ ShellCommandId add_build_fabric_command_template(
                        "Create a random fabric key which will shuffle the "
                        "memory address for encryption purpose");
 
+  /* Add an option '--threads' */
+  CommandOptionId opt_threads = shell_cmd.add_option(
+    "threads", false,
+    "Specify the number of threads to build routing modules. By default, it "
+    "is 1. When set to 0, all the hardware threads are used");
+  shell_cmd.set_option_require_value(opt_threads, openfpga::OPT_INT);
+
   /* Add an option '--verbose' */
   shell_cmd.add_option("verbose", false, "Show verbose outputs");
 
@@ -1113,6 +1146,40 @@ ShellCommandId add_write_module_naming_rules_command_template(
   return shell_cmd_id;
 }
 
+/********************************************************************
+ * - Add a command to Shell environment: write_io_naming_rules
+ * - Add associated options
+ * - Add command dependency
+ *******************************************************************/
+template <class T>
+ShellCommandId add_write_io_naming_rules_command_template(
+  openfpga::Shell<T>& shell, const ShellCommandClassId& cmd_class_id,
+  const std::vector<ShellCommandId>& dependent_cmds, const bool& hidden) {
+  Command shell_cmd("write_io_naming_rules");
+  /* Add an option '--file' in short '-f'*/
+  CommandOptionId opt_file = shell_cmd.add_option(
+    "file", true, "file path to the XML file that contains I/O naming rules");
+  shell_cmd.set_option_short_name(opt_file, "f");
+  shell_cmd.set_option_require_value(opt_file, openfpga::OPT_STRING);
+
+  shell_cmd.add_option("verbose", false, "Show verbose outputs");
+
+  /* Add command to the Shell */
+  ShellCommandId shell_cmd_id = shell.add_command(
+    shell_cmd,
+    "Output the I/O naming rules between fpga_top and fpga_core to a given "
+    "file",
+    hidden);
+  shell.set_command_class(shell_cmd_id, cmd_class_id);
+  shell.set_command_const_execute_function(shell_cmd_id,
+                                           write_io_naming_rules_template<T>);
+
+  /* Add command dependency to the Shell */
+  shell.set_command_dependency(shell_cmd_id, dependent_cmds);
+
+  return shell_cmd_id;
+}
+
 /********************************************************************
  * - Add a command to Shell environment: write_pin_physical_location
  * - Add associated options
@@ -1572,6 +1639,17 @@ void add_setup_command_templates(openfpga::Shell<T>& shell,
     shell, openfpga_setup_cmd_class, cmd_dependency_write_module_naming_rules,
     hidden);
 
+  /********************************
+   * Command 'write_io_naming_rules'
+   */
+  /* The 'write_io_naming_rules' command should NOT be executed before
+   * 'build_fabric' */
+  std::vector<ShellCommandId> cmd_dependency_write_io_naming_rules;
+  cmd_dependency_write_io_naming_rules.push_back(build_fabric_cmd_id);
+  add_write_io_naming_rules_command_template<T>(
+    shell, openfpga_setup_cmd_class, cmd_dependency_write_io_naming_rules,
+    hidden);
+
   /********************************
    * Command 'write_fabric_pin_physical_location'
    */
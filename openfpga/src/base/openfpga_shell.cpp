@@ -1,10 +1,13 @@
 #include "openfpga_shell.h"
 
+#include <fstream>
+
 #include "basic_command.h"
 #include "command_echo.h"
 #include "command_parser.h"
 #include "openfpga_bitstream_command.h"
 #include "openfpga_context.h"
+#include "openfpga_parallel.h"
 #include "openfpga_sdc_command.h"
 #include "openfpga_setup_command.h"
 #include "openfpga_spice_command.h"
@@ -13,7 +16,35 @@
 #ifdef OPENFPGA_INCLUDE_YOSYS_COMMAND
 #include "openfpga_yosys_command.h"
 #endif
+#include "openfpga_tokenizer.h"
 #include "vpr_command.h"
+#include "vtr_log.h"
+
+/********************************************************************
+ * Read the list of design scripts for the fork mode. Each line of the
+ * file is the path to a design script. Empty lines and lines starting
+ * with '#' are skipped. Return false if the file can not be read
+ *******************************************************************/
+static bool read_design_script_list(const std::string& fname,
+                                    std::vector<std::string>& design_scripts) {
+  std::ifstream fp(fname);
+  if (!fp.is_open()) {
+    VTR_LOG_ERROR("Fail to open the design list file: %s!\n", fname.c_str());
+    return false;
+  }
+  std::string line;
+  while (std::getline(fp, line)) {
+    openfpga::StringToken line_tokenizer(line);
+    line_tokenizer.ltrim(std::string(" \t\r"));
+    line_tokenizer.rtrim(std::string(" \t\r"));
+    line = line_tokenizer.data();
+    if (line.empty() || ('#' == line.front())) {
+      continue;
+    }
+    design_scripts.push_back(line);
+  }
+  return true;
+}
 
 OpenfpgaShell::OpenfpgaShell() {
   shell_.set_name("OpenFPGA");
@@ -89,6 +120,33 @@ int OpenfpgaShell::start(int argc, char** argv) {
                          "Launch OpenFPGA in batch  mode when running scripts");
   start_cmd.set_option_short_name(opt_batch_exec, "batch");
 
+  /* '--fork_designs': run each design script listed in a file in a child
+   * process forked after the script of '--file' is executed */
+  openfpga::CommandOptionId opt_fork_designs = start_cmd.add_option(
+    "fork_designs", false,
+    "Specify a file listing design scripts, one per line. The script of "
+    "--file is executed once and then each design script is executed in a "
+    "child process which inherits the data built by the script of --file");
+  start_cmd.set_option_require_value(opt_fork_designs, openfpga::OPT_STRING);
+
+  /* '--fork_jobs': number of child processes of '--fork_designs' running at
+   * the same time */
+  openfpga::CommandOptionId opt_fork_jobs = start_cmd.add_option(
+    "fork_jobs", false,
+    "Specify the number of design scripts to be executed at the same time "
+    "in fork mode. By default, it is 1. When set to 0, all the hardware "
+    "threads are used");
+  start_cmd.set_option_require_value(opt_fork_jobs, openfpga::OPT_INT);
+
+  /* '--profile': output the runtime and memory usage of each command to a
+   * file when the shell finishes */
+  openfpga::CommandOptionId opt_profile = start_cmd.add_option(
+    "profile", false,
+    "Output the runtime and memory usage of each command to a file when "
+    "OpenFPGA finishes. The file is in CSV format if its extension is '.csv', "
+    "otherwise in JSON format");
+  start_cmd.set_option_require_value(opt_profile, openfpga::OPT_STRING);
+
   /* '--version', -v': print version information */
   openfpga::CommandOptionId opt_version =
     start_cmd.add_option("version", false, "Show OpenFPGA version");
@@ -118,6 +176,31 @@ int OpenfpgaShell::start(int argc, char** argv) {
       print_openfpga_version_info();
       return 0;
     }
+    if (true == start_cmd_context.option_enable(start_cmd, opt_profile)) {
+      shell_.set_profile_output(
+        start_cmd_context.option_value(start_cmd, opt_profile));
+    }
+    /* The fork options only apply to a common script */
+    bool fork_mode =
+      start_cmd_context.option_enable(start_cmd, opt_fork_designs);
+    if (((true == fork_mode) ||
+         (true == start_cmd_context.option_enable(start_cmd, opt_fork_jobs))) &&
+        (false ==
+         start_cmd_context.option_enable(start_cmd, opt_script_mode))) {
+      VTR_LOG_ERROR("Option '%s' and '%s' require option '%s'!\n",
+                    start_cmd.option_name(opt_fork_designs).c_str(),
+                    start_cmd.option_name(opt_fork_jobs).c_str(),
+                    start_cmd.option_name(opt_script_mode).c_str());
+      return 1;
+    }
+    if ((true == start_cmd_context.option_enable(start_cmd, opt_fork_jobs)) &&
+        (false == fork_mode)) {
+      VTR_LOG_ERROR("Option '%s' requires option '%s'!\n",
+                    start_cmd.option_name(opt_fork_jobs).c_str(),
+                    start_cmd.option_name(opt_fork_designs).c_str());
+      return 1;
+    }
+
     /* Start a shell */
     if (true == start_cmd_context.option_enable(start_cmd, opt_interactive)) {
       shell_.run_interactive_mode(openfpga_ctx_);
@@ -128,15 +211,46 @@ int OpenfpgaShell::start(int argc, char** argv) {
       shell_.run_execute_mode(
         start_cmd_context.option_value(start_cmd, opt_exec_mode).c_str(),
         openfpga_ctx_);
+      shell_.write_profile();
       return shell_.exit_code();
     }
 
+    if ((true == start_cmd_context.option_enable(start_cmd, opt_script_mode)) &&
+        (true == fork_mode)) {
+      std::vector<std::string> design_scripts;
+      if (!read_design_script_list(
+            start_cmd_context.option_value(start_cmd, opt_fork_designs),
+            design_scripts)) {
+        return 1;
+      }
+      size_t num_jobs = 1;
+      if (true == start_cmd_context.option_enable(start_cmd, opt_fork_jobs)) {
+        if (!openfpga::parse_num_threads(
+              start_cmd_context.option_value(start_cmd, opt_fork_jobs),
+              num_jobs)) {
+          VTR_LOG_ERROR(
+            "Invalid number of jobs '%s' which should be 0 or a positive "
+            "number!\n",
+            start_cmd_context.option_value(start_cmd, opt_fork_jobs).c_str());
+          return 1;
+        }
+        num_jobs =
+          openfpga::find_num_worker_threads(num_jobs, design_scripts.size());
+      }
+      size_t num_failures = shell_.run_fork_mode(
+        start_cmd_context.option_value(start_cmd, opt_script_mode).c_str(),
+        design_scripts, openfpga_ctx_, num_jobs);
+      shell_.write_profile();
+      return (0 == num_failures) ? shell_.exit_code() : 1;
+    }
+
     if (true == start_cmd_context.option_enable(start_cmd, opt_script_mode)) {
-      shell_.run_script_mode(
+      int status = shell_.run_script_mode(
         start_cmd_context.option_value(start_cmd, opt_script_mode).c_str(),
         openfpga_ctx_,
         start_cmd_context.option_enable(start_cmd, opt_batch_exec));
-      return shell_.exit_code();
+      shell_.write_profile();
+      return (openfpga::CMD_EXEC_SUCCESS == status) ? shell_.exit_code() : 1;
     }
     /* Reach here there is something wrong, show the help desk */
     openfpga::print_command_options(start_cmd);
@@ -4,6 +4,7 @@
 #include <string>
 
 #include "openfpga_context.h"
+#include "openfpga_string_interner.h"
 #include "shell.h"
 
 /********************************************************************
@@ -40,6 +41,10 @@ class OpenfpgaShell {
   void reset();
 
  private: /* Internal data */
+  /* The names interned by the data storage, e.g., port names, are released
+   * along with the shell. It must be declared before the data storage, so
+   * that it outlives the data storage */
+  openfpga::StringInternerScope string_interner_scope_;
   openfpga::Shell<OpenfpgaContext> shell_;
   OpenfpgaContext openfpga_ctx_;
 };
@@ -53,6 +53,18 @@ ShellCommandId add_write_fabric_spice_command_template(
   shell_cmd.add_option("explicit_port_mapping", false,
                        "Use explicit port mapping in Verilog netlists");
 
+  /* Add an option '--compress_output' */
+  shell_cmd.add_option(
+    "compress_output", false,
+    "SPICE netlists will be outputted in compressed format (.gz)");
+
+  /* Add an option '--threads' */
+  CommandOptionId threads_opt = shell_cmd.add_option(
+    "threads", false,
+    "Specify the number of threads to write SPICE netlists. By default, it "
+    "is 1. When set to 0, all the hardware threads are used");
+  shell_cmd.set_option_require_value(threads_opt, openfpga::OPT_INT);
+
   /* Add an option '--verbose' */
   shell_cmd.add_option("verbose", false, "Enable verbose output");
 
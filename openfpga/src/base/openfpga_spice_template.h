@@ -5,6 +5,7 @@
 #include "command_context.h"
 #include "command_exit_codes.h"
 #include "globals.h"
+#include "openfpga_parallel.h"
 #include "spice_api.h"
 #include "vtr_log.h"
 #include "vtr_time.h"
@@ -21,6 +22,8 @@ int write_fabric_spice_template(T& openfpga_ctx, const Command& cmd,
   CommandOptionId opt_output_dir = cmd.option("file");
   CommandOptionId opt_explicit_port_mapping =
     cmd.option("explicit_port_mapping");
+  CommandOptionId opt_compress_output = cmd.option("compress_output");
+  CommandOptionId opt_threads = cmd.option("threads");
   CommandOptionId opt_verbose = cmd.option("verbose");
 
   /* This is an intermediate data structure which is designed to modularize the
@@ -32,6 +35,21 @@ int write_fabric_spice_template(T& openfpga_ctx, const Command& cmd,
     cmd_context.option_enable(cmd, opt_explicit_port_mapping));
   options.set_verbose_output(cmd_context.option_enable(cmd, opt_verbose));
   options.set_compress_routing(openfpga_ctx.flow_manager().compress_routing());
+  options.set_compress_output(
+    cmd_context.option_enable(cmd, opt_compress_output));
+
+  if (true == cmd_context.option_enable(cmd, opt_threads)) {
+    size_t num_threads = 1;
+    if (false == parse_num_threads(cmd_context.option_value(cmd, opt_threads),
+                                   num_threads)) {
+      VTR_LOG_ERROR(
+        "Invalid number of threads '%s' which should be 0 or a positive "
+        "number!\n",
+        cmd_context.option_value(cmd, opt_threads).c_str());
+      return CMD_EXEC_FATAL_ERROR;
+    }
+    options.set_num_threads(num_threads);
+  }
 
   int status = CMD_EXEC_SUCCESS;
   status = fpga_fabric_spice(
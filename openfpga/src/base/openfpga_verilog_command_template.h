@@ -303,6 +303,13 @@ ShellCommandId add_write_preconfigured_fabric_wrapper_command_template(
                          "default, big endian is considered");
   shell_cmd.set_option_short_name(le_opt, "le");
 
+  /* Add an option '--threads' */
+  CommandOptionId threads_opt = shell_cmd.add_option(
+    "threads", false,
+    "Specify the number of threads to render the embedded bitstream. By "
+    "default, it is 1. When set to 0, all the hardware threads are used");
+  shell_cmd.set_option_require_value(threads_opt, openfpga::OPT_INT);
+
   /* add an option '--verbose' */
   shell_cmd.add_option("verbose", false, "enable verbose output");
 
@@ -8,6 +8,7 @@
 #include "command_context.h"
 #include "command_exit_codes.h"
 #include "globals.h"
+#include "openfpga_parallel.h"
 #include "openfpga_scale.h"
 #include "read_xml_bus_group.h"
 #include "read_xml_pin_constraints.h"
@@ -208,6 +209,7 @@ int write_preconfigured_fabric_wrapper_template(
   CommandOptionId opt_dump_waveform = cmd.option("dump_waveform");
   CommandOptionId opt_little_endian = cmd.option("little_endian");
   CommandOptionId opt_verbose = cmd.option("verbose");
+  CommandOptionId opt_threads = cmd.option("threads");
 
   /* This is an intermediate data structure which is designed to modularize the
    * FPGA-Verilog Keep it independent from any other outside data structures
@@ -242,6 +244,19 @@ int write_preconfigured_fabric_wrapper_template(
       cmd_context.option_value(cmd, opt_embed_bitstream));
   }
 
+  if (true == cmd_context.option_enable(cmd, opt_threads)) {
+    size_t num_threads = 1;
+    if (false == parse_num_threads(cmd_context.option_value(cmd, opt_threads),
+                                   num_threads)) {
+      VTR_LOG_ERROR(
+        "Invalid number of threads '%s' which should be 0 or a positive "
+        "number!\n",
+        cmd_context.option_value(cmd, opt_threads).c_str());
+      return CMD_EXEC_FATAL_ERROR;
+    }
+    options.set_num_threads(num_threads);
+  }
+
   /* If pin constraints are enabled by command options, read the file */
   PinConstraints pin_constraints;
   if (true == cmd_context.option_enable(cmd, opt_pcf)) {
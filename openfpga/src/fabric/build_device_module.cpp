@@ -38,10 +38,12 @@ int build_device_module_graph(
   MemoryBankShiftRegisterBanks& blwl_sr_banks, FabricTile& fabric_tile,
   ModuleNameMap& module_name_map, const OpenfpgaContext& openfpga_ctx,
   const DeviceContext& vpr_device_ctx, const bool& frame_view,
-  const bool& compress_routing, const bool& duplicate_grid_pin,
-  const FabricKey& fabric_key, const TileConfig& tile_config,
-  const bool& group_config_block, const bool& group_routing,
-  const bool& name_module_using_index, const bool& generate_random_fabric_key,
+  const bool& compress_routing, const bool& flyweight_routing,
+  const bool& duplicate_grid_pin, const FabricKey& fabric_key,
+  const TileConfig& tile_config, const bool& verify_unique_tiles,
+  const bool& group_config_block,
+  const bool& group_routing, const bool& name_module_using_index,
+  const bool& generate_random_fabric_key, const size_t& num_threads,
   const bool& verbose) {
   vtr::ScopedStartFinishTimer timer("Build fabric module graph");
 
@@ -111,7 +113,8 @@ int build_device_module_graph(
                                  openfpga_ctx.device_rr_gsb(),
                                  openfpga_ctx.arch().circuit_lib,
                                  openfpga_ctx.arch().config_protocol.type(),
-                                 sram_model, group_config_block, verbose);
+                                 sram_model, group_config_block, num_threads,
+                                 verbose);
   } else {
     VTR_ASSERT_SAFE(false == compress_routing);
     build_flatten_routing_modules(module_manager, decoder_lib, vpr_device_ctx,
@@ -119,7 +122,8 @@ int build_device_module_graph(
                                   in_edges, openfpga_ctx.device_rr_gsb(),
                                   openfpga_ctx.arch().circuit_lib,
                                   openfpga_ctx.arch().config_protocol.type(),
-                                  sram_model, group_config_block, verbose);
+                                  sram_model, group_config_block,
+                                  flyweight_routing, num_threads, verbose);
   }
 
   /* Build tile modules if defined */
@@ -127,7 +131,8 @@ int build_device_module_graph(
     /* Build detailed tile-level information */
     status = build_fabric_tile(fabric_tile, tile_config, vpr_device_ctx.grid,
                                vpr_device_ctx.rr_graph,
-                               openfpga_ctx.device_rr_gsb(), verbose);
+                               openfpga_ctx.device_rr_gsb(),
+                               verify_unique_tiles, verbose);
     if (CMD_EXEC_FATAL_ERROR == status) {
       return status;
     }
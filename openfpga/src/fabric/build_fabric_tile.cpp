@@ -289,7 +289,8 @@ static int build_fabric_tile_style_top_left(FabricTile& fabric_tile,
  *******************************************************************/
 int build_fabric_tile(FabricTile& fabric_tile, const TileConfig& tile_config,
                       const DeviceGrid& grids, const RRGraphView& rr_graph,
-                      const DeviceRRGSB& device_rr_gsb, const bool& verbose) {
+                      const DeviceRRGSB& device_rr_gsb,
+                      const bool& verify_unique_tiles, const bool& verbose) {
   vtr::ScopedStartFinishTimer timer(
     "Build tile-level information for the FPGA fabric");
 
@@ -322,6 +323,15 @@ int build_fabric_tile(FabricTile& fabric_tile, const TileConfig& tile_config,
   VTR_LOGV(verbose, "Extracted %lu uniques tiles from the FPGA fabric\n",
            fabric_tile.unique_tiles().size());
 
+  /* Cross-check the unique tiles with the pairwise comparison if required */
+  if (verify_unique_tiles) {
+    if (!fabric_tile.verify_unique_tiles(grids, device_rr_gsb)) {
+      VTR_LOG_ERROR("Unique tiles are not consistent with the tiles!\n");
+      return CMD_EXEC_FATAL_ERROR;
+    }
+    VTR_LOG("Verified %lu unique tiles\n", fabric_tile.unique_tiles().size());
+  }
+
   return status_code;
 }
 
@@ -21,7 +21,8 @@ namespace openfpga {
 
 int build_fabric_tile(FabricTile& fabric_tile, const TileConfig& tile_config,
                       const DeviceGrid& grids, const RRGraphView& rr_graph,
-                      const DeviceRRGSB& device_rr_gsb, const bool& verbose);
+                      const DeviceRRGSB& device_rr_gsb,
+                      const bool& verify_unique_tiles, const bool& verbose);
 
 } /* end namespace openfpga */
 
@@ -21,6 +21,7 @@
 #include "build_routing_modules.h"
 #include "module_manager_utils.h"
 #include "openfpga_naming.h"
+#include "openfpga_parallel.h"
 #include "openfpga_reserved_words.h"
 #include "openfpga_rr_graph_utils.h"
 #include "rr_gsb_edges.h"
@@ -353,7 +354,7 @@ static void build_connection_block_module_short_interc(
   const std::map<ModulePinInfo, ModuleNetId>& input_port_to_module_nets) {
   /* Ensure we have only one 1 driver node */
   const RRNodeId& src_rr_node = rr_gsb.get_ipin_node(cb_ipin_side, ipin_index);
-  const std::vector<RREdgeId>& driver_rr_edges =
+  std::span<const RREdgeId> driver_rr_edges =
     gsb_edges.get_ipin_node_in_edges(rr_gsb, in_edges, cb_ipin_side,
                                      ipin_index);
   std::vector<RRNodeId> driver_rr_nodes;
@@ -429,7 +430,7 @@ static void build_connection_block_mux_module(
   VTR_ASSERT(e_rr_type::IPIN == rr_graph.node_type(cur_rr_node));
 
   /* Build a vector of driver rr_nodes */
-  const std::vector<RREdgeId>& driver_rr_edges =
+  std::span<const RREdgeId> driver_rr_edges =
     gsb_edges.get_ipin_node_in_edges(rr_gsb, in_edges, cb_ipin_side,
                                      ipin_index);
   std::vector<RRNodeId> driver_rr_nodes;
@@ -631,7 +632,7 @@ static void build_connection_block_interc_modules(
   const size_t& ipin_index,
   const std::map<ModulePinInfo, ModuleNetId>& input_port_to_module_nets,
   const bool& group_config_block) {
-  const std::vector<RREdgeId>& driver_rr_edges =
+  std::span<const RREdgeId> driver_rr_edges =
     gsb_edges.get_ipin_node_in_edges(rr_gsb, in_edges, cb_ipin_side,
                                      ipin_index);
 
@@ -722,18 +723,12 @@ static void build_switch_block_module(
   const CircuitLibrary& circuit_lib,
   const e_config_protocol_type& sram_orgz_type,
   const CircuitModelId& sram_model, const DeviceRRGSB& device_rr_gsb,
-  const RRGSB& rr_gsb, const bool& group_config_block, const bool& verbose) {
-  /* Create a Module of Switch Block and add to module manager */
+  const RRGSB& rr_gsb, const ModuleId& sb_module,
+  const bool& group_config_block, const bool& verbose) {
   vtr::Point<size_t> gsb_coordinate(rr_gsb.get_sb_x(), rr_gsb.get_sb_y());
 
-  std::string sb_module_name =
-    generate_switch_block_module_name(gsb_coordinate);
-  ModuleId sb_module = module_manager.add_module(sb_module_name);
-
-  /* Label module usage */
-  module_manager.set_module_usage(sb_module, ModuleManager::MODULE_SB);
-
-  VTR_LOGV(verbose, "Building module '%s'...", sb_module_name.c_str());
+  VTR_LOGV(verbose, "Building module '%s'...",
+           module_manager.module_name(sb_module).c_str());
 
   // Create fast lookup for module nets whose source are input ports
 
@@ -1021,25 +1016,16 @@ static void build_connection_block_module(
   const CircuitLibrary& circuit_lib,
   const e_config_protocol_type& sram_orgz_type,
   const CircuitModelId& sram_model, const DeviceRRGSB& device_rr_gsb,
-  const RRGSB& rr_gsb, const e_rr_type& cb_type, const bool& group_config_block,
-  const bool& verbose) {
+  const RRGSB& rr_gsb, const e_rr_type& cb_type, const ModuleId& cb_module,
+  const bool& group_config_block, const bool& verbose) {
   /* Create the netlist */
   vtr::Point<size_t> gsb_coordinate(rr_gsb.get_cb_x(cb_type),
                                     rr_gsb.get_cb_y(cb_type));
   const RRGSBEdges& gsb_edges =
     device_rr_gsb.get_gsb_edges(rr_gsb.get_x(), rr_gsb.get_y());
 
-  /* Create a Verilog Module based on the circuit model, and add to module
-   * manager */
-  ModuleId cb_module = module_manager.add_module(
-    generate_connection_block_module_name(cb_type, gsb_coordinate));
-
-  /* Label module usage */
-  module_manager.set_module_usage(cb_module, ModuleManager::MODULE_CB);
-
-  VTR_LOGV(
-    verbose, "Building module '%s'...",
-    generate_connection_block_module_name(cb_type, gsb_coordinate).c_str());
+  VTR_LOGV(verbose, "Building module '%s'...",
+           module_manager.module_name(cb_module).c_str());
 
   /* Add the input and output ports of routing tracks in the channel
    * Routing tracks pass through the connection blocks
@@ -1258,20 +1244,220 @@ static void build_connection_block_module(
 }
 
 /********************************************************************
- * Iterate over all the connection blocks in a device
- * and build a module for each of them
+ * A routing module whose body is to be built.
+ * The module itself is added to the module manager in advance, so that
+ * module ids and names are assigned in a deterministic order regardless of
+ * how the bodies are built later
+ *******************************************************************/
+struct RoutingModuleTask {
+  ModuleId module;
+  const RRGSB* rr_gsb;
+  /* NUM_RR_TYPES for a switch block, CHANX/CHANY for a connection block */
+  e_rr_type cb_type;
+};
+
+/********************************************************************
+ * Add an empty switch block module to the module manager
+ *******************************************************************/
+static ModuleId add_switch_block_module(ModuleManager& module_manager,
+                                        const RRGSB& rr_gsb) {
+  ModuleId sb_module =
+    module_manager.add_module(generate_switch_block_module_name(
+      vtr::Point<size_t>(rr_gsb.get_sb_x(), rr_gsb.get_sb_y())));
+  module_manager.set_module_usage(sb_module, ModuleManager::MODULE_SB);
+  return sb_module;
+}
+
+/********************************************************************
+ * Add an empty connection block module to the module manager
+ *******************************************************************/
+static ModuleId add_connection_block_module(ModuleManager& module_manager,
+                                            const RRGSB& rr_gsb,
+                                            const e_rr_type& cb_type) {
+  ModuleId cb_module =
+    module_manager.add_module(generate_connection_block_module_name(
+      cb_type,
+      vtr::Point<size_t>(rr_gsb.get_cb_x(cb_type), rr_gsb.get_cb_y(cb_type))));
+  module_manager.set_module_usage(cb_module, ModuleManager::MODULE_CB);
+  return cb_module;
+}
+
+/********************************************************************
+ * Build the bodies of routing modules, in parallel when possible
+ * Each body only writes to its own module, so that bodies can be built
+ * independently. The parent links of the child modules, which are shared
+ * by all the bodies, are restored once all the bodies are built.
+ *
+ * The bodies are built serially when
+ * - configurable memories are grouped, which adds new memory modules
+ * - the configuration protocol is frame-based, which adds new decoders
  *******************************************************************/
-static void build_flatten_connection_block_modules(
+static void build_routing_module_bodies(
   ModuleManager& module_manager, DecoderLibrary& decoder_lib,
-  const DeviceContext& device_ctx, const RRGraphInEdges& in_edges,
-  const VprDeviceAnnotation& device_annotation,
-  const DeviceRRGSB& device_rr_gsb, const CircuitLibrary& circuit_lib,
+  const DeviceContext& device_ctx, const VprDeviceAnnotation& device_annotation,
+  const RRGraphInEdges& in_edges, const DeviceRRGSB& device_rr_gsb,
+  const CircuitLibrary& circuit_lib,
   const e_config_protocol_type& sram_orgz_type,
-  const CircuitModelId& sram_model, const e_rr_type& cb_type,
-  const bool& group_config_block, const bool& verbose) {
+  const CircuitModelId& sram_model, const bool& group_config_block,
+  const std::vector<RoutingModuleTask>& tasks, const size_t& num_threads,
+  const bool& verbose) {
+  size_t num_workers = num_threads;
+  if (group_config_block || CONFIG_MEM_FRAME_BASED == sram_orgz_type) {
+    VTR_LOGV(1 != num_threads,
+             "Build routing modules serially as they may create shared "
+             "memory or decoder modules\n");
+    num_workers = 1;
+  }
+  num_workers = find_num_worker_threads(num_workers, tasks.size());
+  VTR_LOGV(1 < num_workers, "Build %lu routing modules with %lu threads\n",
+           tasks.size(), num_workers);
+
+  module_manager.begin_parallel_build();
+  parallel_for_each_task(
+    tasks.size(), num_workers, [&](const size_t& itask) {
+      const RoutingModuleTask& task = tasks[itask];
+      if (e_rr_type::NUM_RR_TYPES == task.cb_type) {
+        build_switch_block_module(
+          module_manager, decoder_lib, device_annotation, device_ctx.grid,
+          device_ctx.rr_graph, in_edges, circuit_lib, sram_orgz_type,
+          sram_model, device_rr_gsb, *task.rr_gsb, task.module,
+          group_config_block, verbose && 1 == num_workers);
+      } else {
+        build_connection_block_module(
+          module_manager, decoder_lib, device_annotation, device_ctx.grid,
+          device_ctx.rr_graph, in_edges, circuit_lib, sram_orgz_type,
+          sram_model, device_rr_gsb, *task.rr_gsb, task.cb_type, task.module,
+          group_config_block, verbose && 1 == num_workers);
+      }
+    });
+  module_manager.end_parallel_build();
+}
+
+/********************************************************************
+ * Identify if the grid pins of two connection blocks are named the same.
+ * The mirror checks only compare the number of grid pins, while the ports
+ * of a shared module body are named after the grid pins of the body GSB.
+ * The top-level and tile builders look up the ports with the grid pins of
+ * each instance, so the names must match
+ *******************************************************************/
+static bool is_cb_grid_port_name_mirror(
+  const DeviceContext& device_ctx, const VprDeviceAnnotation& device_annotation,
+  const RRGSB& base, const RRGSB& cand, const e_rr_type& cb_type) {
+  for (const e_side& cb_ipin_side : base.get_cb_ipin_sides(cb_type)) {
+    if (base.get_num_ipin_nodes(cb_ipin_side) !=
+        cand.get_num_ipin_nodes(cb_ipin_side)) {
+      return false;
+    }
+    for (size_t inode = 0; inode < base.get_num_ipin_nodes(cb_ipin_side);
+         ++inode) {
+      if (generate_cb_module_grid_port_name(
+            cb_ipin_side, device_ctx.grid, device_annotation,
+            device_ctx.rr_graph, base.get_ipin_node(cb_ipin_side, inode)) !=
+          generate_cb_module_grid_port_name(
+            cb_ipin_side, device_ctx.grid, device_annotation,
+            device_ctx.rr_graph, cand.get_ipin_node(cb_ipin_side, inode))) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+/********************************************************************
+ * Identify if the grid pins of two switch blocks are named the same,
+ * see is_cb_grid_port_name_mirror(). When routing blocks are grouped,
+ * the switch blocks also drive the grid input pins
+ *******************************************************************/
+static bool is_sb_grid_port_name_mirror(
+  const DeviceContext& device_ctx, const VprDeviceAnnotation& device_annotation,
+  const RRGSB& base, const RRGSB& cand, const bool& group_routing) {
+  const RRGraphView& rr_graph = device_ctx.rr_graph;
+  for (size_t side = 0; side < base.get_num_sides(); ++side) {
+    SideManager side_manager(side);
+    e_side sb_side = side_manager.get_side();
+    if (base.get_num_opin_nodes(sb_side) != cand.get_num_opin_nodes(sb_side)) {
+      return false;
+    }
+    for (size_t inode = 0; inode < base.get_num_opin_nodes(sb_side); ++inode) {
+      RRNodeId base_node = base.get_opin_node(sb_side, inode);
+      RRNodeId cand_node = cand.get_opin_node(sb_side, inode);
+      if (generate_sb_module_grid_port_name(
+            sb_side, get_rr_graph_single_node_side(rr_graph, base_node),
+            device_ctx.grid, device_annotation, rr_graph, base_node) !=
+          generate_sb_module_grid_port_name(
+            sb_side, get_rr_graph_single_node_side(rr_graph, cand_node),
+            device_ctx.grid, device_annotation, rr_graph, cand_node)) {
+        return false;
+      }
+    }
+    if (false == group_routing) {
+      continue;
+    }
+    if (base.get_num_ipin_nodes(sb_side) != cand.get_num_ipin_nodes(sb_side)) {
+      return false;
+    }
+    for (size_t inode = 0; inode < base.get_num_ipin_nodes(sb_side); ++inode) {
+      if (generate_cb_module_grid_port_name(
+            sb_side, device_ctx.grid, device_annotation, rr_graph,
+            base.get_ipin_node(sb_side, inode)) !=
+          generate_cb_module_grid_port_name(
+            sb_side, device_ctx.grid, device_annotation, rr_graph,
+            cand.get_ipin_node(sb_side, inode))) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+/********************************************************************
+ * Find a connection block module which has been built for a mirror of
+ * the given GSB. Return an invalid id if there is no such module.
+ * The body GSBs are the ones whose modules have been added so far.
+ * Besides the mirror check, the grid pins must be named the same, so that
+ * each instance can find its grid ports in the shared body
+ *******************************************************************/
+static ModuleId find_flyweight_connection_block_module(
+  const ModuleManager& module_manager, const DeviceContext& device_ctx,
+  const RRGraphInEdges& in_edges, const VprDeviceAnnotation& device_annotation,
+  const DeviceRRGSB& device_rr_gsb,
+  const std::vector<vtr::Point<size_t>>& body_gsbs, const RRGSB& rr_gsb,
+  const e_rr_type& cb_type) {
+  const RRGSBEdges& cand_edges =
+    device_rr_gsb.get_gsb_edges(rr_gsb.get_x(), rr_gsb.get_y());
+  for (const vtr::Point<size_t>& body_coord : body_gsbs) {
+    const RRGSB& body_gsb = device_rr_gsb.get_gsb(body_coord);
+    if (true == is_cb_mirror(device_ctx.rr_graph, in_edges, device_annotation,
+                             body_gsb, device_rr_gsb.get_gsb_edges(body_coord),
+                             rr_gsb, cand_edges, cb_type) &&
+        true == is_cb_grid_port_name_mirror(device_ctx, device_annotation,
+                                            body_gsb, rr_gsb, cb_type)) {
+      return module_manager.find_module(generate_connection_block_module_name(
+        cb_type, vtr::Point<size_t>(body_gsb.get_cb_x(cb_type),
+                                    body_gsb.get_cb_y(cb_type))));
+    }
+  }
+  return ModuleId::INVALID();
+}
+
+/********************************************************************
+ * Iterate over all the connection blocks in a device
+ * and add a module for each of them. The bodies of the modules are
+ * collected as tasks, which are built later
+ * In flyweight mode, a connection block which mirrors a built one does not
+ * get a module body but an alias of the body under its own name
+ *******************************************************************/
+static void add_flatten_connection_block_modules(
+  ModuleManager& module_manager, const DeviceContext& device_ctx,
+  const RRGraphInEdges& in_edges, const VprDeviceAnnotation& device_annotation,
+  const DeviceRRGSB& device_rr_gsb, const e_rr_type& cb_type,
+  const bool& flyweight, std::vector<RoutingModuleTask>& tasks) {
   /* Build unique X-direction connection block modules */
   vtr::Point<size_t> cb_range = device_rr_gsb.get_gsb_range();
 
+  /* GSBs whose connection block modules have a body */
+  std::vector<vtr::Point<size_t>> body_gsbs;
+
   for (size_t ix = 0; ix < cb_range.x(); ++ix) {
     for (size_t iy = 0; iy < cb_range.y(); ++iy) {
       /* Check if the connection block exists in the device!
@@ -1282,12 +1468,58 @@ static void build_flatten_connection_block_modules(
       if (false == rr_gsb.is_cb_exist(cb_type)) {
         continue;
       }
-      build_connection_block_module(
-        module_manager, decoder_lib, device_annotation, device_ctx.grid,
-        device_ctx.rr_graph, in_edges, circuit_lib, sram_orgz_type, sram_model,
-        device_rr_gsb, rr_gsb, cb_type, group_config_block, verbose);
+      if (true == flyweight) {
+        ModuleId body_module = find_flyweight_connection_block_module(
+          module_manager, device_ctx, in_edges, device_annotation,
+          device_rr_gsb, body_gsbs, rr_gsb, cb_type);
+        if (true == module_manager.valid_module_id(body_module)) {
+          vtr::Point<size_t> cb_coord(rr_gsb.get_cb_x(cb_type),
+                                      rr_gsb.get_cb_y(cb_type));
+          module_manager.add_module_alias(
+            body_module,
+            generate_connection_block_module_name(cb_type, cb_coord));
+          continue;
+        }
+        body_gsbs.push_back(vtr::Point<size_t>(ix, iy));
+      }
+      tasks.push_back(
+        {add_connection_block_module(module_manager, rr_gsb, cb_type), &rr_gsb,
+         cb_type});
     }
   }
+
+  VTR_LOGV(flyweight,
+           "Built %lu %s connection block modules shared by all the "
+           "connection blocks\n",
+           body_gsbs.size(), cb_type == e_rr_type::CHANX ? "X-" : "Y-");
+}
+
+/********************************************************************
+ * Find a switch block module which has been built for a mirror of the
+ * given GSB. Return an invalid id if there is no such module.
+ * The body GSBs are the ones whose modules have been added so far.
+ * As for connection blocks, the grid pins must be named the same
+ *******************************************************************/
+static ModuleId find_flyweight_switch_block_module(
+  const ModuleManager& module_manager, const DeviceContext& device_ctx,
+  const RRGraphInEdges& in_edges, const VprDeviceAnnotation& device_annotation,
+  const DeviceRRGSB& device_rr_gsb,
+  const std::vector<vtr::Point<size_t>>& body_gsbs, const RRGSB& rr_gsb) {
+  const RRGSBEdges& cand_edges =
+    device_rr_gsb.get_gsb_edges(rr_gsb.get_x(), rr_gsb.get_y());
+  for (const vtr::Point<size_t>& body_coord : body_gsbs) {
+    const RRGSB& body_gsb = device_rr_gsb.get_gsb(body_coord);
+    if (true == is_sb_mirror(device_ctx.rr_graph, in_edges, device_annotation,
+                             body_gsb, device_rr_gsb.get_gsb_edges(body_coord),
+                             rr_gsb, cand_edges) &&
+        true == is_sb_grid_port_name_mirror(device_ctx, device_annotation,
+                                            body_gsb, rr_gsb,
+                                            module_manager.group_routing())) {
+      return module_manager.find_module(generate_switch_block_module_name(
+        vtr::Point<size_t>(body_gsb.get_sb_x(), body_gsb.get_sb_y())));
+    }
+  }
+  return ModuleId::INVALID();
 }
 
 /********************************************************************
@@ -1298,6 +1530,14 @@ static void build_flatten_connection_block_modules(
  * Covering:
  * 1. Connection blocks
  * 2. Switch blocks
+ *
+ * In flyweight mode, routing blocks which are mirrors of each other share
+ * one module body. Each of them is still known by its own module name,
+ * which is an alias of the body, so that netlist writers can output
+ * the routing blocks as if they are built as unique modules
+ *
+ * All the modules are added first, and then their bodies are built
+ * with the given number of threads
  *******************************************************************/
 void build_flatten_routing_modules(
   ModuleManager& module_manager, DecoderLibrary& decoder_lib,
@@ -1306,11 +1546,16 @@ void build_flatten_routing_modules(
   const CircuitLibrary& circuit_lib,
   const e_config_protocol_type& sram_orgz_type,
   const CircuitModelId& sram_model, const bool& group_config_block,
-  const bool& verbose) {
+  const bool& flyweight, const size_t& num_threads, const bool& verbose) {
   vtr::ScopedStartFinishTimer timer("Build routing modules...");
 
   vtr::Point<size_t> sb_range = device_rr_gsb.get_gsb_range();
 
+  std::vector<RoutingModuleTask> tasks;
+
+  /* GSBs whose switch block modules have a body */
+  std::vector<vtr::Point<size_t>> body_gsbs;
+
   /* Build unique switch block modules */
   for (size_t ix = 0; ix < sb_range.x(); ++ix) {
     for (size_t iy = 0; iy < sb_range.y(); ++iy) {
@@ -1318,23 +1563,42 @@ void build_flatten_routing_modules(
       if (false == device_rr_gsb.get_gsb_edges(ix, iy).is_sb_exist(rr_gsb)) {
         continue;
       }
-      build_switch_block_module(
-        module_manager, decoder_lib, device_annotation, device_ctx.grid,
-        device_ctx.rr_graph, in_edges, circuit_lib, sram_orgz_type, sram_model,
-        device_rr_gsb, rr_gsb, group_config_block, verbose);
+      if (true == flyweight) {
+        ModuleId body_module = find_flyweight_switch_block_module(
+          module_manager, device_ctx, in_edges, device_annotation,
+          device_rr_gsb, body_gsbs, rr_gsb);
+        if (true == module_manager.valid_module_id(body_module)) {
+          module_manager.add_module_alias(
+            body_module,
+            generate_switch_block_module_name(
+              vtr::Point<size_t>(rr_gsb.get_sb_x(), rr_gsb.get_sb_y())));
+          continue;
+        }
+        body_gsbs.push_back(vtr::Point<size_t>(ix, iy));
+      }
+      tasks.push_back(
+        {add_switch_block_module(module_manager, rr_gsb), &rr_gsb,
+         e_rr_type::NUM_RR_TYPES});
     }
   }
+  VTR_LOGV(flyweight,
+           "Built %lu switch block modules shared by all the switch blocks\n",
+           body_gsbs.size());
+
   if (false == module_manager.group_routing()) {
-    build_flatten_connection_block_modules(
-      module_manager, decoder_lib, device_ctx, in_edges, device_annotation,
-      device_rr_gsb, circuit_lib, sram_orgz_type, sram_model, e_rr_type::CHANX,
-      group_config_block, verbose);
-
-    build_flatten_connection_block_modules(
-      module_manager, decoder_lib, device_ctx, in_edges, device_annotation,
-      device_rr_gsb, circuit_lib, sram_orgz_type, sram_model, e_rr_type::CHANY,
-      group_config_block, verbose);
+    add_flatten_connection_block_modules(module_manager, device_ctx, in_edges,
+                                         device_annotation, device_rr_gsb,
+                                         e_rr_type::CHANX, flyweight, tasks);
+
+    add_flatten_connection_block_modules(module_manager, device_ctx, in_edges,
+                                         device_annotation, device_rr_gsb,
+                                         e_rr_type::CHANY, flyweight, tasks);
   }
+
+  build_routing_module_bodies(module_manager, decoder_lib, device_ctx,
+                              device_annotation, in_edges, device_rr_gsb,
+                              circuit_lib, sram_orgz_type, sram_model,
+                              group_config_block, tasks, num_threads, verbose);
 }
 
 /********************************************************************
@@ -1345,6 +1609,9 @@ void build_flatten_routing_modules(
  * 1. Connection blocks
  * 2. Switch blocks
  *
+ * All the modules are added first, and then their bodies are built
+ * with the given number of threads
+ *
  * Note: this function SHOULD be called only when
  * the option compact_routing_hierarchy is turned on!!!
  *******************************************************************/
@@ -1355,46 +1622,35 @@ void build_unique_routing_modules(
   const CircuitLibrary& circuit_lib,
   const e_config_protocol_type& sram_orgz_type,
   const CircuitModelId& sram_model, const bool& group_config_block,
-  const bool& verbose) {
+  const size_t& num_threads, const bool& verbose) {
   vtr::ScopedStartFinishTimer timer("Build unique routing modules...");
 
+  std::vector<RoutingModuleTask> tasks;
+
   /* Build unique switch block modules */
   for (size_t isb = 0; isb < device_rr_gsb.get_num_sb_unique_module(); ++isb) {
     const RRGSB& unique_mirror = device_rr_gsb.get_sb_unique_module(isb);
-    build_switch_block_module(
-      module_manager, decoder_lib, device_annotation, device_ctx.grid,
-      device_ctx.rr_graph, in_edges, circuit_lib, sram_orgz_type, sram_model,
-      device_rr_gsb, unique_mirror, group_config_block, verbose);
+    tasks.push_back({add_switch_block_module(module_manager, unique_mirror),
+                     &unique_mirror, e_rr_type::NUM_RR_TYPES});
   }
 
   if (false == module_manager.group_routing()) {
-    /* Build unique X-direction connection block modules */
-    for (size_t icb = 0;
-         icb < device_rr_gsb.get_num_cb_unique_module(e_rr_type::CHANX);
-         ++icb) {
-      const RRGSB& unique_mirror =
-        device_rr_gsb.get_cb_unique_module(e_rr_type::CHANX, icb);
-
-      build_connection_block_module(
-        module_manager, decoder_lib, device_annotation, device_ctx.grid,
-        device_ctx.rr_graph, in_edges, circuit_lib, sram_orgz_type, sram_model,
-        device_rr_gsb, unique_mirror, e_rr_type::CHANX, group_config_block,
-        verbose);
-    }
-
-    /* Build unique Y-direction connection block modules */
-    for (size_t icb = 0;
-         icb < device_rr_gsb.get_num_cb_unique_module(e_rr_type::CHANY);
-         ++icb) {
-      const RRGSB& unique_mirror =
-        device_rr_gsb.get_cb_unique_module(e_rr_type::CHANY, icb);
-
-      build_connection_block_module(
-        module_manager, decoder_lib, device_annotation, device_ctx.grid,
-        device_ctx.rr_graph, in_edges, circuit_lib, sram_orgz_type, sram_model,
-        device_rr_gsb, unique_mirror, e_rr_type::CHANY, group_config_block,
-        verbose);
+    /* Build unique X-direction and Y-direction connection block modules */
+    for (const e_rr_type& cb_type : {e_rr_type::CHANX, e_rr_type::CHANY}) {
+      for (size_t icb = 0;
+           icb < device_rr_gsb.get_num_cb_unique_module(cb_type); ++icb) {
+        const RRGSB& unique_mirror =
+          device_rr_gsb.get_cb_unique_module(cb_type, icb);
+        tasks.push_back(
+          {add_connection_block_module(module_manager, unique_mirror, cb_type),
+           &unique_mirror, cb_type});
+      }
     }
   }
+
+  build_routing_module_bodies(module_manager, decoder_lib, device_ctx,
+                              device_annotation, in_edges, device_rr_gsb,
+                              circuit_lib, sram_orgz_type, sram_model,
+                              group_config_block, tasks, num_threads, verbose);
 }
 } /* end namespace openfpga */
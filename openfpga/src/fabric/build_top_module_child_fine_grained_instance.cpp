@@ -232,6 +232,13 @@ static vtr::Matrix<size_t> add_top_module_switch_block_instances(
         sb_instance_ids[rr_gsb.get_sb_x()][rr_gsb.get_sb_y()],
         generate_switch_block_module_name(
           vtr::Point<size_t>(rr_gsb.get_sb_x(), rr_gsb.get_sb_y())));
+      /* A shared module body is outputted under the alias of the instance */
+      if (module_manager.is_module_alias(sb_module_name)) {
+        module_manager.set_child_instance_module_alias(
+          top_module, sb_module,
+          sb_instance_ids[rr_gsb.get_sb_x()][rr_gsb.get_sb_y()],
+          sb_module_name);
+      }
     }
   }
 
@@ -302,6 +309,13 @@ static vtr::Matrix<size_t> add_top_module_connection_block_instances(
         top_module, cb_module,
         cb_instance_ids[rr_gsb.get_cb_x(cb_type)][rr_gsb.get_cb_y(cb_type)],
         cb_instance_name);
+      /* A shared module body is outputted under the alias of the instance */
+      if (module_manager.is_module_alias(cb_module_name)) {
+        module_manager.set_child_instance_module_alias(
+          top_module, cb_module,
+          cb_instance_ids[rr_gsb.get_cb_x(cb_type)][rr_gsb.get_cb_y(cb_type)],
+          cb_module_name);
+      }
       VTR_LOGV(verbose, "Added %s connnection block '%s' (module '%s')\n",
                cb_type == e_rr_type::CHANX ? "X-" : "Y-",
                cb_instance_name.c_str(), cb_module_name.c_str());
@@ -1539,14 +1539,14 @@ static void add_top_module_nets_cmos_ql_memory_bank_bl_shift_register_bank_bls(
           sr_module_blwl_port, src_port.pins()[0]);
         VTR_ASSERT(ModuleNetId::INVALID() != net);
 
-        for (size_t ichild = 0;
-             ichild < sr_banks
-                        .bl_shift_register_bank_sink_child_ids(config_region,
-                                                               bank, src_port)
-                        .size();
-             ++ichild) {
-          size_t child_id = sr_banks.bl_shift_register_bank_sink_child_ids(
-            config_region, bank, src_port)[ichild];
+        const std::vector<size_t>& sink_child_ids =
+          sr_banks.bl_shift_register_bank_sink_child_ids(config_region, bank,
+                                                         src_port);
+        const std::vector<size_t>& sink_child_pin_ids =
+          sr_banks.bl_shift_register_bank_sink_child_pin_ids(config_region,
+                                                             bank, src_port);
+        for (size_t ichild = 0; ichild < sink_child_ids.size(); ++ichild) {
+          size_t child_id = sink_child_ids[ichild];
           ModuleId child_module = module_manager.region_configurable_children(
             top_module, config_region)[child_id];
           size_t child_instance =
@@ -1560,9 +1560,7 @@ static void add_top_module_nets_cmos_ql_memory_bank_bl_shift_register_bank_bls(
             module_manager.module_port(child_module, child_blwl_port);
 
           /* Add net sink */
-          size_t sink_child_pin_id =
-            sr_banks.bl_shift_register_bank_sink_child_pin_ids(
-              config_region, bank, src_port)[ichild];
+          size_t sink_child_pin_id = sink_child_pin_ids[ichild];
           module_manager.add_module_net_sink(top_module, net, child_module,
                                              child_instance, child_blwl_port,
                                              sink_child_pin_id);
@@ -1632,14 +1630,14 @@ static void add_top_module_nets_cmos_ql_memory_bank_wl_shift_register_bank_wls(
           sr_module_blwl_port, src_port.pins()[0]);
         VTR_ASSERT(ModuleNetId::INVALID() != net);
 
-        for (size_t ichild = 0;
-             ichild < sr_banks
-                        .wl_shift_register_bank_sink_child_ids(config_region,
-                                                               bank, src_port)
-                        .size();
-             ++ichild) {
-          size_t child_id = sr_banks.wl_shift_register_bank_sink_child_ids(
-            config_region, bank, src_port)[ichild];
+        const std::vector<size_t>& sink_child_ids =
+          sr_banks.wl_shift_register_bank_sink_child_ids(config_region, bank,
+                                                         src_port);
+        const std::vector<size_t>& sink_child_pin_ids =
+          sr_banks.wl_shift_register_bank_sink_child_pin_ids(config_region,
+                                                             bank, src_port);
+        for (size_t ichild = 0; ichild < sink_child_ids.size(); ++ichild) {
+          size_t child_id = sink_child_ids[ichild];
           ModuleId child_module = module_manager.region_configurable_children(
             top_module, config_region)[child_id];
           size_t child_instance =
@@ -1653,9 +1651,7 @@ static void add_top_module_nets_cmos_ql_memory_bank_wl_shift_register_bank_wls(
             module_manager.module_port(child_module, child_blwl_port);
 
           /* Add net sink */
-          size_t sink_child_pin_id =
-            sr_banks.wl_shift_register_bank_sink_child_pin_ids(
-              config_region, bank, src_port)[ichild];
+          size_t sink_child_pin_id = sink_child_pin_ids[ichild];
           module_manager.add_module_net_sink(top_module, net, child_module,
                                              child_instance, child_blwl_port,
                                              sink_child_pin_id);
@@ -1,7 +1,9 @@
 /***************************************************************************************
  * Output internal structure of Module Graph hierarchy to file formats
  ***************************************************************************************/
-#include <regex>
+#include <unordered_map>
+#include <unordered_set>
+
 /* Headers from vtrutil library */
 #include "vtr_assert.h"
 #include "vtr_log.h"
@@ -12,35 +14,100 @@
 #include "fabric_hierarchy_writer.h"
 #include "openfpga_digest.h"
 #include "openfpga_naming.h"
+#include "openfpga_wildcard_matcher.h"
 
 /* begin namespace openfpga */
 namespace openfpga {
 
-/** Identify if the module has no child whose name matches the filter */
-static bool module_filter_all_children(const ModuleManager& module_manager,
-                                       const ModuleId& curr_module,
-                                       const ModuleNameMap& module_name_map,
-                                       const std::string& module_name_filter) {
-  for (const ModuleId& child_module :
-       module_manager.child_modules(curr_module)) {
-    /* Filter out the names which do not match the pattern */
-    std::string child_module_name = module_manager.module_name(child_module);
-    if (module_name_map.name_exist(child_module_name)) {
-      child_module_name = module_name_map.name(child_module_name);
+/** Memorize the outcome of module name filtering. The module graph is a DAG
+ * where a module may be instantiated under many parents, so each name is
+ * matched at most once. An instance may be outputted under an alias of its
+ * module, e.g., a routing block sharing the body of another in a flyweight
+ * build, so the names of instances are matched rather than the modules */
+class ModuleNameFilter {
+ public:
+  ModuleNameFilter(const ModuleManager& module_manager,
+                   const ModuleNameMap& module_name_map,
+                   const std::string& pattern)
+    : module_manager_(module_manager),
+      module_name_map_(module_name_map),
+      matcher_(pattern),
+      children_filtered_(module_manager.num_modules(), UNKNOWN) {}
+
+  /** Return a name of a module or of an alias considering renaming */
+  std::string module_name(const std::string& built_in_name) const {
+    if (module_name_map_.name_exist(built_in_name)) {
+      return module_name_map_.name(built_in_name);
     }
-    std::string pattern = module_name_filter;
-    std::regex star_replace("\\*");
-    std::regex questionmark_replace("\\?");
-    std::string wildcard_pattern =
-      std::regex_replace(std::regex_replace(pattern, star_replace, ".*"),
-                         questionmark_replace, ".");
-    std::regex wildcard_regex(wildcard_pattern);
-    if (std::regex_match(child_module_name, wildcard_regex)) {
-      return false;
+    return built_in_name;
+  }
+
+  /** Return the name of a module considering renaming */
+  std::string module_name(const ModuleId& module) const {
+    return module_name(module_manager_.module_name(module));
+  }
+
+  /** Return the names under which the instances of a child module are
+   * outputted in a parent module, considering aliases and renaming. Each name
+   * is listed once, in the order of the instances */
+  std::vector<std::string> instance_module_names(
+    const ModuleId& parent_module, const ModuleId& child_module) const {
+    std::vector<std::string> names;
+    std::unordered_set<std::string> name_set;
+    for (const size_t& instance :
+         module_manager_.child_module_instances(parent_module, child_module)) {
+      std::string name = module_name(module_manager_.instance_module_name(
+        parent_module, child_module, instance));
+      if (name_set.insert(name).second) {
+        names.push_back(name);
+      }
     }
+    return names;
   }
-  return true;
-}
+
+  /** Identify if a name matches the filter */
+  bool name_match(const std::string& name) {
+    auto result = name_matches_.find(name);
+    if (result == name_matches_.end()) {
+      result = name_matches_.emplace(name, matcher_.match(name)).first;
+    }
+    return result->second;
+  }
+
+  /** Identify if the module has no child instance whose name matches the
+   * filter */
+  bool all_children_filtered(const ModuleId& curr_module) {
+    char& status = children_filtered_[size_t(curr_module)];
+    if (UNKNOWN == status) {
+      status = YES;
+      for (const ModuleId& child_module :
+           module_manager_.child_modules(curr_module)) {
+        for (const std::string& child_name :
+             instance_module_names(curr_module, child_module)) {
+          if (name_match(child_name)) {
+            status = NO;
+            break;
+          }
+        }
+        if (NO == status) {
+          break;
+        }
+      }
+    }
+    return YES == status;
+  }
+
+ private:
+  static constexpr char UNKNOWN = -1;
+  static constexpr char NO = 0;
+  static constexpr char YES = 1;
+
+  const ModuleManager& module_manager_;
+  const ModuleNameMap& module_name_map_;
+  WildCardMatcher matcher_;
+  std::unordered_map<std::string, bool> name_matches_;
+  std::vector<char> children_filtered_;
+};
 
 /***************************************************************************************
  * Recursively output child module of the parent_module to a text file
@@ -51,8 +118,8 @@ static bool module_filter_all_children(const ModuleManager& module_manager,
 static int rec_output_module_hierarchy_to_text_file(
   std::fstream& fp, const size_t& hie_depth_to_stop,
   const size_t& current_hie_depth, const ModuleManager& module_manager,
-  const ModuleId& parent_module, const ModuleNameMap& module_name_map,
-  const std::string& module_name_filter, const bool& verbose) {
+  const ModuleId& parent_module, ModuleNameFilter& module_filter,
+  const bool& verbose) {
   /* Stop if hierarchy depth is beyond the stop line */
   if (hie_depth_to_stop < current_hie_depth) {
     return CMD_EXEC_SUCCESS;
@@ -67,8 +134,7 @@ static int rec_output_module_hierarchy_to_text_file(
   bool use_list = true;
   for (const ModuleId& child_module :
        module_manager.child_modules(parent_module)) {
-    if (!module_filter_all_children(module_manager, child_module,
-                                    module_name_map, module_name_filter)) {
+    if (!module_filter.all_children_filtered(child_module)) {
       use_list = false;
       break;
     }
@@ -77,10 +143,7 @@ static int rec_output_module_hierarchy_to_text_file(
   VTR_LOGV(verbose, "Current depth: %lu, Target depth: %lu\n",
            current_hie_depth, hie_depth_to_stop);
   */
-  std::string parent_module_name = module_manager.module_name(parent_module);
-  if (module_name_map.name_exist(parent_module_name)) {
-    parent_module_name = module_name_map.name(parent_module_name);
-  }
+  std::string parent_module_name = module_filter.module_name(parent_module);
   VTR_LOGV(use_list && verbose,
            "Use list as module '%s' contains only leaf nodes\n",
            parent_module_name.c_str());
@@ -89,46 +152,37 @@ static int rec_output_module_hierarchy_to_text_file(
   for (const ModuleId& child_module :
        module_manager.child_modules(parent_module)) {
     if (true != module_manager.valid_module_id(child_module)) {
-      VTR_LOGV_ERROR(
-        verbose,
-        "Unable to find the child module '%s' under its parent '%s'!\n",
-        module_manager.module_name(child_module).c_str(),
-        module_manager.module_name(parent_module).c_str());
+      VTR_LOGV_ERROR(verbose,
+                     "Unable to find a child module under its parent '%s'!\n",
+                     parent_module_name.c_str());
       return CMD_EXEC_FATAL_ERROR;
     }
 
-    /* Filter out the names which do not match the pattern */
-    std::string child_module_name = module_manager.module_name(child_module);
-    if (module_name_map.name_exist(child_module_name)) {
-      child_module_name = module_name_map.name(child_module_name);
-    }
-    std::string pattern = module_name_filter;
-    std::regex star_replace("\\*");
-    std::regex questionmark_replace("\\?");
-    std::string wildcard_pattern =
-      std::regex_replace(std::regex_replace(pattern, star_replace, ".*"),
-                         questionmark_replace, ".");
-    std::regex wildcard_regex(wildcard_pattern);
-    if (!std::regex_match(child_module_name, wildcard_regex)) {
-      continue;
-    }
+    /* Output the child under each name used by its instances, e.g., the
+     * aliases of a shared routing module */
+    for (const std::string& child_module_name :
+         module_filter.instance_module_names(parent_module, child_module)) {
+      /* Filter out the names which do not match the pattern */
+      if (!module_filter.name_match(child_module_name)) {
+        continue;
+      }
 
-    if (false == write_space_to_file(fp, current_hie_depth * 2)) {
-      return CMD_EXEC_FATAL_ERROR;
-    }
-    if (hie_depth_to_stop == current_hie_depth || use_list) {
-      fp << "- " << child_module_name.c_str() << "\n";
-    } else {
-      fp << child_module_name.c_str() << ":\n";
-    }
-    /* Go to next level */
-    int status = rec_output_module_hierarchy_to_text_file(
-      fp, hie_depth_to_stop,
-      current_hie_depth + 1, /* Increment the depth for the next level */
-      module_manager, child_module, module_name_map, module_name_filter,
-      verbose);
-    if (status != CMD_EXEC_SUCCESS) {
-      return status;
+      if (false == write_space_to_file(fp, current_hie_depth * 2)) {
+        return CMD_EXEC_FATAL_ERROR;
+      }
+      if (hie_depth_to_stop == current_hie_depth || use_list) {
+        fp << "- " << child_module_name.c_str() << "\n";
+      } else {
+        fp << child_module_name.c_str() << ":\n";
+      }
+      /* Go to next level */
+      int status = rec_output_module_hierarchy_to_text_file(
+        fp, hie_depth_to_stop,
+        current_hie_depth + 1, /* Increment the depth for the next level */
+        module_manager, child_module, module_filter, verbose);
+      if (status != CMD_EXEC_SUCCESS) {
+        return status;
+      }
     }
   }
 
@@ -176,46 +230,49 @@ int write_fabric_hierarchy_to_text_file(
   check_file_stream(fname.c_str(), fp);
 
   size_t cnt = 0;
+  /* Compile the patterns only once and share them among all the modules */
+  WildCardMatcher root_module_matcher(root_module_names);
+  ModuleNameFilter module_filter(module_manager, module_name_map,
+                                 module_name_filter);
   /* Use regular expression to capture the module whose name matches the pattern
    */
   for (ModuleId curr_module : module_manager.modules()) {
-    std::string curr_module_name = module_manager.module_name(curr_module);
-    if (module_name_map.name_exist(curr_module_name)) {
-      curr_module_name = module_name_map.name(curr_module_name);
-    }
-    std::string pattern = root_module_names;
-    std::regex star_replace("\\*");
-    std::regex questionmark_replace("\\?");
-    std::string wildcard_pattern =
-      std::regex_replace(std::regex_replace(pattern, star_replace, ".*"),
-                         questionmark_replace, ".");
-    std::regex wildcard_regex(wildcard_pattern);
-    if (!std::regex_match(curr_module_name, wildcard_regex)) {
-      continue;
+    /* A module may also be selected by one of its aliases, which shares the
+     * same hierarchy */
+    std::vector<std::string> curr_module_names(
+      1, module_manager.module_name(curr_module));
+    for (const std::string& alias :
+         module_manager.module_aliases(curr_module)) {
+      curr_module_names.push_back(alias);
     }
-    /* Filter out module without children if required */
-    if (exclude_empty_modules &&
-        module_filter_all_children(module_manager, curr_module, module_name_map,
-                                   module_name_filter)) {
-      continue;
-    }
-    VTR_LOGV(verbose, "Select module '%s' as root\n", curr_module_name.c_str());
-    /* Record current depth of module: top module is the root with 0 depth */
-    size_t hie_depth = 0;
-
-    fp << curr_module_name << ":"
-       << "\n";
-
-    /* Visit child module recursively and output the hierarchy */
-    int err_code = rec_output_module_hierarchy_to_text_file(
-      fp, hie_depth_to_stop, hie_depth + 1, /* Start with level 1 */
-      module_manager, curr_module, module_name_map, module_name_filter,
-      verbose);
-    /* Catch error code and exit if required */
-    if (err_code == CMD_EXEC_FATAL_ERROR) {
-      return err_code;
+    for (const std::string& built_in_name : curr_module_names) {
+      std::string curr_module_name = module_filter.module_name(built_in_name);
+      if (!root_module_matcher.match(curr_module_name)) {
+        continue;
+      }
+      /* Filter out module without children if required */
+      if (exclude_empty_modules &&
+          module_filter.all_children_filtered(curr_module)) {
+        continue;
+      }
+      VTR_LOGV(verbose, "Select module '%s' as root\n",
+               curr_module_name.c_str());
+      /* Record current depth of module: top module is the root with 0 depth */
+      size_t hie_depth = 0;
+
+      fp << curr_module_name << ":"
+         << "\n";
+
+      /* Visit child module recursively and output the hierarchy */
+      int err_code = rec_output_module_hierarchy_to_text_file(
+        fp, hie_depth_to_stop, hie_depth + 1, /* Start with level 1 */
+        module_manager, curr_module, module_filter, verbose);
+      /* Catch error code and exit if required */
+      if (err_code == CMD_EXEC_FATAL_ERROR) {
+        return err_code;
+      }
+      cnt++;
     }
-    cnt++;
   }
 
   if (cnt == 0) {
@@ -12,8 +12,12 @@
 
 /* Headers from archopenfpga library */
 #include "fabric_key_writer.h"
+#include "fabric_key_xml_constants.h"
 #include "memory_utils.h"
 #include "openfpga_naming.h"
+#include "openfpga_reserved_words.h"
+#include "read_bin_fabric_key.h"
+#include "write_bin_fabric_key.h"
 #include "write_xml_fabric_key.h"
 
 /* begin namespace openfpga */
@@ -55,8 +59,9 @@ static int add_module_keys_to_fabric_key(const ModuleManager& module_manager,
       curr_module, ModuleManager::e_config_child_type::PHYSICAL)[ichild];
 
     FabricSubKeyId sub_key = fabric_key.create_module_key(key_module_id);
-    fabric_key.set_sub_key_name(sub_key,
-                                module_manager.module_name(child_module));
+    fabric_key.set_sub_key_name(
+      sub_key, module_manager.instance_module_name(curr_module, child_module,
+                                                   child_instance));
     fabric_key.set_sub_key_value(sub_key, child_instance);
 
     if (false ==
@@ -71,34 +76,11 @@ static int add_module_keys_to_fabric_key(const ModuleManager& module_manager,
 }
 
 /***************************************************************************************
- * Write the fabric key of top module to an XML file
- * We will use the writer API in libfabrickey
- *
- * Return 0 if successful
- * Return 1 if there are more serious bugs in the architecture
- * Return 2 if fail when creating files
+ * Find the module whose configurable children are the keys of the fabric:
+ * the core module if there is one, otherwise the top module
  ***************************************************************************************/
-int write_fabric_key_to_xml_file(
-  const ModuleManager& module_manager, const std::string& fname,
-  const ConfigProtocol& config_protocol,
-  const MemoryBankShiftRegisterBanks& blwl_sr_banks,
-  const bool& include_module_keys, const bool& verbose) {
-  int err_code = CMD_EXEC_SUCCESS;
-  std::string timer_message =
-    std::string("Write fabric key to XML file '") + fname + std::string("'");
-
-  std::string dir_path = format_dir_path(find_path_dir_name(fname));
-
-  /* Create directories */
-  create_directory(dir_path, true, verbose);
-
-  /* Start time count */
-  vtr::ScopedStartFinishTimer timer(timer_message);
-
-  /* Use default name if user does not provide one */
-  VTR_ASSERT(true != fname.empty());
-
-  /* Find top-level module */
+static ModuleId find_fabric_key_top_module(const ModuleManager& module_manager,
+                                           const bool& verbose) {
   std::string top_module_name = generate_fpga_top_module_name();
   ModuleId top_module = module_manager.find_module(top_module_name);
   std::string core_module_name = generate_fpga_core_module_name();
@@ -108,15 +90,29 @@ int write_fabric_key_to_xml_file(
     VTR_LOGV_ERROR(
       verbose, "Unable to find the top-level/core-level module '%s' or '%s'!\n",
       top_module_name.c_str(), core_module_name.c_str());
-    return CMD_EXEC_FATAL_ERROR;
+    return ModuleId::INVALID();
   }
   if (module_manager.valid_module_id(top_module) &&
       module_manager.valid_module_id(core_module)) {
     top_module = core_module;
   }
+  return top_module;
+}
+
+/***************************************************************************************
+ * Build a fabric key database from the configurable children of the top
+ * module and, optionally, of the other modules
+ ***************************************************************************************/
+static int build_fabric_key_from_module_graph(
+  const ModuleManager& module_manager, const ModuleId& top_module,
+  const ConfigProtocol& config_protocol,
+  const MemoryBankShiftRegisterBanks& blwl_sr_banks,
+  const bool& include_module_keys, const bool& verbose,
+  FabricKey& fabric_key) {
+  int err_code = CMD_EXEC_SUCCESS;
+  std::string top_module_name = module_manager.module_name(top_module);
 
   /* Build a fabric key database by visiting all the configurable children */
-  FabricKey fabric_key;
   size_t num_keys =
     module_manager
       .configurable_children(top_module,
@@ -146,9 +142,15 @@ int write_fabric_key_to_xml_file(
 
     /* Each configuration protocol has some child which should not be in the
      * list. They are typically decoders */
-    size_t curr_region_num_config_child =
-      module_manager.region_configurable_children(top_module, config_region)
-        .size();
+    std::vector<ModuleId> region_children =
+      module_manager.region_configurable_children(top_module, config_region);
+    std::vector<size_t> region_child_instances =
+      module_manager.region_configurable_child_instances(top_module,
+                                                         config_region);
+    std::vector<vtr::Point<int>> region_child_coords =
+      module_manager.region_configurable_child_coordinates(top_module,
+                                                           config_region);
+    size_t curr_region_num_config_child = region_children.size();
     size_t num_child_to_skip =
       estimate_num_configurable_children_to_skip_by_config_protocol(
         config_protocol, curr_region_num_config_child);
@@ -157,17 +159,14 @@ int write_fabric_key_to_xml_file(
     fabric_key.reserve_region_keys(fabric_region, curr_region_num_config_child);
 
     for (size_t ichild = 0; ichild < curr_region_num_config_child; ++ichild) {
-      ModuleId child_module = module_manager.region_configurable_children(
-        top_module, config_region)[ichild];
-      size_t child_instance =
-        module_manager.region_configurable_child_instances(
-          top_module, config_region)[ichild];
-      vtr::Point<int> child_coord =
-        module_manager.region_configurable_child_coordinates(
-          top_module, config_region)[ichild];
+      ModuleId child_module = region_children[ichild];
+      size_t child_instance = region_child_instances[ichild];
+      vtr::Point<int> child_coord = region_child_coords[ichild];
 
       FabricKeyId key = fabric_key.create_key();
-      fabric_key.set_key_name(key, module_manager.module_name(child_module));
+      fabric_key.set_key_name(
+        key, module_manager.instance_module_name(top_module, child_module,
+                                                 child_instance));
       fabric_key.set_key_value(key, child_instance);
 
       if (false ==
@@ -242,10 +241,214 @@ int write_fabric_key_to_xml_file(
     }
   }
 
-  /* Call the XML writer for fabric key */
-  err_code = write_xml_fabric_key(fname.c_str(), fabric_key);
-
   return err_code;
 }
 
+/***************************************************************************************
+ * Write the module-level keys of a module to an XML file on the fly
+ ***************************************************************************************/
+static void write_xml_module_keys_from_module_graph(
+  std::fstream& fp, const ModuleManager& module_manager,
+  const ModuleId& curr_module) {
+  /* Bypass top-level module */
+  std::string module_name = module_manager.module_name(curr_module);
+  if (module_name == generate_fpga_top_module_name() ||
+      module_name == generate_fpga_core_module_name()) {
+    return;
+  }
+  std::vector<ModuleId> config_children = module_manager.configurable_children(
+      curr_module, ModuleManager::e_config_child_type::PHYSICAL);
+  /* Bypass modules which does not have any configurable children */
+  if (config_children.empty()) {
+    return;
+  }
+  std::vector<size_t> config_child_instances =
+    module_manager.configurable_child_instances(
+      curr_module, ModuleManager::e_config_child_type::PHYSICAL);
+
+  write_xml_fabric_key_module_begin(fp, module_name, 1);
+  for (size_t ichild = 0; ichild < config_children.size(); ++ichild) {
+    ModuleId child_module = config_children[ichild];
+    size_t child_instance = config_child_instances[ichild];
+    write_xml_fabric_key_key(
+      fp, ichild,
+      module_manager.instance_module_name(curr_module, child_module,
+                                          child_instance),
+      child_instance,
+      module_manager.instance_name(curr_module, child_module, child_instance),
+      vtr::Point<int>(-1, -1), 2);
+  }
+  write_xml_fabric_key_module_end(fp, 1);
+}
+
+/***************************************************************************************
+ * Write the fabric key of top module to an XML file on the fly
+ * Keys are output directly from the configurable children of the module
+ * graph, without building a fabric key database, which is much cheaper for
+ * fabrics with millions of keys. The output is the same as the XML writer
+ * of libfabrickey
+ ***************************************************************************************/
+static int write_xml_fabric_key_from_module_graph(
+  const ModuleManager& module_manager, const ModuleId& top_module,
+  const std::string& fname, const ConfigProtocol& config_protocol,
+  const MemoryBankShiftRegisterBanks& blwl_sr_banks,
+  const bool& include_module_keys, const bool& verbose) {
+  /* Create a file handler */
+  std::fstream fp;
+  /* Open the file stream */
+  fp.open(fname, std::fstream::out | std::fstream::trunc);
+
+  /* Validate the file stream */
+  check_file_stream(fname.c_str(), fp);
+
+  /* Write the root node */
+  fp << "<" << XML_FABRIC_KEY_ROOT_NAME << ">"
+     << "\n";
+
+  write_xml_fabric_key_module_begin(fp, std::string(FPGA_TOP_MODULE_NAME), 1);
+
+  /* Keys are indexed across regions, in the same way as a fabric key
+   * database */
+  size_t num_keys = 0;
+  size_t num_regions = 0;
+  for (const ConfigRegionId& config_region :
+       module_manager.regions(top_module)) {
+    write_xml_fabric_key_region_begin(fp, num_regions, 2);
+
+    /* Skip invalid region, some architecture may not have BL/WL banks */
+    if (0 < blwl_sr_banks.regions().size()) {
+      std::vector<std::vector<BasicPort>> bl_bank_data_ports;
+      for (const FabricBitLineBankId& bank :
+           blwl_sr_banks.bl_banks(config_region)) {
+        bl_bank_data_ports.push_back(
+          blwl_sr_banks.bl_bank_data_ports(config_region, bank));
+      }
+      write_xml_fabric_key_shift_register_banks(
+        fp, XML_FABRIC_KEY_BL_SHIFT_REGISTER_BANKS_NODE_NAME,
+        bl_bank_data_ports, 3);
+
+      std::vector<std::vector<BasicPort>> wl_bank_data_ports;
+      for (const FabricWordLineBankId& bank :
+           blwl_sr_banks.wl_banks(config_region)) {
+        wl_bank_data_ports.push_back(
+          blwl_sr_banks.wl_bank_data_ports(config_region, bank));
+      }
+      write_xml_fabric_key_shift_register_banks(
+        fp, XML_FABRIC_KEY_WL_SHIFT_REGISTER_BANKS_NODE_NAME,
+        wl_bank_data_ports, 3);
+    }
+
+    /* Each configuration protocol has some child which should not be in the
+     * list. They are typically decoders */
+    std::vector<ModuleId> region_children =
+      module_manager.region_configurable_children(top_module, config_region);
+    std::vector<size_t> region_child_instances =
+      module_manager.region_configurable_child_instances(top_module,
+                                                         config_region);
+    std::vector<vtr::Point<int>> region_child_coords =
+      module_manager.region_configurable_child_coordinates(top_module,
+                                                           config_region);
+    size_t curr_region_num_config_child =
+      region_children.size() -
+      estimate_num_configurable_children_to_skip_by_config_protocol(
+        config_protocol, region_children.size());
+
+    for (size_t ichild = 0; ichild < curr_region_num_config_child; ++ichild) {
+      ModuleId child_module = region_children[ichild];
+      size_t child_instance = region_child_instances[ichild];
+      int status = write_xml_fabric_key_key(
+        fp, num_keys,
+        module_manager.instance_module_name(top_module, child_module,
+                                            child_instance),
+        child_instance,
+        module_manager.instance_name(top_module, child_module, child_instance),
+        region_child_coords[ichild], 3);
+      if (0 != status) {
+        return CMD_EXEC_FATAL_ERROR;
+      }
+      ++num_keys;
+    }
+
+    write_xml_fabric_key_region_end(fp, 2);
+    ++num_regions;
+  }
+
+  write_xml_fabric_key_module_end(fp, 1);
+
+  VTR_LOGV(verbose, "Wrote %lu regions and %lu keys for the top module %s.\n",
+           num_regions, num_keys,
+           module_manager.module_name(top_module).c_str());
+
+  /* Output module subkeys if specified */
+  if (include_module_keys) {
+    for (ModuleId submodule : module_manager.modules()) {
+      write_xml_module_keys_from_module_graph(fp, module_manager, submodule);
+    }
+  }
+
+  /* Finish writing the root node */
+  fp << "</" << XML_FABRIC_KEY_ROOT_NAME << ">"
+     << "\n";
+
+  if (false == valid_file_stream(fp)) {
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
+  /* Close the file stream */
+  fp.close();
+
+  return CMD_EXEC_SUCCESS;
+}
+
+/***************************************************************************************
+ * Write the fabric key of top module to a file
+ * The format is binary if the file extension is '.bin', otherwise XML
+ *
+ * Return 0 if successful
+ * Return 1 if there are more serious bugs in the architecture
+ * Return 2 if fail when creating files
+ ***************************************************************************************/
+int write_fabric_key_to_file(const ModuleManager& module_manager,
+                             const std::string& fname,
+                             const ConfigProtocol& config_protocol,
+                             const MemoryBankShiftRegisterBanks& blwl_sr_banks,
+                             const bool& include_module_keys,
+                             const bool& verbose) {
+  std::string timer_message =
+    std::string("Write fabric key to file '") + fname + std::string("'");
+
+  std::string dir_path = format_dir_path(find_path_dir_name(fname));
+
+  /* Create directories */
+  create_directory(dir_path, true, verbose);
+
+  /* Start time count */
+  vtr::ScopedStartFinishTimer timer(timer_message);
+
+  /* Use default name if user does not provide one */
+  VTR_ASSERT(true != fname.empty());
+
+  ModuleId top_module = find_fabric_key_top_module(module_manager, verbose);
+  if (!module_manager.valid_module_id(top_module)) {
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
+  if (!is_bin_fabric_key_file(fname)) {
+    return write_xml_fabric_key_from_module_graph(
+      module_manager, top_module, fname, config_protocol, blwl_sr_banks,
+      include_module_keys, verbose);
+  }
+
+  /* The binary writer requires a fabric key database */
+  FabricKey fabric_key;
+  int err_code = build_fabric_key_from_module_graph(
+    module_manager, top_module, config_protocol, blwl_sr_banks,
+    include_module_keys, verbose, fabric_key);
+  if (CMD_EXEC_SUCCESS != err_code) {
+    return err_code;
+  }
+
+  return write_bin_fabric_key(fname.c_str(), fabric_key);
+}
+
 } /* end namespace openfpga */
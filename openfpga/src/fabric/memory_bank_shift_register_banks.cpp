@@ -8,6 +8,9 @@
 /* begin namespace openfpga */
 namespace openfpga {
 
+/* Returned when a data pin of a shift register bank drives no child */
+static const std::vector<size_t> EMPTY_SINK_LIST;
+
 ModuleManager::region_range MemoryBankShiftRegisterBanks::regions() const {
   return vtr::make_range(config_region_ids_.begin(), config_region_ids_.end());
 }
@@ -123,54 +126,78 @@ std::vector<BasicPort> MemoryBankShiftRegisterBanks::wl_bank_data_ports(
 FabricBitLineBankId
 MemoryBankShiftRegisterBanks::find_bl_shift_register_bank_id(
   const ConfigRegionId& region, const BasicPort& bl_port) const {
+  if ((std::string(MEMORY_BL_PORT_NAME) != bl_port.get_name()) ||
+      (1 != bl_port.get_width())) {
+    return FabricBitLineBankId::INVALID();
+  }
+  return find_bl_shift_register_bank_id(region, bl_port.get_lsb());
+}
+
+BasicPort MemoryBankShiftRegisterBanks::find_bl_shift_register_bank_data_port(
+  const ConfigRegionId& region, const BasicPort& bl_port) const {
+  if ((std::string(MEMORY_BL_PORT_NAME) != bl_port.get_name()) ||
+      (1 != bl_port.get_width())) {
+    return BasicPort();
+  }
+  size_t sr_pin =
+    find_bl_shift_register_bank_data_pin(region, bl_port.get_lsb());
+  if (size_t(-1) == sr_pin) {
+    return BasicPort();
+  }
+  return BasicPort(std::string(MEMORY_BL_PORT_NAME), sr_pin, sr_pin);
+}
+
+FabricBitLineBankId
+MemoryBankShiftRegisterBanks::find_bl_shift_register_bank_id(
+  const ConfigRegionId& region, const size_t& bl_pin) const {
   if (is_bl_bank_dirty_) {
     build_bl_port_fast_lookup();
   }
 
   VTR_ASSERT(valid_region_id(region));
-  const auto& result = bl_ports_to_sr_bank_ids_[region].find(bl_port);
-  if (result == bl_ports_to_sr_bank_ids_[region].end()) {
+  if (bl_pin >= bl_pins_to_sr_bank_ids_[region].size()) {
     return FabricBitLineBankId::INVALID();
   }
-  return result->second;
+  return bl_pins_to_sr_bank_ids_[region][bl_pin];
 }
 
-BasicPort MemoryBankShiftRegisterBanks::find_bl_shift_register_bank_data_port(
-  const ConfigRegionId& region, const BasicPort& bl_port) const {
+size_t MemoryBankShiftRegisterBanks::find_bl_shift_register_bank_data_pin(
+  const ConfigRegionId& region, const size_t& bl_pin) const {
   if (is_bl_bank_dirty_) {
     build_bl_port_fast_lookup();
   }
 
   VTR_ASSERT(valid_region_id(region));
-  const auto& result = bl_ports_to_sr_bank_ports_[region].find(bl_port);
-  if (result == bl_ports_to_sr_bank_ports_[region].end()) {
-    return BasicPort();
+  if (bl_pin >= bl_pins_to_sr_bank_pins_[region].size()) {
+    return size_t(-1);
   }
-  return result->second;
+  return bl_pins_to_sr_bank_pins_[region][bl_pin];
 }
 
-std::vector<size_t>
+const std::vector<size_t>&
 MemoryBankShiftRegisterBanks::bl_shift_register_bank_sink_child_ids(
   const ConfigRegionId& region_id, const FabricBitLineBankId& bank_id,
   const BasicPort& src_port) const {
   VTR_ASSERT(valid_bl_bank_id(region_id, bank_id));
-  auto result = bl_bank_sink_child_ids_[region_id][bank_id].find(src_port);
-  if (result == bl_bank_sink_child_ids_[region_id][bank_id].end()) {
-    return std::vector<size_t>(); /* Not found, return an empty list */
+  VTR_ASSERT(1 == src_port.get_width());
+  const auto& sinks = bl_bank_sink_child_ids_[region_id][bank_id];
+  if (src_port.get_lsb() >= sinks.size()) {
+    return EMPTY_SINK_LIST; /* Not found, return an empty list */
   }
-  return result->second;
+  return sinks[src_port.get_lsb()];
 }
 
-std::vector<size_t>
+const std::vector<size_t>&
 MemoryBankShiftRegisterBanks::bl_shift_register_bank_sink_child_pin_ids(
   const ConfigRegionId& region_id, const FabricBitLineBankId& bank_id,
   const BasicPort& src_port) const {
   VTR_ASSERT(valid_bl_bank_id(region_id, bank_id));
-  auto result = bl_bank_sink_child_pin_ids_[region_id][bank_id].find(src_port);
-  if (result == bl_bank_sink_child_pin_ids_[region_id][bank_id].end()) {
-    return std::vector<size_t>(); /* Not found, return an empty list */
+  VTR_ASSERT(1 == src_port.get_width());
+  const auto& sinks = bl_bank_sink_child_pin_ids_[region_id][bank_id];
+  if (src_port.get_lsb() >= sinks.size()) {
+    return EMPTY_SINK_LIST; /* Not found, return an empty list */
   }
-  return result->second;
+  return sinks[src_port.get_lsb()];
 }
 
 std::vector<BasicPort>
@@ -206,30 +233,52 @@ size_t MemoryBankShiftRegisterBanks::bl_shift_register_bank_instance(
 FabricWordLineBankId
 MemoryBankShiftRegisterBanks::find_wl_shift_register_bank_id(
   const ConfigRegionId& region, const BasicPort& wl_port) const {
+  if ((std::string(MEMORY_WL_PORT_NAME) != wl_port.get_name()) ||
+      (1 != wl_port.get_width())) {
+    return FabricWordLineBankId::INVALID();
+  }
+  return find_wl_shift_register_bank_id(region, wl_port.get_lsb());
+}
+
+BasicPort MemoryBankShiftRegisterBanks::find_wl_shift_register_bank_data_port(
+  const ConfigRegionId& region, const BasicPort& wl_port) const {
+  if ((std::string(MEMORY_WL_PORT_NAME) != wl_port.get_name()) ||
+      (1 != wl_port.get_width())) {
+    return BasicPort();
+  }
+  size_t sr_pin =
+    find_wl_shift_register_bank_data_pin(region, wl_port.get_lsb());
+  if (size_t(-1) == sr_pin) {
+    return BasicPort();
+  }
+  return BasicPort(std::string(MEMORY_WL_PORT_NAME), sr_pin, sr_pin);
+}
+
+FabricWordLineBankId
+MemoryBankShiftRegisterBanks::find_wl_shift_register_bank_id(
+  const ConfigRegionId& region, const size_t& wl_pin) const {
   if (is_wl_bank_dirty_) {
     build_wl_port_fast_lookup();
   }
 
   VTR_ASSERT(valid_region_id(region));
-  const auto& result = wl_ports_to_sr_bank_ids_[region].find(wl_port);
-  if (result == wl_ports_to_sr_bank_ids_[region].end()) {
+  if (wl_pin >= wl_pins_to_sr_bank_ids_[region].size()) {
     return FabricWordLineBankId::INVALID();
   }
-  return result->second;
+  return wl_pins_to_sr_bank_ids_[region][wl_pin];
 }
 
-BasicPort MemoryBankShiftRegisterBanks::find_wl_shift_register_bank_data_port(
-  const ConfigRegionId& region, const BasicPort& wl_port) const {
+size_t MemoryBankShiftRegisterBanks::find_wl_shift_register_bank_data_pin(
+  const ConfigRegionId& region, const size_t& wl_pin) const {
   if (is_wl_bank_dirty_) {
     build_wl_port_fast_lookup();
   }
 
   VTR_ASSERT(valid_region_id(region));
-  const auto& result = wl_ports_to_sr_bank_ports_[region].find(wl_port);
-  if (result == wl_ports_to_sr_bank_ports_[region].end()) {
-    return BasicPort();
+  if (wl_pin >= wl_pins_to_sr_bank_pins_[region].size()) {
+    return size_t(-1);
   }
-  return result->second;
+  return wl_pins_to_sr_bank_pins_[region][wl_pin];
 }
 
 void MemoryBankShiftRegisterBanks::resize_regions(const size_t& num_regions) {
@@ -285,8 +334,14 @@ void MemoryBankShiftRegisterBanks::add_bl_shift_register_bank_sink_node(
   const BasicPort& src_port, const size_t& sink_child_id,
   const size_t& sink_child_pin_id) {
   VTR_ASSERT(valid_bl_bank_id(region, bank));
-  bl_bank_sink_child_ids_[region][bank][src_port].push_back(sink_child_id);
-  bl_bank_sink_child_pin_ids_[region][bank][src_port].push_back(
+  VTR_ASSERT(1 == src_port.get_width());
+  size_t src_pin = src_port.get_lsb();
+  if (src_pin >= bl_bank_sink_child_ids_[region][bank].size()) {
+    bl_bank_sink_child_ids_[region][bank].resize(src_pin + 1);
+    bl_bank_sink_child_pin_ids_[region][bank].resize(src_pin + 1);
+  }
+  bl_bank_sink_child_ids_[region][bank][src_pin].push_back(sink_child_id);
+  bl_bank_sink_child_pin_ids_[region][bank][src_pin].push_back(
     sink_child_pin_id);
 }
 
@@ -295,8 +350,14 @@ void MemoryBankShiftRegisterBanks::add_wl_shift_register_bank_sink_node(
   const BasicPort& src_port, const size_t& sink_child_id,
   const size_t& sink_child_pin_id) {
   VTR_ASSERT(valid_wl_bank_id(region, bank));
-  wl_bank_sink_child_ids_[region][bank][src_port].push_back(sink_child_id);
-  wl_bank_sink_child_pin_ids_[region][bank][src_port].push_back(
+  VTR_ASSERT(1 == src_port.get_width());
+  size_t src_pin = src_port.get_lsb();
+  if (src_pin >= wl_bank_sink_child_ids_[region][bank].size()) {
+    wl_bank_sink_child_ids_[region][bank].resize(src_pin + 1);
+    wl_bank_sink_child_pin_ids_[region][bank].resize(src_pin + 1);
+  }
+  wl_bank_sink_child_ids_[region][bank][src_pin].push_back(sink_child_id);
+  wl_bank_sink_child_pin_ids_[region][bank][src_pin].push_back(
     sink_child_pin_id);
 }
 
@@ -412,16 +473,17 @@ void MemoryBankShiftRegisterBanks::add_data_port_to_wl_shift_register_bank(
   is_wl_bank_dirty_ = true;
 }
 
-std::vector<size_t>
+const std::vector<size_t>&
 MemoryBankShiftRegisterBanks::wl_shift_register_bank_sink_child_ids(
   const ConfigRegionId& region_id, const FabricWordLineBankId& bank_id,
   const BasicPort& src_port) const {
   VTR_ASSERT(valid_wl_bank_id(region_id, bank_id));
-  auto result = wl_bank_sink_child_ids_[region_id][bank_id].find(src_port);
-  if (result == wl_bank_sink_child_ids_[region_id][bank_id].end()) {
-    return std::vector<size_t>(); /* Not found, return an empty list */
+  VTR_ASSERT(1 == src_port.get_width());
+  const auto& sinks = wl_bank_sink_child_ids_[region_id][bank_id];
+  if (src_port.get_lsb() >= sinks.size()) {
+    return EMPTY_SINK_LIST; /* Not found, return an empty list */
   }
-  return result->second;
+  return sinks[src_port.get_lsb()];
 }
 
 ModuleId MemoryBankShiftRegisterBanks::wl_shift_register_bank_module(
@@ -436,16 +498,17 @@ size_t MemoryBankShiftRegisterBanks::wl_shift_register_bank_instance(
   return wl_bank_instances_[region_id][bank_id];
 }
 
-std::vector<size_t>
+const std::vector<size_t>&
 MemoryBankShiftRegisterBanks::wl_shift_register_bank_sink_child_pin_ids(
   const ConfigRegionId& region_id, const FabricWordLineBankId& bank_id,
   const BasicPort& src_port) const {
   VTR_ASSERT(valid_wl_bank_id(region_id, bank_id));
-  auto result = wl_bank_sink_child_pin_ids_[region_id][bank_id].find(src_port);
-  if (result == wl_bank_sink_child_pin_ids_[region_id][bank_id].end()) {
-    return std::vector<size_t>(); /* Not found, return an empty list */
+  VTR_ASSERT(1 == src_port.get_width());
+  const auto& sinks = wl_bank_sink_child_pin_ids_[region_id][bank_id];
+  if (src_port.get_lsb() >= sinks.size()) {
+    return EMPTY_SINK_LIST; /* Not found, return an empty list */
   }
-  return result->second;
+  return sinks[src_port.get_lsb()];
 }
 
 std::vector<BasicPort>
@@ -494,23 +557,29 @@ bool MemoryBankShiftRegisterBanks::empty() const {
 }
 
 void MemoryBankShiftRegisterBanks::build_bl_port_fast_lookup() const {
-  bl_ports_to_sr_bank_ids_.resize(bl_bank_data_ports_.size());
-  bl_ports_to_sr_bank_ports_.resize(bl_bank_data_ports_.size());
-  for (const auto& region : bl_bank_data_ports_) {
-    for (const auto& bank : region) {
-      size_t cur_pin = 0;
+  bl_pins_to_sr_bank_ids_.clear();
+  bl_pins_to_sr_bank_pins_.clear();
+  bl_pins_to_sr_bank_ids_.resize(bl_bank_data_ports_.size());
+  bl_pins_to_sr_bank_pins_.resize(bl_bank_data_ports_.size());
+  for (const ConfigRegionId& region_id : regions()) {
+    /* Size the tables by the largest BL index in the region */
+    size_t num_bls = 0;
+    for (const auto& bank : bl_bank_data_ports_[region_id]) {
       for (const auto& port : bank) {
+        if (port.is_valid()) {
+          num_bls = std::max(num_bls, port.get_msb() + 1);
+        }
+      }
+    }
+    bl_pins_to_sr_bank_ids_[region_id].assign(num_bls,
+                                               FabricBitLineBankId::INVALID());
+    bl_pins_to_sr_bank_pins_[region_id].assign(num_bls, size_t(-1));
+    for (const FabricBitLineBankId& bank_id : bl_bank_ids_[region_id]) {
+      size_t cur_pin = 0;
+      for (const auto& port : bl_bank_data_ports_[region_id][bank_id]) {
         for (const size_t& bl_index : port.pins()) {
-          BasicPort bl_port(std::string(MEMORY_BL_PORT_NAME), bl_index,
-                            bl_index);
-          BasicPort sr_bl_port(std::string(MEMORY_BL_PORT_NAME), cur_pin,
-                               cur_pin);
-          ConfigRegionId region_id =
-            ConfigRegionId(&region - &bl_bank_data_ports_[ConfigRegionId(0)]);
-          FabricBitLineBankId bank_id =
-            FabricBitLineBankId(&bank - &region[FabricBitLineBankId(0)]);
-          bl_ports_to_sr_bank_ids_[region_id][bl_port] = bank_id;
-          bl_ports_to_sr_bank_ports_[region_id][bl_port] = sr_bl_port;
+          bl_pins_to_sr_bank_ids_[region_id][bl_index] = bank_id;
+          bl_pins_to_sr_bank_pins_[region_id][bl_index] = cur_pin;
           cur_pin++;
         }
       }
@@ -521,23 +590,29 @@ void MemoryBankShiftRegisterBanks::build_bl_port_fast_lookup() const {
 }
 
 void MemoryBankShiftRegisterBanks::build_wl_port_fast_lookup() const {
-  wl_ports_to_sr_bank_ids_.resize(wl_bank_data_ports_.size());
-  wl_ports_to_sr_bank_ports_.resize(wl_bank_data_ports_.size());
-  for (const auto& region : wl_bank_data_ports_) {
-    for (const auto& bank : region) {
-      size_t cur_pin = 0;
+  wl_pins_to_sr_bank_ids_.clear();
+  wl_pins_to_sr_bank_pins_.clear();
+  wl_pins_to_sr_bank_ids_.resize(wl_bank_data_ports_.size());
+  wl_pins_to_sr_bank_pins_.resize(wl_bank_data_ports_.size());
+  for (const ConfigRegionId& region_id : regions()) {
+    /* Size the tables by the largest WL index in the region */
+    size_t num_wls = 0;
+    for (const auto& bank : wl_bank_data_ports_[region_id]) {
       for (const auto& port : bank) {
+        if (port.is_valid()) {
+          num_wls = std::max(num_wls, port.get_msb() + 1);
+        }
+      }
+    }
+    wl_pins_to_sr_bank_ids_[region_id].assign(num_wls,
+                                               FabricWordLineBankId::INVALID());
+    wl_pins_to_sr_bank_pins_[region_id].assign(num_wls, size_t(-1));
+    for (const FabricWordLineBankId& bank_id : wl_bank_ids_[region_id]) {
+      size_t cur_pin = 0;
+      for (const auto& port : wl_bank_data_ports_[region_id][bank_id]) {
         for (const size_t& wl_index : port.pins()) {
-          BasicPort wl_port(std::string(MEMORY_WL_PORT_NAME), wl_index,
-                            wl_index);
-          BasicPort sr_wl_port(std::string(MEMORY_WL_PORT_NAME), cur_pin,
-                               cur_pin);
-          ConfigRegionId region_id =
-            ConfigRegionId(&region - &wl_bank_data_ports_[ConfigRegionId(0)]);
-          FabricWordLineBankId bank_id =
-            FabricWordLineBankId(&bank - &region[FabricWordLineBankId(0)]);
-          wl_ports_to_sr_bank_ids_[region_id][wl_port] = bank_id;
-          wl_ports_to_sr_bank_ports_[region_id][wl_port] = sr_wl_port;
+          wl_pins_to_sr_bank_ids_[region_id][wl_index] = bank_id;
+          wl_pins_to_sr_bank_pins_[region_id][wl_index] = cur_pin;
           cur_pin++;
         }
       }
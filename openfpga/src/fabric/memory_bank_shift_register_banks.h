@@ -1,7 +1,6 @@
 #ifndef MEMORY_BANK_SHIFT_REGISTER_BANKS_H
 #define MEMORY_BANK_SHIFT_REGISTER_BANKS_H
 
-#include <map>
 #include <vector>
 
 #include "fabric_key.h"
@@ -62,6 +61,16 @@ class MemoryBankShiftRegisterBanks {
   BasicPort find_bl_shift_register_bank_data_port(
     const ConfigRegionId& region, const BasicPort& bl_port) const;
 
+  /** @brief find the BL shift register bank id to which a BL pin, i.e.,
+   * bl[bl_pin], is connected to */
+  FabricBitLineBankId find_bl_shift_register_bank_id(
+    const ConfigRegionId& region, const size_t& bl_pin) const;
+
+  /** @brief find the data pin of a BL shift register bank to which a BL pin,
+   * i.e., bl[bl_pin], is connected to. Return size_t(-1) if not found */
+  size_t find_bl_shift_register_bank_data_pin(const ConfigRegionId& region,
+                                               const size_t& bl_pin) const;
+
   /** @brief Return the module id of a BL shift register bank */
   ModuleId bl_shift_register_bank_module(
     const ConfigRegionId& region_id, const FabricBitLineBankId& bank_id) const;
@@ -75,7 +84,7 @@ class MemoryBankShiftRegisterBanks {
    *  @note a BL may drive multiple children (children on the same column share
    * the same BLs)
    */
-  std::vector<size_t> bl_shift_register_bank_sink_child_ids(
+  const std::vector<size_t>& bl_shift_register_bank_sink_child_ids(
     const ConfigRegionId& region_id, const FabricBitLineBankId& bank_id,
     const BasicPort& src_port) const;
 
@@ -84,7 +93,7 @@ class MemoryBankShiftRegisterBanks {
    *  @note a BL may drive multiple children (children on the same column share
    * the same BLs)
    */
-  std::vector<size_t> bl_shift_register_bank_sink_child_pin_ids(
+  const std::vector<size_t>& bl_shift_register_bank_sink_child_pin_ids(
     const ConfigRegionId& region_id, const FabricBitLineBankId& bank_id,
     const BasicPort& src_port) const;
 
@@ -120,6 +129,16 @@ class MemoryBankShiftRegisterBanks {
   BasicPort find_wl_shift_register_bank_data_port(
     const ConfigRegionId& region, const BasicPort& wl_port) const;
 
+  /** @brief find the WL shift register bank id to which a WL pin, i.e.,
+   * wl[wl_pin], is connected to */
+  FabricWordLineBankId find_wl_shift_register_bank_id(
+    const ConfigRegionId& region, const size_t& wl_pin) const;
+
+  /** @brief find the data pin of a WL shift register bank to which a WL pin,
+   * i.e., wl[wl_pin], is connected to. Return size_t(-1) if not found */
+  size_t find_wl_shift_register_bank_data_pin(const ConfigRegionId& region,
+                                               const size_t& wl_pin) const;
+
   /** @brief Return the module id of a WL shift register bank */
   ModuleId wl_shift_register_bank_module(
     const ConfigRegionId& region_id, const FabricWordLineBankId& bank_id) const;
@@ -133,7 +152,7 @@ class MemoryBankShiftRegisterBanks {
    *  @note a WL may drive multiple children (children on the same row share the
    * same WLs)
    */
-  std::vector<size_t> wl_shift_register_bank_sink_child_ids(
+  const std::vector<size_t>& wl_shift_register_bank_sink_child_ids(
     const ConfigRegionId& region, const FabricWordLineBankId& bank_id,
     const BasicPort& src_port) const;
 
@@ -142,7 +161,7 @@ class MemoryBankShiftRegisterBanks {
    *  @note a WL may drive multiple children (children on the same row share the
    * same WLs)
    */
-  std::vector<size_t> wl_shift_register_bank_sink_child_pin_ids(
+  const std::vector<size_t>& wl_shift_register_bank_sink_child_pin_ids(
     const ConfigRegionId& region, const FabricWordLineBankId& bank_id,
     const BasicPort& src_port) const;
 
@@ -262,13 +281,15 @@ class MemoryBankShiftRegisterBanks {
     bl_bank_modules_;
   vtr::vector<ConfigRegionId, vtr::vector<FabricBitLineBankId, size_t>>
     bl_bank_instances_;
+  /* Sink children of each data pin of a shift register bank, indexed by the
+   * pin id of the data port */
   vtr::vector<
     ConfigRegionId,
-    vtr::vector<FabricBitLineBankId, std::map<BasicPort, std::vector<size_t>>>>
+    vtr::vector<FabricBitLineBankId, std::vector<std::vector<size_t>>>>
     bl_bank_sink_child_ids_;
   vtr::vector<
     ConfigRegionId,
-    vtr::vector<FabricBitLineBankId, std::map<BasicPort, std::vector<size_t>>>>
+    vtr::vector<FabricBitLineBankId, std::vector<std::vector<size_t>>>>
     bl_bank_sink_child_pin_ids_;
 
   /* General information about the WL shift register bank */
@@ -282,27 +303,30 @@ class MemoryBankShiftRegisterBanks {
     wl_bank_modules_;
   vtr::vector<ConfigRegionId, vtr::vector<FabricWordLineBankId, size_t>>
     wl_bank_instances_;
+  /* Sink children of each data pin of a shift register bank, indexed by the
+   * pin id of the data port */
   vtr::vector<
     ConfigRegionId,
-    vtr::vector<FabricWordLineBankId, std::map<BasicPort, std::vector<size_t>>>>
+    vtr::vector<FabricWordLineBankId, std::vector<std::vector<size_t>>>>
     wl_bank_sink_child_ids_;
   vtr::vector<
     ConfigRegionId,
-    vtr::vector<FabricWordLineBankId, std::map<BasicPort, std::vector<size_t>>>>
+    vtr::vector<FabricWordLineBankId, std::vector<std::vector<size_t>>>>
     wl_bank_sink_child_pin_ids_;
 
-  /* Fast look-up: given a BL/Wl port, e.g., bl[i], find out
+  /* Fast look-up: given a BL/Wl pin, e.g., bl[i], find out
    * - the shift register bank id
    * - the output pin id of the shift register bank
+   * The tables are indexed by the BL/WL pin id i
    */
-  mutable vtr::vector<ConfigRegionId, std::map<BasicPort, FabricBitLineBankId>>
-    bl_ports_to_sr_bank_ids_;
-  mutable vtr::vector<ConfigRegionId, std::map<BasicPort, BasicPort>>
-    bl_ports_to_sr_bank_ports_;
-  mutable vtr::vector<ConfigRegionId, std::map<BasicPort, FabricWordLineBankId>>
-    wl_ports_to_sr_bank_ids_;
-  mutable vtr::vector<ConfigRegionId, std::map<BasicPort, BasicPort>>
-    wl_ports_to_sr_bank_ports_;
+  mutable vtr::vector<ConfigRegionId, std::vector<FabricBitLineBankId>>
+    bl_pins_to_sr_bank_ids_;
+  mutable vtr::vector<ConfigRegionId, std::vector<size_t>>
+    bl_pins_to_sr_bank_pins_;
+  mutable vtr::vector<ConfigRegionId, std::vector<FabricWordLineBankId>>
+    wl_pins_to_sr_bank_ids_;
+  mutable vtr::vector<ConfigRegionId, std::vector<size_t>>
+    wl_pins_to_sr_bank_pins_;
 
   /* A flag to indicate that the general information of the shift register banks
    * have been modified, fast look-up has to be updated */
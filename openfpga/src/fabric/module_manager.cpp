@@ -172,6 +172,12 @@ ModuleManager::module_net_src_range ModuleManager::module_net_sources(
   const ModuleId& module, const ModuleNetId& net) const {
   /* Validate the module_id */
   VTR_ASSERT(valid_module_net_id(module, net));
+  if (net_frozen_[module]) {
+    const std::vector<size_t>& offsets = frozen_net_src_offsets_[module];
+    size_t num_srcs = offsets[size_t(net) + 1] - offsets[size_t(net)];
+    return vtr::make_range(frozen_net_src_ids_.begin(),
+                           frozen_net_src_ids_.begin() + num_srcs);
+  }
   return vtr::make_range(net_src_ids_[module][net].begin(),
                          net_src_ids_[module][net].end());
 }
@@ -181,6 +187,12 @@ ModuleManager::module_net_sink_range ModuleManager::module_net_sinks(
   const ModuleId& module, const ModuleNetId& net) const {
   /* Validate the module_id */
   VTR_ASSERT(valid_module_net_id(module, net));
+  if (net_frozen_[module]) {
+    const std::vector<size_t>& offsets = frozen_net_sink_offsets_[module];
+    size_t num_sinks = offsets[size_t(net) + 1] - offsets[size_t(net)];
+    return vtr::make_range(frozen_net_sink_ids_.begin(),
+                           frozen_net_sink_ids_.begin() + num_sinks);
+  }
   return vtr::make_range(net_sink_ids_[module][net].begin(),
                          net_sink_ids_[module][net].end());
 }
@@ -363,6 +375,38 @@ ModuleId ModuleManager::find_module(const std::string& name) const {
   return ModuleId::INVALID();
 }
 
+/* Find the aliases of a module */
+const std::vector<std::string>& ModuleManager::module_aliases(
+  const ModuleId& module_id) const {
+  /* Validate the module_id */
+  VTR_ASSERT(valid_module_id(module_id));
+  return aliases_[module_id];
+}
+
+/* Identify if a name is registered as an alias */
+bool ModuleManager::is_module_alias(const std::string& name) const {
+  return alias_id_map_.find(name) != alias_id_map_.end();
+}
+
+/* Find the module name to be outputted for an instance of a child module */
+std::string ModuleManager::instance_module_name(
+  const ModuleId& parent_module, const ModuleId& child_module,
+  const size_t& instance_id) const {
+  /* Validate the id of both parent and child modules */
+  VTR_ASSERT(valid_module_id(parent_module));
+  VTR_ASSERT(valid_module_id(child_module));
+
+  auto parent_it = child_instance_aliases_.find(parent_module);
+  if (parent_it != child_instance_aliases_.end()) {
+    auto inst_it =
+      parent_it->second.find(std::make_pair(child_module, instance_id));
+    if (inst_it != parent_it->second.end()) {
+      return aliases_[child_module][inst_it->second];
+    }
+  }
+  return names_[child_module];
+}
+
 /* Find the number of instances of a child module in the parent module */
 size_t ModuleManager::num_instance(const ModuleId& parent_module,
                                    const ModuleId& child_module) const {
@@ -516,52 +560,38 @@ std::string ModuleManager::net_name(const ModuleId& module,
   return net_names_[module][net];
 }
 
-/* Find the source modules of a net */
-vtr::vector<ModuleNetSrcId, ModuleId> ModuleManager::net_source_modules(
-  const ModuleId& module, const ModuleNetId& net) const {
-  /* Validate module net */
-  VTR_ASSERT(valid_module_net_id(module, net));
-
-  vtr::vector<ModuleNetSrcId, ModuleId> src_modules;
-  src_modules.reserve(net_src_terminal_ids_[module][net].size());
-  for (const size_t& id : net_src_terminal_ids_[module][net]) {
-    src_modules.push_back(net_terminal_storage_[id].first);
-  }
-
-  return src_modules;
-}
-
 /* Find the ids of source instances of a net */
-vtr::vector<ModuleNetSrcId, size_t> ModuleManager::net_source_instances(
-  const ModuleId& module, const ModuleNetId& net) const {
-  /* Validate module net */
-  VTR_ASSERT(valid_module_net_id(module, net));
-
-  return net_src_instance_ids_[module][net];
-}
-
-/* Find the source ports of a net */
-vtr::vector<ModuleNetSrcId, ModulePortId> ModuleManager::net_source_ports(
+ModuleManager::module_net_index_range ModuleManager::net_source_instances(
   const ModuleId& module, const ModuleNetId& net) const {
   /* Validate module net */
   VTR_ASSERT(valid_module_net_id(module, net));
 
-  vtr::vector<ModuleNetSrcId, ModulePortId> src_ports;
-  src_ports.reserve(net_src_terminal_ids_[module][net].size());
-  for (const size_t& id : net_src_terminal_ids_[module][net]) {
-    src_ports.push_back(net_terminal_storage_[id].second);
+  if (!net_frozen_[module]) {
+    const vtr::vector<ModuleNetSrcId, size_t>& ids =
+      net_src_instance_ids_[module][net];
+    return vtr::make_range(ids.data(), ids.data() + ids.size());
   }
-
-  return src_ports;
+  const std::vector<size_t>& offsets = frozen_net_src_offsets_[module];
+  const size_t* ids = frozen_net_src_instance_ids_[module].data();
+  return vtr::make_range(ids + offsets[size_t(net)],
+                         ids + offsets[size_t(net) + 1]);
 }
 
 /* Find the source pin indices of a net */
-vtr::vector<ModuleNetSrcId, size_t> ModuleManager::net_source_pins(
+ModuleManager::module_net_index_range ModuleManager::net_source_pins(
   const ModuleId& module, const ModuleNetId& net) const {
   /* Validate module net */
   VTR_ASSERT(valid_module_net_id(module, net));
 
-  return net_src_pin_ids_[module][net];
+  if (!net_frozen_[module]) {
+    const vtr::vector<ModuleNetSrcId, size_t>& ids =
+      net_src_pin_ids_[module][net];
+    return vtr::make_range(ids.data(), ids.data() + ids.size());
+  }
+  const std::vector<size_t>& offsets = frozen_net_src_offsets_[module];
+  const size_t* ids = frozen_net_src_pin_ids_[module].data();
+  return vtr::make_range(ids + offsets[size_t(net)],
+                         ids + offsets[size_t(net) + 1]);
 }
 
 /* Identify if a pin of a port in a module already exists in the net source
@@ -580,14 +610,13 @@ bool ModuleManager::net_source_exist(const ModuleId& module,
    * we can say that the source has already been added to this net!
    */
   for (const ModuleNetSrcId& net_src : module_net_sources(module, net)) {
-    if ((src_module ==
-         net_terminal_storage_[net_src_terminal_ids_[module][net][net_src]]
-           .first) &&
-        (instance_id == net_source_instances(module, net)[net_src]) &&
-        (src_port ==
-         net_terminal_storage_[net_src_terminal_ids_[module][net][net_src]]
-           .second) &&
-        (src_pin == net_source_pins(module, net)[net_src])) {
+    const std::pair<ModuleId, ModulePortId>& terminal =
+      net_terminal_storage_[module]
+                           [net_source_terminal_id(module, net, net_src)];
+    if ((src_module == terminal.first) &&
+        (instance_id == net_source_instance(module, net, net_src)) &&
+        (src_port == terminal.second) &&
+        (src_pin == net_source_pin(module, net, net_src))) {
       return true;
     }
   }
@@ -596,52 +625,38 @@ bool ModuleManager::net_source_exist(const ModuleId& module,
   return false;
 }
 
-/* Find the sink modules of a net */
-vtr::vector<ModuleNetSinkId, ModuleId> ModuleManager::net_sink_modules(
-  const ModuleId& module, const ModuleNetId& net) const {
-  /* Validate module net */
-  VTR_ASSERT(valid_module_net_id(module, net));
-
-  vtr::vector<ModuleNetSinkId, ModuleId> sink_modules;
-  sink_modules.reserve(net_sink_terminal_ids_[module][net].size());
-  for (const size_t& id : net_sink_terminal_ids_[module][net]) {
-    sink_modules.push_back(net_terminal_storage_[id].first);
-  }
-
-  return sink_modules;
-}
-
 /* Find the ids of sink instances of a net */
-vtr::vector<ModuleNetSinkId, size_t> ModuleManager::net_sink_instances(
-  const ModuleId& module, const ModuleNetId& net) const {
-  /* Validate module net */
-  VTR_ASSERT(valid_module_net_id(module, net));
-
-  return net_sink_instance_ids_[module][net];
-}
-
-/* Find the sink ports of a net */
-vtr::vector<ModuleNetSinkId, ModulePortId> ModuleManager::net_sink_ports(
+ModuleManager::module_net_index_range ModuleManager::net_sink_instances(
   const ModuleId& module, const ModuleNetId& net) const {
   /* Validate module net */
   VTR_ASSERT(valid_module_net_id(module, net));
 
-  vtr::vector<ModuleNetSinkId, ModulePortId> sink_ports;
-  sink_ports.reserve(net_sink_terminal_ids_[module][net].size());
-  for (const size_t& id : net_sink_terminal_ids_[module][net]) {
-    sink_ports.push_back(net_terminal_storage_[id].second);
+  if (!net_frozen_[module]) {
+    const vtr::vector<ModuleNetSinkId, size_t>& ids =
+      net_sink_instance_ids_[module][net];
+    return vtr::make_range(ids.data(), ids.data() + ids.size());
   }
-
-  return sink_ports;
+  const std::vector<size_t>& offsets = frozen_net_sink_offsets_[module];
+  const size_t* ids = frozen_net_sink_instance_ids_[module].data();
+  return vtr::make_range(ids + offsets[size_t(net)],
+                         ids + offsets[size_t(net) + 1]);
 }
 
 /* Find the sink pin indices of a net */
-vtr::vector<ModuleNetSinkId, size_t> ModuleManager::net_sink_pins(
+ModuleManager::module_net_index_range ModuleManager::net_sink_pins(
   const ModuleId& module, const ModuleNetId& net) const {
   /* Validate module net */
   VTR_ASSERT(valid_module_net_id(module, net));
 
-  return net_sink_pin_ids_[module][net];
+  if (!net_frozen_[module]) {
+    const vtr::vector<ModuleNetSinkId, size_t>& ids =
+      net_sink_pin_ids_[module][net];
+    return vtr::make_range(ids.data(), ids.data() + ids.size());
+  }
+  const std::vector<size_t>& offsets = frozen_net_sink_offsets_[module];
+  const size_t* ids = frozen_net_sink_pin_ids_[module].data();
+  return vtr::make_range(ids + offsets[size_t(net)],
+                         ids + offsets[size_t(net) + 1]);
 }
 
 /* Identify if a pin of a port in a module already exists in the net sink list*/
@@ -659,14 +674,13 @@ bool ModuleManager::net_sink_exist(const ModuleId& module,
    * sink_pin, we can say that the sink has already been added to this net!
    */
   for (const ModuleNetSinkId& net_sink : module_net_sinks(module, net)) {
-    if ((sink_module ==
-         net_terminal_storage_[net_sink_terminal_ids_[module][net][net_sink]]
-           .first) &&
-        (instance_id == net_sink_instances(module, net)[net_sink]) &&
-        (sink_port ==
-         net_terminal_storage_[net_sink_terminal_ids_[module][net][net_sink]]
-           .second) &&
-        (sink_pin == net_sink_pins(module, net)[net_sink])) {
+    const std::pair<ModuleId, ModulePortId>& terminal =
+      net_terminal_storage_[module]
+                           [net_sink_terminal_id(module, net, net_sink)];
+    if ((sink_module == terminal.first) &&
+        (instance_id == net_sink_instance(module, net, net_sink)) &&
+        (sink_port == terminal.second) &&
+        (sink_pin == net_sink_pin(module, net, net_sink))) {
       return true;
     }
   }
@@ -675,6 +689,95 @@ bool ModuleManager::net_sink_exist(const ModuleId& module,
   return false;
 }
 
+/* Find the source module of a net */
+ModuleId ModuleManager::net_source_module(const ModuleId& module,
+                                          const ModuleNetId& net,
+                                          const ModuleNetSrcId& net_src) const {
+  return net_terminal_storage_[module]
+                              [net_source_terminal_id(module, net, net_src)]
+                                .first;
+}
+
+/* Find the source instance id of a net */
+size_t ModuleManager::net_source_instance(const ModuleId& module,
+                                          const ModuleNetId& net,
+                                          const ModuleNetSrcId& net_src) const {
+  VTR_ASSERT(valid_module_net_id(module, net));
+  if (net_frozen_[module]) {
+    size_t offset = frozen_net_src_offsets_[module][size_t(net)];
+    return frozen_net_src_instance_ids_[module][offset + size_t(net_src)];
+  }
+  return net_src_instance_ids_[module][net][net_src];
+}
+
+/* Find the source port of a net */
+ModulePortId ModuleManager::net_source_port(
+  const ModuleId& module, const ModuleNetId& net,
+  const ModuleNetSrcId& net_src) const {
+  return net_terminal_storage_[module]
+                              [net_source_terminal_id(module, net, net_src)]
+                                .second;
+}
+
+/* Find the source pin index of a net */
+size_t ModuleManager::net_source_pin(const ModuleId& module,
+                                     const ModuleNetId& net,
+                                     const ModuleNetSrcId& net_src) const {
+  VTR_ASSERT(valid_module_net_id(module, net));
+  if (net_frozen_[module]) {
+    size_t offset = frozen_net_src_offsets_[module][size_t(net)];
+    return frozen_net_src_pin_ids_[module][offset + size_t(net_src)];
+  }
+  return net_src_pin_ids_[module][net][net_src];
+}
+
+/* Find the sink module of a net */
+ModuleId ModuleManager::net_sink_module(const ModuleId& module,
+                                        const ModuleNetId& net,
+                                        const ModuleNetSinkId& net_sink) const {
+  return net_terminal_storage_[module]
+                              [net_sink_terminal_id(module, net, net_sink)]
+                                .first;
+}
+
+/* Find the sink instance id of a net */
+size_t ModuleManager::net_sink_instance(const ModuleId& module,
+                                        const ModuleNetId& net,
+                                        const ModuleNetSinkId& net_sink) const {
+  VTR_ASSERT(valid_module_net_id(module, net));
+  if (net_frozen_[module]) {
+    size_t offset = frozen_net_sink_offsets_[module][size_t(net)];
+    return frozen_net_sink_instance_ids_[module][offset + size_t(net_sink)];
+  }
+  return net_sink_instance_ids_[module][net][net_sink];
+}
+
+/* Find the sink port of a net */
+ModulePortId ModuleManager::net_sink_port(
+  const ModuleId& module, const ModuleNetId& net,
+  const ModuleNetSinkId& net_sink) const {
+  return net_terminal_storage_[module]
+                              [net_sink_terminal_id(module, net, net_sink)]
+                                .second;
+}
+
+/* Find the sink pin index of a net */
+size_t ModuleManager::net_sink_pin(const ModuleId& module,
+                                   const ModuleNetId& net,
+                                   const ModuleNetSinkId& net_sink) const {
+  VTR_ASSERT(valid_module_net_id(module, net));
+  if (net_frozen_[module]) {
+    size_t offset = frozen_net_sink_offsets_[module][size_t(net)];
+    return frozen_net_sink_pin_ids_[module][offset + size_t(net_sink)];
+  }
+  return net_sink_pin_ids_[module][net][net_sink];
+}
+
+bool ModuleManager::frozen(const ModuleId& module) const {
+  VTR_ASSERT(valid_module_id(module));
+  return net_frozen_[module];
+}
+
 bool ModuleManager::unified_configurable_children(
   const ModuleId& curr_module) const {
   if (logical_configurable_children_[curr_module].size() !=
@@ -714,6 +817,28 @@ size_t ModuleManager::find_child_module_index_in_parent_module(
   return size_t(-1);
 }
 
+size_t ModuleManager::net_source_terminal_id(
+  const ModuleId& module, const ModuleNetId& net,
+  const ModuleNetSrcId& net_src) const {
+  VTR_ASSERT(valid_module_net_id(module, net));
+  if (net_frozen_[module]) {
+    size_t offset = frozen_net_src_offsets_[module][size_t(net)];
+    return frozen_net_src_terminal_ids_[module][offset + size_t(net_src)];
+  }
+  return net_src_terminal_ids_[module][net][net_src];
+}
+
+size_t ModuleManager::net_sink_terminal_id(
+  const ModuleId& module, const ModuleNetId& net,
+  const ModuleNetSinkId& net_sink) const {
+  VTR_ASSERT(valid_module_net_id(module, net));
+  if (net_frozen_[module]) {
+    size_t offset = frozen_net_sink_offsets_[module][size_t(net)];
+    return frozen_net_sink_terminal_ids_[module][offset + size_t(net_sink)];
+  }
+  return net_sink_terminal_ids_[module][net][net_sink];
+}
+
 /******************************************************************************
  * Public Mutators
  ******************************************************************************/
@@ -732,6 +857,7 @@ ModuleId ModuleManager::add_module(const std::string& name) {
 
   /* Allocate other attributes */
   names_.push_back(name);
+  aliases_.emplace_back();
   usages_.push_back(NUM_MODULE_USAGE_TYPES);
   parents_.emplace_back();
   children_.emplace_back();
@@ -776,6 +902,17 @@ ModuleId ModuleManager::add_module(const std::string& name) {
   net_sink_terminal_ids_.emplace_back();
   net_sink_instance_ids_.emplace_back();
   net_sink_pin_ids_.emplace_back();
+  net_terminal_storage_.emplace_back();
+
+  net_frozen_.push_back(false);
+  frozen_net_src_offsets_.emplace_back();
+  frozen_net_src_terminal_ids_.emplace_back();
+  frozen_net_src_instance_ids_.emplace_back();
+  frozen_net_src_pin_ids_.emplace_back();
+  frozen_net_sink_offsets_.emplace_back();
+  frozen_net_sink_terminal_ids_.emplace_back();
+  frozen_net_sink_instance_ids_.emplace_back();
+  frozen_net_sink_pin_ids_.emplace_back();
 
   /* Register in the name-to-id map */
   name_id_map_[name] = module;
@@ -849,6 +986,36 @@ void ModuleManager::set_module_name(const ModuleId& module,
   name_id_map_[name] = module;
 }
 
+/* Add an alias to a module */
+void ModuleManager::add_module_alias(const ModuleId& module,
+                                     const std::string& alias) {
+  /* Validate the id of module */
+  VTR_ASSERT(valid_module_id(module));
+  /* The alias should not conflict with any module name or alias */
+  VTR_ASSERT(name_id_map_.end() == name_id_map_.find(alias));
+
+  alias_id_map_[alias] = aliases_[module].size();
+  aliases_[module].push_back(alias);
+  name_id_map_[alias] = module;
+}
+
+/* Rename an alias of a module */
+void ModuleManager::set_module_alias_name(const std::string& alias,
+                                          const std::string& name) {
+  auto it = alias_id_map_.find(alias);
+  VTR_ASSERT(it != alias_id_map_.end());
+  size_t alias_id = it->second;
+  ModuleId module = name_id_map_.at(alias);
+  aliases_[module][alias_id] = name;
+
+  /* Unregister the old name */
+  alias_id_map_.erase(it);
+  name_id_map_.erase(alias);
+  /* Register the new name */
+  alias_id_map_[name] = alias_id;
+  name_id_map_[name] = module;
+}
+
 void ModuleManager::set_module_usage(const ModuleId& module,
                                      const e_module_usage_type& usage) {
   /* Validate the id of module */
@@ -938,13 +1105,16 @@ void ModuleManager::add_child_module(const ModuleId& parent_module,
   VTR_ASSERT(valid_module_id(parent_module));
   VTR_ASSERT(valid_module_id(child_module));
 
-  /* Try to find if the parent module is already in the list */
-  std::vector<ModuleId>::iterator parent_it =
-    std::find(parents_[child_module].begin(), parents_[child_module].end(),
-              parent_module);
-  if (parent_it == parents_[child_module].end()) {
-    /* Update the parent module of child module */
-    parents_[child_module].push_back(parent_module);
+  /* Try to find if the parent module is already in the list
+   * Skipped during a parallel build, see end_parallel_build() */
+  if (!in_parallel_build_) {
+    std::vector<ModuleId>::iterator parent_it =
+      std::find(parents_[child_module].begin(), parents_[child_module].end(),
+                parent_module);
+    if (parent_it == parents_[child_module].end()) {
+      /* Update the parent module of child module */
+      parents_[child_module].push_back(parent_module);
+    }
   }
 
   std::vector<ModuleId>::iterator child_it =
@@ -954,6 +1124,11 @@ void ModuleManager::add_child_module(const ModuleId& parent_module,
   if (child_it == children_[parent_module].end()) {
     /* Update the child module of parent module */
     children_[parent_module].push_back(child_module);
+    /* The parent link is new as well, which is added when the parallel build
+     * ends */
+    if (in_parallel_build_) {
+      deferred_parent_links_[parent_module].push_back(child_module);
+    }
     num_child_instances_[parent_module].push_back(1); /* By default give one */
     child_instance_id = 0;
     /* Update the instance name list */
@@ -1006,6 +1181,24 @@ void ModuleManager::set_child_instance_name(const ModuleId& parent_module,
     instance_name;
 }
 
+/* Bind an alias of a child module to one of its instances */
+void ModuleManager::set_child_instance_module_alias(
+  const ModuleId& parent_module, const ModuleId& child_module,
+  const size_t& instance_id, const std::string& alias) {
+  /* Validate the id of both parent and child modules */
+  VTR_ASSERT(valid_module_id(parent_module));
+  VTR_ASSERT(valid_module_id(child_module));
+  /* Ensure that the instance id is in range */
+  VTR_ASSERT(instance_id < num_instance(parent_module, child_module));
+  /* The alias must belong to the child module */
+  auto it = alias_id_map_.find(alias);
+  VTR_ASSERT(it != alias_id_map_.end());
+  VTR_ASSERT(child_module == name_id_map_.at(alias));
+
+  child_instance_aliases_[parent_module][std::make_pair(
+    child_module, instance_id)] = it->second;
+}
+
 /* Add a configurable child module to module
  * Note: this function should be called after add_child_module!
  * It will check if the child module does exist in the parent module
@@ -1217,6 +1410,7 @@ void ModuleManager::reserve_module_nets(const ModuleId& module,
                                         const size_t& num_nets) {
   /* Validate the module id */
   VTR_ASSERT(valid_module_id(module));
+  thaw_module_nets(module);
 
   net_names_[module].reserve(num_nets);
   net_src_ids_[module].reserve(num_nets);
@@ -1234,6 +1428,7 @@ void ModuleManager::reserve_module_nets(const ModuleId& module,
 ModuleNetId ModuleManager::create_module_net(const ModuleId& module) {
   /* Validate the module id */
   VTR_ASSERT(valid_module_id(module));
+  thaw_module_nets(module);
 
   /* Create an new id */
   ModuleNetId net = ModuleNetId(num_nets_[module]);
@@ -1274,6 +1469,7 @@ void ModuleManager::reserve_module_net_sources(const ModuleId& module,
                                                const size_t& num_sources) {
   /* Validate module net */
   VTR_ASSERT(valid_module_net_id(module, net));
+  thaw_module_nets(module);
 
   net_src_ids_[module][net].reserve(num_sources);
   net_src_terminal_ids_[module][net].reserve(num_sources);
@@ -1288,6 +1484,7 @@ ModuleNetSrcId ModuleManager::add_module_net_source(
   const size_t& src_pin) {
   /* Validate the module and net id */
   VTR_ASSERT(valid_module_net_id(module, net));
+  thaw_module_nets(module);
 
   /* Create a new id for src node */
   ModuleNetSrcId net_src = ModuleNetSrcId(net_src_ids_[module][net].size());
@@ -1304,15 +1501,16 @@ ModuleNetSrcId ModuleManager::add_module_net_source(
    * Otherwise, add the pair
    */
   std::pair<ModuleId, ModulePortId> terminal(src_module, src_port);
-  std::vector<std::pair<ModuleId, ModulePortId>>::iterator it = std::find(
-    net_terminal_storage_.begin(), net_terminal_storage_.end(), terminal);
-  if (it == net_terminal_storage_.end()) {
-    net_src_terminal_ids_[module][net].push_back(net_terminal_storage_.size());
-    net_terminal_storage_.push_back(terminal);
+  std::vector<std::pair<ModuleId, ModulePortId>>& terminals =
+    net_terminal_storage_[module];
+  std::vector<std::pair<ModuleId, ModulePortId>>::iterator it =
+    std::find(terminals.begin(), terminals.end(), terminal);
+  if (it == terminals.end()) {
+    net_src_terminal_ids_[module][net].push_back(terminals.size());
+    terminals.push_back(terminal);
   } else {
-    VTR_ASSERT_SAFE(it != net_terminal_storage_.end());
     net_src_terminal_ids_[module][net].push_back(
-      std::distance(net_terminal_storage_.begin(), it));
+      std::distance(terminals.begin(), it));
   }
 
   /* if it has the same id as module, our instance id will be by default 0 */
@@ -1341,6 +1539,7 @@ void ModuleManager::reserve_module_net_sinks(const ModuleId& module,
                                              const size_t& num_sinks) {
   /* Validate module net */
   VTR_ASSERT(valid_module_net_id(module, net));
+  thaw_module_nets(module);
 
   net_sink_ids_[module][net].reserve(num_sinks);
   net_sink_terminal_ids_[module][net].reserve(num_sinks);
@@ -1355,6 +1554,7 @@ ModuleNetSinkId ModuleManager::add_module_net_sink(
   const size_t& sink_pin) {
   /* Validate the module and net id */
   VTR_ASSERT(valid_module_net_id(module, net));
+  thaw_module_nets(module);
 
   /* Create a new id for sink node */
   ModuleNetSinkId net_sink = ModuleNetSinkId(net_sink_ids_[module][net].size());
@@ -1371,15 +1571,16 @@ ModuleNetSinkId ModuleManager::add_module_net_sink(
    * Otherwise, add the pair
    */
   std::pair<ModuleId, ModulePortId> terminal(sink_module, sink_port);
-  std::vector<std::pair<ModuleId, ModulePortId>>::iterator it = std::find(
-    net_terminal_storage_.begin(), net_terminal_storage_.end(), terminal);
-  if (it == net_terminal_storage_.end()) {
-    net_sink_terminal_ids_[module][net].push_back(net_terminal_storage_.size());
-    net_terminal_storage_.push_back(terminal);
+  std::vector<std::pair<ModuleId, ModulePortId>>& terminals =
+    net_terminal_storage_[module];
+  std::vector<std::pair<ModuleId, ModulePortId>>::iterator it =
+    std::find(terminals.begin(), terminals.end(), terminal);
+  if (it == terminals.end()) {
+    net_sink_terminal_ids_[module][net].push_back(terminals.size());
+    terminals.push_back(terminal);
   } else {
-    VTR_ASSERT_SAFE(it != net_terminal_storage_.end());
     net_sink_terminal_ids_[module][net].push_back(
-      std::distance(net_terminal_storage_.begin(), it));
+      std::distance(terminals.begin(), it));
   }
 
   /* if it has the same id as module, our instance id will be by default 0 */
@@ -1526,12 +1727,156 @@ void ModuleManager::clear_io_children(const ModuleId& parent_module) {
 void ModuleManager::clear_module_net_sinks(const ModuleId& parent_module,
                                            const ModuleNetId& net) {
   VTR_ASSERT(valid_module_net_id(parent_module, net));
+  thaw_module_nets(parent_module);
   net_sink_ids_[parent_module][net].clear();
   net_sink_terminal_ids_[parent_module][net].clear();
   net_sink_instance_ids_[parent_module][net].clear();
   net_sink_pin_ids_[parent_module][net].clear();
 }
 
+/******************************************************************************
+ * Private mutators
+ ******************************************************************************/
+/* Flatten a list per net into an array, where the list of a net starts at
+ * the offset of the net */
+template <class ID>
+static void flatten_net_lists(
+  const vtr::vector<ModuleNetId, vtr::vector<ID, size_t>>& lists,
+  std::vector<size_t>& offsets, std::vector<size_t>& flat_list) {
+  offsets.clear();
+  offsets.reserve(lists.size() + 1);
+  offsets.push_back(0);
+  for (const vtr::vector<ID, size_t>& list : lists) {
+    offsets.push_back(offsets.back() + list.size());
+  }
+  flat_list.clear();
+  flat_list.reserve(offsets.back());
+  for (const vtr::vector<ID, size_t>& list : lists) {
+    flat_list.insert(flat_list.end(), list.begin(), list.end());
+  }
+}
+
+/* Split an array flattened by flatten_net_lists() back to a list per net */
+template <class ID>
+static void split_net_lists(const std::vector<size_t>& offsets,
+                            const std::vector<size_t>& flat_list,
+                            vtr::vector<ModuleNetId, vtr::vector<ID, size_t>>&
+                              lists) {
+  lists.resize(offsets.size() - 1);
+  for (size_t inet = 0; inet < offsets.size() - 1; ++inet) {
+    lists[ModuleNetId(inet)].assign(flat_list.begin() + offsets[inet],
+                                    flat_list.begin() + offsets[inet + 1]);
+  }
+}
+
+void ModuleManager::freeze_module_nets(const ModuleId& module) {
+  VTR_ASSERT(valid_module_id(module));
+  if (net_frozen_[module]) {
+    return;
+  }
+
+  flatten_net_lists(net_src_terminal_ids_[module],
+                    frozen_net_src_offsets_[module],
+                    frozen_net_src_terminal_ids_[module]);
+  flatten_net_lists(net_src_instance_ids_[module],
+                    frozen_net_src_offsets_[module],
+                    frozen_net_src_instance_ids_[module]);
+  flatten_net_lists(net_src_pin_ids_[module], frozen_net_src_offsets_[module],
+                    frozen_net_src_pin_ids_[module]);
+
+  flatten_net_lists(net_sink_terminal_ids_[module],
+                    frozen_net_sink_offsets_[module],
+                    frozen_net_sink_terminal_ids_[module]);
+  flatten_net_lists(net_sink_instance_ids_[module],
+                    frozen_net_sink_offsets_[module],
+                    frozen_net_sink_instance_ids_[module]);
+  flatten_net_lists(net_sink_pin_ids_[module],
+                    frozen_net_sink_offsets_[module],
+                    frozen_net_sink_pin_ids_[module]);
+
+  /* Extend the shared ids to cover the largest fan-in and fan-out */
+  for (const ModuleNetId& net : module_nets(module)) {
+    while (frozen_net_src_ids_.size() < net_src_ids_[module][net].size()) {
+      frozen_net_src_ids_.push_back(ModuleNetSrcId(frozen_net_src_ids_.size()));
+    }
+    while (frozen_net_sink_ids_.size() < net_sink_ids_[module][net].size()) {
+      frozen_net_sink_ids_.push_back(
+        ModuleNetSinkId(frozen_net_sink_ids_.size()));
+    }
+  }
+
+  /* Release the lists per net */
+  net_src_ids_[module].clear();
+  net_src_ids_[module].shrink_to_fit();
+  net_src_terminal_ids_[module].clear();
+  net_src_terminal_ids_[module].shrink_to_fit();
+  net_src_instance_ids_[module].clear();
+  net_src_instance_ids_[module].shrink_to_fit();
+  net_src_pin_ids_[module].clear();
+  net_src_pin_ids_[module].shrink_to_fit();
+  net_sink_ids_[module].clear();
+  net_sink_ids_[module].shrink_to_fit();
+  net_sink_terminal_ids_[module].clear();
+  net_sink_terminal_ids_[module].shrink_to_fit();
+  net_sink_instance_ids_[module].clear();
+  net_sink_instance_ids_[module].shrink_to_fit();
+  net_sink_pin_ids_[module].clear();
+  net_sink_pin_ids_[module].shrink_to_fit();
+
+  net_frozen_[module] = true;
+}
+
+void ModuleManager::thaw_module_nets(const ModuleId& module) {
+  VTR_ASSERT(valid_module_id(module));
+  if (!net_frozen_[module]) {
+    return;
+  }
+
+  split_net_lists(frozen_net_src_offsets_[module],
+                  frozen_net_src_terminal_ids_[module],
+                  net_src_terminal_ids_[module]);
+  split_net_lists(frozen_net_src_offsets_[module],
+                  frozen_net_src_instance_ids_[module],
+                  net_src_instance_ids_[module]);
+  split_net_lists(frozen_net_src_offsets_[module],
+                  frozen_net_src_pin_ids_[module], net_src_pin_ids_[module]);
+
+  split_net_lists(frozen_net_sink_offsets_[module],
+                  frozen_net_sink_terminal_ids_[module],
+                  net_sink_terminal_ids_[module]);
+  split_net_lists(frozen_net_sink_offsets_[module],
+                  frozen_net_sink_instance_ids_[module],
+                  net_sink_instance_ids_[module]);
+  split_net_lists(frozen_net_sink_offsets_[module],
+                  frozen_net_sink_pin_ids_[module], net_sink_pin_ids_[module]);
+
+  /* Source and sink ids are always consecutive numbers from 0 */
+  net_src_ids_[module].resize(num_nets_[module]);
+  net_sink_ids_[module].resize(num_nets_[module]);
+  for (size_t inet = 0; inet < num_nets_[module]; ++inet) {
+    ModuleNetId net(inet);
+    for (size_t isrc = 0; isrc < net_src_pin_ids_[module][net].size();
+         ++isrc) {
+      net_src_ids_[module][net].push_back(ModuleNetSrcId(isrc));
+    }
+    for (size_t isink = 0; isink < net_sink_pin_ids_[module][net].size();
+         ++isink) {
+      net_sink_ids_[module][net].push_back(ModuleNetSinkId(isink));
+    }
+  }
+
+  frozen_net_src_offsets_[module].clear();
+  frozen_net_src_terminal_ids_[module].clear();
+  frozen_net_src_instance_ids_[module].clear();
+  frozen_net_src_pin_ids_[module].clear();
+  frozen_net_sink_offsets_[module].clear();
+  frozen_net_sink_terminal_ids_[module].clear();
+  frozen_net_sink_instance_ids_[module].clear();
+  frozen_net_sink_pin_ids_[module].clear();
+
+  net_frozen_[module] = false;
+}
+
 /******************************************************************************
  * Private validators/invalidators
  ******************************************************************************/
@@ -1587,4 +1932,32 @@ void ModuleManager::set_group_routing(const bool& group_routing) {
   group_routing_ = group_routing;
 }
 
+void ModuleManager::begin_parallel_build() {
+  VTR_ASSERT(!in_parallel_build_);
+  in_parallel_build_ = true;
+  /* No module is added during a parallel build */
+  deferred_parent_links_.resize(ids_.size());
+}
+
+void ModuleManager::end_parallel_build() {
+  VTR_ASSERT(in_parallel_build_);
+  in_parallel_build_ = false;
+
+  /* Add the parent links recorded by each parent module. A child is recorded
+   * only when it is added to a parent for the first time, so none of the
+   * links exists yet */
+  for (const ModuleId& parent_module : ids_) {
+    for (const ModuleId& child_module : deferred_parent_links_[parent_module]) {
+      parents_[child_module].push_back(parent_module);
+    }
+  }
+  deferred_parent_links_.clear();
+}
+
+void ModuleManager::freeze() {
+  for (const ModuleId& module : ids_) {
+    freeze_module_nets(module);
+  }
+}
+
 } /* end namespace openfpga */
@@ -173,6 +173,9 @@ class ModuleManager {
   typedef vtr::Range<module_net_src_iterator> module_net_src_range;
   typedef vtr::Range<module_net_sink_iterator> module_net_sink_range;
   typedef vtr::Range<region_iterator> region_range;
+  /* Instance ids or pin indices of the sources/sinks of a net, viewed in
+   * place in either the per-net lists or the frozen arrays */
+  typedef vtr::Range<const size_t*> module_net_index_range;
 
  public: /* Public aggregators */
   /* Find all the modules */
@@ -265,8 +268,21 @@ class ModuleManager {
   /* Find the Port information with a given port id */
   BasicPort module_port(const ModuleId& module_id,
                         const ModulePortId& port_id) const;
-  /* Find a module by a given name */
+  /* Find a module by a given name. The name can be either the name of a
+   * module or one of its aliases */
   ModuleId find_module(const std::string& name) const;
+  /* Find the aliases of a module, i.e., the extra names under which the
+   * module body is shared, e.g., by routing blocks in a flyweight build */
+  const std::vector<std::string>& module_aliases(
+    const ModuleId& module_id) const;
+  /* Identify if a name is an alias rather than the name of a module */
+  bool is_module_alias(const std::string& name) const;
+  /* Find the module name to be outputted for an instance of a child module
+   * in netlists: the alias bound to the instance if any, otherwise the name
+   * of the child module */
+  std::string instance_module_name(const ModuleId& parent_module,
+                                   const ModuleId& child_module,
+                                   const size_t& instance_id) const;
   /* Find the number of instances of a child module in the parent module */
   size_t num_instance(const ModuleId& parent_module,
                       const ModuleId& child_module) const;
@@ -308,42 +324,53 @@ class ModuleManager {
                                        const size_t& child_pin) const;
   /* Find the name of net */
   std::string net_name(const ModuleId& module, const ModuleNetId& net) const;
-  /* Find the source modules of a net */
-  vtr::vector<ModuleNetSrcId, ModuleId> net_source_modules(
-    const ModuleId& module, const ModuleNetId& net) const;
   /* Find the ids of source instances of a net */
-  vtr::vector<ModuleNetSrcId, size_t> net_source_instances(
-    const ModuleId& module, const ModuleNetId& net) const;
-  /* Find the source ports of a net */
-  vtr::vector<ModuleNetSrcId, ModulePortId> net_source_ports(
-    const ModuleId& module, const ModuleNetId& net) const;
+  module_net_index_range net_source_instances(const ModuleId& module,
+                                              const ModuleNetId& net) const;
   /* Find the source pin indices of a net */
-  vtr::vector<ModuleNetSrcId, size_t> net_source_pins(
-    const ModuleId& module, const ModuleNetId& net) const;
+  module_net_index_range net_source_pins(const ModuleId& module,
+                                         const ModuleNetId& net) const;
   /* Identify if a pin of a port in a module already exists in the net source
    * list*/
   bool net_source_exist(const ModuleId& module, const ModuleNetId& net,
                         const ModuleId& src_module, const size_t& instance_id,
                         const ModulePortId& src_port, const size_t& src_pin);
 
-  /* Find the sink modules of a net */
-  vtr::vector<ModuleNetSinkId, ModuleId> net_sink_modules(
-    const ModuleId& module, const ModuleNetId& net) const;
   /* Find the ids of sink instances of a net */
-  vtr::vector<ModuleNetSinkId, size_t> net_sink_instances(
-    const ModuleId& module, const ModuleNetId& net) const;
-  /* Find the sink ports of a net */
-  vtr::vector<ModuleNetSinkId, ModulePortId> net_sink_ports(
-    const ModuleId& module, const ModuleNetId& net) const;
+  module_net_index_range net_sink_instances(const ModuleId& module,
+                                            const ModuleNetId& net) const;
   /* Find the sink pin indices of a net */
-  vtr::vector<ModuleNetSinkId, size_t> net_sink_pins(
-    const ModuleId& module, const ModuleNetId& net) const;
+  module_net_index_range net_sink_pins(const ModuleId& module,
+                                       const ModuleNetId& net) const;
   /* Identify if a pin of a port in a module already exists in the net sink
    * list*/
   bool net_sink_exist(const ModuleId& module, const ModuleNetId& net,
                       const ModuleId& sink_module, const size_t& instance_id,
                       const ModulePortId& sink_port, const size_t& sink_pin);
 
+  /* Find the module, instance, port and pin of a single source or sink of a
+   * net, which are preferred when walking through all the nets of a large
+   * module */
+  ModuleId net_source_module(const ModuleId& module, const ModuleNetId& net,
+                             const ModuleNetSrcId& net_src) const;
+  size_t net_source_instance(const ModuleId& module, const ModuleNetId& net,
+                             const ModuleNetSrcId& net_src) const;
+  ModulePortId net_source_port(const ModuleId& module, const ModuleNetId& net,
+                               const ModuleNetSrcId& net_src) const;
+  size_t net_source_pin(const ModuleId& module, const ModuleNetId& net,
+                        const ModuleNetSrcId& net_src) const;
+  ModuleId net_sink_module(const ModuleId& module, const ModuleNetId& net,
+                           const ModuleNetSinkId& net_sink) const;
+  size_t net_sink_instance(const ModuleId& module, const ModuleNetId& net,
+                           const ModuleNetSinkId& net_sink) const;
+  ModulePortId net_sink_port(const ModuleId& module, const ModuleNetId& net,
+                             const ModuleNetSinkId& net_sink) const;
+  size_t net_sink_pin(const ModuleId& module, const ModuleNetId& net,
+                      const ModuleNetSinkId& net_sink) const;
+
+  /* Identify if the nets of a module are frozen, see freeze() */
+  bool frozen(const ModuleId& module) const;
+
   /** @brief Check if the configurable children under a given module are unified
    * or not. If unified, it means that the logical configurable children are the
    * same as the physical configurable children */
@@ -352,6 +379,11 @@ class ModuleManager {
  private: /* Private accessors */
   size_t find_child_module_index_in_parent_module(
     const ModuleId& parent_module, const ModuleId& child_module) const;
+  /* Find the index of a source/sink of a net in the terminal storage */
+  size_t net_source_terminal_id(const ModuleId& module, const ModuleNetId& net,
+                                const ModuleNetSrcId& net_src) const;
+  size_t net_sink_terminal_id(const ModuleId& module, const ModuleNetId& net,
+                              const ModuleNetSinkId& net_sink) const;
 
  public: /* Public mutators */
   /* Add a module */
@@ -365,6 +397,12 @@ class ModuleManager {
                             const std::string& port_name);
   /* Set a name for a module */
   void set_module_name(const ModuleId& module, const std::string& name);
+  /* Add an alias to a module. The alias shares the body of the module and
+   * can be found by find_module(). Error out if the name is already used */
+  void add_module_alias(const ModuleId& module, const std::string& alias);
+  /* Rename an alias of a module */
+  void set_module_alias_name(const std::string& alias,
+                             const std::string& name);
   /* Set a usage for a module */
   void set_module_usage(const ModuleId& module,
                         const e_module_usage_type& usage);
@@ -412,6 +450,12 @@ class ModuleManager {
                                const ModuleId& child_module,
                                const size_t& instance_id,
                                const std::string& instance_name);
+  /* Bind an alias of a child module to one of its instances, so that the
+   * instance is outputted under the alias in netlists */
+  void set_child_instance_module_alias(const ModuleId& parent_module,
+                                       const ModuleId& child_module,
+                                       const size_t& instance_id,
+                                       const std::string& alias);
   /* Add a configurable child module to module
    * This function also set the coordinate of a configurable child
    * The coordinate is a relative position in each region, which is used to
@@ -524,6 +568,23 @@ class ModuleManager {
   bool group_routing() const;
   void set_group_routing(const bool& group_routing);
 
+  /* Bodies of modules which have been added can be built in parallel, as
+   * long as each thread only modifies the modules it builds and no module is
+   * added meanwhile. The links from child modules to their parents are the
+   * only data shared by different parents. They are not updated during a
+   * parallel build and are restored in the order of module ids when it ends,
+   * which is the same order as building the modules one by one */
+  void begin_parallel_build();
+  void end_parallel_build();
+
+  /* Compact the sources and sinks of all the nets into flat arrays, one per
+   * module, indexed by the offsets of the nets. This is done when a fabric is
+   * completely built, so that the writers walk through contiguous memory and
+   * the per-net lists are released.
+   * A frozen module is still editable: any change on its nets turns it back
+   * to the regular storage first, which is expensive for large modules */
+  void freeze();
+
  public: /* Public deconstructors */
   /* This is a strong function which will remove all the configurable children
    * under a given parent module
@@ -562,6 +623,11 @@ class ModuleManager {
   bool valid_region_id(const ModuleId& module,
                        const ConfigRegionId& region) const;
 
+ private: /* Private mutators */
+  void freeze_module_nets(const ModuleId& module);
+  /* Bring a frozen module back to the regular storage before editing nets */
+  void thaw_module_nets(const ModuleId& module);
+
  private: /* Private validators/invalidators */
   void invalidate_name2id_map();
   void invalidate_port_lookup();
@@ -582,6 +648,13 @@ class ModuleManager {
   vtr::vector<ModuleId, std::vector<std::vector<std::string>>>
     child_instance_names_; /* Number of children instance in each child module
                             */
+  vtr::vector<ModuleId, std::vector<std::string>>
+    aliases_; /* Extra names sharing the body of each module */
+  /* Aliases bound to child instances, which are sparse and only used by the
+   * routing blocks of a flyweight build:
+   * [parent_module][(child_module, instance_id)] -> index in aliases_ */
+  std::map<ModuleId, std::map<std::pair<ModuleId, size_t>, size_t>>
+    child_instance_aliases_;
 
   /* Configurable child modules are used to record the position of configurable
    * modules in bitstream The sequence of children in the list denotes which one
@@ -717,8 +790,28 @@ class ModuleManager {
               vtr::vector<ModuleNetId, vtr::vector<ModuleNetSinkId, size_t>>>
     net_sink_pin_ids_; /* Pin ids that drive the net */
 
+  /* Storage of the nets of frozen modules. The per-net lists above are
+   * empty for a frozen module. Instead, the sources of a net are stored in
+   * [frozen_net_src_offsets_[net], frozen_net_src_offsets_[net + 1]) of the
+   * flat arrays. So do the sinks */
+  vtr::vector<ModuleId, bool> net_frozen_;
+  vtr::vector<ModuleId, std::vector<size_t>> frozen_net_src_offsets_;
+  vtr::vector<ModuleId, std::vector<size_t>> frozen_net_src_terminal_ids_;
+  vtr::vector<ModuleId, std::vector<size_t>> frozen_net_src_instance_ids_;
+  vtr::vector<ModuleId, std::vector<size_t>> frozen_net_src_pin_ids_;
+  vtr::vector<ModuleId, std::vector<size_t>> frozen_net_sink_offsets_;
+  vtr::vector<ModuleId, std::vector<size_t>> frozen_net_sink_terminal_ids_;
+  vtr::vector<ModuleId, std::vector<size_t>> frozen_net_sink_instance_ids_;
+  vtr::vector<ModuleId, std::vector<size_t>> frozen_net_sink_pin_ids_;
+  /* Ids from 0 to the largest number of sources/sinks of frozen nets, shared
+   * by the ranges of source/sink ids of all the frozen nets */
+  vtr::vector<ModuleNetSrcId, ModuleNetSrcId> frozen_net_src_ids_;
+  vtr::vector<ModuleNetSinkId, ModuleNetSinkId> frozen_net_sink_ids_;
+
   /* fast look-up for module */
   std::map<std::string, ModuleId> name_id_map_;
+  /* fast look-up for aliases: alias -> index in aliases_ of its module */
+  std::map<std::string, size_t> alias_id_map_;
   /* fast look-up for ports */
   typedef vtr::vector<ModuleId, std::vector<std::vector<ModulePortId>>>
     PortLookup;
@@ -735,8 +828,16 @@ class ModuleManager {
 
   /* Store pairs of a module and a port, which are frequently used in net
    * terminals (either source or sink)
+   * The storage is private to each parent module, so that the nets of
+   * different modules can be built independently, e.g., in parallel
    */
-  std::vector<std::pair<ModuleId, ModulePortId>> net_terminal_storage_;
+  vtr::vector<ModuleId, std::vector<std::pair<ModuleId, ModulePortId>>>
+    net_terminal_storage_;
+
+  bool in_parallel_build_ = false; /* Parent links are deferred if true */
+  /* Child modules first added to each parent module during a parallel build,
+   * whose parent links are deferred. Each parent only modifies its own list */
+  vtr::vector<ModuleId, std::vector<ModuleId>> deferred_parent_links_;
 
   bool group_routing_ =
     false; /* A flag to indicate if the routing nets are grouped together in the
@@ -12,7 +12,7 @@ namespace openfpga {
 
 /** @brief Initialize a module name map with the existing module names from a
  * module manager. In this case, all the built-in names are the same as
- * customized names */
+ * customized names. Module aliases are covered as well */
 int init_fabric_module_name_map(ModuleNameMap& module_name_map,
                                 const ModuleManager& module_manager,
                                 const bool& verbose) {
@@ -25,9 +25,17 @@ int init_fabric_module_name_map(ModuleNameMap& module_name_map,
       module_manager.module_name(curr_module),
       module_manager.module_name(curr_module));
     if (status != CMD_EXEC_SUCCESS) {
-      return CMD_EXEC_SUCCESS;
+      return CMD_EXEC_FATAL_ERROR;
     }
     cnt++;
+    for (const std::string& alias :
+         module_manager.module_aliases(curr_module)) {
+      status = module_name_map.set_tag_to_name_pair(alias, alias);
+      if (status != CMD_EXEC_SUCCESS) {
+        return CMD_EXEC_FATAL_ERROR;
+      }
+      cnt++;
+    }
   }
   VTR_LOGV(verbose, "Initialized module name map for '%lu' modules\n", cnt);
   return CMD_EXEC_SUCCESS;
@@ -50,7 +58,7 @@ int update_module_map_name_with_indexing_names(ModuleNameMap& module_name_map,
     status =
       module_name_map.set_tag_to_name_pair(name_using_coord, name_using_index);
     if (status != CMD_EXEC_SUCCESS) {
-      return CMD_EXEC_SUCCESS;
+      return CMD_EXEC_FATAL_ERROR;
     }
     VTR_LOGV(verbose, "Now use indexing name for module '%s' (was '%s')\n",
              name_using_index.c_str(), name_using_coord.c_str());
@@ -69,7 +77,7 @@ int update_module_map_name_with_indexing_names(ModuleNameMap& module_name_map,
       status = module_name_map.set_tag_to_name_pair(name_using_coord,
                                                     name_using_index);
       if (status != CMD_EXEC_SUCCESS) {
-        return CMD_EXEC_SUCCESS;
+        return CMD_EXEC_FATAL_ERROR;
       }
       VTR_LOGV(verbose, "Now use indexing name for module '%s' (was '%s')\n",
                name_using_index.c_str(), name_using_coord.c_str());
@@ -84,7 +92,7 @@ int update_module_map_name_with_indexing_names(ModuleNameMap& module_name_map,
     status =
       module_name_map.set_tag_to_name_pair(name_using_coord, name_using_index);
     if (status != CMD_EXEC_SUCCESS) {
-      return CMD_EXEC_SUCCESS;
+      return CMD_EXEC_FATAL_ERROR;
     }
     VTR_LOGV(verbose, "Now use indexing name for module '%s' (was '%s')\n",
              name_using_index.c_str(), name_using_coord.c_str());
@@ -115,6 +123,25 @@ int rename_fabric_modules(ModuleManager& module_manager,
       module_manager.set_module_name(curr_module, new_name);
     }
     cnt++;
+    /* Aliases are renamed in the same way as modules. Copy the list as it is
+     * modified during renaming */
+    std::vector<std::string> aliases =
+      module_manager.module_aliases(curr_module);
+    for (const std::string& alias : aliases) {
+      if (!module_name_map.name_exist(alias)) {
+        VTR_LOG_ERROR(
+          "The built-in module name '%s' does not exist! Abort renaming...\n",
+          alias.c_str());
+        return CMD_EXEC_FATAL_ERROR;
+      }
+      std::string new_alias = module_name_map.name(alias);
+      if (new_alias != alias) {
+        VTR_LOGV(verbose, "Rename module '%s' to its new name '%s'\n",
+                 alias.c_str(), new_alias.c_str());
+        module_manager.set_module_alias_name(alias, new_alias);
+      }
+      cnt++;
+    }
   }
   VTR_LOG("Renamed %lu modules\n", cnt);
   return status;
@@ -140,7 +167,11 @@ int partial_rename_fabric_modules(ModuleManager& module_manager,
     if (new_name != built_in_name) {
       VTR_LOGV(verbose, "Rename module '%s' to its new name '%s'\n",
                built_in_name.c_str(), new_name.c_str());
-      module_manager.set_module_name(curr_module, new_name);
+      if (module_manager.is_module_alias(built_in_name)) {
+        module_manager.set_module_alias_name(built_in_name, new_name);
+      } else {
+        module_manager.set_module_name(curr_module, new_name);
+      }
     }
     cnt++;
   }
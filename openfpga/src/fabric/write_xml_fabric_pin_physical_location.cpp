@@ -5,8 +5,8 @@
 #include <algorithm>
 #include <chrono>
 #include <ctime>
-#include <regex>
 #include <string>
+#include <vector>
 
 /* Headers from vtrutil library */
 #include "vtr_assert.h"
@@ -16,6 +16,7 @@
 /* Headers from openfpgautil library */
 #include "command_exit_codes.h"
 #include "openfpga_digest.h"
+#include "openfpga_wildcard_matcher.h"
 #include "side_manager.h"
 
 /* Headers from arch openfpga library */
@@ -53,8 +54,8 @@ static void write_xml_fabric_pin_physical_location_file_head(
  *******************************************************************/
 static int write_xml_fabric_module_pin_phy_loc(
   std::fstream& fp, const ModuleManager& module_manager,
-  const ModuleId& curr_module, const bool& show_invalid_side,
-  const bool& verbose) {
+  const ModuleId& curr_module, const std::string& curr_module_name,
+  const bool& show_invalid_side, const bool& verbose) {
   valid_file_stream(fp);
 
   /* If show invalid side is off, we should check if there is any valid side. If
@@ -70,14 +71,13 @@ static int write_xml_fabric_module_pin_phy_loc(
 
   if (!show_invalid_side && skip_curr_module) {
     VTR_LOGV(verbose, "Skip module '%s' as it contains no valid sides\n",
-             module_manager.module_name(curr_module).c_str());
+             curr_module_name.c_str());
     return CMD_EXEC_SUCCESS;
   }
   /* Print a head */
   write_tab_to_file(fp, 1);
   fp << "<" << XML_MODULE_NODE_NAME;
-  write_xml_attribute(fp, XML_MODULE_ATTRIBUTE_NAME,
-                      module_manager.module_name(curr_module).c_str());
+  write_xml_attribute(fp, XML_MODULE_ATTRIBUTE_NAME, curr_module_name.c_str());
   fp << ">"
      << "\n";
 
@@ -103,7 +103,7 @@ static int write_xml_fabric_module_pin_phy_loc(
     cnt++;
   }
   VTR_LOGV(verbose, "Output %lu ports with physical sides for module '%s'\n",
-           cnt, module_manager.module_name(curr_module).c_str());
+           cnt, curr_module_name.c_str());
 
   /* Print a tail */
   write_tab_to_file(fp, 1);
@@ -142,30 +142,34 @@ int write_xml_fabric_pin_physical_location(const char* fname,
 
   /* If module name is not specified, walk through all the modules and write
    * physical pin location when any is specified */
-  short cnt = 0;
+  size_t cnt = 0;
   /* Use regular expression to capture the module whose name matches the pattern
    */
+  WildCardMatcher module_name_matcher(module_name);
   for (ModuleId curr_module : module_manager.modules()) {
-    std::string curr_module_name = module_manager.module_name(curr_module);
-    std::string pattern = module_name;
-    std::regex star_replace("\\*");
-    std::regex questionmark_replace("\\?");
-    std::string wildcard_pattern =
-      std::regex_replace(std::regex_replace(pattern, star_replace, ".*"),
-                         questionmark_replace, ".");
-    std::regex wildcard_regex(wildcard_pattern);
-    if (!std::regex_match(curr_module_name, wildcard_regex)) {
-      continue;
+    /* The aliases of a module, e.g., routing blocks sharing a module body in a
+     * flyweight build, have the same pins as the module */
+    std::vector<std::string> curr_module_names(
+      1, module_manager.module_name(curr_module));
+    for (const std::string& alias :
+         module_manager.module_aliases(curr_module)) {
+      curr_module_names.push_back(alias);
     }
-    VTR_LOGV(verbose, "Outputted pin physical location of module '%s'.\n",
-             curr_module_name.c_str());
-    /* Write the pin physical location for this module */
-    int err_code = write_xml_fabric_module_pin_phy_loc(
-      fp, module_manager, curr_module, show_invalid_side, verbose);
-    if (err_code != CMD_EXEC_SUCCESS) {
-      return CMD_EXEC_FATAL_ERROR;
+    for (const std::string& curr_module_name : curr_module_names) {
+      if (!module_name_matcher.match(curr_module_name)) {
+        continue;
+      }
+      VTR_LOGV(verbose, "Outputted pin physical location of module '%s'.\n",
+               curr_module_name.c_str());
+      /* Write the pin physical location for this module */
+      int err_code = write_xml_fabric_module_pin_phy_loc(
+        fp, module_manager, curr_module, curr_module_name, show_invalid_side,
+        verbose);
+      if (err_code != CMD_EXEC_SUCCESS) {
+        return CMD_EXEC_FATAL_ERROR;
+      }
+      cnt++;
     }
-    cnt++;
   }
 
   /* Finish writing the root node */
@@ -83,7 +83,7 @@ static std::vector<bool> build_cmos_mux_bitstream(
   if (!mux_lib.valid_mux_id(mux_graph_id)) {
     VTR_ASSERT(mux_lib.valid_mux_id(mux_graph_id));
   }
-  const MuxGraph mux_graph = mux_lib.mux_graph(mux_graph_id);
+  const MuxGraph& mux_graph = mux_lib.mux_graph(mux_graph_id);
 
   size_t datapath_id = path_id;
 
@@ -39,7 +39,7 @@ static void build_switch_block_mux_bitstream(
   const CircuitLibrary& circuit_lib, const MuxLibrary& mux_lib,
   const RRGraphView& rr_graph, const RRGraphInEdges& in_edges,
   const RRNodeId& cur_rr_node, const std::vector<RRNodeId>& drive_rr_nodes,
-  const std::vector<RREdgeId>& /*driver_rr_edges*/, const AtomContext& atom_ctx,
+  std::span<const RREdgeId> /*driver_rr_edges*/, const AtomContext& atom_ctx,
   const VprDeviceAnnotation& device_annotation,
   const VprRoutingAnnotation& routing_annotation,
   const std::string& unused_mux_config, const bool& verbose) {
@@ -271,7 +271,7 @@ static void build_connection_block_mux_bitstream(
   const bool& verbose) {
   RRNodeId src_rr_node = rr_gsb.get_ipin_node(cb_ipin_side, ipin_index);
   /* Find drive_rr_nodes*/
-  std::vector<RREdgeId> driver_rr_edges = gsb_edges.get_ipin_node_in_edges(
+  std::span<const RREdgeId> driver_rr_edges = gsb_edges.get_ipin_node_in_edges(
     rr_gsb, in_edges, cb_ipin_side, ipin_index);
   size_t datapath_mux_size = driver_rr_edges.size();
 
@@ -421,7 +421,7 @@ static void build_connection_block_interc_bitstream(
            ipin_index, rr_graph.node_coordinate_to_string(src_rr_node).c_str());
 
   /* Consider configurable edges only */
-  std::vector<RREdgeId> driver_rr_edges = gsb_edges.get_ipin_node_in_edges(
+  std::span<const RREdgeId> driver_rr_edges = gsb_edges.get_ipin_node_in_edges(
     rr_gsb, in_edges, cb_ipin_side, ipin_index);
   std::vector<RRNodeId> driver_rr_nodes;
   for (const RREdgeId curr_edge : driver_rr_edges) {
@@ -25,14 +25,19 @@ void overwrite_bitstream(openfpga::BitstreamManager& bitstream_manager,
                          const bool& verbose) {
   vtr::ScopedStartFinishTimer timer("\nOverwrite Bitstream\n");
 
-  /* Apply overwrite_bitstream bit's path and value */
+  /* Apply overwrite_bitstream bit's path and value. All the paths are
+   * applied in a batch so that their common prefixes are resolved once */
+  std::vector<std::string> paths;
+  std::vector<bool> values;
   for (auto& id : bitstream_setting.overwrite_bitstreams()) {
     std::string path = bitstream_setting.overwrite_bitstream_path(id);
     bool value = bitstream_setting.overwrite_bitstream_value(id);
     VTR_LOGV(verbose, "Overwrite bitstream path='%s' to value='%d'\n",
              path.c_str(), value);
-    bitstream_manager.overwrite_bitstream(path, value);
+    paths.push_back(path);
+    values.push_back(value);
   }
+  bitstream_manager.overwrite_bitstreams(paths, values);
 }
 
 } /* end namespace openfpga */
@@ -681,7 +681,7 @@ int write_fabric_bitstream_to_text_file(
   fp << std::endl;
 
   /* Close file handler */
-  fp.close();
+  close_file_mmostream(fname.c_str(), fp);
 
   VTR_LOGV(options.verbose_output(),
            "Outputted %lu configuration bits to plain text file: %s\n",
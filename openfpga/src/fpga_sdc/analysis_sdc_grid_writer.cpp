@@ -3,6 +3,9 @@
  * to disable unused ports of grids, such as Configurable Logic Block
  * (CLBs), heterogeneous blocks, etc.
  *******************************************************************/
+#include <map>
+#include <vector>
+
 /* Headers from vtrutil library */
 #include "vtr_assert.h"
 
@@ -32,7 +35,7 @@ namespace openfpga {
  * combinatinal path inside an unused grid, when finding critical paths!!!
  *******************************************************************/
 static void rec_print_analysis_sdc_disable_unused_pb_graph_nodes(
-  std::fstream& fp, const VprDeviceAnnotation& device_annotation,
+  std::ostream& fp, const VprDeviceAnnotation& device_annotation,
   const ModuleManager& module_manager, const ModuleId& parent_module,
   const std::string& hierarchy_name, t_pb_graph_node* physical_pb_graph_node) {
   t_pb_type* physical_pb_type = physical_pb_graph_node->pb_type;
@@ -98,7 +101,7 @@ static void rec_print_analysis_sdc_disable_unused_pb_graph_nodes(
  * Disable an unused pin of a pb_graph_node (parent_module)
  *******************************************************************/
 static void disable_pb_graph_node_unused_pin(
-  std::fstream& fp, const ModuleManager& module_manager,
+  std::ostream& fp, const ModuleManager& module_manager,
   const ModuleId& parent_module, const std::string& hierarchy_name,
   const t_pb_graph_pin* pb_graph_pin, const PhysicalPb& physical_pb,
   const PhysicalPbId& pb_id) {
@@ -140,7 +143,7 @@ static void disable_pb_graph_node_unused_pin(
  *disable them
  *******************************************************************/
 static void disable_pb_graph_node_unused_pins(
-  std::fstream& fp, const ModuleManager& module_manager,
+  std::ostream& fp, const ModuleManager& module_manager,
   const ModuleId& parent_module, const std::string& hierarchy_name,
   t_pb_graph_node* physical_pb_graph_node, const PhysicalPb& physical_pb) {
   const PhysicalPbId& pb_id = physical_pb.find_pb(physical_pb_graph_node);
@@ -193,7 +196,7 @@ static void disable_pb_graph_node_unused_pins(
  * and store the results in a mux_name-to-net mapping
  *******************************************************************/
 static void disable_pb_graph_node_unused_mux_inputs(
-  std::fstream& fp, const VprDeviceAnnotation& device_annotation,
+  std::ostream& fp, const VprDeviceAnnotation& device_annotation,
   const ModuleManager& module_manager, const ModuleId& parent_module,
   const std::string& hierarchy_name, t_pb_graph_node* physical_pb_graph_node,
   const PhysicalPb& physical_pb) {
@@ -446,7 +449,7 @@ static void disable_pb_graph_node_unused_mux_inputs(
  * combinatinal path inside an unused grid, when finding critical paths!!!
  *******************************************************************/
 static void rec_print_analysis_sdc_disable_pb_graph_node_unused_resources(
-  std::fstream& fp, const VprDeviceAnnotation& device_annotation,
+  std::ostream& fp, const VprDeviceAnnotation& device_annotation,
   const ModuleManager& module_manager, const ModuleId& parent_module,
   const std::string& hierarchy_name, t_pb_graph_node* physical_pb_graph_node,
   const PhysicalPb& physical_pb) {
@@ -527,7 +530,7 @@ static void rec_print_analysis_sdc_disable_pb_graph_node_unused_resources(
  * Just walk through each pb_type and disable all the ports using wildcards
  *******************************************************************/
 static void print_analysis_sdc_disable_pb_block_unused_resources(
-  std::fstream& fp, t_physical_tile_type_ptr grid_type,
+  std::ostream& fp, t_physical_tile_type_ptr grid_type,
   const vtr::Point<size_t>& grid_coordinate,
   const VprDeviceAnnotation& device_annotation,
   const ModuleManager& module_manager, const std::string& grid_instance_name,
@@ -597,7 +600,7 @@ static void print_analysis_sdc_disable_pb_block_unused_resources(
  * Just walk through each pb_type and disable all the ports using wildcards
  *******************************************************************/
 static void print_analysis_sdc_disable_unused_grid(
-  std::fstream& fp, const vtr::Point<size_t>& grid_coordinate,
+  std::ostream& fp, const vtr::Point<size_t>& grid_coordinate,
   const DeviceGrid& grids, const VprDeviceAnnotation& device_annotation,
   const VprClusteringAnnotation& cluster_annotation,
   const VprPlacementAnnotation& place_annotation,
@@ -684,34 +687,48 @@ static void print_analysis_sdc_disable_unused_grid(
  * while the path from inputB to output should NOT be considered!!!
  *
  *******************************************************************/
-void print_analysis_sdc_disable_unused_grids(
-  std::fstream& fp, const DeviceGrid& grids,
+int print_analysis_sdc_disable_unused_grids(
+  std::ostream& fp, const DeviceGrid& grids,
   const VprDeviceAnnotation& device_annotation,
   const VprClusteringAnnotation& cluster_annotation,
   const VprPlacementAnnotation& place_annotation,
-  const ModuleManager& module_manager) {
-  /* Process unused core grids */
-  for (size_t ix = 1; ix < grids.width() - 1; ++ix) {
-    for (size_t iy = 1; iy < grids.height() - 1; ++iy) {
-      print_analysis_sdc_disable_unused_grid(
-        fp, vtr::Point<size_t>(ix, iy), grids, device_annotation,
-        cluster_annotation, place_annotation, module_manager, NUM_2D_SIDES);
-    }
-  }
-
-  /* Instanciate I/O grids */
+  const ModuleManager& module_manager, const size_t& num_threads) {
   /* Create the coordinate range for each side of FPGA fabric */
   std::map<e_side, std::vector<vtr::Point<size_t>>> io_coordinates =
     generate_perimeter_grid_coordinates(grids);
 
-  /* Add instances of I/O grids to top_module */
+  /* Each shard is either a column of core grids or an I/O grid
+   * The core grids come first and then the I/O grids of each side */
+  size_t num_core_columns = grids.width() - 2;
+  std::vector<std::pair<e_side, vtr::Point<size_t>>> io_grids;
   for (const e_side& io_side : FPGA_SIDES_CLOCKWISE) {
     for (const vtr::Point<size_t>& io_coordinate : io_coordinates[io_side]) {
-      print_analysis_sdc_disable_unused_grid(
-        fp, io_coordinate, grids, device_annotation, cluster_annotation,
-        place_annotation, module_manager, io_side);
+      io_grids.push_back(std::make_pair(io_side, io_coordinate));
     }
   }
+
+  return print_analysis_sdc_shards(
+    fp, num_core_columns + io_grids.size(), num_threads,
+    [&](std::ostream& shard_fp, const size_t& ishard) {
+      /* Process unused core grids */
+      if (ishard < num_core_columns) {
+        size_t ix = ishard + 1;
+        for (size_t iy = 1; iy < grids.height() - 1; ++iy) {
+          print_analysis_sdc_disable_unused_grid(
+            shard_fp, vtr::Point<size_t>(ix, iy), grids, device_annotation,
+            cluster_annotation, place_annotation, module_manager,
+            NUM_2D_SIDES);
+        }
+        return;
+      }
+
+      /* Process I/O grids */
+      const std::pair<e_side, vtr::Point<size_t>>& io_grid =
+        io_grids[ishard - num_core_columns];
+      print_analysis_sdc_disable_unused_grid(
+        shard_fp, io_grid.second, grids, device_annotation, cluster_annotation,
+        place_annotation, module_manager, io_grid.first);
+    });
 }
 
 } /* end namespace openfpga */
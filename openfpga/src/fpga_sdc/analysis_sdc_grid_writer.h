@@ -4,7 +4,7 @@
 /********************************************************************
  * Include header files that are required by function declaration
  *******************************************************************/
-#include <fstream>
+#include <ostream>
 #include <vector>
 
 #include "device_grid.h"
@@ -20,12 +20,12 @@
 /* begin namespace openfpga */
 namespace openfpga {
 
-void print_analysis_sdc_disable_unused_grids(
-  std::fstream& fp, const DeviceGrid& grids,
+int print_analysis_sdc_disable_unused_grids(
+  std::ostream& fp, const DeviceGrid& grids,
   const VprDeviceAnnotation& device_annotation,
   const VprClusteringAnnotation& cluster_annotation,
   const VprPlacementAnnotation& place_annotation,
-  const ModuleManager& module_manager);
+  const ModuleManager& module_manager, const size_t& num_threads);
 
 } /* end namespace openfpga */
 
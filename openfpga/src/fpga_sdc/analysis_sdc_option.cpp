@@ -16,6 +16,7 @@ AnalysisSdcOption::AnalysisSdcOption(const std::string& sdc_dir) {
   time_unit_ = 1.;
   time_stamp_ = true;
   generate_sdc_analysis_ = false;
+  num_threads_ = 1;
 }
 
 /********************************************************************
@@ -33,6 +34,8 @@ bool AnalysisSdcOption::generate_sdc_analysis() const {
   return generate_sdc_analysis_;
 }
 
+size_t AnalysisSdcOption::num_threads() const { return num_threads_; }
+
 /********************************************************************
  * Public mutators
  ********************************************************************/
@@ -57,4 +60,8 @@ void AnalysisSdcOption::set_generate_sdc_analysis(
   generate_sdc_analysis_ = generate_sdc_analysis;
 }
 
+void AnalysisSdcOption::set_num_threads(const size_t& num_threads) {
+  num_threads_ = num_threads;
+}
+
 } /* end namespace openfpga */
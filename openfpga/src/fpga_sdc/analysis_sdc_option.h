@@ -6,6 +6,7 @@
  * in purpose of analyzing users' implementations
  ********************************************************************/
 
+#include <cstddef>
 #include <string>
 
 /* begin namespace openfpga */
@@ -21,6 +22,7 @@ class AnalysisSdcOption {
   float time_unit() const;
   bool generate_sdc_analysis() const;
   bool time_stamp() const;
+  size_t num_threads() const;
 
  public: /* Public mutators */
   void set_sdc_dir(const std::string& sdc_dir);
@@ -28,6 +30,7 @@ class AnalysisSdcOption {
   void set_time_stamp(const bool& time_stamp);
   void set_time_unit(const float& time_unit);
   void set_generate_sdc_analysis(const bool& generate_sdc_analysis);
+  void set_num_threads(const size_t& num_threads);
 
  private: /* Internal data */
   std::string sdc_dir_;
@@ -35,6 +38,9 @@ class AnalysisSdcOption {
   bool flatten_names_;
   float time_unit_;
   bool time_stamp_;
+  /* Number of threads to build the SDC file, 0 means all the hardware
+   * threads */
+  size_t num_threads_;
 };
 
 } /* end namespace openfpga */
@@ -3,6 +3,7 @@
  * that constrain routing modules of a FPGA fabric (P&Red netlist)
  * using a benchmark
  *******************************************************************/
+#include <array>
 #include <map>
 
 /* Headers from vtrutil library */
@@ -31,7 +32,7 @@ namespace openfpga {
  *    in a connection block
  *******************************************************************/
 static void print_analysis_sdc_disable_cb_unused_resources(
-  std::fstream& fp, const AtomContext& atom_ctx,
+  std::ostream& fp, const AtomContext& atom_ctx,
   const ModuleManager& module_manager,
   const VprDeviceAnnotation& device_annotation, const DeviceGrid& grids,
   const RRGraphView& rr_graph, const RRGraphInEdges& in_edges,
@@ -244,60 +245,62 @@ static void print_analysis_sdc_disable_cb_unused_resources(
 }
 
 /********************************************************************
- * Iterate over all the connection blocks in a device
+ * Iterate over all the connection blocks in a column of a device
  * and disable unused ports for each of them
  *******************************************************************/
 static void print_analysis_sdc_disable_unused_cb_ports(
-  std::fstream& fp, const AtomContext& atom_ctx,
+  std::ostream& fp, const AtomContext& atom_ctx,
   const ModuleManager& module_manager,
   const VprDeviceAnnotation& device_annotation, const DeviceGrid& grids,
   const RRGraphView& rr_graph, const RRGraphInEdges& in_edges,
   const VprRoutingAnnotation& routing_annotation,
   const DeviceRRGSB& device_rr_gsb, const e_rr_type& cb_type,
-  const bool& compact_routing_hierarchy) {
-  /* Build unique X-direction connection block modules */
+  const size_t& ix, const bool& compact_routing_hierarchy) {
   vtr::Point<size_t> cb_range = device_rr_gsb.get_gsb_range();
 
-  for (size_t ix = 0; ix < cb_range.x(); ++ix) {
-    for (size_t iy = 0; iy < cb_range.y(); ++iy) {
-      /* Check if the connection block exists in the device!
-       * Some of them do NOT exist due to heterogeneous blocks (height > 1)
-       * We will skip those modules
-       */
-      const RRGSB& rr_gsb = device_rr_gsb.get_gsb(ix, iy);
-      if (false == rr_gsb.is_cb_exist(cb_type)) {
-        continue;
-      }
-
-      print_analysis_sdc_disable_cb_unused_resources(
-        fp, atom_ctx, module_manager, device_annotation, grids, rr_graph,
-        in_edges, routing_annotation, device_rr_gsb, rr_gsb,
-        device_rr_gsb.get_gsb_edges(ix, iy), cb_type,
-        compact_routing_hierarchy);
+  for (size_t iy = 0; iy < cb_range.y(); ++iy) {
+    /* Check if the connection block exists in the device!
+     * Some of them do NOT exist due to heterogeneous blocks (height > 1)
+     * We will skip those modules
+     */
+    const RRGSB& rr_gsb = device_rr_gsb.get_gsb(ix, iy);
+    if (false == rr_gsb.is_cb_exist(cb_type)) {
+      continue;
     }
+
+    print_analysis_sdc_disable_cb_unused_resources(
+      fp, atom_ctx, module_manager, device_annotation, grids, rr_graph,
+      in_edges, routing_annotation, device_rr_gsb, rr_gsb,
+      device_rr_gsb.get_gsb_edges(ix, iy), cb_type, compact_routing_hierarchy);
   }
 }
 
 /********************************************************************
  * Iterate over all the connection blocks in a device
  * and disable unused ports for each of them
+ * Each column of X-direction and then Y-direction connection blocks is
+ * a shard, which can be written by a separated thread
  *******************************************************************/
-void print_analysis_sdc_disable_unused_cbs(
-  std::fstream& fp, const AtomContext& atom_ctx,
+int print_analysis_sdc_disable_unused_cbs(
+  std::ostream& fp, const AtomContext& atom_ctx,
   const ModuleManager& module_manager,
   const VprDeviceAnnotation& device_annotation, const DeviceGrid& grids,
   const RRGraphView& rr_graph, const RRGraphInEdges& in_edges,
   const VprRoutingAnnotation& routing_annotation,
-  const DeviceRRGSB& device_rr_gsb, const bool& compact_routing_hierarchy) {
-  print_analysis_sdc_disable_unused_cb_ports(
-    fp, atom_ctx, module_manager, device_annotation, grids, rr_graph, in_edges,
-    routing_annotation, device_rr_gsb, e_rr_type::CHANX,
-    compact_routing_hierarchy);
-
-  print_analysis_sdc_disable_unused_cb_ports(
-    fp, atom_ctx, module_manager, device_annotation, grids, rr_graph, in_edges,
-    routing_annotation, device_rr_gsb, e_rr_type::CHANY,
-    compact_routing_hierarchy);
+  const DeviceRRGSB& device_rr_gsb, const bool& compact_routing_hierarchy,
+  const size_t& num_threads) {
+  std::array<e_rr_type, 2> cb_types = {e_rr_type::CHANX, e_rr_type::CHANY};
+  size_t num_columns = device_rr_gsb.get_gsb_range().x();
+
+  return print_analysis_sdc_shards(
+    fp, cb_types.size() * num_columns, num_threads,
+    [&](std::ostream& shard_fp, const size_t& ishard) {
+      print_analysis_sdc_disable_unused_cb_ports(
+        shard_fp, atom_ctx, module_manager, device_annotation, grids, rr_graph,
+        in_edges, routing_annotation, device_rr_gsb,
+        cb_types[ishard / num_columns], ishard % num_columns,
+        compact_routing_hierarchy);
+    });
 }
 
 /********************************************************************
@@ -307,7 +310,7 @@ void print_analysis_sdc_disable_unused_cbs(
  *    in a switch block
  *******************************************************************/
 static void print_analysis_sdc_disable_sb_unused_resources(
-  std::fstream& fp, const AtomContext& atom_ctx,
+  std::ostream& fp, const AtomContext& atom_ctx,
   const ModuleManager& module_manager,
   const VprDeviceAnnotation& device_annotation, const DeviceGrid& grids,
   const RRGraphView& rr_graph, const VprRoutingAnnotation& routing_annotation,
@@ -574,34 +577,39 @@ static void print_analysis_sdc_disable_sb_unused_resources(
 }
 
 /********************************************************************
- * Iterate over all the connection blocks in a device
+ * Iterate over all the switch blocks in a device
  * and disable unused ports for each of them
+ * Each column of switch blocks is a shard, which can be written by
+ * a separated thread
  *******************************************************************/
-void print_analysis_sdc_disable_unused_sbs(
-  std::fstream& fp, const AtomContext& atom_ctx,
+int print_analysis_sdc_disable_unused_sbs(
+  std::ostream& fp, const AtomContext& atom_ctx,
   const ModuleManager& module_manager,
   const VprDeviceAnnotation& device_annotation, const DeviceGrid& grids,
   const RRGraphView& rr_graph, const VprRoutingAnnotation& routing_annotation,
-  const DeviceRRGSB& device_rr_gsb, const bool& compact_routing_hierarchy) {
-  /* Build unique X-direction connection block modules */
+  const DeviceRRGSB& device_rr_gsb, const bool& compact_routing_hierarchy,
+  const size_t& num_threads) {
   vtr::Point<size_t> sb_range = device_rr_gsb.get_gsb_range();
 
-  for (size_t ix = 0; ix < sb_range.x(); ++ix) {
-    for (size_t iy = 0; iy < sb_range.y(); ++iy) {
-      /* Check if the connection block exists in the device!
-       * Some of them do NOT exist due to heterogeneous blocks (height > 1)
-       * We will skip those modules
-       */
-      const RRGSB& rr_gsb = device_rr_gsb.get_gsb(ix, iy);
-      if (false == device_rr_gsb.is_sb_exist(ix, iy)) {
-        continue;
-      }
+  return print_analysis_sdc_shards(
+    fp, sb_range.x(), num_threads,
+    [&](std::ostream& shard_fp, const size_t& ix) {
+      for (size_t iy = 0; iy < sb_range.y(); ++iy) {
+        /* Check if the switch block exists in the device!
+         * Some of them do NOT exist due to heterogeneous blocks (height > 1)
+         * We will skip those modules
+         */
+        if (false == device_rr_gsb.is_sb_exist(ix, iy)) {
+          continue;
+        }
+        const RRGSB& rr_gsb = device_rr_gsb.get_gsb(ix, iy);
 
-      print_analysis_sdc_disable_sb_unused_resources(
-        fp, atom_ctx, module_manager, device_annotation, grids, rr_graph,
-        routing_annotation, device_rr_gsb, rr_gsb, compact_routing_hierarchy);
-    }
-  }
+        print_analysis_sdc_disable_sb_unused_resources(
+          shard_fp, atom_ctx, module_manager, device_annotation, grids,
+          rr_graph, routing_annotation, device_rr_gsb, rr_gsb,
+          compact_routing_hierarchy);
+      }
+    });
 }
 
 } /* end namespace openfpga */
@@ -14,6 +14,7 @@
 #include "analysis_sdc_grid_writer.h"
 #include "analysis_sdc_routing_writer.h"
 #include "analysis_sdc_writer.h"
+#include "command_exit_codes.h"
 #include "mux_utils.h"
 #include "openfpga_atom_netlist_utils.h"
 #include "openfpga_digest.h"
@@ -227,12 +228,16 @@ static void print_analysis_sdc_disable_global_ports(
 /********************************************************************
  * Top-level function outputs a SDC file
  * that constrain a FPGA fabric (P&Red netlist) using a benchmark
+ *
+ * Return code:
+ *   0: success
+ *   1: fatal error occurred
  *******************************************************************/
-void print_analysis_sdc(const AnalysisSdcOption& option,
-                        const float& critical_path_delay,
-                        const VprContext& vpr_ctx,
-                        const OpenfpgaContext& openfpga_ctx,
-                        const bool& compact_routing_hierarchy) {
+int print_analysis_sdc(const AnalysisSdcOption& option,
+                       const float& critical_path_delay,
+                       const VprContext& vpr_ctx,
+                       const OpenfpgaContext& openfpga_ctx,
+                       const bool& compact_routing_hierarchy) {
   /* Create the file name for Verilog netlist */
   std::string sdc_fname(
     option.sdc_dir() +
@@ -297,28 +302,42 @@ void print_analysis_sdc(const AnalysisSdcOption& option,
     format_dir_path(openfpga_ctx.module_graph().module_name(top_module)));
 
   /* Disable timing for unused routing resources in connection blocks */
-  print_analysis_sdc_disable_unused_cbs(
+  int status = print_analysis_sdc_disable_unused_cbs(
     fp, vpr_ctx.atom(), openfpga_ctx.module_graph(),
     openfpga_ctx.vpr_device_annotation(), vpr_ctx.device().grid,
     vpr_ctx.device().rr_graph, in_edges, openfpga_ctx.vpr_routing_annotation(),
-    openfpga_ctx.device_rr_gsb(), compact_routing_hierarchy);
+    openfpga_ctx.device_rr_gsb(), compact_routing_hierarchy,
+    option.num_threads());
+  if (CMD_EXEC_FATAL_ERROR == status) {
+    return status;
+  }
 
   /* Disable timing for unused routing resources in switch blocks */
-  print_analysis_sdc_disable_unused_sbs(
+  status = print_analysis_sdc_disable_unused_sbs(
     fp, vpr_ctx.atom(), openfpga_ctx.module_graph(),
     openfpga_ctx.vpr_device_annotation(), vpr_ctx.device().grid,
     vpr_ctx.device().rr_graph, openfpga_ctx.vpr_routing_annotation(),
-    openfpga_ctx.device_rr_gsb(), compact_routing_hierarchy);
+    openfpga_ctx.device_rr_gsb(), compact_routing_hierarchy,
+    option.num_threads());
+  if (CMD_EXEC_FATAL_ERROR == status) {
+    return status;
+  }
 
   /* Disable timing for unused routing resources in grids (programmable blocks)
    */
-  print_analysis_sdc_disable_unused_grids(
+  status = print_analysis_sdc_disable_unused_grids(
     fp, vpr_ctx.device().grid, openfpga_ctx.vpr_device_annotation(),
     openfpga_ctx.vpr_clustering_annotation(),
-    openfpga_ctx.vpr_placement_annotation(), openfpga_ctx.module_graph());
+    openfpga_ctx.vpr_placement_annotation(), openfpga_ctx.module_graph(),
+    option.num_threads());
+  if (CMD_EXEC_FATAL_ERROR == status) {
+    return status;
+  }
 
   /* Close file handler */
   fp.close();
+
+  return CMD_EXEC_SUCCESS;
 }
 
 } /* end namespace openfpga */
@@ -18,11 +18,11 @@
 /* begin namespace openfpga */
 namespace openfpga {
 
-void print_analysis_sdc(const AnalysisSdcOption& option,
-                        const float& critical_path_delay,
-                        const VprContext& vpr_ctx,
-                        const OpenfpgaContext& openfpga_ctx,
-                        const bool& compact_routing_hierarchy);
+int print_analysis_sdc(const AnalysisSdcOption& option,
+                       const float& critical_path_delay,
+                       const VprContext& vpr_ctx,
+                       const OpenfpgaContext& openfpga_ctx,
+                       const bool& compact_routing_hierarchy);
 
 } /* end namespace openfpga */
 
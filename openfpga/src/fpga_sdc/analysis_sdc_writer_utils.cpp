@@ -3,18 +3,61 @@
  * that are used to output a SDC file
  * in order to constrain a FPGA fabric (P&Red netlist) mapped to a benchmark
  *******************************************************************/
+#include <sstream>
+#include <vector>
 
 /* Headers from vtrutil library */
 #include "vtr_assert.h"
+#include "vtr_log.h"
 
 /* Headers from openfpgautil library */
 #include "analysis_sdc_writer_utils.h"
+#include "command_exit_codes.h"
 #include "openfpga_digest.h"
+#include "openfpga_parallel.h"
 #include "sdc_writer_utils.h"
 
 /* begin namespace openfpga */
 namespace openfpga {
 
+/********************************************************************
+ * Print SDC commands shard by shard.
+ * Each shard is written to its own in-memory stream by a worker thread.
+ * The shards are then appended to the output stream in the order of
+ * their ids, so that the output is the same as a sequential writing
+ * regardless of the number of threads
+ *
+ * Return code:
+ *   0: success
+ *   1: fatal error occurred, e.g., the output stream is not writable
+ *******************************************************************/
+int print_analysis_sdc_shards(std::ostream& fp, const size_t& num_shards,
+                              const size_t& num_threads,
+                              const AnalysisSdcShardWriter& shard_writer) {
+  /* Validate file stream */
+  if (false == valid_file_stream(fp)) {
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
+  std::vector<std::ostringstream> shards(num_shards);
+  parallel_for_each_task(num_shards, num_threads, [&](const size_t& ishard) {
+    shard_writer(shards[ishard], ishard);
+  });
+
+  for (std::ostringstream& shard : shards) {
+    fp << shard.str();
+    /* Release the memory as soon as the shard is outputted */
+    shard.str(std::string());
+  }
+
+  if (!fp.good()) {
+    VTR_LOG_ERROR("Fail to write SDC commands of %lu shards!\n", num_shards);
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
+  return CMD_EXEC_SUCCESS;
+}
+
 /********************************************************************
  * Identify if a node should be disabled during analysis SDC generation
  *******************************************************************/
@@ -48,7 +91,7 @@ bool is_rr_node_to_be_disable_for_analysis(
  *
  *******************************************************************/
 void disable_analysis_module_input_pin_net_sinks(
-  std::fstream& fp, const ModuleManager& module_manager,
+  std::ostream& fp, const ModuleManager& module_manager,
   const ModuleId& parent_module, const std::string& parent_instance_name,
   const ModulePortId& module_input_port, const size_t& module_input_pin,
   const AtomNetId& mapped_net,
@@ -67,9 +110,9 @@ void disable_analysis_module_input_pin_net_sinks(
   for (const ModuleNetSinkId& sink_id :
        module_manager.module_net_sinks(parent_module, module_net)) {
     ModuleId sink_module =
-      module_manager.net_sink_modules(parent_module, module_net)[sink_id];
+      module_manager.net_sink_module(parent_module, module_net, sink_id);
     size_t sink_instance =
-      module_manager.net_sink_instances(parent_module, module_net)[sink_id];
+      module_manager.net_sink_instance(parent_module, module_net, sink_id);
 
     /* Skip when sink module is the parent module,
      * the output ports of parent modules have been disabled/enabled already!
@@ -103,10 +146,10 @@ void disable_analysis_module_input_pin_net_sinks(
 
     BasicPort sink_port = module_manager.module_port(
       sink_module,
-      module_manager.net_sink_ports(parent_module, module_net)[sink_id]);
+      module_manager.net_sink_port(parent_module, module_net, sink_id));
     sink_port.set_width(
-      module_manager.net_sink_pins(parent_module, module_net)[sink_id],
-      module_manager.net_sink_pins(parent_module, module_net)[sink_id]);
+      module_manager.net_sink_pin(parent_module, module_net, sink_id),
+      module_manager.net_sink_pin(parent_module, module_net, sink_id));
 
     VTR_ASSERT(!sink_instance_name.empty());
     /* Get the input id that is used! Disable the unused inputs! */
@@ -139,7 +182,7 @@ void disable_analysis_module_input_pin_net_sinks(
  *
  *******************************************************************/
 void disable_analysis_module_input_port_net_sinks(
-  std::fstream& fp, const ModuleManager& module_manager,
+  std::ostream& fp, const ModuleManager& module_manager,
   const ModuleId& parent_module, const std::string& parent_instance_name,
   const ModulePortId& module_input_port, const AtomNetId& mapped_net,
   const std::map<std::string, AtomNetId> mux_instance_to_net_map) {
@@ -182,7 +225,7 @@ void disable_analysis_module_input_port_net_sinks(
  *
  *******************************************************************/
 void disable_analysis_module_output_pin_net_sinks(
-  std::fstream& fp, const ModuleManager& module_manager,
+  std::ostream& fp, const ModuleManager& module_manager,
   const ModuleId& parent_module, const std::string& parent_instance_name,
   const ModuleId& child_module, const size_t& child_instance,
   const ModulePortId& child_module_port, const size_t& child_module_pin,
@@ -202,9 +245,9 @@ void disable_analysis_module_output_pin_net_sinks(
   for (const ModuleNetSinkId& sink_id :
        module_manager.module_net_sinks(parent_module, module_net)) {
     ModuleId sink_module =
-      module_manager.net_sink_modules(parent_module, module_net)[sink_id];
+      module_manager.net_sink_module(parent_module, module_net, sink_id);
     size_t sink_instance =
-      module_manager.net_sink_instances(parent_module, module_net)[sink_id];
+      module_manager.net_sink_instance(parent_module, module_net, sink_id);
 
     /* Skip when sink module is the parent module,
      * the output ports of parent modules have been disabled/enabled already!
@@ -238,10 +281,10 @@ void disable_analysis_module_output_pin_net_sinks(
 
     BasicPort sink_port = module_manager.module_port(
       sink_module,
-      module_manager.net_sink_ports(parent_module, module_net)[sink_id]);
+      module_manager.net_sink_port(parent_module, module_net, sink_id));
     sink_port.set_width(
-      module_manager.net_sink_pins(parent_module, module_net)[sink_id],
-      module_manager.net_sink_pins(parent_module, module_net)[sink_id]);
+      module_manager.net_sink_pin(parent_module, module_net, sink_id),
+      module_manager.net_sink_pin(parent_module, module_net, sink_id));
 
     VTR_ASSERT(!sink_instance_name.empty());
     /* Get the input id that is used! Disable the unused inputs! */
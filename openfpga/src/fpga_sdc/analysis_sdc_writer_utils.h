@@ -4,8 +4,9 @@
 /********************************************************************
  * Include header files that are required by function declaration
  *******************************************************************/
-#include <fstream>
+#include <functional>
 #include <map>
+#include <ostream>
 #include <string>
 
 #include "atom_netlist_fwd.h"
@@ -20,24 +21,33 @@
 /* begin namespace openfpga */
 namespace openfpga {
 
+/* Print the SDC commands of a shard, e.g., a column of routing blocks,
+ * to the given stream */
+typedef std::function<void(std::ostream& fp, const size_t& shard_id)>
+  AnalysisSdcShardWriter;
+
+int print_analysis_sdc_shards(std::ostream& fp, const size_t& num_shards,
+                              const size_t& num_threads,
+                              const AnalysisSdcShardWriter& shard_writer);
+
 bool is_rr_node_to_be_disable_for_analysis(
   const VprRoutingAnnotation& routing_annotation, const RRNodeId& cur_rr_node);
 
 void disable_analysis_module_input_pin_net_sinks(
-  std::fstream& fp, const ModuleManager& module_manager,
+  std::ostream& fp, const ModuleManager& module_manager,
   const ModuleId& parent_module, const std::string& parent_instance_name,
   const ModulePortId& module_input_port, const size_t& module_input_pin,
   const AtomNetId& mapped_net,
   const std::map<std::string, AtomNetId> mux_instance_to_net_map);
 
 void disable_analysis_module_input_port_net_sinks(
-  std::fstream& fp, const ModuleManager& module_manager,
+  std::ostream& fp, const ModuleManager& module_manager,
   const ModuleId& parent_module, const std::string& parent_instance_name,
   const ModulePortId& module_input_port, const AtomNetId& mapped_net,
   const std::map<std::string, AtomNetId> mux_instance_to_net_map);
 
 void disable_analysis_module_output_pin_net_sinks(
-  std::fstream& fp, const ModuleManager& module_manager,
+  std::ostream& fp, const ModuleManager& module_manager,
   const ModuleId& parent_module, const std::string& parent_instance_name,
   const ModuleId& child_module, const size_t& child_instance,
   const ModulePortId& child_module_port, const size_t& child_module_pin,
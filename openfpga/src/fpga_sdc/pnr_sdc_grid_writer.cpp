@@ -9,6 +9,8 @@
  *******************************************************************/
 #include <ctime>
 #include <fstream>
+#include <map>
+#include <vector>
 
 /* Headers from vtrutil library */
 #include "vtr_assert.h"
@@ -20,6 +22,7 @@
 #include "openfpga_digest.h"
 #include "openfpga_interconnect_types.h"
 #include "openfpga_naming.h"
+#include "openfpga_parallel.h"
 #include "openfpga_physical_tile_utils.h"
 #include "openfpga_port.h"
 #include "openfpga_reserved_words.h"
@@ -476,21 +479,14 @@ static void print_pnr_sdc_constrain_primitive_pb_graph_node(
 }
 
 /********************************************************************
- * Recursively print SDC timing constraints for a pb_type
- * This function will generate a SDC file for each pb_type,
- * constraining the pin-to-pin timing
+ * Print SDC timing constraints for a pb_graph node
+ * A SDC file is generated for the pb_type, constraining the pin-to-pin timing
  *******************************************************************/
-static void rec_print_pnr_sdc_constrain_pb_graph_timing(
+static void print_pnr_sdc_constrain_pb_graph_timing(
   const PnrSdcOption& options, const std::string& module_path,
   const ModuleManager& module_manager,
   const VprDeviceAnnotation& device_annotation,
   t_pb_graph_node* parent_pb_graph_node) {
-  /* Validate pb_graph node */
-  if (nullptr == parent_pb_graph_node) {
-    VTR_LOGF_ERROR(__FILE__, __LINE__, "Invalid parent_pb_graph_node.\n");
-    exit(1);
-  }
-
   /* Get the pb_type */
   t_pb_type* parent_pb_type = parent_pb_graph_node->pb_type;
 
@@ -509,20 +505,49 @@ static void rec_print_pnr_sdc_constrain_pb_graph_timing(
   /* Write a SDC file for this pb_type */
   print_pnr_sdc_constrain_pb_graph_node_timing(
     options, module_path, module_manager, parent_pb_graph_node, physical_mode);
+}
+
+/********************************************************************
+ * Recursively collect the pb_graph nodes to be constrained for a pb_type,
+ * as well as their paths in the module hierarchy.
+ * The nodes are collected in the same order as a depth-first visit
+ *******************************************************************/
+static void rec_collect_pnr_sdc_pb_graph_timing_tasks(
+  const std::string& module_path,
+  const VprDeviceAnnotation& device_annotation,
+  t_pb_graph_node* parent_pb_graph_node,
+  std::vector<std::pair<std::string, t_pb_graph_node*>>& tasks) {
+  /* Validate pb_graph node */
+  if (nullptr == parent_pb_graph_node) {
+    VTR_LOGF_ERROR(__FILE__, __LINE__, "Invalid parent_pb_graph_node.\n");
+    exit(1);
+  }
+
+  tasks.push_back(std::make_pair(module_path, parent_pb_graph_node));
+
+  /* Get the pb_type */
+  t_pb_type* parent_pb_type = parent_pb_graph_node->pb_type;
+
+  /* Primitive node has no child to constrain */
+  if (true == is_primitive_pb_type(parent_pb_type)) {
+    return;
+  }
+
+  t_mode* physical_mode = device_annotation.physical_mode(parent_pb_type);
 
   /* Go recursively to the lower level in the pb_graph
    * Note that we assume a full hierarchical P&R, we will only visit
    * pb_graph_node of unique pb_type
    */
   for (int ipb = 0; ipb < physical_mode->num_pb_type_children; ++ipb) {
-    rec_print_pnr_sdc_constrain_pb_graph_timing(
-      options,
+    rec_collect_pnr_sdc_pb_graph_timing_tasks(
       format_dir_path(module_path +
                       generate_physical_block_instance_name(
                         &(physical_mode->pb_type_children[ipb]), ipb)),
-      module_manager, device_annotation,
+      device_annotation,
       &(parent_pb_graph_node
-          ->child_pb_graph_nodes[physical_mode->index][ipb][0]));
+          ->child_pb_graph_nodes[physical_mode->index][ipb][0]),
+      tasks);
   }
 }
 
@@ -540,6 +565,9 @@ void print_pnr_sdc_constrain_grid_timing(
   std::string root_path =
     format_dir_path(module_manager.module_name(top_module));
 
+  /* Collect all the pb_graph nodes to constrain before writing any file */
+  std::vector<std::pair<std::string, t_pb_graph_node*>> tasks;
+
   for (const t_physical_tile_type& physical_tile :
        device_ctx.physical_tile_types) {
     /* Bypass empty type or nullptr */
@@ -588,9 +616,8 @@ void print_pnr_sdc_constrain_grid_timing(
                                             pb_graph_head->pb_type,
                                             pb_graph_head->placement_index));
 
-          rec_print_pnr_sdc_constrain_pb_graph_timing(
-            options, module_path, module_manager, device_annotation,
-            pb_graph_head);
+          rec_collect_pnr_sdc_pb_graph_timing_tasks(
+            module_path, device_annotation, pb_graph_head, tasks);
         }
       } else {
         /* For CLB and heterogenenous blocks */
@@ -607,12 +634,37 @@ void print_pnr_sdc_constrain_grid_timing(
                                           pb_graph_head->pb_type,
                                           pb_graph_head->placement_index));
 
-        rec_print_pnr_sdc_constrain_pb_graph_timing(
-          options, module_path, module_manager, device_annotation,
-          pb_graph_head);
+        rec_collect_pnr_sdc_pb_graph_timing_tasks(
+          module_path, device_annotation, pb_graph_head, tasks);
       }
     }
   }
+
+  /* A pb_type may be reached from different grids, e.g., I/O blocks on
+   * different sides, while there is only one SDC file per pb_type.
+   * Keep only the last visit of each pb_type, which is the file content
+   * left on disk by a sequential writing, so that threads never write
+   * the same file */
+  std::map<std::string, size_t> last_task_of_pb_module;
+  for (size_t itask = 0; itask < tasks.size(); ++itask) {
+    last_task_of_pb_module[generate_physical_block_module_name(
+      tasks[itask].second->pb_type)] = itask;
+  }
+  std::vector<size_t> unique_tasks;
+  for (size_t itask = 0; itask < tasks.size(); ++itask) {
+    if (itask == last_task_of_pb_module.at(generate_physical_block_module_name(
+                   tasks[itask].second->pb_type))) {
+      unique_tasks.push_back(itask);
+    }
+  }
+
+  parallel_for_each_task(
+    unique_tasks.size(), options.num_threads(), [&](const size_t& itask) {
+      const std::pair<std::string, t_pb_graph_node*>& task =
+        tasks[unique_tasks[itask]];
+      print_pnr_sdc_constrain_pb_graph_timing(
+        options, task.first, module_manager, device_annotation, task.second);
+    });
 }
 
 } /* end namespace openfpga */
@@ -10,6 +10,7 @@
  *******************************************************************/
 #include <ctime>
 #include <fstream>
+#include <vector>
 
 /* Headers from vtrutil library */
 #include "vtr_assert.h"
@@ -21,6 +22,7 @@
 #include "mux_utils.h"
 #include "openfpga_digest.h"
 #include "openfpga_naming.h"
+#include "openfpga_parallel.h"
 #include "openfpga_port.h"
 #include "openfpga_rr_graph_utils.h"
 #include "openfpga_scale.h"
@@ -50,7 +52,7 @@ static void print_pnr_sdc_constrain_sb_mux_timing(
   const std::string& module_path, const ModuleManager& module_manager,
   const ModuleId& sb_module, const VprDeviceAnnotation& device_annotation,
   const DeviceGrid& grids, const RRGraphView& rr_graph,
-  const RRGraphInEdges in_edges, const RRGSB& rr_gsb,
+  const RRGraphInEdges& in_edges, const RRGSB& rr_gsb,
   const RRGSBEdges& gsb_edges, const e_side& output_node_side,
   const size_t itrack, const RRNodeId& output_rr_node,
   const bool& constrain_zero_delay_paths) {
@@ -66,7 +68,7 @@ static void print_pnr_sdc_constrain_sb_mux_timing(
     output_rr_node, OUT_PORT);
 
   /* Collect configurable driver nodes from cached sorted edges */
-  const std::vector<RREdgeId>& chan_in_edges = gsb_edges.get_chan_node_in_edges(
+  std::span<const RREdgeId> chan_in_edges = gsb_edges.get_chan_node_in_edges(
     rr_gsb, in_edges, output_node_side, itrack);
   std::vector<RRNodeId> driver_nodes;
   for (const RREdgeId& edge : chan_in_edges) {
@@ -141,7 +143,7 @@ static void print_pnr_sdc_constrain_sb_timing(
   const PnrSdcOption& options, const std::string& module_path,
   const ModuleManager& module_manager,
   const VprDeviceAnnotation& device_annotation, const DeviceGrid& grids,
-  const RRGraphView& rr_graph, const RRGraphInEdges in_edges,
+  const RRGraphView& rr_graph, const RRGraphInEdges& in_edges,
   const RRGSB& rr_gsb, const RRGSBEdges& gsb_edges) {
   std::string sdc_dir = options.sdc_dir();
   float time_unit = options.time_unit();
@@ -220,15 +222,23 @@ void print_pnr_sdc_flatten_routing_constrain_sb_timing(
 
   std::string root_path = module_manager.module_name(top_module);
 
-  /* Get the range of SB array */
+  /* Collect the switch blocks to constrain. Each of them has its own SDC file,
+   * so that the files can be written in parallel */
+  std::vector<vtr::Point<size_t>> sb_coords;
   vtr::Point<size_t> sb_range = device_rr_gsb.get_gsb_range();
-  /* Go for each SB */
   for (size_t ix = 0; ix < sb_range.x(); ++ix) {
     for (size_t iy = 0; iy < sb_range.y(); ++iy) {
-      const RRGSB& rr_gsb = device_rr_gsb.get_gsb(ix, iy);
       if (false == device_rr_gsb.is_sb_exist(ix, iy)) {
         continue;
       }
+      sb_coords.push_back(vtr::Point<size_t>(ix, iy));
+    }
+  }
+
+  parallel_for_each_task(
+    sb_coords.size(), options.num_threads(), [&](const size_t& itask) {
+      const vtr::Point<size_t>& coord = sb_coords[itask];
+      const RRGSB& rr_gsb = device_rr_gsb.get_gsb(coord);
 
       vtr::Point<size_t> gsb_coordinate(rr_gsb.get_sb_x(), rr_gsb.get_sb_y());
       std::string sb_instance_name =
@@ -241,9 +251,8 @@ void print_pnr_sdc_flatten_routing_constrain_sb_timing(
 
       print_pnr_sdc_constrain_sb_timing(
         options, module_path, module_manager, device_annotation, grids,
-        rr_graph, in_edges, rr_gsb, device_rr_gsb.get_gsb_edges(ix, iy));
-    }
-  }
+        rr_graph, in_edges, rr_gsb, device_rr_gsb.get_gsb_edges(coord));
+    });
 }
 
 /********************************************************************
@@ -261,29 +270,33 @@ void print_pnr_sdc_compact_routing_constrain_sb_timing(
 
   std::string root_path = module_manager.module_name(top_module);
 
-  for (size_t isb = 0; isb < device_rr_gsb.get_num_sb_unique_module(); ++isb) {
-    const RRGSB& rr_gsb = device_rr_gsb.get_sb_unique_module(isb);
-    if (false ==
-        device_rr_gsb.is_sb_exist(rr_gsb.get_sb_x(), rr_gsb.get_sb_y())) {
-      continue;
-    }
+  /* Each unique module has its own SDC file, which is written in a task */
+  parallel_for_each_task(
+    device_rr_gsb.get_num_sb_unique_module(), options.num_threads(),
+    [&](const size_t& isb) {
+      const RRGSB& rr_gsb = device_rr_gsb.get_sb_unique_module(isb);
+      if (false ==
+          device_rr_gsb.is_sb_exist(rr_gsb.get_sb_x(), rr_gsb.get_sb_y())) {
+        return;
+      }
 
-    /* Find all the sb instance under this module
-     * Create a regular expression to include these instance names
-     */
-    vtr::Point<size_t> gsb_coordinate(rr_gsb.get_sb_x(), rr_gsb.get_sb_y());
-    std::string sb_module_name =
-      generate_switch_block_module_name(gsb_coordinate);
+      /* Find all the sb instance under this module
+       * Create a regular expression to include these instance names
+       */
+      vtr::Point<size_t> gsb_coordinate(rr_gsb.get_sb_x(), rr_gsb.get_sb_y());
+      std::string sb_module_name =
+        generate_switch_block_module_name(gsb_coordinate);
 
-    ModuleId sb_module = module_manager.find_module(sb_module_name);
-    VTR_ASSERT(true == module_manager.valid_module_id(sb_module));
+      ModuleId sb_module = module_manager.find_module(sb_module_name);
+      VTR_ASSERT(true == module_manager.valid_module_id(sb_module));
 
-    std::string module_path = format_dir_path(root_path) + sb_module_name;
+      std::string module_path = format_dir_path(root_path) + sb_module_name;
 
-    print_pnr_sdc_constrain_sb_timing(
-      options, module_path, module_manager, device_annotation, grids, rr_graph,
-      in_edges, rr_gsb, device_rr_gsb.get_gsb_edges(gsb_coordinate));
-  }
+      print_pnr_sdc_constrain_sb_timing(
+        options, module_path, module_manager, device_annotation, grids,
+        rr_graph, in_edges, rr_gsb,
+        device_rr_gsb.get_gsb_edges(gsb_coordinate));
+    });
 }
 
 /********************************************************************
@@ -295,7 +308,7 @@ static void print_pnr_sdc_constrain_cb_mux_timing(
   const std::string& module_path, const ModuleManager& module_manager,
   const ModuleId& cb_module, const VprDeviceAnnotation& device_annotation,
   const DeviceGrid& grids, const RRGraphView& rr_graph,
-  const RRGraphInEdges in_edges, const RRGSB& rr_gsb,
+  const RRGraphInEdges& in_edges, const RRGSB& rr_gsb,
   const RRGSBEdges& gsb_edges, const e_rr_type& cb_type,
   const e_side& cb_ipin_side, const size_t inode,
   const RRNodeId& output_rr_node, const bool& constrain_zero_delay_paths) {
@@ -306,7 +319,7 @@ static void print_pnr_sdc_constrain_cb_mux_timing(
 
   /* Use cached ipin in-edges (from CHAN nodes only). If empty, all connections
    * are direct OPIN→IPIN which are handled elsewhere — skip this IPIN. */
-  const std::vector<RREdgeId>& ipin_in_edges =
+  std::span<const RREdgeId> ipin_in_edges =
     gsb_edges.get_ipin_node_in_edges(rr_gsb, in_edges, cb_ipin_side, inode);
   std::vector<RRNodeId> input_rr_nodes;
   for (const RREdgeId& edge : ipin_in_edges) {
@@ -383,7 +396,7 @@ static void print_pnr_sdc_constrain_cb_timing(
   const PnrSdcOption& options, const std::string& module_path,
   const ModuleManager& module_manager,
   const VprDeviceAnnotation& device_annotation, const DeviceGrid& grids,
-  const RRGraphView& rr_graph, const RRGraphInEdges in_edges,
+  const RRGraphView& rr_graph, const RRGraphInEdges& in_edges,
   const RRGSB& rr_gsb, const RRGSBEdges& gsb_edges, const e_rr_type& cb_type) {
   std::string sdc_dir = options.sdc_dir();
   float time_unit = options.time_unit();
@@ -500,27 +513,43 @@ static void print_pnr_sdc_constrain_cb_timing(
  * Iterate over all the connection blocks in a device
  * and print SDC file for each of them
  *******************************************************************/
-static void print_pnr_sdc_flatten_routing_constrain_cb_timing(
+void print_pnr_sdc_flatten_routing_constrain_cb_timing(
   const PnrSdcOption& options, const ModuleManager& module_manager,
   const ModuleId& top_module, const VprDeviceAnnotation& device_annotation,
   const DeviceGrid& grids, const RRGraphView& rr_graph,
-  const RRGraphInEdges& in_edges, const DeviceRRGSB& device_rr_gsb,
-  const e_rr_type& cb_type) {
-  /* Build unique X-direction connection block modules */
-  vtr::Point<size_t> cb_range = device_rr_gsb.get_gsb_range();
+  const RRGraphInEdges& in_edges, const DeviceRRGSB& device_rr_gsb) {
+  /* Start time count */
+  vtr::ScopedStartFinishTimer timer(
+    "Write SDC for constrain Connection Block timing for P&R flow");
 
   std::string root_path = module_manager.module_name(top_module);
 
-  for (size_t ix = 0; ix < cb_range.x(); ++ix) {
-    for (size_t iy = 0; iy < cb_range.y(); ++iy) {
-      /* Check if the connection block exists in the device!
-       * Some of them do NOT exist due to heterogeneous blocks (height > 1)
-       * We will skip those modules
-       */
-      const RRGSB& rr_gsb = device_rr_gsb.get_gsb(ix, iy);
-      if (false == rr_gsb.is_cb_exist(cb_type)) {
-        continue;
+  /* Collect the connection blocks to constrain, X-direction first and then
+   * Y-direction. Each of them has its own SDC file, so that the files can be
+   * written in parallel */
+  std::vector<std::pair<e_rr_type, vtr::Point<size_t>>> cbs;
+  vtr::Point<size_t> cb_range = device_rr_gsb.get_gsb_range();
+  for (const e_rr_type& cb_type : {e_rr_type::CHANX, e_rr_type::CHANY}) {
+    for (size_t ix = 0; ix < cb_range.x(); ++ix) {
+      for (size_t iy = 0; iy < cb_range.y(); ++iy) {
+        /* Check if the connection block exists in the device!
+         * Some of them do NOT exist due to heterogeneous blocks (height > 1)
+         * We will skip those modules
+         */
+        const RRGSB& rr_gsb = device_rr_gsb.get_gsb(ix, iy);
+        if (false == rr_gsb.is_cb_exist(cb_type)) {
+          continue;
+        }
+        cbs.push_back(std::make_pair(cb_type, vtr::Point<size_t>(ix, iy)));
       }
+    }
+  }
+
+  parallel_for_each_task(
+    cbs.size(), options.num_threads(), [&](const size_t& itask) {
+      const e_rr_type& cb_type = cbs[itask].first;
+      const vtr::Point<size_t>& coord = cbs[itask].second;
+      const RRGSB& rr_gsb = device_rr_gsb.get_gsb(coord);
 
       /* Find all the cb instance under this module
        * Create a regular expression to include these instance names
@@ -536,32 +565,9 @@ static void print_pnr_sdc_flatten_routing_constrain_cb_timing(
 
       print_pnr_sdc_constrain_cb_timing(
         options, module_path, module_manager, device_annotation, grids,
-        rr_graph, in_edges, rr_gsb, device_rr_gsb.get_gsb_edges(ix, iy),
+        rr_graph, in_edges, rr_gsb, device_rr_gsb.get_gsb_edges(coord),
         cb_type);
-    }
-  }
-}
-
-/********************************************************************
- * Iterate over all the connection blocks in a device
- * and print SDC file for each of them
- *******************************************************************/
-void print_pnr_sdc_flatten_routing_constrain_cb_timing(
-  const PnrSdcOption& options, const ModuleManager& module_manager,
-  const ModuleId& top_module, const VprDeviceAnnotation& device_annotation,
-  const DeviceGrid& grids, const RRGraphView& rr_graph,
-  const RRGraphInEdges& in_edges, const DeviceRRGSB& device_rr_gsb) {
-  /* Start time count */
-  vtr::ScopedStartFinishTimer timer(
-    "Write SDC for constrain Connection Block timing for P&R flow");
-
-  print_pnr_sdc_flatten_routing_constrain_cb_timing(
-    options, module_manager, top_module, device_annotation, grids, rr_graph,
-    in_edges, device_rr_gsb, e_rr_type::CHANX);
-
-  print_pnr_sdc_flatten_routing_constrain_cb_timing(
-    options, module_manager, top_module, device_annotation, grids, rr_graph,
-    in_edges, device_rr_gsb, e_rr_type::CHANY);
+    });
 }
 
 /********************************************************************
@@ -579,53 +585,40 @@ void print_pnr_sdc_compact_routing_constrain_cb_timing(
 
   std::string root_path = module_manager.module_name(top_module);
 
-  /* Print SDC for unique X-direction connection block modules */
-  for (size_t icb = 0;
-       icb < device_rr_gsb.get_num_cb_unique_module(e_rr_type::CHANX); ++icb) {
-    const RRGSB& unique_mirror =
-      device_rr_gsb.get_cb_unique_module(e_rr_type::CHANX, icb);
-
-    /* Find all the cb instance under this module
-     * Create a regular expression to include these instance names
-     */
-    vtr::Point<size_t> gsb_coordinate(unique_mirror.get_cb_x(e_rr_type::CHANX),
-                                      unique_mirror.get_cb_y(e_rr_type::CHANX));
-    std::string cb_module_name =
-      generate_connection_block_module_name(e_rr_type::CHANX, gsb_coordinate);
-    ModuleId cb_module = module_manager.find_module(cb_module_name);
-    VTR_ASSERT(true == module_manager.valid_module_id(cb_module));
-
-    std::string module_path = format_dir_path(root_path) + cb_module_name;
-
-    print_pnr_sdc_constrain_cb_timing(
-      options, module_path, module_manager, device_annotation, grids, rr_graph,
-      in_edges, unique_mirror, device_rr_gsb.get_gsb_edges(gsb_coordinate),
-      e_rr_type::CHANX);
+  /* Print SDC for unique X-direction and then Y-direction connection block
+   * modules. Each unique module has its own SDC file, which is written in a
+   * task */
+  std::vector<std::pair<e_rr_type, size_t>> unique_cbs;
+  for (const e_rr_type& cb_type : {e_rr_type::CHANX, e_rr_type::CHANY}) {
+    for (size_t icb = 0; icb < device_rr_gsb.get_num_cb_unique_module(cb_type);
+         ++icb) {
+      unique_cbs.push_back(std::make_pair(cb_type, icb));
+    }
   }
 
-  /* Print SDC for unique Y-direction connection block modules */
-  for (size_t icb = 0;
-       icb < device_rr_gsb.get_num_cb_unique_module(e_rr_type::CHANY); ++icb) {
-    const RRGSB& unique_mirror =
-      device_rr_gsb.get_cb_unique_module(e_rr_type::CHANY, icb);
+  parallel_for_each_task(
+    unique_cbs.size(), options.num_threads(), [&](const size_t& itask) {
+      const e_rr_type& cb_type = unique_cbs[itask].first;
+      const RRGSB& unique_mirror =
+        device_rr_gsb.get_cb_unique_module(cb_type, unique_cbs[itask].second);
 
-    /* Find all the cb instance under this module
-     * Create a regular expression to include these instance names
-     */
-    vtr::Point<size_t> gsb_coordinate(unique_mirror.get_cb_x(e_rr_type::CHANY),
-                                      unique_mirror.get_cb_y(e_rr_type::CHANY));
-    std::string cb_module_name =
-      generate_connection_block_module_name(e_rr_type::CHANY, gsb_coordinate);
-    ModuleId cb_module = module_manager.find_module(cb_module_name);
-    VTR_ASSERT(true == module_manager.valid_module_id(cb_module));
-
-    std::string module_path = format_dir_path(root_path) + cb_module_name;
-
-    print_pnr_sdc_constrain_cb_timing(
-      options, module_path, module_manager, device_annotation, grids, rr_graph,
-      in_edges, unique_mirror, device_rr_gsb.get_gsb_edges(gsb_coordinate),
-      e_rr_type::CHANY);
-  }
+      /* Find all the cb instance under this module
+       * Create a regular expression to include these instance names
+       */
+      vtr::Point<size_t> gsb_coordinate(unique_mirror.get_cb_x(cb_type),
+                                        unique_mirror.get_cb_y(cb_type));
+      std::string cb_module_name =
+        generate_connection_block_module_name(cb_type, gsb_coordinate);
+      ModuleId cb_module = module_manager.find_module(cb_module_name);
+      VTR_ASSERT(true == module_manager.valid_module_id(cb_module));
+
+      std::string module_path = format_dir_path(root_path) + cb_module_name;
+
+      print_pnr_sdc_constrain_cb_timing(
+        options, module_path, module_manager, device_annotation, grids,
+        rr_graph, in_edges, unique_mirror,
+        device_rr_gsb.get_gsb_edges(gsb_coordinate), cb_type);
+    });
 }
 
 } /* end namespace openfpga */
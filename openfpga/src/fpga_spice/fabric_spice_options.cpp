@@ -15,6 +15,8 @@ FabricSpiceOption::FabricSpiceOption() {
   output_directory_.clear();
   explicit_port_mapping_ = false;
   compress_routing_ = false;
+  compress_output_ = false;
+  num_threads_ = 1;
   verbose_output_ = false;
 }
 
@@ -31,6 +33,10 @@ bool FabricSpiceOption::explicit_port_mapping() const {
 
 bool FabricSpiceOption::compress_routing() const { return compress_routing_; }
 
+bool FabricSpiceOption::compress_output() const { return compress_output_; }
+
+size_t FabricSpiceOption::num_threads() const { return num_threads_; }
+
 bool FabricSpiceOption::verbose_output() const { return verbose_output_; }
 
 /******************************************************************************
@@ -48,6 +54,14 @@ void FabricSpiceOption::set_compress_routing(const bool& enabled) {
   compress_routing_ = enabled;
 }
 
+void FabricSpiceOption::set_compress_output(const bool& enabled) {
+  compress_output_ = enabled;
+}
+
+void FabricSpiceOption::set_num_threads(const size_t& num_threads) {
+  num_threads_ = num_threads;
+}
+
 void FabricSpiceOption::set_verbose_output(const bool& enabled) {
   verbose_output_ = enabled;
 }
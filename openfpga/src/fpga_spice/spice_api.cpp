@@ -35,6 +35,9 @@ namespace openfpga {
  *  - Logic block modules, which are Configuration Logic Blocks (CLBs)
  *  - FPGA module, which are the full FPGA fabric with configuration protocol
  *
+ * Independent netlists, e.g., primitive modules, routing blocks and grids,
+ * are written by a group of threads when requested by options
+ *
  * Note:
  *  - Please do NOT include ANY testbench generation in this function!!!
  *    It is about the fabric itself, independent from any implementation
@@ -82,7 +85,7 @@ int fpga_fabric_spice(const ModuleManager& module_manager,
   int status = CMD_EXEC_SUCCESS;
 
   status = print_spice_submodule(netlist_manager, module_manager, openfpga_arch,
-                                 mux_lib, submodule_dir_path);
+                                 mux_lib, submodule_dir_path, options);
 
   if (CMD_EXEC_SUCCESS != status) {
     return status;
@@ -91,24 +94,25 @@ int fpga_fabric_spice(const ModuleManager& module_manager,
   /* Generate routing blocks */
   if (true == options.compress_routing()) {
     print_spice_unique_routing_modules(netlist_manager, module_manager,
-                                       device_rr_gsb, rr_dir_path);
+                                       device_rr_gsb, rr_dir_path, options);
   } else {
     VTR_ASSERT(false == options.compress_routing());
     print_spice_flatten_routing_modules(netlist_manager, module_manager,
-                                        device_rr_gsb, rr_dir_path);
+                                        device_rr_gsb, rr_dir_path, options);
   }
 
   /* Generate grids */
   print_spice_grids(netlist_manager, module_manager, device_ctx,
-                    device_annotation, lb_dir_path, options.verbose_output());
+                    device_annotation, lb_dir_path, options);
 
   /* Generate FPGA fabric */
-  print_spice_top_module(netlist_manager, module_manager, src_dir_path);
+  print_spice_top_module(netlist_manager, module_manager, src_dir_path,
+                         options);
 
   /* Generate an netlist including all the fabric-related netlists */
   print_spice_fabric_include_netlist(
     const_cast<const NetlistManager&>(netlist_manager), src_dir_path,
-    openfpga_arch.circuit_lib);
+    openfpga_arch.circuit_lib, options);
 
   /* Given a brief stats on how many Spice modules have been written to files */
   VTR_LOGV(options.verbose_output(), "Written %lu SPICE modules in total\n",
@@ -31,16 +31,17 @@ namespace openfpga {
  *******************************************************************/
 void print_spice_fabric_include_netlist(const NetlistManager& netlist_manager,
                                         const std::string& src_dir,
-                                        const CircuitLibrary& circuit_lib) {
+                                        const CircuitLibrary& circuit_lib,
+                                        const FabricSpiceOption& options) {
   std::string spice_fname =
     src_dir + std::string(FABRIC_INCLUDE_SPICE_NETLIST_FILE_NAME);
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
+  mmostream fp(spice_fname, options.compress_output(),
+               SPICE_NETLIST_STREAM_BUFFER_SIZE);
 
   /* Validate the file stream */
-  check_file_stream(spice_fname.c_str(), fp);
+  check_file_mmostream(spice_fname.c_str(), fp);
 
   /* Print the title */
   print_spice_file_header(fp, std::string("Fabric Netlist Summary"));
@@ -58,7 +59,7 @@ void print_spice_fabric_include_netlist(const NetlistManager& netlist_manager,
        netlist_manager.netlists_by_type(NetlistManager::SUBMODULE_NETLIST)) {
     print_spice_include_netlist(fp, netlist_manager.netlist_name(nlist_id));
   }
-  fp << std::endl;
+  fp << "\n";
 
   /* Include all the CLB, heterogeneous block modules */
   print_spice_comment(fp, std::string("Include logic block netlists"));
@@ -66,7 +67,7 @@ void print_spice_fabric_include_netlist(const NetlistManager& netlist_manager,
        netlist_manager.netlists_by_type(NetlistManager::LOGIC_BLOCK_NETLIST)) {
     print_spice_include_netlist(fp, netlist_manager.netlist_name(nlist_id));
   }
-  fp << std::endl;
+  fp << "\n";
 
   /* Include all the routing architecture modules */
   print_spice_comment(fp, std::string("Include routing module netlists"));
@@ -74,7 +75,7 @@ void print_spice_fabric_include_netlist(const NetlistManager& netlist_manager,
          NetlistManager::ROUTING_MODULE_NETLIST)) {
     print_spice_include_netlist(fp, netlist_manager.netlist_name(nlist_id));
   }
-  fp << std::endl;
+  fp << "\n";
 
   /* Include FPGA top module */
   print_spice_comment(fp, std::string("Include fabric top-level netlists"));
@@ -82,10 +83,10 @@ void print_spice_fabric_include_netlist(const NetlistManager& netlist_manager,
        netlist_manager.netlists_by_type(NetlistManager::TOP_MODULE_NETLIST)) {
     print_spice_include_netlist(fp, netlist_manager.netlist_name(nlist_id));
   }
-  fp << std::endl;
+  fp << "\n";
 
   /* Close the file stream */
-  fp.close();
+  close_file_mmostream(spice_fname.c_str(), fp);
 }
 
 } /* end namespace openfpga */
@@ -7,6 +7,7 @@
 #include <string>
 
 #include "circuit_library.h"
+#include "fabric_spice_options.h"
 #include "netlist_manager.h"
 
 /********************************************************************
@@ -18,7 +19,8 @@ namespace openfpga {
 
 void print_spice_fabric_include_netlist(const NetlistManager& netlist_manager,
                                         const std::string& src_dir,
-                                        const CircuitLibrary& circuit_lib);
+                                        const CircuitLibrary& circuit_lib,
+                                        const FabricSpiceOption& options);
 
 } /* end namespace openfpga */
 
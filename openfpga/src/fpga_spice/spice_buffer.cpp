@@ -36,12 +36,12 @@ namespace openfpga {
  *   an inverter. Any preprocessing or subckt definition should not be included!
  *******************************************************************/
 static int print_spice_powergated_inverter_pmos_modeling(
-  std::fstream& fp, const std::string& trans_name_postfix,
+  mmostream& fp, const std::string& trans_name_postfix,
   const std::string& input_port_name, const std::string& output_port_name,
   const CircuitLibrary& circuit_lib, const CircuitPortId& enb_port,
   const TechnologyLibrary& tech_lib, const TechnologyModelId& tech_model,
   const float& trans_width) {
-  if (false == valid_file_stream(fp)) {
+  if (false == valid_file_mmostream(fp)) {
     return CMD_EXEC_FATAL_ERROR;
   }
 
@@ -107,12 +107,12 @@ static int print_spice_powergated_inverter_pmos_modeling(
  *   an inverter. Any preprocessing or subckt definition should not be included!
  *******************************************************************/
 static int print_spice_powergated_inverter_nmos_modeling(
-  std::fstream& fp, const std::string& trans_name_postfix,
+  mmostream& fp, const std::string& trans_name_postfix,
   const std::string& input_port_name, const std::string& output_port_name,
   const CircuitLibrary& circuit_lib, const CircuitPortId& en_port,
   const TechnologyLibrary& tech_lib, const TechnologyModelId& tech_model,
   const float& trans_width) {
-  if (false == valid_file_stream(fp)) {
+  if (false == valid_file_mmostream(fp)) {
     return CMD_EXEC_FATAL_ERROR;
   }
 
@@ -207,11 +207,11 @@ static int print_spice_powergated_inverter_nmos_modeling(
  *
  *******************************************************************/
 static int print_spice_powergated_inverter_subckt(
-  std::fstream& fp, const ModuleManager& module_manager,
+  mmostream& fp, const ModuleManager& module_manager,
   const ModuleId& module_id, const CircuitLibrary& circuit_lib,
   const CircuitModelId& circuit_model, const TechnologyLibrary& tech_lib,
   const TechnologyModelId& tech_model) {
-  if (false == valid_file_stream(fp)) {
+  if (false == valid_file_mmostream(fp)) {
     return CMD_EXEC_FATAL_ERROR;
   }
 
@@ -322,11 +322,11 @@ static int print_spice_powergated_inverter_subckt(
  *   an inverter. Any preprocessing or subckt definition should not be included!
  *******************************************************************/
 static int print_spice_regular_inverter_pmos_modeling(
-  std::fstream& fp, const std::string& trans_name_postfix,
+  mmostream& fp, const std::string& trans_name_postfix,
   const std::string& input_port_name, const std::string& output_port_name,
   const TechnologyLibrary& tech_lib, const TechnologyModelId& tech_model,
   const float& trans_width) {
-  if (false == valid_file_stream(fp)) {
+  if (false == valid_file_mmostream(fp)) {
     return CMD_EXEC_FATAL_ERROR;
   }
 
@@ -357,11 +357,11 @@ static int print_spice_regular_inverter_pmos_modeling(
  *   an inverter. Any preprocessing or subckt definition should not be included!
  *******************************************************************/
 static int print_spice_regular_inverter_nmos_modeling(
-  std::fstream& fp, const std::string& trans_name_postfix,
+  mmostream& fp, const std::string& trans_name_postfix,
   const std::string& input_port_name, const std::string& output_port_name,
   const TechnologyLibrary& tech_lib, const TechnologyModelId& tech_model,
   const float& trans_width) {
-  if (false == valid_file_stream(fp)) {
+  if (false == valid_file_mmostream(fp)) {
     return CMD_EXEC_FATAL_ERROR;
   }
 
@@ -402,11 +402,11 @@ static int print_spice_regular_inverter_nmos_modeling(
  *
  *******************************************************************/
 static int print_spice_regular_inverter_subckt(
-  std::fstream& fp, const ModuleManager& module_manager,
+  mmostream& fp, const ModuleManager& module_manager,
   const ModuleId& module_id, const CircuitLibrary& circuit_lib,
   const CircuitModelId& circuit_model, const TechnologyLibrary& tech_lib,
   const TechnologyModelId& tech_model) {
-  if (false == valid_file_stream(fp)) {
+  if (false == valid_file_mmostream(fp)) {
     return CMD_EXEC_FATAL_ERROR;
   }
 
@@ -500,7 +500,7 @@ static int print_spice_regular_inverter_subckt(
  * Generate the SPICE subckt for an inverter
  * Branch on the different circuit topologies
  *******************************************************************/
-int print_spice_inverter_subckt(std::fstream& fp,
+int print_spice_inverter_subckt(mmostream& fp,
                                 const ModuleManager& module_manager,
                                 const ModuleId& module_id,
                                 const CircuitLibrary& circuit_lib,
@@ -570,11 +570,11 @@ int print_spice_inverter_subckt(std::fstream& fp,
  *
  *******************************************************************/
 static int print_spice_powergated_buffer_subckt(
-  std::fstream& fp, const ModuleManager& module_manager,
+  mmostream& fp, const ModuleManager& module_manager,
   const ModuleId& module_id, const CircuitLibrary& circuit_lib,
   const CircuitModelId& circuit_model, const TechnologyLibrary& tech_lib,
   const TechnologyModelId& tech_model) {
-  if (false == valid_file_stream(fp)) {
+  if (false == valid_file_mmostream(fp)) {
     return CMD_EXEC_FATAL_ERROR;
   }
 
@@ -736,11 +736,11 @@ static int print_spice_powergated_buffer_subckt(
  *
  *******************************************************************/
 static int print_spice_regular_buffer_subckt(
-  std::fstream& fp, const ModuleManager& module_manager,
+  mmostream& fp, const ModuleManager& module_manager,
   const ModuleId& module_id, const CircuitLibrary& circuit_lib,
   const CircuitModelId& circuit_model, const TechnologyLibrary& tech_lib,
   const TechnologyModelId& tech_model) {
-  if (false == valid_file_stream(fp)) {
+  if (false == valid_file_mmostream(fp)) {
     return CMD_EXEC_FATAL_ERROR;
   }
 
@@ -870,7 +870,7 @@ static int print_spice_regular_buffer_subckt(
  * Generate the SPICE subckt for an buffer
  * which consists of multiple stage of inverters
  *******************************************************************/
-int print_spice_buffer_subckt(std::fstream& fp,
+int print_spice_buffer_subckt(mmostream& fp,
                               const ModuleManager& module_manager,
                               const ModuleId& module_id,
                               const CircuitLibrary& circuit_lib,
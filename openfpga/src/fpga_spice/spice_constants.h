@@ -4,6 +4,10 @@
 /* global parameters for dumping spice netlists */
 constexpr size_t SPICE_NETLIST_MAX_NUM_PORTS_PER_LINE = 10;
 
+/* Size of the in-memory buffer of each SPICE netlist file stream.
+ * Netlists are flushed to disk (or zlib) by large chunks */
+constexpr size_t SPICE_NETLIST_STREAM_BUFFER_SIZE = 1 << 18;
+
 constexpr const char* SPICE_NETLIST_FILE_POSTFIX = ".sp";
 
 constexpr const char* TRANSISTOR_WRAPPER_POSTFIX = "_wrapper";
@@ -11,6 +11,7 @@
 /* Headers from vtrutil library */
 #include "vtr_assert.h"
 #include "vtr_log.h"
+#include "vtr_util.h"
 
 /* Headers from openfpgashell library */
 #include "command_exit_codes.h"
@@ -35,7 +36,7 @@ namespace openfpga {
  * i.e., either VDD or GND
  ***********************************************/
 static void print_spice_supply_wrapper_subckt(
-  const ModuleManager& module_manager, std::fstream& fp,
+  const ModuleManager& module_manager, mmostream& fp,
   const size_t& const_value) {
   /* Find the module in module manager */
   std::string module_name = generate_const_value_module_name(const_value);
@@ -43,7 +44,7 @@ static void print_spice_supply_wrapper_subckt(
   VTR_ASSERT(true == module_manager.valid_module_id(const_val_module));
 
   /* Ensure a valid file handler*/
-  VTR_ASSERT(true == valid_file_stream(fp));
+  VTR_ASSERT(true == valid_file_mmostream(fp));
 
   /* dump module definition + ports */
   print_spice_subckt_definition(fp, module_manager, const_val_module);
@@ -78,24 +79,26 @@ static void print_spice_supply_wrapper_subckt(
  *
  *******************************************************************/
 int print_spice_supply_wrappers(NetlistManager& netlist_manager,
+                                SpiceWriterLog& log,
                                 const ModuleManager& module_manager,
-                                const std::string& submodule_dir) {
+                                const std::string& submodule_dir,
+                                const FabricSpiceOption& options) {
   int status = CMD_EXEC_SUCCESS;
 
   /* Create file stream */
   std::string spice_fname =
     submodule_dir + std::string(SUPPLY_WRAPPER_SPICE_FILE_NAME);
 
-  std::fstream fp;
-
   /* Create the file stream */
-  fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
+  mmostream fp(spice_fname, options.compress_output(),
+               SPICE_NETLIST_STREAM_BUFFER_SIZE);
   /* Check if the file stream if valid or not */
-  check_file_stream(spice_fname.c_str(), fp);
+  check_file_mmostream(spice_fname.c_str(), fp);
 
   /* Create file */
-  VTR_LOG("Generating SPICE netlist '%s' for voltage supply wrappers...",
-          spice_fname.c_str());
+  log.log(vtr::string_fmt(
+    "Generating SPICE netlist '%s' for voltage supply wrappers...",
+    spice_fname.c_str()));
 
   print_spice_file_header(fp, std::string("Voltage Supply Wrappers"));
 
@@ -105,14 +108,14 @@ int print_spice_supply_wrappers(NetlistManager& netlist_manager,
   print_spice_supply_wrapper_subckt(module_manager, fp, 1);
 
   /* Close file handler*/
-  fp.close();
+  close_file_mmostream(spice_fname.c_str(), fp);
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = netlist_manager.add_netlist(spice_fname);
   VTR_ASSERT(NetlistId::INVALID() != nlist_id);
   netlist_manager.set_netlist_type(nlist_id, NetlistManager::SUBMODULE_NETLIST);
 
-  VTR_LOG("Done\n");
+  log.log("Done\n");
 
   return status;
 }
@@ -125,10 +128,11 @@ int print_spice_supply_wrappers(NetlistManager& netlist_manager,
  * - logic gates
  *******************************************************************/
 int print_spice_essential_gates(
-  NetlistManager& netlist_manager, const ModuleManager& module_manager,
-  const CircuitLibrary& circuit_lib, const TechnologyLibrary& tech_lib,
+  NetlistManager& netlist_manager, SpiceWriterLog& log,
+  const ModuleManager& module_manager, const CircuitLibrary& circuit_lib,
+  const TechnologyLibrary& tech_lib,
   const std::map<CircuitModelId, TechnologyModelId>& circuit_tech_binding,
-  const std::string& submodule_dir) {
+  const std::string& submodule_dir, const FabricSpiceOption& options) {
   int status = CMD_EXEC_SUCCESS;
 
   /* Iterate over the circuit models */
@@ -157,10 +161,9 @@ int print_spice_essential_gates(
         (CIRCUIT_MODEL_GATE == circuit_lib.model_type(circuit_model))) {
       auto result = circuit_tech_binding.find(circuit_model);
       if (result == circuit_tech_binding.end()) {
-        VTR_LOGF_ERROR(
-          __FILE__, __LINE__,
+        log.log_error(vtr::string_fmt(
           "Unable to find technology binding for circuit model '%s'!\n",
-          circuit_lib.model_name(circuit_model).c_str());
+          circuit_lib.model_name(circuit_model).c_str()));
         return CMD_EXEC_FATAL_ERROR;
       }
       /* Valid technology binding. Assign techology model */
@@ -175,16 +178,16 @@ int print_spice_essential_gates(
                               circuit_lib.model_name(circuit_model) +
                               std::string(SPICE_NETLIST_FILE_POSTFIX);
 
-    std::fstream fp;
-
     /* Create the file stream */
-    fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
+    mmostream fp(spice_fname, options.compress_output(),
+                 SPICE_NETLIST_STREAM_BUFFER_SIZE);
     /* Check if the file stream if valid or not */
-    check_file_stream(spice_fname.c_str(), fp);
+    check_file_mmostream(spice_fname.c_str(), fp);
 
     /* Create file */
-    VTR_LOG("Generating SPICE netlist '%s' for circuit model '%s'...",
-            spice_fname.c_str(), circuit_lib.model_name(circuit_model).c_str());
+    log.log(vtr::string_fmt(
+      "Generating SPICE netlist '%s' for circuit model '%s'...",
+      spice_fname.c_str(), circuit_lib.model_name(circuit_model).c_str()));
 
     print_spice_file_header(fp, circuit_lib.model_name(circuit_model));
 
@@ -247,7 +250,7 @@ int print_spice_essential_gates(
 
     /* Now branch on netlist writing: for wires */
     if (CIRCUIT_MODEL_WIRE == circuit_lib.model_type(circuit_model)) {
-      status = print_spice_wire_subckt(fp, module_manager, module_id,
+      status = print_spice_wire_subckt(fp, log, module_manager, module_id,
                                        circuit_lib, circuit_model);
       netlist_filled = true;
       if (CMD_EXEC_FATAL_ERROR == status) {
@@ -259,16 +262,16 @@ int print_spice_essential_gates(
      * If not, flag a fatal error
      */
     if (false == netlist_filled) {
-      VTR_LOG_ERROR(
+      log.log_error(vtr::string_fmt(
         "Cannot auto-generate netlist for circuit model '%s'!\n\tThe circuit "
         "topology is not supported yet!\n",
-        circuit_lib.model_name(circuit_model).c_str());
+        circuit_lib.model_name(circuit_model).c_str()));
       status = CMD_EXEC_FATAL_ERROR;
       break;
     }
 
     /* Close file handler*/
-    fp.close();
+    close_file_mmostream(spice_fname.c_str(), fp);
 
     /* Add fname to the netlist name list */
     NetlistId nlist_id = netlist_manager.add_netlist(spice_fname);
@@ -276,7 +279,7 @@ int print_spice_essential_gates(
     netlist_manager.set_netlist_type(nlist_id,
                                      NetlistManager::SUBMODULE_NETLIST);
 
-    VTR_LOG("Done\n");
+    log.log("Done\n");
   }
 
   return status;
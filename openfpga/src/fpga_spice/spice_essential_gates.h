@@ -8,8 +8,10 @@
 #include <string>
 
 #include "circuit_library.h"
+#include "fabric_spice_options.h"
 #include "module_manager.h"
 #include "netlist_manager.h"
+#include "spice_writer_utils.h"
 #include "technology_library.h"
 
 /********************************************************************
@@ -20,14 +22,17 @@
 namespace openfpga {
 
 int print_spice_supply_wrappers(NetlistManager& netlist_manager,
+                                SpiceWriterLog& log,
                                 const ModuleManager& module_manager,
-                                const std::string& submodule_dir);
+                                const std::string& submodule_dir,
+                                const FabricSpiceOption& options);
 
 int print_spice_essential_gates(
-  NetlistManager& netlist_manager, const ModuleManager& module_manager,
-  const CircuitLibrary& circuit_lib, const TechnologyLibrary& tech_lib,
+  NetlistManager& netlist_manager, SpiceWriterLog& log,
+  const ModuleManager& module_manager, const CircuitLibrary& circuit_lib,
+  const TechnologyLibrary& tech_lib,
   const std::map<CircuitModelId, TechnologyModelId>& circuit_tech_binding,
-  const std::string& submodule_dir);
+  const std::string& submodule_dir, const FabricSpiceOption& options);
 
 } /* end namespace openfpga */
 
@@ -10,11 +10,15 @@
 #include "vtr_assert.h"
 #include "vtr_geometry.h"
 #include "vtr_log.h"
+#include "vtr_util.h"
 
 /* Headers from readarch library */
 #include "physical_types.h"
 #include "physical_types_util.h"
 
+/* Headers from openfpgashell library */
+#include "command_exit_codes.h"
+
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
 #include "side_manager.h"
@@ -63,8 +67,9 @@ namespace openfpga {
  *
  *******************************************************************/
 static void print_spice_primitive_block(
-  NetlistManager& netlist_manager, const ModuleManager& module_manager,
-  const std::string& subckt_dir, t_pb_graph_node* primitive_pb_graph_node,
+  NetlistManager& netlist_manager, SpiceWriterLog& log,
+  const ModuleManager& module_manager, const std::string& subckt_dir,
+  t_pb_graph_node* primitive_pb_graph_node, const FabricSpiceOption& options,
   const bool& verbose) {
   /* Ensure a valid pb_graph_node */
   if (nullptr == primitive_pb_graph_node) {
@@ -79,15 +84,16 @@ static void print_spice_primitive_block(
                             std::string(), primitive_pb_graph_node,
                             std::string(SPICE_NETLIST_FILE_POSTFIX)));
 
-  VTR_LOG("Writing SPICE netlist '%s' for primitive pb_type '%s' ...",
-          spice_fname.c_str(), primitive_pb_graph_node->pb_type->name);
-  VTR_LOGV(verbose, "\n");
+  log.log(vtr::string_fmt(
+    "Writing SPICE netlist '%s' for primitive pb_type '%s' ...",
+    spice_fname.c_str(), primitive_pb_graph_node->pb_type->name));
+  log.logv(verbose, "\n");
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
+  mmostream fp(spice_fname, options.compress_output(),
+               SPICE_NETLIST_STREAM_BUFFER_SIZE);
 
-  check_file_stream(spice_fname.c_str(), fp);
+  check_file_mmostream(spice_fname.c_str(), fp);
 
   print_spice_file_header(
     fp, std::string("SPICE subckts for primitive pb_type: " +
@@ -102,15 +108,16 @@ static void print_spice_primitive_block(
   /* Ensure that the module has been created and thus unique! */
   VTR_ASSERT(true == module_manager.valid_module_id(primitive_module));
 
-  VTR_LOGV(verbose,
-           "Writing SPICE codes of logical tile primitive block '%s'...",
-           module_manager.module_name(primitive_module).c_str());
+  log.logv(verbose,
+           vtr::string_fmt(
+             "Writing SPICE codes of logical tile primitive block '%s'...",
+             module_manager.module_name(primitive_module).c_str()));
 
   /* Write the spice module */
   write_spice_subckt_to_file(fp, module_manager, primitive_module);
 
   /* Close file handler */
-  fp.close();
+  close_file_mmostream(spice_fname.c_str(), fp);
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = netlist_manager.add_netlist(spice_fname);
@@ -118,7 +125,7 @@ static void print_spice_primitive_block(
   netlist_manager.set_netlist_type(nlist_id,
                                    NetlistManager::LOGIC_BLOCK_NETLIST);
 
-  VTR_LOGV(verbose, "Done\n");
+  log.logv(verbose, "Done\n");
 }
 
 /********************************************************************
@@ -138,9 +145,11 @@ static void print_spice_primitive_block(
  * to its parent in module manager
  *******************************************************************/
 static void rec_print_spice_logical_tile(
-  NetlistManager& netlist_manager, const ModuleManager& module_manager,
+  NetlistManager& netlist_manager, SpiceWriterLog& log,
+  const ModuleManager& module_manager,
   const VprDeviceAnnotation& device_annotation, const std::string& subckt_dir,
-  t_pb_graph_node* physical_pb_graph_node, const bool& verbose) {
+  t_pb_graph_node* physical_pb_graph_node, const FabricSpiceOption& options,
+  const bool& verbose) {
   /* Check cur_pb_graph_node*/
   if (nullptr == physical_pb_graph_node) {
     VTR_LOGF_ERROR(__FILE__, __LINE__, "Invalid physical_pb_graph_node\n");
@@ -160,10 +169,10 @@ static void rec_print_spice_logical_tile(
     for (int ipb = 0; ipb < physical_mode->num_pb_type_children; ++ipb) {
       /* Go recursive to visit the children */
       rec_print_spice_logical_tile(
-        netlist_manager, module_manager, device_annotation, subckt_dir,
+        netlist_manager, log, module_manager, device_annotation, subckt_dir,
         &(physical_pb_graph_node
             ->child_pb_graph_nodes[physical_mode->index][ipb][0]),
-        verbose);
+        options, verbose);
     }
   }
 
@@ -172,8 +181,9 @@ static void rec_print_spice_logical_tile(
    * explict port mapping. This aims to avoid any port sequence issues!!!
    */
   if (true == is_primitive_pb_type(physical_pb_type)) {
-    print_spice_primitive_block(netlist_manager, module_manager, subckt_dir,
-                                physical_pb_graph_node, verbose);
+    print_spice_primitive_block(netlist_manager, log, module_manager,
+                                subckt_dir, physical_pb_graph_node, options,
+                                verbose);
     /* Finish for primitive node, return */
     return;
   }
@@ -185,15 +195,15 @@ static void rec_print_spice_logical_tile(
                             std::string(), physical_pb_graph_node,
                             std::string(SPICE_NETLIST_FILE_POSTFIX)));
 
-  VTR_LOG("Writing SPICE netlist '%s' for pb_type '%s' ...",
-          spice_fname.c_str(), physical_pb_type->name);
-  VTR_LOGV(verbose, "\n");
+  log.log(vtr::string_fmt("Writing SPICE netlist '%s' for pb_type '%s' ...",
+                          spice_fname.c_str(), physical_pb_type->name));
+  log.logv(verbose, "\n");
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
+  mmostream fp(spice_fname, options.compress_output(),
+               SPICE_NETLIST_STREAM_BUFFER_SIZE);
 
-  check_file_stream(spice_fname.c_str(), fp);
+  check_file_mmostream(spice_fname.c_str(), fp);
 
   print_spice_file_header(fp, std::string("SPICE subckts for pb_type: " +
                                           std::string(physical_pb_type->name)));
@@ -206,8 +216,9 @@ static void rec_print_spice_logical_tile(
   ModuleId pb_module = module_manager.find_module(pb_module_name);
   VTR_ASSERT(true == module_manager.valid_module_id(pb_module));
 
-  VTR_LOGV(verbose, "Writing SPICE codes of pb_type '%s'...",
-           module_manager.module_name(pb_module).c_str());
+  log.logv(verbose,
+           vtr::string_fmt("Writing SPICE codes of pb_type '%s'...",
+                           module_manager.module_name(pb_module).c_str()));
 
   /* Comment lines */
   print_spice_comment(
@@ -222,7 +233,7 @@ static void rec_print_spice_logical_tile(
                     std::string(physical_pb_type->name)));
 
   /* Close file handler */
-  fp.close();
+  close_file_mmostream(spice_fname.c_str(), fp);
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = netlist_manager.add_netlist(spice_fname);
@@ -230,7 +241,7 @@ static void rec_print_spice_logical_tile(
   netlist_manager.set_netlist_type(nlist_id,
                                    NetlistManager::LOGIC_BLOCK_NETLIST);
 
-  VTR_LOGV(verbose, "Done\n");
+  log.logv(verbose, "Done\n");
 }
 
 /*****************************************************************************
@@ -238,12 +249,14 @@ static void rec_print_spice_logical_tile(
  * for the logical tile (pb_graph/pb_type)
  *****************************************************************************/
 static void print_spice_logical_tile_netlist(
-  NetlistManager& netlist_manager, const ModuleManager& module_manager,
+  NetlistManager& netlist_manager, SpiceWriterLog& log,
+  const ModuleManager& module_manager,
   const VprDeviceAnnotation& device_annotation, const std::string& subckt_dir,
-  t_pb_graph_node* pb_graph_head, const bool& verbose) {
-  VTR_LOG("Writing Verilog netlists for logic tile '%s' ...",
-          pb_graph_head->pb_type->name);
-  VTR_LOG("\n");
+  t_pb_graph_node* pb_graph_head, const FabricSpiceOption& options,
+  const bool& verbose) {
+  log.log(vtr::string_fmt("Writing Verilog netlists for logic tile '%s' ...",
+                          pb_graph_head->pb_type->name));
+  log.log("\n");
 
   /* Print SPICE subckts for all the pb_types/pb_graph_nodes
    * use a Depth-First Search Algorithm to print the sub-modules
@@ -253,12 +266,12 @@ static void print_spice_logical_tile_netlist(
    */
   /* Print SPICE subckts starting from the top-level pb_type/pb_graph_node, and
    * traverse the graph in a recursive way */
-  rec_print_spice_logical_tile(netlist_manager, module_manager,
+  rec_print_spice_logical_tile(netlist_manager, log, module_manager,
                                device_annotation, subckt_dir, pb_graph_head,
-                               verbose);
+                               options, verbose);
 
-  VTR_LOG("Done\n");
-  VTR_LOG("\n");
+  log.log("Done\n");
+  log.log("\n");
 }
 
 /*****************************************************************************
@@ -270,9 +283,10 @@ static void print_spice_logical_tile_netlist(
  * the I/O block locates at.
  *****************************************************************************/
 static void print_spice_physical_tile_netlist(
-  NetlistManager& netlist_manager, const ModuleManager& module_manager,
-  const std::string& subckt_dir, t_physical_tile_type_ptr phy_block_type,
-  const e_side& border_side) {
+  NetlistManager& netlist_manager, SpiceWriterLog& log,
+  const ModuleManager& module_manager, const std::string& subckt_dir,
+  t_physical_tile_type_ptr phy_block_type, const e_side& border_side,
+  const FabricSpiceOption& options) {
   /* Check code: if this is an IO block, the border side MUST be valid */
   if (phy_block_type->is_io()) {
     VTR_ASSERT(NUM_2D_SIDES != border_side);
@@ -290,19 +304,21 @@ static void print_spice_physical_tile_netlist(
   /* Echo status */
   if (phy_block_type->is_io()) {
     SideManager side_manager(border_side);
-    VTR_LOG("Writing SPICE Netlist '%s' for physical tile '%s' at %s side ...",
-            spice_fname.c_str(), phy_block_type->name.c_str(),
-            side_manager.c_str());
+    log.log(vtr::string_fmt(
+      "Writing SPICE Netlist '%s' for physical tile '%s' at %s side ...",
+      spice_fname.c_str(), phy_block_type->name.c_str(),
+      side_manager.c_str()));
   } else {
-    VTR_LOG("Writing SPICE Netlist '%s' for physical_tile '%s'...",
-            spice_fname.c_str(), phy_block_type->name.c_str());
+    log.log(
+      vtr::string_fmt("Writing SPICE Netlist '%s' for physical_tile '%s'...",
+                      spice_fname.c_str(), phy_block_type->name.c_str()));
   }
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
+  mmostream fp(spice_fname, options.compress_output(),
+               SPICE_NETLIST_STREAM_BUFFER_SIZE);
 
-  check_file_stream(spice_fname.c_str(), fp);
+  check_file_mmostream(spice_fname.c_str(), fp);
 
   print_spice_file_header(fp,
                           std::string("SPICE subckts for physical tile: " +
@@ -325,10 +341,10 @@ static void print_spice_physical_tile_netlist(
                                       module_manager.module_name(grid_module)));
 
   /* Add an empty line as a splitter */
-  fp << std::endl;
+  fp << "\n";
 
   /* Close file handler */
-  fp.close();
+  close_file_mmostream(spice_fname.c_str(), fp);
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = netlist_manager.add_netlist(spice_fname);
@@ -336,7 +352,7 @@ static void print_spice_physical_tile_netlist(
   netlist_manager.set_netlist_type(nlist_id,
                                    NetlistManager::LOGIC_BLOCK_NETLIST);
 
-  VTR_LOG("Done\n");
+  log.log("Done\n");
 }
 
 /*****************************************************************************
@@ -344,15 +360,17 @@ static void print_spice_physical_tile_netlist(
  * 1. Only one module for each I/O on each border side (IO_TYPE)
  * 2. Only one module for each CLB (FILL_TYPE)
  * 3. Only one module for each heterogeneous block
+ *
+ * Each logical tile and each physical tile is outputted to its own netlists,
+ * so that they can be written concurrently
  ****************************************************************************/
 void print_spice_grids(NetlistManager& netlist_manager,
                        const ModuleManager& module_manager,
                        const DeviceContext& device_ctx,
                        const VprDeviceAnnotation& device_annotation,
-                       const std::string& subckt_dir, const bool& verbose) {
-  /* Create a vector to contain all the Verilog netlist names that have been
-   * generated in this function */
-  std::vector<std::string> netlist_names;
+                       const std::string& subckt_dir,
+                       const FabricSpiceOption& options) {
+  bool verbose = options.verbose_output();
 
   /* Enumerate the types of logical tiles, and build a module for each
    * Write modules for all the pb_types/pb_graph_nodes
@@ -363,16 +381,25 @@ void print_spice_grids(NetlistManager& netlist_manager,
    */
   VTR_LOG("Writing logical tiles...");
   VTR_LOGV(verbose, "\n");
+  std::vector<SpiceNetlistWriterTask> logical_tile_writer_tasks;
   for (const t_logical_block_type& logical_tile :
        device_ctx.logical_block_types) {
     /* Bypass empty pb_graph */
     if (nullptr == logical_tile.pb_graph_head) {
       continue;
     }
-    print_spice_logical_tile_netlist(netlist_manager, module_manager,
-                                     device_annotation, subckt_dir,
-                                     logical_tile.pb_graph_head, verbose);
+    t_pb_graph_node* pb_graph_head = logical_tile.pb_graph_head;
+    logical_tile_writer_tasks.push_back(
+      [&, pb_graph_head](NetlistManager& task_netlist_manager,
+                         SpiceWriterLog& task_log) {
+        print_spice_logical_tile_netlist(
+          task_netlist_manager, task_log, module_manager, device_annotation,
+          subckt_dir, pb_graph_head, options, verbose);
+        return CMD_EXEC_SUCCESS;
+      });
   }
+  print_spice_netlists_by_tasks(netlist_manager, logical_tile_writer_tasks,
+                                options.num_threads());
   VTR_LOG("Writing logical tiles...");
   VTR_LOG("Done\n");
 
@@ -383,8 +410,10 @@ void print_spice_grids(NetlistManager& netlist_manager,
    */
   VTR_LOG("Building physical tiles...");
   VTR_LOGV(verbose, "\n");
+  std::vector<SpiceNetlistWriterTask> physical_tile_writer_tasks;
   for (const t_physical_tile_type& physical_tile :
        device_ctx.physical_tile_types) {
+    t_physical_tile_type_ptr phy_block_type = &physical_tile;
     /* Bypass empty type or nullptr */
     if (physical_tile.is_empty()) {
       continue;
@@ -401,32 +430,33 @@ void print_spice_grids(NetlistManager& netlist_manager,
       std::set<e_side> io_type_sides =
         find_physical_io_tile_located_sides(device_ctx.grid, &physical_tile);
       for (const e_side& io_type_side : io_type_sides) {
-        print_spice_physical_tile_netlist(netlist_manager, module_manager,
-                                          subckt_dir, &physical_tile,
-                                          io_type_side);
+        physical_tile_writer_tasks.push_back(
+          [&, phy_block_type, io_type_side](
+            NetlistManager& task_netlist_manager, SpiceWriterLog& task_log) {
+            print_spice_physical_tile_netlist(
+              task_netlist_manager, task_log, module_manager, subckt_dir,
+              phy_block_type, io_type_side, options);
+            return CMD_EXEC_SUCCESS;
+          });
       }
       continue;
     } else {
       /* For CLB and heterogenenous blocks */
-      print_spice_physical_tile_netlist(netlist_manager, module_manager,
-                                        subckt_dir, &physical_tile,
-                                        NUM_2D_SIDES);
+      physical_tile_writer_tasks.push_back(
+        [&, phy_block_type](NetlistManager& task_netlist_manager,
+                            SpiceWriterLog& task_log) {
+          print_spice_physical_tile_netlist(
+            task_netlist_manager, task_log, module_manager, subckt_dir,
+            phy_block_type, NUM_2D_SIDES, options);
+          return CMD_EXEC_SUCCESS;
+        });
     }
   }
+  print_spice_netlists_by_tasks(netlist_manager, physical_tile_writer_tasks,
+                                options.num_threads());
   VTR_LOG("Building physical tiles...");
   VTR_LOG("Done\n");
   VTR_LOG("\n");
-
-  /* Output a header file for all the logic blocks */
-  /*
-  std::string grid_spice_fname(LOGIC_BLOCK_VERILOG_FILE_NAME);
-  VTR_LOG("Writing header file for grid SPICE subckts '%s' ...",
-          grid_spice_fname.c_str());
-  print_spice_netlist_include_header_file(netlist_names,
-                                          subckt_dir.c_str(),
-                                          grid_spice_fname.c_str());
-  VTR_LOG("Done\n");
-   */
 }
 
 } /* end namespace openfpga */
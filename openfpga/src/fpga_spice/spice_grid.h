@@ -6,6 +6,7 @@
  *******************************************************************/
 #include <string>
 
+#include "fabric_spice_options.h"
 #include "module_manager.h"
 #include "netlist_manager.h"
 #include "vpr_context.h"
@@ -22,7 +23,8 @@ void print_spice_grids(NetlistManager& netlist_manager,
                        const ModuleManager& module_manager,
                        const DeviceContext& device_ctx,
                        const VprDeviceAnnotation& device_annotation,
-                       const std::string& subckt_dir, const bool& verbose);
+                       const std::string& subckt_dir,
+                       const FabricSpiceOption& options);
 
 } /* end namespace openfpga */
 
@@ -55,14 +55,14 @@ namespace openfpga {
  *                 |
  *                GND
  *******************************************************************/
-int print_spice_and_gate_subckt(std::fstream& fp,
+int print_spice_and_gate_subckt(mmostream& fp,
                                 const ModuleManager& module_manager,
                                 const ModuleId& module_id,
                                 const CircuitLibrary& circuit_lib,
                                 const CircuitModelId& circuit_model,
                                 const TechnologyLibrary& tech_lib,
                                 const TechnologyModelId& tech_model) {
-  if (false == valid_file_stream(fp)) {
+  if (false == valid_file_mmostream(fp)) {
     return CMD_EXEC_FATAL_ERROR;
   }
 
@@ -217,14 +217,14 @@ int print_spice_and_gate_subckt(std::fstream& fp,
  *            |          |                   |
  *           GND        GND                 GND
  *******************************************************************/
-int print_spice_or_gate_subckt(std::fstream& fp,
+int print_spice_or_gate_subckt(mmostream& fp,
                                const ModuleManager& module_manager,
                                const ModuleId& module_id,
                                const CircuitLibrary& circuit_lib,
                                const CircuitModelId& circuit_model,
                                const TechnologyLibrary& tech_lib,
                                const TechnologyModelId& tech_model) {
-  if (false == valid_file_stream(fp)) {
+  if (false == valid_file_mmostream(fp)) {
     return CMD_EXEC_FATAL_ERROR;
   }
 
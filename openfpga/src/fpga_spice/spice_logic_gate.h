@@ -9,6 +9,7 @@
 
 #include "circuit_library.h"
 #include "module_manager.h"
+#include "openfpga_mmfstream.h"
 #include "technology_library.h"
 
 /********************************************************************
@@ -18,7 +19,7 @@
 /* begin namespace openfpga */
 namespace openfpga {
 
-int print_spice_and_gate_subckt(std::fstream& fp,
+int print_spice_and_gate_subckt(mmostream& fp,
                                 const ModuleManager& module_manager,
                                 const ModuleId& module_id,
                                 const CircuitLibrary& circuit_lib,
@@ -26,7 +27,7 @@ int print_spice_and_gate_subckt(std::fstream& fp,
                                 const TechnologyLibrary& tech_lib,
                                 const TechnologyModelId& tech_model);
 
-int print_spice_or_gate_subckt(std::fstream& fp,
+int print_spice_or_gate_subckt(mmostream& fp,
                                const ModuleManager& module_manager,
                                const ModuleId& module_id,
                                const CircuitLibrary& circuit_lib,
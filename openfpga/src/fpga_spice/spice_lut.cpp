@@ -7,6 +7,7 @@
 /* Headers from vtrutil library */
 #include "vtr_assert.h"
 #include "vtr_log.h"
+#include "vtr_util.h"
 
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
@@ -30,22 +31,24 @@ namespace openfpga {
  * in the circuit library
  ********************************************************************/
 int print_spice_submodule_luts(NetlistManager& netlist_manager,
+                               SpiceWriterLog& log,
                                const ModuleManager& module_manager,
                                const CircuitLibrary& circuit_lib,
-                               const std::string& submodule_dir) {
+                               const std::string& submodule_dir,
+                               const FabricSpiceOption& options) {
   int status = CMD_EXEC_SUCCESS;
 
   std::string spice_fname = submodule_dir + std::string(LUTS_SPICE_FILE_NAME);
 
-  std::fstream fp;
-
   /* Create the file stream */
-  fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
+  mmostream fp(spice_fname, options.compress_output(),
+               SPICE_NETLIST_STREAM_BUFFER_SIZE);
   /* Check if the file stream if valid or not */
-  check_file_stream(spice_fname.c_str(), fp);
+  check_file_mmostream(spice_fname.c_str(), fp);
 
   /* Create file */
-  VTR_LOG("Writing SPICE netlist for LUTs '%s'...", spice_fname.c_str());
+  log.log(vtr::string_fmt("Writing SPICE netlist for LUTs '%s'...",
+                          spice_fname.c_str()));
 
   print_spice_file_header(fp, "Look-Up Tables");
 
@@ -64,14 +67,14 @@ int print_spice_submodule_luts(NetlistManager& netlist_manager,
   }
 
   /* Close the file handler */
-  fp.close();
+  close_file_mmostream(spice_fname.c_str(), fp);
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = netlist_manager.add_netlist(spice_fname);
   VTR_ASSERT(NetlistId::INVALID() != nlist_id);
   netlist_manager.set_netlist_type(nlist_id, NetlistManager::SUBMODULE_NETLIST);
 
-  VTR_LOG("Done\n");
+  log.log("Done\n");
 
   return status;
 }
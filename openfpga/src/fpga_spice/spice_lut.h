@@ -8,8 +8,10 @@
 #include <string>
 
 #include "circuit_library.h"
+#include "fabric_spice_options.h"
 #include "module_manager.h"
 #include "netlist_manager.h"
+#include "spice_writer_utils.h"
 
 /********************************************************************
  * Function declaration
@@ -19,9 +21,11 @@
 namespace openfpga {
 
 int print_spice_submodule_luts(NetlistManager& netlist_manager,
+                               SpiceWriterLog& log,
                                const ModuleManager& module_manager,
                                const CircuitLibrary& circuit_lib,
-                               const std::string& submodule_dir);
+                               const std::string& submodule_dir,
+                               const FabricSpiceOption& options);
 
 } /* end namespace openfpga */
 
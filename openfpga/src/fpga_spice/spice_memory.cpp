@@ -9,6 +9,7 @@
 /* Headers from vtrutil library */
 #include "vtr_assert.h"
 #include "vtr_log.h"
+#include "vtr_util.h"
 
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
@@ -43,7 +44,7 @@ namespace openfpga {
  ********************************************************************/
 static void print_spice_mux_memory_module(const ModuleManager& module_manager,
                                           const CircuitLibrary& circuit_lib,
-                                          std::fstream& fp,
+                                          mmostream& fp,
                                           const CircuitModelId& mux_model,
                                           const MuxGraph& mux_graph) {
   /* Multiplexers built with different technology is in different organization
@@ -62,7 +63,7 @@ static void print_spice_mux_memory_module(const ModuleManager& module_manager,
       write_spice_subckt_to_file(fp, module_manager, mem_module);
 
       /* Add an empty line as a splitter */
-      fp << std::endl;
+      fp << "\n";
       break;
     }
     case CIRCUIT_MODEL_DESIGN_RRAM:
@@ -96,10 +97,12 @@ static void print_spice_mux_memory_module(const ModuleManager& module_manager,
  * memory-bank organization for the memories.
  ********************************************************************/
 int print_spice_submodule_memories(NetlistManager& netlist_manager,
+                                   SpiceWriterLog& log,
                                    const ModuleManager& module_manager,
                                    const MuxLibrary& mux_lib,
                                    const CircuitLibrary& circuit_lib,
-                                   const std::string& submodule_dir) {
+                                   const std::string& submodule_dir,
+                                   const FabricSpiceOption& options) {
   int status = CMD_EXEC_SUCCESS;
 
   /* Plug in with the mux subckt */
@@ -107,14 +110,15 @@ int print_spice_submodule_memories(NetlistManager& netlist_manager,
                           std::string(MEMORIES_SPICE_FILE_NAME));
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
+  mmostream fp(spice_fname, options.compress_output(),
+               SPICE_NETLIST_STREAM_BUFFER_SIZE);
 
-  check_file_stream(spice_fname.c_str(), fp);
+  check_file_mmostream(spice_fname.c_str(), fp);
 
   /* Print out debugging information for if the file is not opened/created
    * properly */
-  VTR_LOG("Writing SPICE netlist for memories '%s' ...", spice_fname.c_str());
+  log.log(vtr::string_fmt("Writing SPICE netlist for memories '%s' ...",
+                          spice_fname.c_str()));
 
   print_spice_file_header(fp, "Memories used in FPGA");
 
@@ -181,18 +185,18 @@ int print_spice_submodule_memories(NetlistManager& netlist_manager,
     write_spice_subckt_to_file(fp, module_manager, mem_module);
 
     /* Add an empty line as a splitter */
-    fp << std::endl;
+    fp << "\n";
   }
 
   /* Close the file stream */
-  fp.close();
+  close_file_mmostream(spice_fname.c_str(), fp);
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = netlist_manager.add_netlist(spice_fname);
   VTR_ASSERT(NetlistId::INVALID() != nlist_id);
   netlist_manager.set_netlist_type(nlist_id, NetlistManager::SUBMODULE_NETLIST);
 
-  VTR_LOG("Done\n");
+  log.log("Done\n");
 
   return status;
 }
@@ -7,10 +7,12 @@
 #include <fstream>
 
 #include "circuit_library.h"
+#include "fabric_spice_options.h"
 #include "module_manager.h"
 #include "mux_graph.h"
 #include "mux_library.h"
 #include "netlist_manager.h"
+#include "spice_writer_utils.h"
 
 /********************************************************************
  * Function declaration
@@ -20,10 +22,12 @@
 namespace openfpga {
 
 int print_spice_submodule_memories(NetlistManager& netlist_manager,
+                                   SpiceWriterLog& log,
                                    const ModuleManager& module_manager,
                                    const MuxLibrary& mux_lib,
                                    const CircuitLibrary& circuit_lib,
-                                   const std::string& submodule_dir);
+                                   const std::string& submodule_dir,
+                                   const FabricSpiceOption& options);
 
 } /* end namespace openfpga */
 
@@ -12,6 +12,7 @@
 /* Headers from vtrutil library */
 #include "vtr_assert.h"
 #include "vtr_log.h"
+#include "vtr_util.h"
 
 /* Headers from readarch library */
 #include "physical_types.h"
@@ -44,7 +45,7 @@ namespace openfpga {
  **********************************************/
 static void generate_spice_mux_branch_subckt(
   const ModuleManager& module_manager, const CircuitLibrary& circuit_lib,
-  std::fstream& fp, const CircuitModelId& mux_model, const MuxGraph& mux_graph,
+  mmostream& fp, const CircuitModelId& mux_model, const MuxGraph& mux_graph,
   std::map<std::string, bool>& branch_mux_module_is_outputted) {
   std::string module_name = generate_mux_branch_subckt_name(
     circuit_lib, mux_model, mux_graph.num_inputs(), mux_graph.num_memory_bits(),
@@ -75,7 +76,7 @@ static void generate_spice_mux_branch_subckt(
       VTR_ASSERT(true == module_manager.valid_module_id(mux_module));
       write_spice_subckt_to_file(fp, module_manager, mux_module);
       /* Add an empty line as a splitter */
-      fp << std::endl;
+      fp << "\n";
       break;
     }
     case CIRCUIT_MODEL_DESIGN_RRAM:
@@ -102,7 +103,7 @@ static void generate_spice_mux_branch_subckt(
  **********************************************/
 static void generate_spice_mux_subckt(const ModuleManager& module_manager,
                                       const CircuitLibrary& circuit_lib,
-                                      std::fstream& fp,
+                                      mmostream& fp,
                                       const CircuitModelId& mux_model,
                                       const MuxGraph& mux_graph) {
   std::string module_name =
@@ -120,7 +121,7 @@ static void generate_spice_mux_subckt(const ModuleManager& module_manager,
       VTR_ASSERT(true == module_manager.valid_module_id(mux_module));
       write_spice_subckt_to_file(fp, module_manager, mux_module);
       /* Add an empty line as a splitter */
-      fp << std::endl;
+      fp << "\n";
       break;
     }
     case CIRCUIT_MODEL_DESIGN_RRAM:
@@ -143,24 +144,26 @@ static void generate_spice_mux_subckt(const ModuleManager& module_manager,
  * multiplexers in the FPGA device
  **********************************************/
 static int print_spice_submodule_mux_primitives(
-  NetlistManager& netlist_manager, const ModuleManager& module_manager,
-  const MuxLibrary& mux_lib, const CircuitLibrary& circuit_lib,
-  const std::string& submodule_dir) {
+  NetlistManager& netlist_manager, SpiceWriterLog& log,
+  const ModuleManager& module_manager, const MuxLibrary& mux_lib,
+  const CircuitLibrary& circuit_lib, const std::string& submodule_dir,
+  const FabricSpiceOption& options) {
   int status = CMD_EXEC_SUCCESS;
 
   std::string spice_fname(submodule_dir +
                           std::string(MUX_PRIMITIVES_SPICE_FILE_NAME));
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
+  mmostream fp(spice_fname, options.compress_output(),
+               SPICE_NETLIST_STREAM_BUFFER_SIZE);
 
-  check_file_stream(spice_fname.c_str(), fp);
+  check_file_mmostream(spice_fname.c_str(), fp);
 
   /* Print out debugging information for if the file is not opened/created
    * properly */
-  VTR_LOG("Writing SPICE netlist for Multiplexer primitives '%s' ...",
-          spice_fname.c_str());
+  log.log(
+    vtr::string_fmt("Writing SPICE netlist for Multiplexer primitives '%s' ...",
+                    spice_fname.c_str()));
 
   print_spice_file_header(fp, "Multiplexer primitives");
 
@@ -187,14 +190,14 @@ static int print_spice_submodule_mux_primitives(
   }
 
   /* Close the file stream */
-  fp.close();
+  close_file_mmostream(spice_fname.c_str(), fp);
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = netlist_manager.add_netlist(spice_fname);
   VTR_ASSERT(NetlistId::INVALID() != nlist_id);
   netlist_manager.set_netlist_type(nlist_id, NetlistManager::SUBMODULE_NETLIST);
 
-  VTR_LOG("Done\n");
+  log.log("Done\n");
 
   return status;
 }
@@ -204,23 +207,24 @@ static int print_spice_submodule_mux_primitives(
  * multiplexers in the FPGA device
  **********************************************/
 static int print_spice_submodule_mux_top_subckt(
-  NetlistManager& netlist_manager, const ModuleManager& module_manager,
-  const MuxLibrary& mux_lib, const CircuitLibrary& circuit_lib,
-  const std::string& submodule_dir) {
+  NetlistManager& netlist_manager, SpiceWriterLog& log,
+  const ModuleManager& module_manager, const MuxLibrary& mux_lib,
+  const CircuitLibrary& circuit_lib, const std::string& submodule_dir,
+  const FabricSpiceOption& options) {
   int status = CMD_EXEC_SUCCESS;
 
   std::string spice_fname(submodule_dir + std::string(MUXES_SPICE_FILE_NAME));
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
+  mmostream fp(spice_fname, options.compress_output(),
+               SPICE_NETLIST_STREAM_BUFFER_SIZE);
 
-  check_file_stream(spice_fname.c_str(), fp);
+  check_file_mmostream(spice_fname.c_str(), fp);
 
   /* Print out debugging information for if the file is not opened/created
    * properly */
-  VTR_LOG("Writing SPICE netlist for Multiplexers '%s' ...",
-          spice_fname.c_str());
+  log.log(vtr::string_fmt("Writing SPICE netlist for Multiplexers '%s' ...",
+                          spice_fname.c_str()));
 
   print_spice_file_header(fp, "Multiplexers");
 
@@ -234,14 +238,14 @@ static int print_spice_submodule_mux_top_subckt(
   }
 
   /* Close the file stream */
-  fp.close();
+  close_file_mmostream(spice_fname.c_str(), fp);
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = netlist_manager.add_netlist(spice_fname);
   VTR_ASSERT(NetlistId::INVALID() != nlist_id);
   netlist_manager.set_netlist_type(nlist_id, NetlistManager::SUBMODULE_NETLIST);
 
-  VTR_LOG("Done\n");
+  log.log("Done\n");
 
   return status;
 }
@@ -256,21 +260,25 @@ static int print_spice_submodule_mux_top_subckt(
  *   module for routing multiplexers
  **********************************************/
 int print_spice_submodule_muxes(NetlistManager& netlist_manager,
+                                SpiceWriterLog& log,
                                 const ModuleManager& module_manager,
                                 const MuxLibrary& mux_lib,
                                 const CircuitLibrary& circuit_lib,
-                                const std::string& submodule_dir) {
+                                const std::string& submodule_dir,
+                                const FabricSpiceOption& options) {
   int status = CMD_EXEC_SUCCESS;
 
   status = print_spice_submodule_mux_primitives(
-    netlist_manager, module_manager, mux_lib, circuit_lib, submodule_dir);
+    netlist_manager, log, module_manager, mux_lib, circuit_lib, submodule_dir,
+    options);
 
   if (CMD_EXEC_FATAL_ERROR == status) {
     return status;
   }
 
   status = print_spice_submodule_mux_top_subckt(
-    netlist_manager, module_manager, mux_lib, circuit_lib, submodule_dir);
+    netlist_manager, log, module_manager, mux_lib, circuit_lib, submodule_dir,
+    options);
 
   if (CMD_EXEC_FATAL_ERROR == status) {
     return status;
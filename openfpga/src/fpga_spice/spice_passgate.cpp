@@ -37,11 +37,11 @@ namespace openfpga {
  *
  *******************************************************************/
 static int print_spice_pass_transistor_subckt(
-  std::fstream& fp, const ModuleManager& module_manager,
+  mmostream& fp, const ModuleManager& module_manager,
   const ModuleId& module_id, const CircuitLibrary& circuit_lib,
   const CircuitModelId& circuit_model, const TechnologyLibrary& tech_lib,
   const TechnologyModelId& tech_model) {
-  if (false == valid_file_stream(fp)) {
+  if (false == valid_file_mmostream(fp)) {
     return CMD_EXEC_FATAL_ERROR;
   }
 
@@ -124,11 +124,11 @@ static int print_spice_pass_transistor_subckt(
  *
  *******************************************************************/
 static int print_spice_transmission_gate_subckt(
-  std::fstream& fp, const ModuleManager& module_manager,
+  mmostream& fp, const ModuleManager& module_manager,
   const ModuleId& module_id, const CircuitLibrary& circuit_lib,
   const CircuitModelId& circuit_model, const TechnologyLibrary& tech_lib,
   const TechnologyModelId& tech_model) {
-  if (false == valid_file_stream(fp)) {
+  if (false == valid_file_mmostream(fp)) {
     return CMD_EXEC_FATAL_ERROR;
   }
 
@@ -229,7 +229,7 @@ static int print_spice_transmission_gate_subckt(
  * - This function supports both pass-transistor
  *   and transmission gates
  *******************************************************************/
-int print_spice_passgate_subckt(std::fstream& fp,
+int print_spice_passgate_subckt(mmostream& fp,
                                 const ModuleManager& module_manager,
                                 const ModuleId& module_id,
                                 const CircuitLibrary& circuit_lib,
@@ -9,6 +9,7 @@
 
 #include "circuit_library.h"
 #include "module_manager.h"
+#include "openfpga_mmfstream.h"
 #include "technology_library.h"
 
 /********************************************************************
@@ -18,7 +19,7 @@
 /* begin namespace openfpga */
 namespace openfpga {
 
-int print_spice_passgate_subckt(std::fstream& fp,
+int print_spice_passgate_subckt(mmostream& fp,
                                 const ModuleManager& module_manager,
                                 const ModuleId& module_id,
                                 const CircuitLibrary& circuit_lib,
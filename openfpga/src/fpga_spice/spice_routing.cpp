@@ -7,6 +7,9 @@
 #include "vtr_log.h"
 #include "vtr_time.h"
 
+/* Headers from openfpgashell library */
+#include "command_exit_codes.h"
+
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
 
@@ -77,8 +80,8 @@ namespace openfpga {
  ********************************************************************/
 static void print_spice_routing_connection_box_unique_module(
   NetlistManager& netlist_manager, const ModuleManager& module_manager,
-  const std::string& subckt_dir, const RRGSB& rr_gsb,
-  const e_rr_type& cb_type) {
+  const std::string& subckt_dir, const RRGSB& rr_gsb, const e_rr_type& cb_type,
+  const FabricSpiceOption& options) {
   /* Create the netlist */
   vtr::Point<size_t> gsb_coordinate(rr_gsb.get_cb_x(cb_type),
                                     rr_gsb.get_cb_y(cb_type));
@@ -88,10 +91,10 @@ static void print_spice_routing_connection_box_unique_module(
       cb_type, gsb_coordinate, std::string(SPICE_NETLIST_FILE_POSTFIX)));
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
+  mmostream fp(spice_fname, options.compress_output(),
+               SPICE_NETLIST_STREAM_BUFFER_SIZE);
 
-  check_file_stream(spice_fname.c_str(), fp);
+  check_file_mmostream(spice_fname.c_str(), fp);
 
   print_spice_file_header(
     fp, std::string("SPICE modules for Unique Connection Blocks[" +
@@ -100,18 +103,20 @@ static void print_spice_routing_connection_box_unique_module(
 
   /* Create a Verilog Module based on the circuit model, and add to module
    * manager */
-  ModuleId cb_module = module_manager.find_module(
-    generate_connection_block_module_name(cb_type, gsb_coordinate));
+  std::string cb_module_name =
+    generate_connection_block_module_name(cb_type, gsb_coordinate);
+  ModuleId cb_module = module_manager.find_module(cb_module_name);
   VTR_ASSERT(true == module_manager.valid_module_id(cb_module));
 
-  /* Write the spice module */
-  write_spice_subckt_to_file(fp, module_manager, cb_module);
+  /* Write the spice module under the name of the routing block, which can
+   * be an alias of a module body shared in a flyweight build */
+  write_spice_subckt_to_file(fp, module_manager, cb_module, cb_module_name);
 
   /* Add an empty line as a splitter */
-  fp << std::endl;
+  fp << "\n";
 
   /* Close file handler */
-  fp.close();
+  close_file_mmostream(spice_fname.c_str(), fp);
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = netlist_manager.add_netlist(spice_fname);
@@ -182,7 +187,8 @@ static void print_spice_routing_connection_box_unique_module(
  ********************************************************************/
 static void print_spice_routing_switch_box_unique_module(
   NetlistManager& netlist_manager, const ModuleManager& module_manager,
-  const std::string& subckt_dir, const RRGSB& rr_gsb) {
+  const std::string& subckt_dir, const RRGSB& rr_gsb,
+  const FabricSpiceOption& options) {
   /* Create the netlist */
   vtr::Point<size_t> gsb_coordinate(rr_gsb.get_sb_x(), rr_gsb.get_sb_y());
   std::string spice_fname(subckt_dir +
@@ -191,10 +197,10 @@ static void print_spice_routing_switch_box_unique_module(
                             std::string(SPICE_NETLIST_FILE_POSTFIX)));
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
+  mmostream fp(spice_fname, options.compress_output(),
+               SPICE_NETLIST_STREAM_BUFFER_SIZE);
 
-  check_file_stream(spice_fname.c_str(), fp);
+  check_file_mmostream(spice_fname.c_str(), fp);
 
   print_spice_file_header(
     fp, std::string("SPICE subcircuits for Unique Switch Blocks[" +
@@ -203,15 +209,17 @@ static void print_spice_routing_switch_box_unique_module(
 
   /* Create a Verilog Module based on the circuit model, and add to module
    * manager */
-  ModuleId sb_module = module_manager.find_module(
-    generate_switch_block_module_name(gsb_coordinate));
+  std::string sb_module_name =
+    generate_switch_block_module_name(gsb_coordinate);
+  ModuleId sb_module = module_manager.find_module(sb_module_name);
   VTR_ASSERT(true == module_manager.valid_module_id(sb_module));
 
-  /* Write the spice module */
-  write_spice_subckt_to_file(fp, module_manager, sb_module);
+  /* Write the spice module under the name of the routing block, which can
+   * be an alias of a module body shared in a flyweight build */
+  write_spice_subckt_to_file(fp, module_manager, sb_module, sb_module_name);
 
   /* Close file handler */
-  fp.close();
+  close_file_mmostream(spice_fname.c_str(), fp);
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = netlist_manager.add_netlist(spice_fname);
@@ -222,12 +230,13 @@ static void print_spice_routing_switch_box_unique_module(
 
 /********************************************************************
  * Iterate over all the connection blocks in a device
- * and build a module for each of them
+ * and create a writer task for each of them
  *******************************************************************/
-static void print_spice_flatten_connection_block_modules(
-  NetlistManager& netlist_manager, const ModuleManager& module_manager,
-  const DeviceRRGSB& device_rr_gsb, const std::string& subckt_dir,
-  const e_rr_type& cb_type) {
+static void add_spice_flatten_connection_block_writer_tasks(
+  std::vector<SpiceNetlistWriterTask>& writer_tasks,
+  const ModuleManager& module_manager, const DeviceRRGSB& device_rr_gsb,
+  const std::string& subckt_dir, const e_rr_type& cb_type,
+  const FabricSpiceOption& options) {
   /* Build unique X-direction connection block modules */
   vtr::Point<size_t> cb_range = device_rr_gsb.get_gsb_range();
 
@@ -237,12 +246,17 @@ static void print_spice_flatten_connection_block_modules(
        * Some of them do NOT exist due to heterogeneous blocks (height > 1)
        * We will skip those modules
        */
-      const RRGSB& rr_gsb = device_rr_gsb.get_gsb(ix, iy);
-      if (true != rr_gsb.is_cb_exist(cb_type)) {
+      if (true != device_rr_gsb.get_gsb(ix, iy).is_cb_exist(cb_type)) {
         continue;
       }
-      print_spice_routing_connection_box_unique_module(
-        netlist_manager, module_manager, subckt_dir, rr_gsb, cb_type);
+      writer_tasks.push_back(
+        [&, ix, iy, cb_type](NetlistManager& task_netlist_manager,
+                             SpiceWriterLog&) {
+          print_spice_routing_connection_box_unique_module(
+            task_netlist_manager, module_manager, subckt_dir,
+            device_rr_gsb.get_gsb(ix, iy), cb_type, options);
+          return CMD_EXEC_SUCCESS;
+        });
     }
   }
 }
@@ -255,46 +269,45 @@ static void print_spice_flatten_connection_block_modules(
  * Covering:
  * 1. Connection blocks
  * 2. Switch blocks
+ *
+ * Each module is outputted to a dedicated netlist, so that
+ * the netlists can be written concurrently
  *******************************************************************/
 void print_spice_flatten_routing_modules(NetlistManager& netlist_manager,
                                          const ModuleManager& module_manager,
                                          const DeviceRRGSB& device_rr_gsb,
-                                         const std::string& subckt_dir) {
-  /* Create a vector to contain all the Verilog netlist names that have been
-   * generated in this function */
-  std::vector<std::string> netlist_names;
+                                         const std::string& subckt_dir,
+                                         const FabricSpiceOption& options) {
+  std::vector<SpiceNetlistWriterTask> writer_tasks;
 
   vtr::Point<size_t> sb_range = device_rr_gsb.get_gsb_range();
 
   /* Build unique switch block modules */
   for (size_t ix = 0; ix < sb_range.x(); ++ix) {
     for (size_t iy = 0; iy < sb_range.y(); ++iy) {
-      const RRGSB& rr_gsb = device_rr_gsb.get_gsb(ix, iy);
       if (true != device_rr_gsb.is_sb_exist(ix, iy)) {
         continue;
       }
-      print_spice_routing_switch_box_unique_module(
-        netlist_manager, module_manager, subckt_dir, rr_gsb);
+      writer_tasks.push_back(
+        [&, ix, iy](NetlistManager& task_netlist_manager, SpiceWriterLog&) {
+          print_spice_routing_switch_box_unique_module(
+            task_netlist_manager, module_manager, subckt_dir,
+            device_rr_gsb.get_gsb(ix, iy), options);
+          return CMD_EXEC_SUCCESS;
+        });
     }
   }
 
-  print_spice_flatten_connection_block_modules(netlist_manager, module_manager,
-                                               device_rr_gsb, subckt_dir,
-                                               e_rr_type::CHANX);
-
-  print_spice_flatten_connection_block_modules(netlist_manager, module_manager,
-                                               device_rr_gsb, subckt_dir,
-                                               e_rr_type::CHANY);
-
-  /*
-  VTR_LOG("Writing header file for routing submodules '%s'...",
-          ROUTING_VERILOG_FILE_NAME);
-  print_spice_netlist_include_header_file(netlist_names,
-                                          subckt_dir.c_str(),
-                                          ROUTING_VERILOG_FILE_NAME);
-  VTR_LOG("Done\n");
-  VTR_LOG("\n");
-   */
+  add_spice_flatten_connection_block_writer_tasks(
+    writer_tasks, module_manager, device_rr_gsb, subckt_dir, e_rr_type::CHANX,
+    options);
+
+  add_spice_flatten_connection_block_writer_tasks(
+    writer_tasks, module_manager, device_rr_gsb, subckt_dir, e_rr_type::CHANY,
+    options);
+
+  print_spice_netlists_by_tasks(netlist_manager, writer_tasks,
+                                options.num_threads());
 }
 
 /********************************************************************
@@ -310,48 +323,40 @@ void print_spice_flatten_routing_modules(NetlistManager& netlist_manager,
 void print_spice_unique_routing_modules(NetlistManager& netlist_manager,
                                         const ModuleManager& module_manager,
                                         const DeviceRRGSB& device_rr_gsb,
-                                        const std::string& subckt_dir) {
-  /* Create a vector to contain all the Verilog netlist names that have been
-   * generated in this function */
-  std::vector<std::string> netlist_names;
+                                        const std::string& subckt_dir,
+                                        const FabricSpiceOption& options) {
+  std::vector<SpiceNetlistWriterTask> writer_tasks;
 
   /* Build unique switch block modules */
   for (size_t isb = 0; isb < device_rr_gsb.get_num_sb_unique_module(); ++isb) {
-    const RRGSB& unique_mirror = device_rr_gsb.get_sb_unique_module(isb);
-    print_spice_routing_switch_box_unique_module(
-      netlist_manager, module_manager, subckt_dir, unique_mirror);
+    writer_tasks.push_back(
+      [&, isb](NetlistManager& task_netlist_manager, SpiceWriterLog&) {
+        print_spice_routing_switch_box_unique_module(
+          task_netlist_manager, module_manager, subckt_dir,
+          device_rr_gsb.get_sb_unique_module(isb), options);
+        return CMD_EXEC_SUCCESS;
+      });
   }
 
-  /* Build unique X-direction connection block modules */
-  for (size_t icb = 0;
-       icb < device_rr_gsb.get_num_cb_unique_module(e_rr_type::CHANX); ++icb) {
-    const RRGSB& unique_mirror =
-      device_rr_gsb.get_cb_unique_module(e_rr_type::CHANX, icb);
-
-    print_spice_routing_connection_box_unique_module(
-      netlist_manager, module_manager, subckt_dir, unique_mirror,
-      e_rr_type::CHANX);
+  /* Build unique X-direction and Y-direction connection block modules */
+  for (const e_rr_type& cb_type : {e_rr_type::CHANX, e_rr_type::CHANY}) {
+    for (size_t icb = 0; icb < device_rr_gsb.get_num_cb_unique_module(cb_type);
+         ++icb) {
+      writer_tasks.push_back(
+        [&, cb_type, icb](NetlistManager& task_netlist_manager,
+                          SpiceWriterLog&) {
+          print_spice_routing_connection_box_unique_module(
+            task_netlist_manager, module_manager, subckt_dir,
+            device_rr_gsb.get_cb_unique_module(cb_type, icb), cb_type,
+            options);
+          return CMD_EXEC_SUCCESS;
+        });
+    }
   }
 
-  /* Build unique X-direction connection block modules */
-  for (size_t icb = 0;
-       icb < device_rr_gsb.get_num_cb_unique_module(e_rr_type::CHANY); ++icb) {
-    const RRGSB& unique_mirror =
-      device_rr_gsb.get_cb_unique_module(e_rr_type::CHANY, icb);
-
-    print_spice_routing_connection_box_unique_module(
-      netlist_manager, module_manager, subckt_dir, unique_mirror,
-      e_rr_type::CHANY);
-  }
+  print_spice_netlists_by_tasks(netlist_manager, writer_tasks,
+                                options.num_threads());
 
-  /*
-  VTR_LOG("Writing header file for routing submodules '%s'...",
-          ROUTING_VERILOG_FILE_NAME);
-  print_spice_netlist_include_header_file(netlist_names,
-                                          subckt_dir.c_str(),
-                                          ROUTING_VERILOG_FILE_NAME);
-  VTR_LOG("Done\n");
-   */
   VTR_LOG("\n");
 }
 
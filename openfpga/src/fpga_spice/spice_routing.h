@@ -6,6 +6,7 @@
  *******************************************************************/
 
 #include "device_rr_gsb.h"
+#include "fabric_spice_options.h"
 #include "module_manager.h"
 #include "mux_library.h"
 #include "netlist_manager.h"
@@ -21,12 +22,14 @@ namespace openfpga {
 void print_spice_flatten_routing_modules(NetlistManager& netlist_manager,
                                          const ModuleManager& module_manager,
                                          const DeviceRRGSB& device_rr_gsb,
-                                         const std::string& subckt_dir);
+                                         const std::string& subckt_dir,
+                                         const FabricSpiceOption& options);
 
 void print_spice_unique_routing_modules(NetlistManager& netlist_manager,
                                         const ModuleManager& module_manager,
                                         const DeviceRRGSB& device_rr_gsb,
-                                        const std::string& subckt_dir);
+                                        const std::string& subckt_dir,
+                                        const FabricSpiceOption& options);
 
 } /* end namespace openfpga */
 
@@ -67,12 +67,12 @@ static BasicPort generate_spice_port_for_module_net(
   for (ModuleNetSrcId src_id :
        module_manager.module_net_sources(module_id, module_net)) {
     if (module_id ==
-        module_manager.net_source_modules(module_id, module_net)[src_id]) {
+        module_manager.net_source_module(module_id, module_net, src_id)) {
       /* Here, this is not a local wire, return the port name of the src_port */
       ModulePortId net_src_port =
-        module_manager.net_source_ports(module_id, module_net)[src_id];
+        module_manager.net_source_port(module_id, module_net, src_id);
       size_t src_pin_index =
-        module_manager.net_source_pins(module_id, module_net)[src_id];
+        module_manager.net_source_pin(module_id, module_net, src_id);
       return BasicPort(
         module_manager.module_port(module_id, net_src_port).get_name(),
         src_pin_index, src_pin_index);
@@ -83,13 +83,13 @@ static BasicPort generate_spice_port_for_module_net(
   for (ModuleNetSinkId sink_id :
        module_manager.module_net_sinks(module_id, module_net)) {
     if (module_id ==
-        module_manager.net_sink_modules(module_id, module_net)[sink_id]) {
+        module_manager.net_sink_module(module_id, module_net, sink_id)) {
       /* Here, this is not a local wire, return the port name of the sink_port
        */
       ModulePortId net_sink_port =
-        module_manager.net_sink_ports(module_id, module_net)[sink_id];
+        module_manager.net_sink_port(module_id, module_net, sink_id);
       size_t sink_pin_index =
-        module_manager.net_sink_pins(module_id, module_net)[sink_id];
+        module_manager.net_sink_pin(module_id, module_net, sink_id);
       return BasicPort(
         module_manager.module_port(module_id, net_sink_port).get_name(),
         sink_pin_index, sink_pin_index);
@@ -101,26 +101,27 @@ static BasicPort generate_spice_port_for_module_net(
 
   /* Each net must only one 1 source */
   VTR_ASSERT(1 ==
-             module_manager.net_source_modules(module_id, module_net).size());
+             module_manager.module_net_sources(module_id, module_net).size());
 
   /* Get the source module */
   ModuleId net_src_module =
-    module_manager.net_source_modules(module_id, module_net)[ModuleNetSrcId(0)];
+    module_manager.net_source_module(module_id, module_net, ModuleNetSrcId(0));
   /* Get the instance id */
-  size_t net_src_instance = module_manager.net_source_instances(
-    module_id, module_net)[ModuleNetSrcId(0)];
+  size_t net_src_instance = module_manager.net_source_instance(
+    module_id, module_net, ModuleNetSrcId(0));
   /* Get the port id */
   ModulePortId net_src_port =
-    module_manager.net_source_ports(module_id, module_net)[ModuleNetSrcId(0)];
+    module_manager.net_source_port(module_id, module_net, ModuleNetSrcId(0));
   /* Get the pin id */
   size_t net_src_pin =
-    module_manager.net_source_pins(module_id, module_net)[ModuleNetSrcId(0)];
+    module_manager.net_source_pin(module_id, module_net, ModuleNetSrcId(0));
 
   /* Load user-defined name if we have it */
   if (false == module_manager.net_name(module_id, module_net).empty()) {
     net_name = module_manager.net_name(module_id, module_net);
   } else {
-    net_name = module_manager.module_name(net_src_module);
+    net_name = module_manager.instance_module_name(module_id, net_src_module,
+                                                   net_src_instance);
     net_name +=
       std::string("_") + std::to_string(net_src_instance) + std::string("_");
     net_name +=
@@ -138,10 +139,10 @@ static BasicPort generate_spice_port_for_module_net(
  * For each module output (except the first one), we print a wire connection
  *******************************************************************/
 static void print_spice_subckt_output_short_connection(
-  std::fstream& fp, const ModuleManager& module_manager,
+  mmostream& fp, const ModuleManager& module_manager,
   const ModuleId& module_id, const ModuleNetId& module_net) {
   /* Ensure a valid file stream */
-  VTR_ASSERT(true == valid_file_stream(fp));
+  VTR_ASSERT(true == valid_file_mmostream(fp));
 
   bool first_port = true;
   BasicPort src_port;
@@ -150,16 +151,16 @@ static void print_spice_subckt_output_short_connection(
   for (ModuleNetSinkId net_sink :
        module_manager.module_net_sinks(module_id, module_net)) {
     ModuleId sink_module =
-      module_manager.net_sink_modules(module_id, module_net)[net_sink];
+      module_manager.net_sink_module(module_id, module_net, net_sink);
     if (module_id != sink_module) {
       continue;
     }
 
     /* Find the sink port and pin information */
     ModulePortId sink_port_id =
-      module_manager.net_sink_ports(module_id, module_net)[net_sink];
+      module_manager.net_sink_port(module_id, module_net, net_sink);
     size_t sink_pin =
-      module_manager.net_sink_pins(module_id, module_net)[net_sink];
+      module_manager.net_sink_pin(module_id, module_net, net_sink);
     BasicPort sink_port(
       module_manager.module_port(module_id, sink_port_id).get_name(), sink_pin,
       sink_pin);
@@ -194,15 +195,15 @@ static void print_spice_subckt_output_short_connection(
  * If we find such a pair, we print a wire connection
  *******************************************************************/
 static void print_spice_subckt_local_short_connection(
-  std::fstream& fp, const ModuleManager& module_manager,
+  mmostream& fp, const ModuleManager& module_manager,
   const ModuleId& module_id, const ModuleNetId& module_net) {
   /* Ensure a valid file stream */
-  VTR_ASSERT(true == valid_file_stream(fp));
+  VTR_ASSERT(true == valid_file_mmostream(fp));
 
   for (ModuleNetSrcId net_src :
        module_manager.module_net_sources(module_id, module_net)) {
     ModuleId src_module =
-      module_manager.net_source_modules(module_id, module_net)[net_src];
+      module_manager.net_source_module(module_id, module_net, net_src);
     if (module_id != src_module) {
       continue;
     }
@@ -210,9 +211,9 @@ static void print_spice_subckt_local_short_connection(
     print_spice_comment(
       fp, std::string("Net source id " + std::to_string(size_t(net_src))));
     ModulePortId src_port_id =
-      module_manager.net_source_ports(module_id, module_net)[net_src];
+      module_manager.net_source_port(module_id, module_net, net_src);
     size_t src_pin =
-      module_manager.net_source_pins(module_id, module_net)[net_src];
+      module_manager.net_source_pin(module_id, module_net, net_src);
     BasicPort src_port(
       module_manager.module_port(module_id, src_port_id).get_name(), src_pin,
       src_pin);
@@ -222,7 +223,7 @@ static void print_spice_subckt_local_short_connection(
     for (ModuleNetSinkId net_sink :
          module_manager.module_net_sinks(module_id, module_net)) {
       ModuleId sink_module =
-        module_manager.net_sink_modules(module_id, module_net)[net_sink];
+        module_manager.net_sink_module(module_id, module_net, net_sink);
       if (module_id != sink_module) {
         continue;
       }
@@ -231,9 +232,9 @@ static void print_spice_subckt_local_short_connection(
       print_spice_comment(
         fp, std::string("Net sink id " + std::to_string(size_t(net_sink))));
       ModulePortId sink_port_id =
-        module_manager.net_sink_ports(module_id, module_net)[net_sink];
+        module_manager.net_sink_port(module_id, module_net, net_sink);
       size_t sink_pin =
-        module_manager.net_sink_pins(module_id, module_net)[net_sink];
+        module_manager.net_sink_pin(module_id, module_net, net_sink);
       BasicPort sink_port(
         module_manager.module_port(module_id, sink_port_id).get_name(),
         sink_pin, sink_pin);
@@ -269,7 +270,7 @@ static void print_spice_subckt_local_short_connection(
  *            +-----------------------------+
  *******************************************************************/
 static void print_spice_subckt_local_short_connections(
-  std::fstream& fp, const ModuleManager& module_manager,
+  mmostream& fp, const ModuleManager& module_manager,
   const ModuleId& module_id) {
   /* Local wires come from the child modules */
   for (ModuleNetId module_net : module_manager.module_nets(module_id)) {
@@ -302,7 +303,7 @@ static void print_spice_subckt_local_short_connections(
  *            +-----------------------------+
  *******************************************************************/
 static void print_spice_subckt_output_short_connections(
-  std::fstream& fp, const ModuleManager& module_manager,
+  mmostream& fp, const ModuleManager& module_manager,
   const ModuleId& module_id) {
   /* Local wires come from the child modules */
   for (ModuleNetId module_net : module_manager.module_nets(module_id)) {
@@ -333,13 +334,13 @@ static void print_spice_subckt_output_short_connections(
  *    +-----------------------------+
  *
  *******************************************************************/
-static void write_spice_instance_to_file(std::fstream& fp,
+static void write_spice_instance_to_file(mmostream& fp,
                                          const ModuleManager& module_manager,
                                          const ModuleId& parent_module,
                                          const ModuleId& child_module,
                                          const size_t& instance_id) {
   /* Ensure a valid file stream */
-  VTR_ASSERT(true == valid_file_stream(fp));
+  VTR_ASSERT(true == valid_file_mmostream(fp));
 
   /* Print instance name:
    * if we have an instance name, use it;
@@ -350,7 +351,9 @@ static void write_spice_instance_to_file(std::fstream& fp,
       module_manager.instance_name(parent_module, child_module, instance_id)
         .empty()) {
     instance_head_line += generate_instance_name(
-      module_manager.module_name(child_module), instance_id);
+      module_manager.instance_module_name(parent_module, child_module,
+                                          instance_id),
+      instance_id);
   } else {
     instance_head_line +=
       module_manager.instance_name(parent_module, child_module, instance_id);
@@ -419,7 +422,7 @@ static void write_spice_instance_to_file(std::fstream& fp,
         new_line = false;
         if (SPICE_NETLIST_MAX_NUM_PORTS_PER_LINE == pin_cnt) {
           pin_cnt = 0;
-          fp << std::endl;
+          fp << "\n";
           new_line = true;
           fit_one_line = false;
         }
@@ -445,7 +448,7 @@ static void write_spice_instance_to_file(std::fstream& fp,
   new_line = false;
   if (SPICE_NETLIST_MAX_NUM_PORTS_PER_LINE == pin_cnt) {
     pin_cnt = 0;
-    fp << std::endl;
+    fp << "\n";
     new_line = true;
     fit_one_line = false;
   }
@@ -455,14 +458,15 @@ static void write_spice_instance_to_file(std::fstream& fp,
    * a clean format
    */
   if (false == fit_one_line) {
-    fp << std::endl;
+    fp << "\n";
     fp << "+";
   }
   write_space_to_file(fp, 1);
-  fp << module_manager.module_name(child_module);
+  fp << module_manager.instance_module_name(parent_module, child_module,
+                                            instance_id);
 
   /* Print an end to the instance */
-  fp << std::endl;
+  fp << "\n";
 }
 
 /********************************************************************
@@ -470,22 +474,34 @@ static void write_spice_instance_to_file(std::fstream& fp,
  * This is a key function, maybe most frequently called in our SPICE writer
  * Note that file stream must be valid
  *******************************************************************/
-void write_spice_subckt_to_file(std::fstream& fp,
+void write_spice_subckt_to_file(mmostream& fp,
                                 const ModuleManager& module_manager,
                                 const ModuleId& module_id) {
-  VTR_ASSERT(true == valid_file_stream(fp));
+  write_spice_subckt_to_file(fp, module_manager, module_id,
+                             module_manager.module_name(module_id));
+}
+
+/********************************************************************
+ * Write a SPICE sub-circuit to a file under a given module name, which can
+ * be either the name of the module or one of its aliases
+ *******************************************************************/
+void write_spice_subckt_to_file(mmostream& fp,
+                                const ModuleManager& module_manager,
+                                const ModuleId& module_id,
+                                const std::string& module_name) {
+  VTR_ASSERT(true == valid_file_mmostream(fp));
 
   /* Ensure we have a valid module_id */
   VTR_ASSERT(module_manager.valid_module_id(module_id));
 
   /* Print module declaration */
-  print_spice_subckt_definition(fp, module_manager, module_id);
+  print_spice_subckt_definition(fp, module_manager, module_id, module_name);
 
   /* Print an empty line as splitter */
-  fp << std::endl;
+  fp << "\n";
 
   /* Print an empty line as splitter */
-  fp << std::endl;
+  fp << "\n";
 
   /* Print local connection (from module inputs to output! */
   print_spice_comment(fp, std::string("BEGIN Local short connections"));
@@ -497,7 +513,7 @@ void write_spice_subckt_to_file(std::fstream& fp,
 
   print_spice_comment(fp, std::string("END Local output short connections"));
   /* Print an empty line as splitter */
-  fp << std::endl;
+  fp << "\n";
 
   /* Print instances */
   for (ModuleId child_module : module_manager.child_modules(module_id)) {
@@ -507,15 +523,15 @@ void write_spice_subckt_to_file(std::fstream& fp,
       write_spice_instance_to_file(fp, module_manager, module_id, child_module,
                                    instance);
       /* Print an empty line as splitter */
-      fp << std::endl;
+      fp << "\n";
     }
   }
 
   /* Print an end for the module */
-  print_spice_subckt_end(fp, module_manager.module_name(module_id));
+  print_spice_subckt_end(fp, module_name);
 
   /* Print an empty line as splitter */
-  fp << std::endl;
+  fp << "\n";
 }
 
 } /* end namespace openfpga */
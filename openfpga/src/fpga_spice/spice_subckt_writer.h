@@ -5,8 +5,10 @@
  * Include header files that are required by function declaration
  *******************************************************************/
 #include <fstream>
+#include <string>
 
 #include "module_manager.h"
+#include "openfpga_mmfstream.h"
 
 /********************************************************************
  * Function declaration
@@ -15,10 +17,15 @@
 /* begin namespace openfpga */
 namespace openfpga {
 
-void write_spice_subckt_to_file(std::fstream& fp,
+void write_spice_subckt_to_file(mmostream& fp,
                                 const ModuleManager& module_manager,
                                 const ModuleId& module_id);
 
+void write_spice_subckt_to_file(mmostream& fp,
+                                const ModuleManager& module_manager,
+                                const ModuleId& module_id,
+                                const std::string& module_name);
+
 } /* end namespace openfpga */
 
 #endif
@@ -16,6 +16,7 @@
 #include "spice_mux.h"
 #include "spice_submodule.h"
 #include "spice_transistor_wrapper.h"
+#include "spice_writer_utils.h"
 
 /* begin namespace openfpga */
 namespace openfpga {
@@ -29,30 +30,32 @@ namespace openfpga {
  * 4. TODO: Local encoders for routing multiplexers
  * 5. Wires
  * 6. Configuration memory blocks
+ *
+ * Note: each group of primitive modules is outputted to its own netlists
+ * and only reads the module manager. The groups can be written concurrently
  ********************************************************************/
 int print_spice_submodule(NetlistManager& netlist_manager,
                           const ModuleManager& module_manager,
                           const Arch& openfpga_arch, const MuxLibrary& mux_lib,
-                          const std::string& submodule_dir) {
-  int status = CMD_EXEC_SUCCESS;
+                          const std::string& submodule_dir,
+                          const FabricSpiceOption& options) {
+  std::vector<SpiceNetlistWriterTask> writer_tasks;
 
   /* Transistor wrapper */
-  status = print_spice_transistor_wrapper(
-    netlist_manager, openfpga_arch.tech_lib, submodule_dir);
-
-  /* Error out if fatal errors have been reported */
-  if (CMD_EXEC_SUCCESS != status) {
-    return CMD_EXEC_FATAL_ERROR;
-  }
+  writer_tasks.push_back(
+    [&](NetlistManager& task_netlist_manager, SpiceWriterLog& task_log) {
+      return print_spice_transistor_wrapper(task_netlist_manager, task_log,
+                                            openfpga_arch.tech_lib,
+                                            submodule_dir, options);
+    });
 
   /* Constant modules: VDD and GND */
-  status =
-    print_spice_supply_wrappers(netlist_manager, module_manager, submodule_dir);
-
-  /* Error out if fatal errors have been reported */
-  if (CMD_EXEC_SUCCESS != status) {
-    return CMD_EXEC_FATAL_ERROR;
-  }
+  writer_tasks.push_back(
+    [&](NetlistManager& task_netlist_manager, SpiceWriterLog& task_log) {
+      return print_spice_supply_wrappers(task_netlist_manager, task_log,
+                                         module_manager, submodule_dir,
+                                         options);
+    });
 
   /* Logic gates:
    *   - AND/OR,
@@ -60,49 +63,46 @@ int print_spice_submodule(NetlistManager& netlist_manager,
    *   - transmission-gate/pass-transistor
    *   - wires
    */
-  status = print_spice_essential_gates(
-    netlist_manager, module_manager, openfpga_arch.circuit_lib,
-    openfpga_arch.tech_lib, openfpga_arch.circuit_tech_binding, submodule_dir);
-
-  /* Error out if fatal errors have been reported */
-  if (CMD_EXEC_SUCCESS != status) {
-    return CMD_EXEC_FATAL_ERROR;
-  }
+  writer_tasks.push_back(
+    [&](NetlistManager& task_netlist_manager, SpiceWriterLog& task_log) {
+      return print_spice_essential_gates(
+        task_netlist_manager, task_log, module_manager,
+        openfpga_arch.circuit_lib, openfpga_arch.tech_lib,
+        openfpga_arch.circuit_tech_binding, submodule_dir, options);
+    });
 
   /* TODO: local decoders for routing multiplexers */
 
   /* Routing multiplexers */
-  status =
-    print_spice_submodule_muxes(netlist_manager, module_manager, mux_lib,
-                                openfpga_arch.circuit_lib, submodule_dir);
-
-  /* Error out if fatal errors have been reported */
-  if (CMD_EXEC_SUCCESS != status) {
-    return CMD_EXEC_FATAL_ERROR;
-  }
+  writer_tasks.push_back(
+    [&](NetlistManager& task_netlist_manager, SpiceWriterLog& task_log) {
+      return print_spice_submodule_muxes(
+        task_netlist_manager, task_log, module_manager, mux_lib,
+        openfpga_arch.circuit_lib, submodule_dir, options);
+    });
 
   /* Look-Up Tables */
-  status = print_spice_submodule_luts(netlist_manager, module_manager,
-                                      openfpga_arch.circuit_lib, submodule_dir);
-
-  /* Error out if fatal errors have been reported */
-  if (CMD_EXEC_SUCCESS != status) {
-    return CMD_EXEC_FATAL_ERROR;
-  }
+  writer_tasks.push_back(
+    [&](NetlistManager& task_netlist_manager, SpiceWriterLog& task_log) {
+      return print_spice_submodule_luts(task_netlist_manager, task_log,
+                                        module_manager,
+                                        openfpga_arch.circuit_lib,
+                                        submodule_dir, options);
+    });
 
   /* Memories */
-  status =
-    print_spice_submodule_memories(netlist_manager, module_manager, mux_lib,
-                                   openfpga_arch.circuit_lib, submodule_dir);
-
-  /* Error out if fatal errors have been reported */
-  if (CMD_EXEC_SUCCESS != status) {
-    return CMD_EXEC_FATAL_ERROR;
-  }
+  writer_tasks.push_back(
+    [&](NetlistManager& task_netlist_manager, SpiceWriterLog& task_log) {
+      return print_spice_submodule_memories(
+        task_netlist_manager, task_log, module_manager, mux_lib,
+        openfpga_arch.circuit_lib, submodule_dir, options);
+    });
 
   /* TODO: architecture decoders */
 
-  return status;
+  /* Error out if fatal errors have been reported by any writer */
+  return print_spice_netlists_by_tasks(netlist_manager, writer_tasks,
+                                       options.num_threads());
 }
 
 } /* end namespace openfpga */
@@ -4,6 +4,7 @@
 /********************************************************************
  * Include header files that are required by function declaration
  *******************************************************************/
+#include "fabric_spice_options.h"
 #include "module_manager.h"
 #include "mux_library.h"
 #include "netlist_manager.h"
@@ -19,7 +20,8 @@ namespace openfpga {
 int print_spice_submodule(NetlistManager& netlist_manager,
                           const ModuleManager& module_manager,
                           const Arch& openfpga_arch, const MuxLibrary& mux_lib,
-                          const std::string& submodule_dir);
+                          const std::string& submodule_dir,
+                          const FabricSpiceOption& options);
 
 } /* end namespace openfpga */
 
@@ -34,7 +34,8 @@ namespace openfpga {
  *******************************************************************/
 void print_spice_top_module(NetlistManager& netlist_manager,
                             const ModuleManager& module_manager,
-                            const std::string& spice_dir) {
+                            const std::string& spice_dir,
+                            const FabricSpiceOption& options) {
   /* Create a module as the top-level fabric, and add it to the module manager
    */
   std::string top_module_name = generate_fpga_top_module_name();
@@ -50,10 +51,10 @@ void print_spice_top_module(NetlistManager& netlist_manager,
           spice_fname.c_str());
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
+  mmostream fp(spice_fname, options.compress_output(),
+               SPICE_NETLIST_STREAM_BUFFER_SIZE);
 
-  check_file_stream(spice_fname.c_str(), fp);
+  check_file_mmostream(spice_fname.c_str(), fp);
 
   print_spice_file_header(fp, std::string("Top-level SPICE subckt for FPGA"));
 
@@ -61,10 +62,10 @@ void print_spice_top_module(NetlistManager& netlist_manager,
   write_spice_subckt_to_file(fp, module_manager, top_module);
 
   /* Add an empty line as a splitter */
-  fp << std::endl;
+  fp << "\n";
 
   /* Close file handler */
-  fp.close();
+  close_file_mmostream(spice_fname.c_str(), fp);
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = netlist_manager.add_netlist(spice_fname);
@@ -6,6 +6,7 @@
  *******************************************************************/
 #include <string>
 
+#include "fabric_spice_options.h"
 #include "module_manager.h"
 #include "netlist_manager.h"
 
@@ -18,7 +19,8 @@ namespace openfpga {
 
 void print_spice_top_module(NetlistManager& netlist_manager,
                             const ModuleManager& module_manager,
-                            const std::string& spice_dir);
+                            const std::string& spice_dir,
+                            const FabricSpiceOption& options);
 
 } /* end namespace openfpga */
 
@@ -9,6 +9,7 @@
 /* Headers from vtrutil library */
 #include "vtr_assert.h"
 #include "vtr_log.h"
+#include "vtr_util.h"
 
 /* Headers from openfpgashell library */
 #include "command_exit_codes.h"
@@ -27,9 +28,9 @@ namespace openfpga {
  * Print a SPICE model wrapper for a transistor model
  *******************************************************************/
 static int print_spice_transistor_model_wrapper(
-  std::fstream& fp, const TechnologyLibrary& tech_lib,
+  mmostream& fp, const TechnologyLibrary& tech_lib,
   const TechnologyModelId& model) {
-  if (false == valid_file_stream(fp)) {
+  if (false == valid_file_mmostream(fp)) {
     return CMD_EXEC_FATAL_ERROR;
   }
 
@@ -71,21 +72,22 @@ static int print_spice_transistor_model_wrapper(
  * Generate the SPICE netlist for transistors
  *******************************************************************/
 int print_spice_transistor_wrapper(NetlistManager& netlist_manager,
+                                   SpiceWriterLog& log,
                                    const TechnologyLibrary& tech_lib,
-                                   const std::string& submodule_dir) {
+                                   const std::string& submodule_dir,
+                                   const FabricSpiceOption& options) {
   std::string spice_fname =
     submodule_dir + std::string(TRANSISTORS_SPICE_FILE_NAME);
 
-  std::fstream fp;
-
   /* Create the file stream */
-  fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
+  mmostream fp(spice_fname, options.compress_output(),
+               SPICE_NETLIST_STREAM_BUFFER_SIZE);
   /* Check if the file stream if valid or not */
-  check_file_stream(spice_fname.c_str(), fp);
+  check_file_mmostream(spice_fname.c_str(), fp);
 
   /* Create file */
-  VTR_LOG("Generating SPICE netlist '%s' for transistors...",
-          spice_fname.c_str());
+  log.log(vtr::string_fmt("Generating SPICE netlist '%s' for transistors...",
+                          spice_fname.c_str()));
 
   print_spice_file_header(fp, std::string("Transistor wrappers"));
 
@@ -103,14 +105,14 @@ int print_spice_transistor_wrapper(NetlistManager& netlist_manager,
   }
 
   /* Close file handler*/
-  fp.close();
+  close_file_mmostream(spice_fname.c_str(), fp);
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = netlist_manager.add_netlist(spice_fname);
   VTR_ASSERT(NetlistId::INVALID() != nlist_id);
   netlist_manager.set_netlist_type(nlist_id, NetlistManager::SUBMODULE_NETLIST);
 
-  VTR_LOG("Done\n");
+  log.log("Done\n");
 
   return CMD_EXEC_SUCCESS;
 }
@@ -128,11 +130,11 @@ int print_spice_transistor_wrapper(NetlistManager& netlist_manager,
  *   a PMOS. Any preprocessing or subckt definition should not be included!
  *******************************************************************/
 int print_spice_generic_pmos_modeling(
-  std::fstream& fp, const std::string& trans_name_postfix,
+  mmostream& fp, const std::string& trans_name_postfix,
   const std::string& input_port_name, const std::string& gate_port_name,
   const std::string& output_port_name, const TechnologyLibrary& tech_lib,
   const TechnologyModelId& tech_model, const float& trans_width) {
-  if (false == valid_file_stream(fp)) {
+  if (false == valid_file_mmostream(fp)) {
     return CMD_EXEC_FATAL_ERROR;
   }
 
@@ -160,11 +162,11 @@ int print_spice_generic_pmos_modeling(
  *   a NMOS. Any preprocessing or subckt definition should not be included!
  *******************************************************************/
 int print_spice_generic_nmos_modeling(
-  std::fstream& fp, const std::string& trans_name_postfix,
+  mmostream& fp, const std::string& trans_name_postfix,
   const std::string& input_port_name, const std::string& gate_port_name,
   const std::string& output_port_name, const TechnologyLibrary& tech_lib,
   const TechnologyModelId& tech_model, const float& trans_width) {
-  if (false == valid_file_stream(fp)) {
+  if (false == valid_file_mmostream(fp)) {
     return CMD_EXEC_FATAL_ERROR;
   }
 
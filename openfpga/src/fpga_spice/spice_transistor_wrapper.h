@@ -7,7 +7,10 @@
 #include <map>
 #include <string>
 
+#include "fabric_spice_options.h"
 #include "netlist_manager.h"
+#include "openfpga_mmfstream.h"
+#include "spice_writer_utils.h"
 #include "technology_library.h"
 
 /********************************************************************
@@ -18,17 +21,19 @@
 namespace openfpga {
 
 int print_spice_transistor_wrapper(NetlistManager& netlist_manager,
+                                   SpiceWriterLog& log,
                                    const TechnologyLibrary& tech_lib,
-                                   const std::string& submodule_dir);
+                                   const std::string& submodule_dir,
+                                   const FabricSpiceOption& options);
 
 int print_spice_generic_pmos_modeling(
-  std::fstream& fp, const std::string& trans_name_postfix,
+  mmostream& fp, const std::string& trans_name_postfix,
   const std::string& input_port_name, const std::string& gate_port_name,
   const std::string& output_port_name, const TechnologyLibrary& tech_lib,
   const TechnologyModelId& tech_model, const float& trans_width);
 
 int print_spice_generic_nmos_modeling(
-  std::fstream& fp, const std::string& trans_name_postfix,
+  mmostream& fp, const std::string& trans_name_postfix,
   const std::string& input_port_name, const std::string& gate_port_name,
   const std::string& output_port_name, const TechnologyLibrary& tech_lib,
   const TechnologyModelId& tech_model, const float& trans_width);
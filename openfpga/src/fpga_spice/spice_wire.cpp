@@ -11,6 +11,7 @@
 /* Headers from vtrutil library */
 #include "vtr_assert.h"
 #include "vtr_log.h"
+#include "vtr_util.h"
 
 /* Headers from openfpgashell library */
 #include "command_exit_codes.h"
@@ -39,7 +40,7 @@ namespace openfpga {
  *      GND     GND    GND           GND
  *******************************************************************/
 static int print_spice_wire_pi_type_rc_modeling(
-  std::fstream& fp, const std::string& input_port_name,
+  mmostream& fp, const std::string& input_port_name,
   const std::string& output_port_name,
   const std::string& middle_output_port_name, const float& res_total,
   const float& cap_total, const size_t& num_levels) {
@@ -155,7 +156,7 @@ static int print_spice_wire_pi_type_rc_modeling(
  *           GND    GND    GND                GND
  *******************************************************************/
 static int print_spice_wire_t_type_rc_modeling(
-  std::fstream& fp, const std::string& input_port_name,
+  mmostream& fp, const std::string& input_port_name,
   const std::string& output_port_name,
   const std::string& middle_output_port_name, const float& res_total,
   const float& cap_total, const size_t& num_levels) {
@@ -260,12 +261,12 @@ static int print_spice_wire_t_type_rc_modeling(
  *      +---------------------    +---------------+     +--------------------+
  *
  *******************************************************************/
-int print_spice_wire_subckt(std::fstream& fp,
+int print_spice_wire_subckt(mmostream& fp, SpiceWriterLog& log,
                             const ModuleManager& module_manager,
                             const ModuleId& module_id,
                             const CircuitLibrary& circuit_lib,
                             const CircuitModelId& circuit_model) {
-  if (false == valid_file_stream(fp)) {
+  if (false == valid_file_mmostream(fp)) {
     return CMD_EXEC_FATAL_ERROR;
   }
 
@@ -379,9 +380,9 @@ int print_spice_wire_subckt(std::fstream& fp,
         circuit_lib.wire_num_level(circuit_model));
       break;
     default:
-      VTR_LOGF_ERROR(__FILE__, __LINE__,
-                     "Unsupport wire model type for circuit model '%s.\n",
-                     circuit_lib.model_name(circuit_model).c_str());
+      log.log_error(
+        vtr::string_fmt("Unsupport wire model type for circuit model '%s.\n",
+                        circuit_lib.model_name(circuit_model).c_str()));
       return CMD_EXEC_FATAL_ERROR;
   }
 
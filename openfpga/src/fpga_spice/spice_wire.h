@@ -9,6 +9,8 @@
 
 #include "circuit_library.h"
 #include "module_manager.h"
+#include "openfpga_mmfstream.h"
+#include "spice_writer_utils.h"
 
 /********************************************************************
  * Function declaration
@@ -17,7 +19,7 @@
 /* begin namespace openfpga */
 namespace openfpga {
 
-int print_spice_wire_subckt(std::fstream& fp,
+int print_spice_wire_subckt(mmostream& fp, SpiceWriterLog& log,
                             const ModuleManager& module_manager,
                             const ModuleId& module_id,
                             const CircuitLibrary& circuit_lib,
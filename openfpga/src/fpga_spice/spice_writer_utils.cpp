@@ -2,10 +2,12 @@
  * Include functions for most frequently
  * used Spice writers
  ***********************************************/
+#include <atomic>
 #include <chrono>
 #include <ctime>
 #include <fstream>
 #include <iomanip>
+#include <mutex>
 #include <string>
 
 /* Headers from vtrutil library */
@@ -15,8 +17,12 @@
 /* Headers from readarchopenfpga library */
 #include "circuit_types.h"
 
+/* Headers from openfpgashell library */
+#include "command_exit_codes.h"
+
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
+#include "openfpga_parallel.h"
 #include "spice_constants.h"
 #include "spice_writer_utils.h"
 
@@ -27,42 +33,50 @@ namespace openfpga {
  * Generate header comments for a Spice netlist
  * include the description
  ***********************************************/
-void print_spice_file_header(std::fstream& fp, const std::string& usage) {
-  VTR_ASSERT(true == valid_file_stream(fp));
+void print_spice_file_header(mmostream& fp, const std::string& usage) {
+  VTR_ASSERT(true == valid_file_mmostream(fp));
 
   auto end = std::chrono::system_clock::now();
   std::time_t end_time = std::chrono::system_clock::to_time_t(end);
+  /* std::ctime() returns a static buffer, which is shared by all the writers
+   * running concurrently */
+  std::string end_time_str;
+  {
+    static std::mutex ctime_mutex;
+    std::lock_guard<std::mutex> lock(ctime_mutex);
+    end_time_str = std::ctime(&end_time);
+  }
 
-  fp << "*********************************************" << std::endl;
-  fp << "*\tFPGA-SPICE Netlist" << std::endl;
-  fp << "*\tDescription: " << usage << std::endl;
-  fp << "*\tAuthor: Xifan TANG" << std::endl;
-  fp << "*\tOrganization: University of Utah" << std::endl;
-  fp << "*\tDate: " << std::ctime(&end_time);
-  fp << "*********************************************" << std::endl;
-  fp << std::endl;
+  fp << "*********************************************\n";
+  fp << "*\tFPGA-SPICE Netlist\n";
+  fp << "*\tDescription: " << usage << "\n";
+  fp << "*\tAuthor: Xifan TANG\n";
+  fp << "*\tOrganization: University of Utah\n";
+  fp << "*\tDate: " << end_time_str;
+  fp << "*********************************************\n";
+  fp << "\n";
 }
 
 /********************************************************************
  * Print Spice codes to include a netlist
  *******************************************************************/
-void print_spice_include_netlist(std::fstream& fp,
+void print_spice_include_netlist(mmostream& fp,
                                  const std::string& netlist_name) {
-  VTR_ASSERT(true == valid_file_stream(fp));
+  VTR_ASSERT(true == valid_file_mmostream(fp));
 
-  fp << ".include \"" << netlist_name << "\"" << std::endl;
+  fp << ".include \"" << netlist_name << "\"\n";
 }
 
 /************************************************
  * Print a Spice comment line
  ***********************************************/
-void print_spice_comment(std::fstream& fp, const std::string& comment) {
-  VTR_ASSERT(true == valid_file_stream(fp));
+void print_spice_comment(mmostream& fp, const std::string& comment) {
+  VTR_ASSERT(true == valid_file_mmostream(fp));
 
   std::string comment_cover(comment.length() + 4, '*');
-  fp << comment_cover << std::endl;
-  fp << "* " << comment << " *" << std::endl;
-  fp << comment_cover << std::endl;
+  fp << comment_cover << "\n";
+  fp << "* " << comment << " *\n";
+  fp << comment_cover << "\n";
 }
 
 /************************************************
@@ -93,17 +107,29 @@ std::string generate_spice_port(const BasicPort& port,
  * We use the following format:
  * module <module_name> (<ports without directions>);
  ***********************************************/
-void print_spice_subckt_definition(std::fstream& fp,
+void print_spice_subckt_definition(mmostream& fp,
+                                   const ModuleManager& module_manager,
+                                   const ModuleId& module_id,
+                                   const bool& include_supply_ports) {
+  print_spice_subckt_definition(fp, module_manager, module_id,
+                                module_manager.module_name(module_id),
+                                include_supply_ports);
+}
+
+/************************************************
+ * Print a SPICE subckt definition under a given
+ * module name, e.g., an alias of the module
+ ***********************************************/
+void print_spice_subckt_definition(mmostream& fp,
                                    const ModuleManager& module_manager,
                                    const ModuleId& module_id,
+                                   const std::string& module_name,
                                    const bool& include_supply_ports) {
-  VTR_ASSERT(true == valid_file_stream(fp));
+  VTR_ASSERT(true == valid_file_mmostream(fp));
 
-  print_spice_comment(fp, std::string("SPICE module for " +
-                                      module_manager.module_name(module_id)));
+  print_spice_comment(fp, std::string("SPICE module for " + module_name));
 
-  std::string module_head_line =
-    ".subckt " + module_manager.module_name(module_id) + " ";
+  std::string module_head_line = ".subckt " + module_name + " ";
   fp << module_head_line;
 
   /* Port sequence: global, inout, input, output and clock ports, */
@@ -147,7 +173,7 @@ void print_spice_subckt_definition(std::fstream& fp,
         new_line = false;
         if (SPICE_NETLIST_MAX_NUM_PORTS_PER_LINE == pin_cnt) {
           pin_cnt = 0;
-          fp << std::endl;
+          fp << "\n";
           new_line = true;
         }
       }
@@ -169,57 +195,57 @@ void print_spice_subckt_definition(std::fstream& fp,
     fp << SPICE_SUBCKT_GND_PORT_NAME;
   }
 
-  fp << std::endl;
+  fp << "\n";
 }
 
 /************************************************
  * Print an end line for a Spice module
  ***********************************************/
-void print_spice_subckt_end(std::fstream& fp, const std::string& module_name) {
-  VTR_ASSERT(true == valid_file_stream(fp));
+void print_spice_subckt_end(mmostream& fp, const std::string& module_name) {
+  VTR_ASSERT(true == valid_file_mmostream(fp));
 
-  fp << ".ends" << std::endl;
+  fp << ".ends\n";
   print_spice_comment(
     fp, std::string("***** END SPICE module for " + module_name + " *****"));
-  fp << std::endl;
+  fp << "\n";
 }
 
 /************************************************
  * Print a resistor in SPICE syntax
  ***********************************************/
-void print_spice_resistor(std::fstream& fp, const std::string& input_port,
+void print_spice_resistor(mmostream& fp, const std::string& input_port,
                           const std::string& output_port,
                           const float& resistance) {
-  VTR_ASSERT(true == valid_file_stream(fp));
+  VTR_ASSERT(true == valid_file_mmostream(fp));
 
   /* Set an unique name to the resistor */
   fp << "R" << input_port << "_to_" << output_port;
   fp << " " << input_port;
   fp << " " << output_port;
   fp << " " << std::setprecision(10) << resistance;
-  fp << std::endl;
+  fp << "\n";
 }
 
 /************************************************
  * Print a capacitor in SPICE syntax
  ***********************************************/
-void print_spice_capacitor(std::fstream& fp, const std::string& input_port,
+void print_spice_capacitor(mmostream& fp, const std::string& input_port,
                            const std::string& output_port,
                            const float& capacitance) {
-  VTR_ASSERT(true == valid_file_stream(fp));
+  VTR_ASSERT(true == valid_file_mmostream(fp));
 
   /* Set an unique name to the capacitor */
   fp << "C" << input_port << "_to_" << output_port;
   fp << " " << input_port;
   fp << " " << output_port;
   fp << " " << std::setprecision(10) << capacitance;
-  fp << std::endl;
+  fp << "\n";
 }
 
 /************************************************
  * Print a short-connected wire using zero resistance in SPICE syntax
  ***********************************************/
-void print_spice_short_connection(std::fstream& fp,
+void print_spice_short_connection(mmostream& fp,
                                   const std::string& input_port,
                                   const std::string& output_port) {
   print_spice_resistor(fp, input_port, output_port, 0.);
@@ -243,10 +269,10 @@ void print_spice_short_connection(std::fstream& fp,
  * mapping will be output by the module port name.
  *******************************************************************/
 void print_spice_subckt_instance(
-  std::fstream& fp, const ModuleManager& module_manager,
+  mmostream& fp, const ModuleManager& module_manager,
   const ModuleId& module_id, const std::string& instance_name,
   const std::map<std::string, BasicPort>& port2port_name_map) {
-  VTR_ASSERT(true == valid_file_stream(fp));
+  VTR_ASSERT(true == valid_file_mmostream(fp));
 
   /* Check: all the key ports in the port2port_name_map does exist in the child
    * module */
@@ -317,7 +343,7 @@ void print_spice_subckt_instance(
         new_line = false;
         if (SPICE_NETLIST_MAX_NUM_PORTS_PER_LINE == pin_cnt) {
           pin_cnt = 0;
-          fp << std::endl;
+          fp << "\n";
           new_line = true;
           fit_one_line = false;
         }
@@ -343,7 +369,7 @@ void print_spice_subckt_instance(
   new_line = false;
   if (SPICE_NETLIST_MAX_NUM_PORTS_PER_LINE == pin_cnt) {
     pin_cnt = 0;
-    fp << std::endl;
+    fp << "\n";
     new_line = true;
     fit_one_line = false;
   }
@@ -353,14 +379,93 @@ void print_spice_subckt_instance(
    * a clean format
    */
   if (false == fit_one_line) {
-    fp << std::endl;
+    fp << "\n";
     fp << "+";
   }
   write_space_to_file(fp, 1);
   fp << module_manager.module_name(module_id);
 
   /* Print an end to the instance */
-  fp << std::endl;
+  fp << "\n";
+}
+
+/********************************************************************
+ * Record the messages of a writer task
+ *******************************************************************/
+void SpiceWriterLog::log(const std::string& msg) {
+  messages_.emplace_back(false, msg);
+}
+
+void SpiceWriterLog::logv(const bool& expr, const std::string& msg) {
+  if (expr) {
+    log(msg);
+  }
+}
+
+void SpiceWriterLog::log_error(const std::string& msg) {
+  messages_.emplace_back(true, msg);
+}
+
+void SpiceWriterLog::print() const {
+  for (const auto& message : messages_) {
+    if (message.first) {
+      VTR_LOG_ERROR("%s", message.second.c_str());
+    } else {
+      VTR_LOG("%s", message.second.c_str());
+    }
+  }
+}
+
+/********************************************************************
+ * Run a list of SPICE netlist writers over a number of threads
+ * Writer tasks should be independent from each other: each of them
+ * outputs its own files and only reads the shared data structures.
+ * To keep the outputs deterministic, each task registers its netlists
+ * in a private netlist manager and records its messages in a private log,
+ * which are merged into the given netlist manager and printed following
+ * the order of tasks.
+ * Therefore, the netlist list and the log are the same as a serial run,
+ * regardless of the number of threads.
+ *
+ * Tasks are dispatched in ascending order, so once a task fails, all the
+ * tasks before it have been started. The tasks after it are skipped, and
+ * the results are collected up to the failed task, as a serial run stops
+ * at its first failure.
+ *******************************************************************/
+int print_spice_netlists_by_tasks(
+  NetlistManager& netlist_manager,
+  const std::vector<SpiceNetlistWriterTask>& writer_tasks,
+  const size_t& num_threads) {
+  size_t num_tasks = writer_tasks.size();
+  std::vector<NetlistManager> task_netlist_managers(num_tasks);
+  std::vector<SpiceWriterLog> task_logs(num_tasks);
+  std::vector<int> task_status(num_tasks, CMD_EXEC_SUCCESS);
+  std::atomic<size_t> first_failed_task(num_tasks);
+
+  parallel_for_each_task(num_tasks, num_threads, [&](const size_t& itask) {
+    if (itask > first_failed_task) {
+      return;
+    }
+    task_status[itask] =
+      writer_tasks[itask](task_netlist_managers[itask], task_logs[itask]);
+    if (CMD_EXEC_SUCCESS != task_status[itask]) {
+      /* Keep the lowest failed task */
+      size_t failed_task = first_failed_task;
+      while (itask < failed_task &&
+             !first_failed_task.compare_exchange_weak(failed_task, itask)) {
+      }
+    }
+  });
+
+  for (size_t itask = 0; itask < num_tasks; ++itask) {
+    netlist_manager.merge(task_netlist_managers[itask]);
+    task_logs[itask].print();
+    if (CMD_EXEC_SUCCESS != task_status[itask]) {
+      return CMD_EXEC_FATAL_ERROR;
+    }
+  }
+
+  return CMD_EXEC_SUCCESS;
 }
 
 } /* end namespace openfpga */
@@ -10,11 +10,15 @@
  * Include header files that are required by function declaration
  *******************************************************************/
 #include <fstream>
+#include <functional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "circuit_library.h"
 #include "module_manager.h"
+#include "netlist_manager.h"
+#include "openfpga_mmfstream.h"
 #include "openfpga_port.h"
 
 /********************************************************************
@@ -24,6 +28,33 @@
 /* begin namespace openfpga */
 namespace openfpga {
 
+/********************************************************************
+ * Log messages of a writer task
+ * Writer tasks may run in worker threads, so they record their messages
+ * here instead of printing them. The messages of each task are printed
+ * by the caller in the order of tasks, as a serial run does.
+ * Note: fatal errors which exit the program are still printed directly
+ *******************************************************************/
+class SpiceWriterLog {
+ public: /* Public mutators */
+  void log(const std::string& msg);
+  /* Record a message only when the expression is true, like VTR_LOGV */
+  void logv(const bool& expr, const std::string& msg);
+  void log_error(const std::string& msg);
+
+ public: /* Public writers */
+  void print() const;
+
+ private: /* Internal data */
+  /* Each message is flagged if it is an error */
+  std::vector<std::pair<bool, std::string>> messages_;
+};
+
+/* A writer task outputs one or more SPICE netlists, registers them
+ * in the netlist manager it is given, and records its messages in the log */
+typedef std::function<int(NetlistManager&, SpiceWriterLog&)>
+  SpiceNetlistWriterTask;
+
 /* Tips: for naming your function in this header/source file
  * If a function outputs to a file, its name should begin with "print_spice"
  * If a function creates a string without outputting to a file, its name should
@@ -32,40 +63,51 @@ namespace openfpga {
  * identify the functions
  */
 
-void print_spice_file_header(std::fstream& fp, const std::string& usage);
+void print_spice_file_header(mmostream& fp, const std::string& usage);
 
-void print_spice_include_netlist(std::fstream& fp,
+void print_spice_include_netlist(mmostream& fp,
                                  const std::string& netlist_name);
 
-void print_spice_comment(std::fstream& fp, const std::string& comment);
+void print_spice_comment(mmostream& fp, const std::string& comment);
 
 std::string generate_spice_port(const BasicPort& port,
                                 const bool& omit_pin_zero = false);
 
-void print_spice_subckt_definition(std::fstream& fp,
+void print_spice_subckt_definition(mmostream& fp,
+                                   const ModuleManager& module_manager,
+                                   const ModuleId& module_id,
+                                   const bool& include_supply_ports = true);
+
+void print_spice_subckt_definition(mmostream& fp,
                                    const ModuleManager& module_manager,
                                    const ModuleId& module_id,
+                                   const std::string& module_name,
                                    const bool& include_supply_ports = true);
 
-void print_spice_subckt_end(std::fstream& fp, const std::string& module_name);
+void print_spice_subckt_end(mmostream& fp, const std::string& module_name);
 
-void print_spice_resistor(std::fstream& fp, const std::string& input_port,
+void print_spice_resistor(mmostream& fp, const std::string& input_port,
                           const std::string& output_port,
                           const float& resistance);
 
-void print_spice_capacitor(std::fstream& fp, const std::string& input_port,
+void print_spice_capacitor(mmostream& fp, const std::string& input_port,
                            const std::string& output_port,
                            const float& capacitance);
 
-void print_spice_short_connection(std::fstream& fp,
+void print_spice_short_connection(mmostream& fp,
                                   const std::string& input_port,
                                   const std::string& output_port);
 
 void print_spice_subckt_instance(
-  std::fstream& fp, const ModuleManager& module_manager,
+  mmostream& fp, const ModuleManager& module_manager,
   const ModuleId& module_id, const std::string& instance_name,
   const std::map<std::string, BasicPort>& port2port_name_map);
 
+int print_spice_netlists_by_tasks(
+  NetlistManager& netlist_manager,
+  const std::vector<SpiceNetlistWriterTask>& writer_tasks,
+  const size_t& num_threads);
+
 } /* end namespace openfpga */
 
 #endif
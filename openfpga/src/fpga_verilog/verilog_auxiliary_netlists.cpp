@@ -61,7 +61,7 @@ void print_verilog_mock_fabric_include_netlist(
   fp << std::endl;
 
   /* Close the file stream */
-  fp.close();
+  close_file_mmostream(verilog_fpath.c_str(), fp);
 }
 
 /********************************************************************
@@ -160,7 +160,7 @@ void print_verilog_fabric_include_netlist(const NetlistManager& netlist_manager,
   fp << std::endl;
 
   /* Close the file stream */
-  fp.close();
+  close_file_mmostream(verilog_fpath.c_str(), fp);
 }
 
 /********************************************************************
@@ -221,7 +221,7 @@ void print_verilog_full_testbench_include_netlists(
           std::string(AUTOCHECK_TOP_TESTBENCH_VERILOG_FILE_POSTFIX));
 
   /* Close the file stream */
-  fp.close();
+  close_file_mmostream(verilog_fname.c_str(), fp);
 }
 
 /********************************************************************
@@ -287,7 +287,7 @@ void print_verilog_preconfigured_testbench_include_netlists(
           std::string(RANDOM_TOP_TESTBENCH_VERILOG_FILE_POSTFIX));
 
   /* Close the file stream */
-  fp.close();
+  close_file_mmostream(verilog_fname.c_str(), fp);
 }
 
 /********************************************************************
@@ -317,7 +317,7 @@ void print_verilog_preprocessing_flags_netlist(
   }
 
   /* Close the file stream */
-  fp.close();
+  close_file_mmostream(verilog_fname.c_str(), fp);
 }
 
 } /* end namespace openfpga */
@@ -252,7 +252,7 @@ void print_verilog_submodule_mux_local_decoders(
   }
 
   /* Close the file stream */
-  fp.close();
+  close_file_mmostream(verilog_fpath.c_str(), fp);
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = NetlistId::INVALID();
@@ -918,7 +918,7 @@ void print_verilog_submodule_arch_decoders(
   }
 
   /* Close the file stream */
-  fp.close();
+  close_file_mmostream(verilog_fpath.c_str(), fp);
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = NetlistId::INVALID();
@@ -610,7 +610,7 @@ void print_verilog_submodule_essentials(const ModuleManager& module_manager,
   }
 
   /* Close file handler*/
-  fp.close();
+  close_file_mmostream(verilog_fpath.c_str(), fp);
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = NetlistId::INVALID();
@@ -378,7 +378,7 @@ void print_verilog_random_top_testbench(
                            VERILOG_DEFAULT_NET_TYPE_WIRE);
 
   /* Close the file stream */
-  fp.close();
+  close_file_mmostream(verilog_fname.c_str(), fp);
 }
 
 } /* end namespace openfpga */
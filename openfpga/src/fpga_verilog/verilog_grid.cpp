@@ -118,7 +118,7 @@ static void print_verilog_primitive_block(
                                curr_options);
 
   /* Close file handler */
-  fp.close();
+  close_file_mmostream(verilog_fpath.c_str(), fp);
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = NetlistId::INVALID();
@@ -239,7 +239,7 @@ static void rec_print_verilog_logical_tile(
                 std::string(physical_pb_type->name) + " -----"));
 
   /* Close file handler */
-  fp.close();
+  close_file_mmostream(verilog_fpath.c_str(), fp);
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = NetlistId::INVALID();
@@ -352,7 +352,7 @@ static void print_verilog_physical_tile_netlist(
   fp << std::endl;
 
   /* Close file handler */
-  fp.close();
+  close_file_mmostream(verilog_fpath.c_str(), fp);
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = NetlistId::INVALID();
@@ -65,7 +65,7 @@ void print_verilog_submodule_luts(const ModuleManager& module_manager,
   }
 
   /* Close the file handler */
-  fp.close();
+  close_file_mmostream(verilog_fpath.c_str(), fp);
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = NetlistId::INVALID();
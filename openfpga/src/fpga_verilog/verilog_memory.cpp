@@ -242,7 +242,7 @@ void print_verilog_submodule_memories(
   }
 
   /* Close the file stream */
-  fp.close();
+  close_file_mmostream(verilog_fpath.c_str(), fp);
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = NetlistId::INVALID();
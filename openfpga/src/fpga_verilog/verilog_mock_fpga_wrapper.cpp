@@ -564,7 +564,7 @@ int print_verilog_mock_fpga_wrapper(
   print_verilog_module_end(fp, title, options.default_net_type());
 
   /* Close the file stream */
-  fp.close();
+  close_file_mmostream(verilog_fname.c_str(), fp);
 
   return status;
 }
@@ -36,8 +36,9 @@ static std::string generate_verilog_undriven_local_wire_name(
   if (!module_manager.instance_name(parent, child, instance_id).empty()) {
     wire_name = module_manager.instance_name(parent, child, instance_id);
   } else {
-    wire_name = module_manager.module_name(child) + std::string("_") +
-                std::to_string(instance_id);
+    wire_name =
+      module_manager.instance_module_name(parent, child, instance_id) +
+      std::string("_") + std::to_string(instance_id);
     wire_name += std::string("_");
   }
 
@@ -68,12 +69,12 @@ static BasicPort generate_verilog_port_for_module_net(
   for (ModuleNetSrcId src_id :
        module_manager.module_net_sources(module_id, module_net)) {
     if (module_id ==
-        module_manager.net_source_modules(module_id, module_net)[src_id]) {
+        module_manager.net_source_module(module_id, module_net, src_id)) {
       /* Here, this is not a local wire, return the port name of the src_port */
       ModulePortId net_src_port =
-        module_manager.net_source_ports(module_id, module_net)[src_id];
+        module_manager.net_source_port(module_id, module_net, src_id);
       size_t src_pin_index =
-        module_manager.net_source_pins(module_id, module_net)[src_id];
+        module_manager.net_source_pin(module_id, module_net, src_id);
       port_to_return.set(module_manager.module_port(module_id, net_src_port));
       port_to_return.set_width(src_pin_index, src_pin_index);
       port_to_return.set_origin_port_width(
@@ -86,13 +87,13 @@ static BasicPort generate_verilog_port_for_module_net(
   for (ModuleNetSinkId sink_id :
        module_manager.module_net_sinks(module_id, module_net)) {
     if (module_id ==
-        module_manager.net_sink_modules(module_id, module_net)[sink_id]) {
+        module_manager.net_sink_module(module_id, module_net, sink_id)) {
       /* Here, this is not a local wire, return the port name of the sink_port
        */
       ModulePortId net_sink_port =
-        module_manager.net_sink_ports(module_id, module_net)[sink_id];
+        module_manager.net_sink_port(module_id, module_net, sink_id);
       size_t sink_pin_index =
-        module_manager.net_sink_pins(module_id, module_net)[sink_id];
+        module_manager.net_sink_pin(module_id, module_net, sink_id);
       port_to_return.set(module_manager.module_port(module_id, net_sink_port));
       port_to_return.set_width(sink_pin_index, sink_pin_index);
       port_to_return.set_origin_port_width(
@@ -106,26 +107,27 @@ static BasicPort generate_verilog_port_for_module_net(
 
   /* Each net must only one 1 source */
   VTR_ASSERT(1 ==
-             module_manager.net_source_modules(module_id, module_net).size());
+             module_manager.module_net_sources(module_id, module_net).size());
 
   /* Get the source module */
   ModuleId net_src_module =
-    module_manager.net_source_modules(module_id, module_net)[ModuleNetSrcId(0)];
+    module_manager.net_source_module(module_id, module_net, ModuleNetSrcId(0));
   /* Get the instance id */
-  size_t net_src_instance = module_manager.net_source_instances(
-    module_id, module_net)[ModuleNetSrcId(0)];
+  size_t net_src_instance = module_manager.net_source_instance(
+    module_id, module_net, ModuleNetSrcId(0));
   /* Get the port id */
   ModulePortId net_src_port =
-    module_manager.net_source_ports(module_id, module_net)[ModuleNetSrcId(0)];
+    module_manager.net_source_port(module_id, module_net, ModuleNetSrcId(0));
   /* Get the pin id */
   size_t net_src_pin =
-    module_manager.net_source_pins(module_id, module_net)[ModuleNetSrcId(0)];
+    module_manager.net_source_pin(module_id, module_net, ModuleNetSrcId(0));
 
   /* Load user-defined name if we have it */
   if (false == module_manager.net_name(module_id, module_net).empty()) {
     net_name = module_manager.net_name(module_id, module_net);
   } else {
-    net_name = module_manager.module_name(net_src_module);
+    net_name = module_manager.instance_module_name(module_id, net_src_module,
+                                                   net_src_instance);
     net_name +=
       std::string("_") + std::to_string(net_src_instance) + std::string("_");
     net_name +=
@@ -293,16 +295,16 @@ static void print_verilog_module_output_short_connection(
   for (ModuleNetSinkId net_sink :
        module_manager.module_net_sinks(module_id, module_net)) {
     ModuleId sink_module =
-      module_manager.net_sink_modules(module_id, module_net)[net_sink];
+      module_manager.net_sink_module(module_id, module_net, net_sink);
     if (module_id != sink_module) {
       continue;
     }
 
     /* Find the sink port and pin information */
     ModulePortId sink_port_id =
-      module_manager.net_sink_ports(module_id, module_net)[net_sink];
+      module_manager.net_sink_port(module_id, module_net, net_sink);
     size_t sink_pin =
-      module_manager.net_sink_pins(module_id, module_net)[net_sink];
+      module_manager.net_sink_pin(module_id, module_net, net_sink);
     BasicPort sink_port(
       module_manager.module_port(module_id, sink_port_id).get_name(), sink_pin,
       sink_pin);
@@ -338,7 +340,7 @@ static void print_verilog_module_local_short_connection(
   for (ModuleNetSrcId net_src :
        module_manager.module_net_sources(module_id, module_net)) {
     ModuleId src_module =
-      module_manager.net_source_modules(module_id, module_net)[net_src];
+      module_manager.net_source_module(module_id, module_net, net_src);
     if (module_id != src_module) {
       continue;
     }
@@ -347,9 +349,9 @@ static void print_verilog_module_local_short_connection(
       fp, std::string("----- Net source id " + std::to_string(size_t(net_src)) +
                       " -----"));
     ModulePortId src_port_id =
-      module_manager.net_source_ports(module_id, module_net)[net_src];
+      module_manager.net_source_port(module_id, module_net, net_src);
     size_t src_pin =
-      module_manager.net_source_pins(module_id, module_net)[net_src];
+      module_manager.net_source_pin(module_id, module_net, net_src);
     BasicPort src_port(
       module_manager.module_port(module_id, src_port_id).get_name(), src_pin,
       src_pin);
@@ -359,7 +361,7 @@ static void print_verilog_module_local_short_connection(
     for (ModuleNetSinkId net_sink :
          module_manager.module_net_sinks(module_id, module_net)) {
       ModuleId sink_module =
-        module_manager.net_sink_modules(module_id, module_net)[net_sink];
+        module_manager.net_sink_module(module_id, module_net, net_sink);
       if (module_id != sink_module) {
         continue;
       }
@@ -369,9 +371,9 @@ static void print_verilog_module_local_short_connection(
         fp, std::string("----- Net sink id " +
                         std::to_string(size_t(net_sink)) + " -----"));
       ModulePortId sink_port_id =
-        module_manager.net_sink_ports(module_id, module_net)[net_sink];
+        module_manager.net_sink_port(module_id, module_net, net_sink);
       size_t sink_pin =
-        module_manager.net_sink_pins(module_id, module_net)[net_sink];
+        module_manager.net_sink_pin(module_id, module_net, net_sink);
       BasicPort sink_port(
         module_manager.module_port(module_id, sink_port_id).get_name(),
         sink_pin, sink_pin);
@@ -475,8 +477,10 @@ static void write_verilog_instance_to_file(mmostream& fp,
   /* Ensure a valid file stream */
   VTR_ASSERT(true == valid_file_mmostream(fp));
 
-  /* Print module name */
-  fp << "\t" << module_manager.module_name(child_module) << " ";
+  /* Print module name, which can be an alias of the child module */
+  std::string child_module_name = module_manager.instance_module_name(
+    parent_module, child_module, instance_id);
+  fp << "\t" << child_module_name << " ";
   /* Print instance name:
    * if we have an instance name, use it;
    * if not, we use a default name <name>_<num_instance_in_parent_module>
@@ -484,9 +488,8 @@ static void write_verilog_instance_to_file(mmostream& fp,
   if (true ==
       module_manager.instance_name(parent_module, child_module, instance_id)
         .empty()) {
-    fp << generate_instance_name(module_manager.module_name(child_module),
-                                 instance_id)
-       << " (" << std::endl;
+    fp << generate_instance_name(child_module_name, instance_id) << " ("
+       << std::endl;
   } else {
     fp << module_manager.instance_name(parent_module, child_module, instance_id)
        << " (" << std::endl;
@@ -580,13 +583,26 @@ void write_verilog_module_to_file(mmostream& fp,
                                   const ModuleManager& module_manager,
                                   const ModuleId& module_id,
                                   const FabricVerilogOption& options) {
+  write_verilog_module_to_file(fp, module_manager, module_id,
+                               module_manager.module_name(module_id), options);
+}
+
+/********************************************************************
+ * Write a Verilog module to a file under a given module name, which can be
+ * either the name of the module or one of its aliases
+ *******************************************************************/
+void write_verilog_module_to_file(mmostream& fp,
+                                  const ModuleManager& module_manager,
+                                  const ModuleId& module_id,
+                                  const std::string& module_name,
+                                  const FabricVerilogOption& options) {
   VTR_ASSERT(true == valid_file_mmostream(fp));
 
   /* Ensure we have a valid module_id */
   VTR_ASSERT(module_manager.valid_module_id(module_id));
 
   /* Print module declaration */
-  print_verilog_module_declaration(fp, module_manager, module_id,
+  print_verilog_module_declaration(fp, module_manager, module_id, module_name,
                                    options.default_net_type(),
                                    options.little_endian());
 
@@ -680,8 +696,7 @@ void write_verilog_module_to_file(mmostream& fp,
   }
 
   /* Print an end for the module */
-  print_verilog_module_end(fp, module_manager.module_name(module_id),
-                           options.default_net_type());
+  print_verilog_module_end(fp, module_name, options.default_net_type());
 
   /* Print an empty line as splitter */
   fp << std::endl;
@@ -3,6 +3,8 @@
 /********************************************************************
  * Include header files that are required by function declaration
  *******************************************************************/
+#include <string>
+
 #include "fabric_verilog_options.h"
 #include "module_manager.h"
 #include "openfpga_mmfstream.h"
@@ -20,4 +22,10 @@ void write_verilog_module_to_file(mmostream& fp,
                                   const ModuleId& module_id,
                                   const FabricVerilogOption& options);
 
+void write_verilog_module_to_file(mmostream& fp,
+                                  const ModuleManager& module_manager,
+                                  const ModuleId& module_id,
+                                  const std::string& module_name,
+                                  const FabricVerilogOption& options);
+
 } /* end namespace openfpga */
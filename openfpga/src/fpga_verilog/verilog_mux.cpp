@@ -1531,7 +1531,7 @@ static void print_verilog_submodule_mux_primitives(
   }
 
   /* Close the file stream */
-  fp.close();
+  close_file_mmostream(verilog_fpath.c_str(), fp);
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = NetlistId::INVALID();
@@ -1582,7 +1582,7 @@ static void print_verilog_submodule_mux_top_modules(
   }
 
   /* Close the file stream */
-  fp.close();
+  close_file_mmostream(verilog_fpath.c_str(), fp);
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = NetlistId::INVALID();
@@ -2,7 +2,9 @@
  * This file includes functions that are used to generate
  * a Verilog module of a pre-configured FPGA fabric
  *******************************************************************/
+#include <algorithm>
 #include <fstream>
+#include <sstream>
 
 /* Headers from vtrutil library */
 #include "command_exit_codes.h"
@@ -15,6 +17,7 @@
 #include "openfpga_atom_netlist_utils.h"
 #include "openfpga_digest.h"
 #include "openfpga_naming.h"
+#include "openfpga_parallel.h"
 #include "openfpga_port.h"
 #include "openfpga_reserved_words.h"
 #include "verilog_constants.h"
@@ -133,164 +136,162 @@ static void print_verilog_preconfig_top_module_ports(
   fp << std::endl;
 }
 
+/* Number of configuration blocks rendered by a task when the bitstream is
+ * rendered by multiple threads */
+constexpr size_t PRECONFIG_BITSTREAM_NUM_BLOCKS_PER_TASK = 1024;
+
 /********************************************************************
- * Impose the bitstream on the configuration memories
- * This function uses 'assign' syntax to impost the bitstream at mem port
- * while uses 'force' syntax to impost the bitstream at mem_inv port
+ * Impose the bitstream on the configuration memories of a block
+ * - For Icarus, this function uses 'force' syntax to impose the bitstream
+ *   at both mem and mem_inv ports
+ * - For other simulators, this function uses '$deposit' syntax
  *******************************************************************/
-static void print_verilog_preconfig_top_module_force_bitstream(
-  mmostream &fp, const std::string &top_block_name,
-  const BitstreamManager &bitstream_manager, const bool &output_datab_bits,
-  const bool &little_endian) {
-  /* Validate the file stream */
-  valid_file_mmostream(fp);
-
-  print_verilog_comment(
-    fp, std::string(
-          "----- Begin assign bitstream to configuration memories -----"));
+static void print_verilog_preconfig_top_module_block_bitstream(
+  std::ostream &fp, const std::string &top_block_name,
+  const BitstreamManager &bitstream_manager,
+  const ConfigBlockId &config_block_id,
+  const e_embedded_bitstream_hdl_type &embedded_bitstream_hdl_type,
+  const bool &output_datab_bits, const bool &little_endian) {
+  /* Build the hierarchical path of the configuration bit in modules */
+  std::vector<ConfigBlockId> block_hierarchy =
+    find_bitstream_manager_block_hierarchy(bitstream_manager, config_block_id,
+                                           top_block_name);
+  /* Drop the first block, which is the top module, it should be replaced by
+   * the instance name here */
+  /* Ensure that this is the module we want to drop! */
+  VTR_ASSERT(top_block_name ==
+             bitstream_manager.block_name(block_hierarchy[0]));
+  block_hierarchy.erase(block_hierarchy.begin());
+
+  /* Build the full hierarchy path */
+  std::string bit_hierarchy_path(FORMAL_VERIFICATION_TOP_MODULE_UUT_NAME);
+  for (const ConfigBlockId &temp_block : block_hierarchy) {
+    bit_hierarchy_path += std::string(".");
+    bit_hierarchy_path += bitstream_manager.block_name(temp_block);
+  }
+  bit_hierarchy_path += std::string(".");
 
-  fp << "initial begin" << std::endl;
+  std::vector<size_t> config_data_values;
+  for (const ConfigBitId config_bit :
+       bitstream_manager.block_bits(config_block_id)) {
+    config_data_values.push_back(bitstream_manager.bit_value(config_bit));
+  }
 
-  for (const ConfigBlockId &config_block_id : bitstream_manager.blocks()) {
-    /* We only cares blocks with configuration bits */
-    if (0 == bitstream_manager.block_bits(config_block_id).size()) {
-      continue;
-    }
-    /* Build the hierarchical path of the configuration bit in modules */
-    std::vector<ConfigBlockId> block_hierarchy =
-      find_bitstream_manager_block_hierarchy(bitstream_manager, config_block_id,
-                                             top_block_name);
-    /* Ensure that this is the module we want to drop! */
-    VTR_ASSERT(top_block_name ==
-               bitstream_manager.block_name(block_hierarchy[0]));
-    block_hierarchy.erase(block_hierarchy.begin());
-    /* Build the full hierarchy path */
-    std::string bit_hierarchy_path(FORMAL_VERIFICATION_TOP_MODULE_UUT_NAME);
-    for (const ConfigBlockId &temp_block : block_hierarchy) {
-      bit_hierarchy_path += std::string(".");
-      bit_hierarchy_path += bitstream_manager.block_name(temp_block);
-    }
-    bit_hierarchy_path += std::string(".");
+  /* Find the bit index in the parent block */
+  BasicPort config_data_port(
+    bit_hierarchy_path + generate_configurable_memory_data_out_name(),
+    config_data_values.size());
 
-    /* Find the bit index in the parent block */
-    BasicPort config_data_port(
-      bit_hierarchy_path + generate_configurable_memory_data_out_name(),
-      bitstream_manager.block_bits(config_block_id).size());
-
-    /* Wire it to the configuration bit: access both data out and data outb
-     * ports */
-    std::vector<size_t> config_data_values;
-    for (const ConfigBitId config_bit :
-         bitstream_manager.block_bits(config_block_id)) {
-      config_data_values.push_back(bitstream_manager.bit_value(config_bit));
-    }
+  /* Wire it to the configuration bit: access both data out and data outb
+   * ports */
+  if (EMBEDDED_BITSTREAM_HDL_IVERILOG == embedded_bitstream_hdl_type) {
     print_verilog_force_wire_constant_values(fp, config_data_port,
                                              config_data_values, little_endian);
+  } else {
+    print_verilog_deposit_wire_constant_values(
+      fp, config_data_port, config_data_values, little_endian);
+  }
 
-    if (true == output_datab_bits) {
-      /* Find the bit index in the parent block */
-      BasicPort config_datab_port(
-        bit_hierarchy_path +
-          generate_configurable_memory_inverted_data_out_name(),
-        bitstream_manager.block_bits(config_block_id).size());
-
-      std::vector<size_t> config_datab_values;
-      for (const ConfigBitId config_bit :
-           bitstream_manager.block_bits(config_block_id)) {
-        config_datab_values.push_back(!bitstream_manager.bit_value(config_bit));
-      }
-      print_verilog_force_wire_constant_values(
-        fp, config_datab_port, config_datab_values, little_endian);
-    }
+  /* Skip datab ports if specified */
+  if (false == output_datab_bits) {
+    return;
   }
 
-  fp << "end" << std::endl;
+  BasicPort config_datab_port(
+    bit_hierarchy_path + generate_configurable_memory_inverted_data_out_name(),
+    config_data_values.size());
 
-  print_verilog_comment(
-    fp,
-    std::string("----- End assign bitstream to configuration memories -----"));
+  std::vector<size_t> config_datab_values;
+  for (const size_t &config_data_value : config_data_values) {
+    config_datab_values.push_back(!config_data_value);
+  }
+  if (EMBEDDED_BITSTREAM_HDL_IVERILOG == embedded_bitstream_hdl_type) {
+    print_verilog_force_wire_constant_values(
+      fp, config_datab_port, config_datab_values, little_endian);
+  } else {
+    print_verilog_deposit_wire_constant_values(
+      fp, config_datab_port, config_datab_values, little_endian);
+  }
 }
 
 /********************************************************************
- * Impose the bitstream on the configuration memories
- * This function uses '$deposit' syntax to do so
+ * Impose the bitstream on the configuration memories of all the blocks
+ * The blocks are split into tasks of consecutive blocks. Each task is
+ * rendered to its own in-memory stream by a worker thread. The streams are
+ * then appended to the file in the order of the tasks, so that the netlist
+ * is the same as a sequential writing regardless of the number of threads.
+ * Tasks are rendered by batches, so that only a part of the bitstream is
+ * held in memory at a time
  *******************************************************************/
-static void print_verilog_preconfig_top_module_deposit_bitstream(
+static void print_verilog_preconfig_top_module_blocks_bitstream(
   mmostream &fp, const std::string &top_block_name,
-  const BitstreamManager &bitstream_manager, const bool &output_datab_bits,
-  const bool &little_endian) {
+  const BitstreamManager &bitstream_manager,
+  const e_embedded_bitstream_hdl_type &embedded_bitstream_hdl_type,
+  const bool &output_datab_bits, const bool &little_endian,
+  const size_t &num_threads) {
   /* Validate the file stream */
   valid_file_mmostream(fp);
 
+  std::string syntax_name("assign");
+  if (EMBEDDED_BITSTREAM_HDL_MODELSIM == embedded_bitstream_hdl_type) {
+    syntax_name = std::string("deposit");
+  }
   print_verilog_comment(
-    fp, std::string(
-          "----- Begin deposit bitstream to configuration memories -----"));
+    fp, std::string("----- Begin " + syntax_name +
+                    " bitstream to configuration memories -----"));
 
   fp << "initial begin" << std::endl;
 
+  /* We only cares blocks with configuration bits */
+  std::vector<ConfigBlockId> config_blocks;
   for (const ConfigBlockId &config_block_id : bitstream_manager.blocks()) {
-    /* We only cares blocks with configuration bits */
-    if (0 == bitstream_manager.block_bits(config_block_id).size()) {
-      continue;
+    if (0 != bitstream_manager.block_bits(config_block_id).size()) {
+      config_blocks.push_back(config_block_id);
     }
-    /* Build the hierarchical path of the configuration bit in modules */
-    std::vector<ConfigBlockId> block_hierarchy =
-      find_bitstream_manager_block_hierarchy(bitstream_manager, config_block_id,
-                                             top_block_name);
-    /* Drop the first block, which is the top module, it should be replaced by
-     * the instance name here */
-    /* Ensure that this is the module we want to drop! */
-    VTR_ASSERT(top_block_name ==
-               bitstream_manager.block_name(block_hierarchy[0]));
-    block_hierarchy.erase(block_hierarchy.begin());
-
-    /* Build the full hierarchy path */
-    std::string bit_hierarchy_path(FORMAL_VERIFICATION_TOP_MODULE_UUT_NAME);
-    for (const ConfigBlockId &temp_block : block_hierarchy) {
-      bit_hierarchy_path += std::string(".");
-      bit_hierarchy_path += bitstream_manager.block_name(temp_block);
-    }
-    bit_hierarchy_path += std::string(".");
-
-    /* Find the bit index in the parent block */
-    BasicPort config_data_port(
-      bit_hierarchy_path + generate_configurable_memory_data_out_name(),
-      bitstream_manager.block_bits(config_block_id).size());
-
-    /* Wire it to the configuration bit: access both data out and data outb
-     * ports */
-    std::vector<size_t> config_data_values;
-    for (const ConfigBitId config_bit :
-         bitstream_manager.block_bits(config_block_id)) {
-      config_data_values.push_back(bitstream_manager.bit_value(config_bit));
-    }
-    print_verilog_deposit_wire_constant_values(
-      fp, config_data_port, config_data_values, little_endian);
-
-    /* Skip datab ports if specified */
-    if (false == output_datab_bits) {
-      continue;
-    }
-
-    BasicPort config_datab_port(
-      bit_hierarchy_path +
-        generate_configurable_memory_inverted_data_out_name(),
-      bitstream_manager.block_bits(config_block_id).size());
+  }
 
-    std::vector<size_t> config_datab_values;
-    for (const ConfigBitId config_bit :
-         bitstream_manager.block_bits(config_block_id)) {
-      config_datab_values.push_back(!bitstream_manager.bit_value(config_bit));
+  /* The block hierarchy is found through the subtree index of the bitstream
+   * manager, which is built on its first query. Build it before any worker
+   * thread reads it */
+  bitstream_manager.build_block_subtree_index();
+
+  size_t num_tasks =
+    (config_blocks.size() + PRECONFIG_BITSTREAM_NUM_BLOCKS_PER_TASK - 1) /
+    PRECONFIG_BITSTREAM_NUM_BLOCKS_PER_TASK;
+  size_t num_workers = find_num_worker_threads(num_threads, num_tasks);
+  /* Give each worker a few tasks per batch to balance the load */
+  size_t batch_size = std::max(size_t(1), 4 * num_workers);
+
+  std::vector<std::ostringstream> task_streams(std::min(batch_size, num_tasks));
+  for (size_t batch_start = 0; batch_start < num_tasks;
+       batch_start += batch_size) {
+    size_t curr_batch_size = std::min(batch_size, num_tasks - batch_start);
+    parallel_for_each_task(
+      curr_batch_size, num_workers, [&](const size_t &itask) {
+        size_t block_start =
+          (batch_start + itask) * PRECONFIG_BITSTREAM_NUM_BLOCKS_PER_TASK;
+        size_t block_end =
+          std::min(config_blocks.size(),
+                   block_start + PRECONFIG_BITSTREAM_NUM_BLOCKS_PER_TASK);
+        for (size_t iblk = block_start; iblk < block_end; ++iblk) {
+          print_verilog_preconfig_top_module_block_bitstream(
+            task_streams[itask], top_block_name, bitstream_manager,
+            config_blocks[iblk], embedded_bitstream_hdl_type,
+            output_datab_bits, little_endian);
+        }
+      });
+    for (size_t itask = 0; itask < curr_batch_size; ++itask) {
+      fp << task_streams[itask].str();
+      /* Release the memory as soon as the task is outputted */
+      task_streams[itask].str(std::string());
     }
-    print_verilog_deposit_wire_constant_values(
-      fp, config_datab_port, config_datab_values, little_endian);
   }
 
   fp << "end" << std::endl;
 
   print_verilog_comment(
-    fp,
-    std::string("----- End deposit bitstream to configuration memories -----"));
+    fp, std::string("----- End " + syntax_name +
+                    " bitstream to configuration memories -----"));
 }
 
 /********************************************************************
@@ -304,7 +305,7 @@ static void print_verilog_preconfig_top_module_load_bitstream(
   const CircuitLibrary &circuit_lib, const CircuitModelId &mem_model,
   const BitstreamManager &bitstream_manager,
   const e_embedded_bitstream_hdl_type &embedded_bitstream_hdl_type,
-  const bool &little_endian) {
+  const bool &little_endian, const size_t &num_threads) {
   /* Skip the datab port if there is only 1 output port in memory model
    * Currently, it assumes that the data output port is always defined while
    * datab is optional If we see only 1 port, we assume datab is not defined by
@@ -322,14 +323,13 @@ static void print_verilog_preconfig_top_module_load_bitstream(
     fp,
     std::string("----- Begin load bitstream to configuration memories -----"));
 
-  /* Use assign syntax for Icarus simulator */
-  if (EMBEDDED_BITSTREAM_HDL_IVERILOG == embedded_bitstream_hdl_type) {
-    print_verilog_preconfig_top_module_force_bitstream(
-      fp, top_block_name, bitstream_manager, output_datab_bits, little_endian);
-    /* Use deposit syntax for other simulators */
-  } else if (EMBEDDED_BITSTREAM_HDL_MODELSIM == embedded_bitstream_hdl_type) {
-    print_verilog_preconfig_top_module_deposit_bitstream(
-      fp, top_block_name, bitstream_manager, output_datab_bits, little_endian);
+  /* Use assign syntax for Icarus simulator and deposit syntax for Modelsim.
+   * Nothing is embedded for other simulators */
+  if ((EMBEDDED_BITSTREAM_HDL_IVERILOG == embedded_bitstream_hdl_type) ||
+      (EMBEDDED_BITSTREAM_HDL_MODELSIM == embedded_bitstream_hdl_type)) {
+    print_verilog_preconfig_top_module_blocks_bitstream(
+      fp, top_block_name, bitstream_manager, embedded_bitstream_hdl_type,
+      output_datab_bits, little_endian, num_threads);
   }
 
   print_verilog_comment(
@@ -483,7 +483,8 @@ int print_verilog_preconfig_top_module(
    * when needed */
   print_verilog_preconfig_top_module_load_bitstream(
     fp, inst_name, circuit_lib, sram_model, bitstream_manager,
-    options.embedded_bitstream_hdl_type(), little_endian);
+    options.embedded_bitstream_hdl_type(), little_endian,
+    options.num_threads());
 
   /* Add signal initialization:
    * Bypass writing codes to files due to the autogenerated codes are very
@@ -509,7 +510,7 @@ int print_verilog_preconfig_top_module(
     options.default_net_type());
 
   /* Close the file stream */
-  fp.close();
+  close_file_mmostream(verilog_fname.c_str(), fp);
 
   return status;
 }
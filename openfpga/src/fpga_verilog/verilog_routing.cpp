@@ -118,14 +118,16 @@ static void print_verilog_routing_connection_box_unique_module(
                 std::to_string(rr_gsb.get_cb_y(cb_type)) + "]"),
     options.time_stamp());
 
-  /* Write the verilog module */
-  write_verilog_module_to_file(fp, module_manager, cb_module, options);
+  /* Write the verilog module under the name of the routing block, which
+   * can be an alias of a module body shared in a flyweight build */
+  write_verilog_module_to_file(fp, module_manager, cb_module, cb_module_name,
+                               options);
 
   /* Add an empty line as a splitter */
   fp << std::endl;
 
   /* Close file handler */
-  fp.close();
+  close_file_mmostream(verilog_fpath.c_str(), fp);
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = NetlistId::INVALID();
@@ -235,11 +237,13 @@ static void print_verilog_routing_switch_box_unique_module(
   ModuleId sb_module = module_manager.find_module(sb_module_name);
   VTR_ASSERT(true == module_manager.valid_module_id(sb_module));
 
-  /* Write the verilog module */
-  write_verilog_module_to_file(fp, module_manager, sb_module, options);
+  /* Write the verilog module under the name of the routing block, which
+   * can be an alias of a module body shared in a flyweight build */
+  write_verilog_module_to_file(fp, module_manager, sb_module, sb_module_name,
+                               options);
 
   /* Close file handler */
-  fp.close();
+  close_file_mmostream(verilog_fpath.c_str(), fp);
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = NetlistId::INVALID();
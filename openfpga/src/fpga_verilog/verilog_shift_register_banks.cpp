@@ -71,7 +71,7 @@ void print_verilog_submodule_shift_register_banks(
   }
 
   /* Close the file stream */
-  fp.close();
+  close_file_mmostream(verilog_fpath.c_str(), fp);
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = NetlistId::INVALID();
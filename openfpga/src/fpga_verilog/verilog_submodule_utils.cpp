@@ -230,7 +230,7 @@ void print_verilog_submodule_templates(const ModuleManager& module_manager,
   }
 
   /* close file stream */
-  fp.close();
+  close_file_mmostream(verilog_fname.c_str(), fp);
 
   /* No need to add the template to the subckt include files! */
   VTR_LOG("Done\n");
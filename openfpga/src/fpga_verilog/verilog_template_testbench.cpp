@@ -124,7 +124,7 @@ int print_verilog_template_testbench(const ModuleManager &module_manager,
                            options.default_net_type());
 
   /* Close the file stream */
-  fp.close();
+  close_file_mmostream(verilog_fname.c_str(), fp);
 
   return status;
 }
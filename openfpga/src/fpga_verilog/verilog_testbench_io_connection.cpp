@@ -105,7 +105,7 @@ int print_verilog_testbench_io_connection(
     little_endian);
 
   /* Close the file stream */
-  fp.close();
+  close_file_mmostream(verilog_fname.c_str(), fp);
 
   return status;
 }
@@ -35,6 +35,7 @@ VerilogTestbenchOption::VerilogTestbenchOption() {
   dump_waveform_ = false;
   little_endian_ = false;
   verbose_output_ = false;
+  num_threads_ = 1;
 
   SIMULATOR_TYPE_STRING_ = {{"iverilog", "vcs"}};
 }
@@ -125,6 +126,8 @@ VerilogTestbenchOption::simulator_type() const {
   return simulator_type_;
 }
 
+size_t VerilogTestbenchOption::num_threads() const { return num_threads_; }
+
 /******************************************************************************
  * Private Mutators
  ******************************************************************************/
@@ -289,6 +292,10 @@ void VerilogTestbenchOption::set_verbose_output(const bool& enabled) {
   verbose_output_ = enabled;
 }
 
+void VerilogTestbenchOption::set_num_threads(const size_t& num_threads) {
+  num_threads_ = num_threads;
+}
+
 int VerilogTestbenchOption::set_simulator_type(const std::string& value) {
   simulator_type_ = str2simulator_type(value);
   return valid_simulator_type(simulator_type_);
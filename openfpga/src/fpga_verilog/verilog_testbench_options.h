@@ -70,6 +70,7 @@ class VerilogTestbenchOption {
   bool little_endian() const;
   bool verbose_output() const;
   e_simulator_type simulator_type() const;
+  size_t num_threads() const;
 
  public: /* Public validator */
   bool validate() const;
@@ -111,6 +112,7 @@ class VerilogTestbenchOption {
   void set_use_relative_path(const bool& enabled);
   void set_little_endian(const bool& enabled);
   void set_verbose_output(const bool& enabled);
+  void set_num_threads(const size_t& num_threads);
 
   /* @brief Create the simulator type by parsing a given string. Return error
    * when failed */
@@ -148,6 +150,9 @@ class VerilogTestbenchOption {
   bool use_relative_path_;
   bool little_endian_;
   bool verbose_output_;
+  /* Number of threads to render the embedded bitstream, 0 means all the
+   * hardware threads */
+  size_t num_threads_;
 };
 
 } /* End namespace openfpga*/
@@ -62,7 +62,7 @@ static int print_verilog_tile_module_netlist(
   fp << std::endl;
 
   /* Close file handler */
-  fp.close();
+  close_file_mmostream(verilog_fpath.c_str(), fp);
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = NetlistId::INVALID();
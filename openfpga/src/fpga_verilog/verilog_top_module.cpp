@@ -65,7 +65,7 @@ void print_verilog_core_module(NetlistManager& netlist_manager,
   fp << std::endl;
 
   /* Close file handler */
-  fp.close();
+  close_file_mmostream(verilog_fpath.c_str(), fp);
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = NetlistId::INVALID();
@@ -127,7 +127,7 @@ void print_verilog_top_module(NetlistManager& netlist_manager,
   fp << std::endl;
 
   /* Close file handler */
-  fp.close();
+  close_file_mmostream(verilog_fpath.c_str(), fp);
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = NetlistId::INVALID();
@@ -2846,7 +2846,7 @@ int print_verilog_full_testbench(
     options.default_net_type());
 
   /* Close the file stream */
-  fp.close();
+  close_file_mmostream(verilog_fname.c_str(), fp);
 
   return status;
 }
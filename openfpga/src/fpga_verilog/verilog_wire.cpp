@@ -144,7 +144,7 @@ void print_verilog_submodule_wires(const ModuleManager& module_manager,
     fp, std::string("----- END Verilog modules for regular wires -----"));
 
   /* Close the file stream */
-  fp.close();
+  close_file_mmostream(verilog_fpath.c_str(), fp);
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = NetlistId::INVALID();
@@ -151,14 +151,24 @@ void print_verilog_endif(mmostream& fp) {
 void print_verilog_module_definition(mmostream& fp,
                                      const ModuleManager& module_manager,
                                      const ModuleId& module_id) {
+  print_verilog_module_definition(fp, module_manager, module_id,
+                                  module_manager.module_name(module_id));
+}
+
+/************************************************
+ * Print a Verilog module definition under a given
+ * module name, e.g., an alias of the module
+ ***********************************************/
+void print_verilog_module_definition(mmostream& fp,
+                                     const ModuleManager& module_manager,
+                                     const ModuleId& module_id,
+                                     const std::string& module_name) {
   VTR_ASSERT(true == valid_file_mmostream(fp));
 
   print_verilog_comment(
-    fp, std::string("----- Verilog module for " +
-                    module_manager.module_name(module_id) + " -----"));
+    fp, std::string("----- Verilog module for " + module_name + " -----"));
 
-  std::string module_head_line =
-    "module " + module_manager.module_name(module_id) + "(";
+  std::string module_head_line = "module " + module_name + "(";
   fp << module_head_line;
 
   /* port type2type mapping */
@@ -354,6 +364,16 @@ void print_verilog_module_declaration(
   mmostream& fp, const ModuleManager& module_manager, const ModuleId& module_id,
   const e_verilog_default_net_type& default_net_type,
   const bool& little_endian) {
+  print_verilog_module_declaration(fp, module_manager, module_id,
+                                   module_manager.module_name(module_id),
+                                   default_net_type, little_endian);
+}
+
+void print_verilog_module_declaration(
+  mmostream& fp, const ModuleManager& module_manager, const ModuleId& module_id,
+  const std::string& module_name,
+  const e_verilog_default_net_type& default_net_type,
+  const bool& little_endian) {
   VTR_ASSERT(true == valid_file_mmostream(fp));
 
   /* Apply default net type from user's option */
@@ -361,7 +381,7 @@ void print_verilog_module_declaration(
     print_verilog_default_net_type_declaration(fp, default_net_type);
   }
 
-  print_verilog_module_definition(fp, module_manager, module_id);
+  print_verilog_module_definition(fp, module_manager, module_id, module_name);
 
   print_verilog_module_ports(fp, module_manager, module_id, default_net_type,
                              little_endian);
@@ -892,10 +912,10 @@ void print_verilog_wire_constant_values_bit_blast(
  * Deposit constant values to a Verilog port
  *******************************************************************/
 void print_verilog_deposit_wire_constant_values(
-  mmostream& fp, const BasicPort& output_port,
+  std::ostream& fp, const BasicPort& output_port,
   const std::vector<size_t>& const_values, const bool& little_endian) {
   /* Make sure we have a valid file handler*/
-  VTR_ASSERT(true == valid_file_mmostream(fp));
+  VTR_ASSERT(true == valid_file_stream(fp));
 
   fp << "\t";
   fp << "$deposit(";
@@ -915,10 +935,10 @@ void print_verilog_deposit_wire_constant_values(
  * Verilog port
  *******************************************************************/
 void print_verilog_force_wire_constant_values(
-  mmostream& fp, const BasicPort& output_port,
+  std::ostream& fp, const BasicPort& output_port,
   const std::vector<size_t>& const_values, const bool& little_endian) {
   /* Make sure we have a valid file handler*/
-  VTR_ASSERT(true == valid_file_mmostream(fp));
+  VTR_ASSERT(true == valid_file_stream(fp));
 
   fp << "\t";
   fp << "force ";
@@ -1750,7 +1770,7 @@ void print_verilog_netlist_include_header_file(
   }
 
   /* close file stream */
-  fp.close();
+  close_file_mmostream(verilog_fname.c_str(), fp);
 }
 
 } /* end namespace openfpga */
@@ -64,6 +64,11 @@ void print_verilog_module_definition(mmostream& fp,
                                      const ModuleManager& module_manager,
                                      const ModuleId& module_id);
 
+void print_verilog_module_definition(mmostream& fp,
+                                     const ModuleManager& module_manager,
+                                     const ModuleId& module_id,
+                                     const std::string& module_name);
+
 void print_verilog_module_ports(
   mmostream& fp, const ModuleManager& module_manager, const ModuleId& module_id,
   const e_verilog_default_net_type& default_net_type,
@@ -74,6 +79,12 @@ void print_verilog_module_declaration(
   const e_verilog_default_net_type& default_net_type,
   const bool& little_endian);
 
+void print_verilog_module_declaration(
+  mmostream& fp, const ModuleManager& module_manager, const ModuleId& module_id,
+  const std::string& module_name,
+  const e_verilog_default_net_type& default_net_type,
+  const bool& little_endian);
+
 void print_verilog_module_instance(
   mmostream& fp, const ModuleManager& module_manager, const ModuleId& module_id,
   const std::string& instance_name,
@@ -136,11 +147,11 @@ void print_verilog_wire_constant_values_bit_blast(
   const std::vector<size_t>& const_values, const bool& little_endian);
 
 void print_verilog_deposit_wire_constant_values(
-  mmostream& fp, const BasicPort& output_port,
+  std::ostream& fp, const BasicPort& output_port,
   const std::vector<size_t>& const_values, const bool& little_endian);
 
 void print_verilog_force_wire_constant_values(
-  mmostream& fp, const BasicPort& output_port,
+  std::ostream& fp, const BasicPort& output_port,
   const std::vector<size_t>& const_values, const bool& little_endian);
 
 void print_verilog_wire_connection(mmostream& fp, const BasicPort& output_port,
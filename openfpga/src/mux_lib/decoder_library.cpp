@@ -3,6 +3,8 @@
  **************************************************************************************/
 #include "decoder_library.h"
 
+#include <functional>
+
 #include "vtr_assert.h"
 
 /* Begin namespace openfpga */
@@ -69,19 +71,14 @@ DecoderId DecoderLibrary::find_decoder(const size_t& addr_size,
                                        const bool& use_data_in,
                                        const bool& use_data_inv_port,
                                        const bool& use_readback) const {
-  for (auto decoder : decoders()) {
-    if ((addr_size == addr_sizes_[decoder]) &&
-        (data_size == data_sizes_[decoder]) &&
-        (use_enable == use_enable_[decoder]) &&
-        (use_data_in == use_data_in_[decoder]) &&
-        (use_data_inv_port == use_data_inv_port_[decoder]) &&
-        (use_readback == use_readback_[decoder])) {
-      return decoder;
-    }
+  auto result = decoder_lookup_.find(
+    decoder_lookup_key(addr_size, data_size, use_enable, use_data_in,
+                       use_data_inv_port, use_readback));
+  if (result == decoder_lookup_.end()) {
+    /* Not found, return an invalid id by default */
+    return DecoderId::INVALID();
   }
-
-  /* Not found, return an invalid id by default */
-  return DecoderId::INVALID();
+  return result->second;
 }
 
 /***************************************************************************************
@@ -114,7 +111,37 @@ DecoderId DecoderLibrary::add_decoder(const size_t& addr_size,
   use_data_inv_port_.push_back(use_data_inv_port);
   use_readback_.push_back(use_readback);
 
+  /* Update the fast look-up. Keep the first decoder for a duplicated
+   * specification, as find_decoder() always did */
+  decoder_lookup_.emplace(
+    decoder_lookup_key(addr_size, data_size, use_enable, use_data_in,
+                       use_data_inv_port, use_readback),
+    decoder);
+
   return decoder;
 }
 
+/***************************************************************************************
+ * Private Accessors : Fast look-up
+ **************************************************************************************/
+DecoderLibrary::DecoderLookupKey DecoderLibrary::decoder_lookup_key(
+  const size_t& addr_size, const size_t& data_size, const bool& use_enable,
+  const bool& use_data_in, const bool& use_data_inv_port,
+  const bool& use_readback) {
+  unsigned flags = (unsigned(use_enable) << 0) | (unsigned(use_data_in) << 1) |
+                   (unsigned(use_data_inv_port) << 2) |
+                   (unsigned(use_readback) << 3);
+  return DecoderLookupKey{addr_size, data_size, flags};
+}
+
+size_t DecoderLibrary::DecoderLookupKeyHash::operator()(
+  const DecoderLookupKey& key) const {
+  size_t seed = std::hash<size_t>()(key.addr_size);
+  seed ^= std::hash<size_t>()(key.data_size) + 0x9e3779b9 + (seed << 6) +
+          (seed >> 2);
+  seed ^= std::hash<unsigned>()(key.flags) + 0x9e3779b9 + (seed << 6) +
+          (seed >> 2);
+  return seed;
+}
+
 } /* End namespace openfpga*/
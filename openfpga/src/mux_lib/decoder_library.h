@@ -22,6 +22,8 @@
 #ifndef DECODER_LIBRARY_H
 #define DECODER_LIBRARY_H
 
+#include <unordered_map>
+
 #include "decoder_library_fwd.h"
 #include "vtr_range.h"
 #include "vtr_vector.h"
@@ -87,6 +89,24 @@ class DecoderLibrary {
   vtr::vector<DecoderId, bool> use_data_in_;
   vtr::vector<DecoderId, bool> use_data_inv_port_;
   vtr::vector<DecoderId, bool> use_readback_;
+
+  /* A fast look-up to find decoders with a given specification. The key packs
+   * the address size, data size and all the flags */
+  struct DecoderLookupKey {
+    size_t addr_size;
+    size_t data_size;
+    unsigned flags;
+    bool operator==(const DecoderLookupKey& other) const = default;
+  };
+  struct DecoderLookupKeyHash {
+    size_t operator()(const DecoderLookupKey& key) const;
+  };
+  static DecoderLookupKey decoder_lookup_key(
+    const size_t& addr_size, const size_t& data_size, const bool& use_enable,
+    const bool& use_data_in, const bool& use_data_inv_port,
+    const bool& use_readback);
+  std::unordered_map<DecoderLookupKey, DecoderId, DecoderLookupKeyHash>
+    decoder_lookup_;
 };
 
 } /* End namespace openfpga*/
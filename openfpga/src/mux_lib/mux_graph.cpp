@@ -46,28 +46,11 @@ MuxGraph::node_range MuxGraph::nodes() const {
   return vtr::make_range(node_ids_.begin(), node_ids_.end());
 }
 
-/* Find the non-input nodes */
-std::vector<MuxNodeId> MuxGraph::non_input_nodes() const {
+/* Find the non-input nodes, level by level */
+std::span<const MuxNodeId> MuxGraph::non_input_nodes() const {
   /* Must be an valid graph */
   VTR_ASSERT_SAFE(valid_mux_graph());
-  std::vector<MuxNodeId> node_list;
-
-  /* Build the node list, level by level */
-  for (size_t level = 0; level < num_node_levels(); ++level) {
-    for (size_t node_type = 0; node_type < size_t(NUM_MUX_NODE_TYPES);
-         ++node_type) {
-      /* Bypass any nodes which are not OUTPUT and INTERNAL */
-      if (size_t(MUX_INPUT_NODE) == node_type) {
-        continue;
-      }
-      /* Reach here, this is either an OUTPUT or INTERNAL node */
-      for (auto node : node_lookup_[level][node_type]) {
-        node_list.push_back(node);
-      }
-    }
-  }
-
-  return node_list;
+  return non_input_nodes_;
 }
 
 MuxGraph::edge_range MuxGraph::edges() const {
@@ -102,52 +85,28 @@ std::vector<size_t> MuxGraph::node_levels() const {
 size_t MuxGraph::num_inputs() const {
   /* need to check if the graph is valid or not */
   VTR_ASSERT_SAFE(valid_mux_graph());
-  /* Sum up the number of INPUT nodes in each level */
-  size_t num_inputs = 0;
-  for (auto node_per_level : node_lookup_) {
-    num_inputs += node_per_level[MUX_INPUT_NODE].size();
-  }
-  return num_inputs;
+  return input_nodes_.size();
 }
 
 /* Return the node ids of all the inputs of the multiplexer */
-std::vector<MuxNodeId> MuxGraph::inputs() const {
-  std::vector<MuxNodeId> input_nodes;
+std::span<const MuxNodeId> MuxGraph::inputs() const {
   /* need to check if the graph is valid or not */
   VTR_ASSERT_SAFE(valid_mux_graph());
-  /* Add the input nodes in each level */
-  for (auto node_per_level : node_lookup_) {
-    input_nodes.insert(input_nodes.end(),
-                       node_per_level[MUX_INPUT_NODE].begin(),
-                       node_per_level[MUX_INPUT_NODE].end());
-  }
-  return input_nodes;
+  return input_nodes_;
 }
 
 /* Find the number of outputs in the MUX graph */
 size_t MuxGraph::num_outputs() const {
   /* need to check if the graph is valid or not */
   VTR_ASSERT_SAFE(valid_mux_graph());
-  /* Sum up the number of INPUT nodes in each level */
-  size_t num_outputs = 0;
-  for (auto node_per_level : node_lookup_) {
-    num_outputs += node_per_level[MUX_OUTPUT_NODE].size();
-  }
-  return num_outputs;
+  return output_nodes_.size();
 }
 
 /* Return the node ids of all the outputs of the multiplexer */
-std::vector<MuxNodeId> MuxGraph::outputs() const {
-  std::vector<MuxNodeId> output_nodes;
+std::span<const MuxNodeId> MuxGraph::outputs() const {
   /* need to check if the graph is valid or not */
   VTR_ASSERT_SAFE(valid_mux_graph());
-  /* Add the output nodes in each level */
-  for (auto node_per_level : node_lookup_) {
-    output_nodes.insert(output_nodes.end(),
-                        node_per_level[MUX_OUTPUT_NODE].begin(),
-                        node_per_level[MUX_OUTPUT_NODE].end());
-  }
-  return output_nodes;
+  return output_nodes_;
 }
 
 /* Find the edge between two MUX nodes */
@@ -158,12 +117,10 @@ std::vector<MuxEdgeId> MuxGraph::find_edges(const MuxNodeId& from_node,
   VTR_ASSERT(valid_node_id(from_node));
   VTR_ASSERT(valid_node_id(to_node));
 
-  for (const auto& edge : node_out_edges_[from_node]) {
-    for (const auto& cand : edge_sink_nodes_[edge]) {
-      if (cand == to_node) {
-        /* This is the wanted edge, add to list */
-        edges.push_back(edge);
-      }
+  for (const auto& edge : node_out_edges(from_node)) {
+    if (edge_sink_nodes_[edge] == to_node) {
+      /* This is the wanted edge, add to list */
+      edges.push_back(edge);
     }
   }
 
@@ -202,7 +159,8 @@ size_t MuxGraph::num_memory_bits_at_level(const size_t& level) const {
 }
 
 /* Return memory id at level */
-std::vector<MuxMemId> MuxGraph::memories_at_level(const size_t& level) const {
+const std::vector<MuxMemId>& MuxGraph::memories_at_level(
+  const size_t& level) const {
   /* need to check if the graph is valid or not */
   VTR_ASSERT_SAFE(valid_level(level));
   VTR_ASSERT_SAFE(valid_mux_graph());
@@ -238,17 +196,41 @@ size_t MuxGraph::node_index_at_level(const MuxNodeId& node) const {
 }
 
 /* Find the  input edges for a node */
-std::vector<MuxEdgeId> MuxGraph::node_in_edges(const MuxNodeId& node) const {
+std::span<const MuxEdgeId> MuxGraph::node_in_edges(
+  const MuxNodeId& node) const {
   /* validate the node */
   VTR_ASSERT(valid_node_id(node));
-  return node_in_edges_[node];
+  return std::span<const MuxEdgeId>(node_in_edge_list_)
+    .subspan(node_in_edge_offsets_[size_t(node)],
+             node_in_edge_offsets_[size_t(node) + 1] -
+               node_in_edge_offsets_[size_t(node)]);
 }
 
-/* Find the input nodes for a edge */
-std::vector<MuxNodeId> MuxGraph::edge_src_nodes(const MuxEdgeId& edge) const {
+/* Find the output edges for a node */
+std::span<const MuxEdgeId> MuxGraph::node_out_edges(
+  const MuxNodeId& node) const {
+  /* validate the node */
+  VTR_ASSERT(valid_node_id(node));
+  return std::span<const MuxEdgeId>(node_out_edge_list_)
+    .subspan(node_out_edge_offsets_[size_t(node)],
+             node_out_edge_offsets_[size_t(node) + 1] -
+               node_out_edge_offsets_[size_t(node)]);
+}
+
+/* Find the input nodes for a edge. Each edge has exactly one source node */
+std::span<const MuxNodeId> MuxGraph::edge_src_nodes(
+  const MuxEdgeId& edge) const {
   /* validate the edge */
   VTR_ASSERT(valid_edge_id(edge));
-  return edge_src_nodes_[edge];
+  return std::span<const MuxNodeId>(&edge_src_nodes_[edge], 1);
+}
+
+/* Find the output nodes for a edge. Each edge has exactly one sink node */
+std::span<const MuxNodeId> MuxGraph::edge_sink_nodes(
+  const MuxEdgeId& edge) const {
+  /* validate the edge */
+  VTR_ASSERT(valid_edge_id(edge));
+  return std::span<const MuxNodeId>(&edge_sink_nodes_[edge], 1);
 }
 
 /* Find the mem that control the edge */
@@ -277,7 +259,7 @@ std::vector<size_t> MuxGraph::branch_sizes() const {
       continue;
     }
 
-    size_t branch_size = node_in_edges_[node].size();
+    size_t branch_size = node_in_edges(node).size();
 
     /* make sure the branch size is valid */
     VTR_ASSERT_SAFE(valid_mux_implementation_num_inputs(branch_size));
@@ -316,7 +298,7 @@ std::vector<size_t> MuxGraph::branch_sizes(const size_t& level) const {
       continue;
     }
 
-    size_t branch_size = node_in_edges_[node].size();
+    size_t branch_size = node_in_edges(node).size();
 
     /* make sure the branch size is valid */
     VTR_ASSERT_SAFE(valid_mux_implementation_num_inputs(branch_size));
@@ -366,10 +348,9 @@ MuxGraph MuxGraph::subgraph(const MuxNodeId& root_node) const {
 
   /* Add input nodes and edges to subgraph */
   size_t input_cnt = 0;
-  for (auto edge_origin : this->node_in_edges_[root_node]) {
-    VTR_ASSERT_SAFE(1 == edge_src_nodes_[edge_origin].size());
+  for (auto edge_origin : this->node_in_edges(root_node)) {
     /* Add nodes */
-    MuxNodeId from_node_origin = this->edge_src_nodes_[edge_origin][0];
+    MuxNodeId from_node_origin = this->edge_src_nodes_[edge_origin];
     MuxNodeId from_node_subgraph = mux_graph.add_node(MUX_INPUT_NODE);
     /* Configure the nodes */
     mux_graph.node_levels_[from_node_subgraph] = 0;
@@ -392,7 +373,7 @@ MuxGraph MuxGraph::subgraph(const MuxNodeId& root_node) const {
   std::map<MuxMemId, MuxMemId> mem2mem_map;
 
   /* Add memory bits and configure edges */
-  for (auto edge_origin : this->node_in_edges_[root_node]) {
+  for (auto edge_origin : this->node_in_edges(root_node)) {
     MuxMemId mem_origin = this->edge_mem_ids_[edge_origin];
     /* Try to find if the mem is already in the list */
     std::map<MuxMemId, MuxMemId>::iterator it = mem2mem_map.find(mem_origin);
@@ -415,6 +396,7 @@ MuxGraph MuxGraph::subgraph(const MuxNodeId& root_node) const {
   /* Since the graph is finalized, it is time to build the fast look-up */
   mux_graph.build_node_lookup();
   mux_graph.build_mem_lookup();
+  mux_graph.build_edge_lookup();
 
   return mux_graph;
 }
@@ -441,7 +423,7 @@ std::vector<MuxGraph> MuxGraph::build_mux_branch_graphs() const {
       continue;
     }
 
-    size_t branch_size = node_in_edges_[node].size();
+    size_t branch_size = node_in_edges(node).size();
 
     /* make sure the branch size is valid */
     VTR_ASSERT_SAFE(valid_mux_implementation_num_inputs(branch_size));
@@ -498,30 +480,18 @@ bool MuxGraph::is_node_output(const MuxNodeId& node_id) const {
 
 /* Get the node id of a given input */
 MuxNodeId MuxGraph::node_id(const MuxInputId& input_id) const {
-  /* Use the node_lookup to accelerate the search */
-  for (const auto& lvl : node_lookup_) {
-    for (const auto& cand_node : lvl[MUX_INPUT_NODE]) {
-      if (input_id == node_input_ids_[cand_node]) {
-        return cand_node;
-      }
-    }
+  if (size_t(input_id) >= input_id_nodes_.size()) {
+    return MuxNodeId::INVALID();
   }
-
-  return MuxNodeId::INVALID();
+  return input_id_nodes_[input_id];
 }
 
 /* Get the node id of a given output */
 MuxNodeId MuxGraph::node_id(const MuxOutputId& output_id) const {
-  /* Use the node_lookup to accelerate the search */
-  for (const auto& lvl : node_lookup_) {
-    for (const auto& cand_node : lvl[MUX_OUTPUT_NODE]) {
-      if (output_id == node_output_ids_[cand_node]) {
-        return cand_node;
-      }
-    }
+  if (size_t(output_id) >= output_id_nodes_.size()) {
+    return MuxNodeId::INVALID();
   }
-
-  return MuxNodeId::INVALID();
+  return output_id_nodes_[output_id];
 }
 
 /* Get the node id w.r.t. the node level and node_index at the level
@@ -529,34 +499,12 @@ MuxNodeId MuxGraph::node_id(const MuxOutputId& output_id) const {
  */
 MuxNodeId MuxGraph::node_id(const size_t& node_level,
                             const size_t& node_index_at_level) const {
-  /* Ensure we have a valid node_look-up */
-  VTR_ASSERT_SAFE(valid_node_lookup());
-
-  MuxNodeId ret_node = MuxNodeId::INVALID();
-
   /* Search in the fast look up */
-  if (node_level >= node_lookup_.size()) {
-    return ret_node;
-  }
-
-  size_t node_cnt = 0;
-  /* Node level is valid, search in the node list */
-  for (const auto& nodes_by_type : node_lookup_[node_level]) {
-    /* Search the node_index_at_level of each node */
-    for (const auto& node : nodes_by_type) {
-      if (node_index_at_level != node_ids_at_level_[node]) {
-        continue;
-      }
-      /* Find the node, assign value and update the counter */
-      ret_node = node;
-      node_cnt++;
-    }
+  if ((node_level >= level_nodes_.size()) ||
+      (node_index_at_level >= level_nodes_[node_level].size())) {
+    return MuxNodeId::INVALID();
   }
-
-  /* We should either find a node or nothing */
-  VTR_ASSERT((0 == node_cnt) || (1 == node_cnt));
-
-  return ret_node;
+  return level_nodes_[node_level][node_index_at_level];
 }
 
 /* Decode memory bits based on an input id and an output id */
@@ -592,8 +540,8 @@ vtr::vector<MuxMemId, bool> MuxGraph::decode_memory_bits(
      * If the node has not been visited,
      * then mark it visited and enqueue it
      */
-    VTR_ASSERT_SAFE(1 == node_out_edges_[node_to_expand].size());
-    MuxEdgeId edge = node_out_edges_[node_to_expand][0];
+    VTR_ASSERT_SAFE(1 == node_out_edges(node_to_expand).size());
+    MuxEdgeId edge = node_out_edges(node_to_expand)[0];
 
     /* Configure the mem bits:
      * if inv_mem is enabled, it means 0 to enable this edge
@@ -607,11 +555,8 @@ vtr::vector<MuxMemId, bool> MuxGraph::decode_memory_bits(
       mem_bits[mem] = true;
     }
 
-    /* each edge must have 1 fan-out */
-    VTR_ASSERT_SAFE(1 == edge_sink_nodes_[edge].size());
-
-    /* Get the fan-out node */
-    MuxNodeId next_node = edge_sink_nodes_[edge][0];
+    /* Get the fan-out node, each edge has 1 fan-out */
+    MuxNodeId next_node = edge_sink_nodes_[edge];
 
     /* If next node is the output node we want, we can finish here */
     if (next_node == node_id(output_id)) {
@@ -670,7 +615,7 @@ MuxInputId MuxGraph::find_input_node_driven_by_output_node(
      * then mark it visited and enqueue it
      */
     MuxEdgeId next_edge = MuxEdgeId::INVALID();
-    for (const MuxEdgeId& edge : node_in_edges_[node_to_expand]) {
+    for (const MuxEdgeId& edge : node_in_edges(node_to_expand)) {
       /* Configure the mem bits and find the edge that will propagate the signal
        * if inv_mem is enabled, it means false to enable this edge
        * otherwise, it is true to enable this edge
@@ -685,11 +630,8 @@ MuxInputId MuxGraph::find_input_node_driven_by_output_node(
     /* We must have a valid next edge */
     VTR_ASSERT(MuxEdgeId::INVALID() != next_edge);
 
-    /* each edge must have 1 fan-out */
-    VTR_ASSERT_SAFE(1 == edge_src_nodes_[next_edge].size());
-
-    /* Get the fan-in node */
-    MuxNodeId next_node = edge_src_nodes_[next_edge][0];
+    /* Get the fan-in node, each edge has 1 fan-in */
+    MuxNodeId next_node = edge_src_nodes_[next_edge];
 
     /* If next node is an input node, we can finish here */
     if (true == is_node_input(next_node)) {
@@ -724,8 +666,6 @@ MuxNodeId MuxGraph::add_node(const enum e_mux_graph_node_type& node_type) {
   node_output_ids_.push_back(MuxOutputId::INVALID());
   node_levels_.push_back(-1);
   node_ids_at_level_.push_back(-1);
-  node_in_edges_.emplace_back();
-  node_out_edges_.emplace_back();
 
   return node;
 }
@@ -741,16 +681,13 @@ MuxEdgeId MuxGraph::add_edge(const MuxNodeId& from_node,
   edge_mem_ids_.push_back(MuxMemId::INVALID());
   edge_inv_mem_.push_back(false);
 
-  /* update the edge-node connections */
+  /* update the edge-node connections. The node-to-edge relations are built
+   * by build_edge_lookup() once the graph is finalized */
   VTR_ASSERT(valid_node_id(from_node));
-  edge_src_nodes_.emplace_back();
-  edge_src_nodes_[edge].push_back(from_node);
-  node_out_edges_[from_node].push_back(edge);
+  edge_src_nodes_.push_back(from_node);
 
   VTR_ASSERT(valid_node_id(to_node));
-  edge_sink_nodes_.emplace_back();
-  edge_sink_nodes_[edge].push_back(to_node);
-  node_in_edges_[to_node].push_back(edge);
+  edge_sink_nodes_.push_back(to_node);
 
   return edge;
 }
@@ -1138,6 +1075,7 @@ void MuxGraph::build_mux_graph(const CircuitLibrary& circuit_lib,
   /* Since the graph is finalized, it is time to build the fast look-up */
   build_node_lookup();
   build_mem_lookup();
+  build_edge_lookup();
 
   /* For fracturable LUTs, we need to add more outputs to the MUX graph */
   if ((CIRCUIT_MODEL_LUT == circuit_lib.model_type(circuit_model)) &&
@@ -1168,6 +1106,50 @@ void MuxGraph::build_node_lookup() {
   for (auto node : nodes()) {
     node_lookup_[node_levels_[node]][size_t(node_types_[node])].push_back(node);
   }
+
+  /* Build the input, output and level tables in the order of the lookup */
+  input_nodes_.clear();
+  output_nodes_.clear();
+  non_input_nodes_.clear();
+  input_id_nodes_.clear();
+  output_id_nodes_.clear();
+  level_nodes_.assign(node_lookup_.size(), std::vector<MuxNodeId>());
+  for (size_t lvl = 0; lvl < node_lookup_.size(); ++lvl) {
+    for (size_t node_type = 0; node_type < size_t(NUM_MUX_NODE_TYPES);
+         ++node_type) {
+      for (const MuxNodeId& node : node_lookup_[lvl][node_type]) {
+        if (size_t(MUX_INPUT_NODE) == node_type) {
+          input_nodes_.push_back(node);
+        } else {
+          non_input_nodes_.push_back(node);
+        }
+        if (size_t(MUX_OUTPUT_NODE) == node_type) {
+          output_nodes_.push_back(node);
+        }
+        /* Each index at a level should be used by only one node */
+        size_t index_at_level = node_ids_at_level_[node];
+        if (index_at_level >= level_nodes_[lvl].size()) {
+          level_nodes_[lvl].resize(index_at_level + 1, MuxNodeId::INVALID());
+        }
+        VTR_ASSERT(MuxNodeId::INVALID() == level_nodes_[lvl][index_at_level]);
+        level_nodes_[lvl][index_at_level] = node;
+      }
+    }
+  }
+  for (const MuxNodeId& node : input_nodes_) {
+    MuxInputId input_id = node_input_ids_[node];
+    if (size_t(input_id) >= input_id_nodes_.size()) {
+      input_id_nodes_.resize(size_t(input_id) + 1, MuxNodeId::INVALID());
+    }
+    input_id_nodes_[input_id] = node;
+  }
+  for (const MuxNodeId& node : output_nodes_) {
+    MuxOutputId output_id = node_output_ids_[node];
+    if (size_t(output_id) >= output_id_nodes_.size()) {
+      output_id_nodes_.resize(size_t(output_id) + 1, MuxNodeId::INVALID());
+    }
+    output_id_nodes_[output_id] = node;
+  }
 }
 
 /* Build fast mem lookup */
@@ -1189,6 +1171,36 @@ void MuxGraph::build_mem_lookup() {
   }
 }
 
+/* Build the CSR tables of incoming and outgoing edges for each node.
+ * Edges are kept in the ascending order of ids for each node, which is the
+ * order they are added to the graph
+ */
+void MuxGraph::build_edge_lookup() {
+  node_in_edge_offsets_.assign(node_ids_.size() + 1, 0);
+  node_out_edge_offsets_.assign(node_ids_.size() + 1, 0);
+  for (const MuxEdgeId& edge : edges()) {
+    node_in_edge_offsets_[size_t(edge_sink_nodes_[edge]) + 1]++;
+    node_out_edge_offsets_[size_t(edge_src_nodes_[edge]) + 1]++;
+  }
+  for (size_t inode = 0; inode < node_ids_.size(); ++inode) {
+    node_in_edge_offsets_[inode + 1] += node_in_edge_offsets_[inode];
+    node_out_edge_offsets_[inode + 1] += node_out_edge_offsets_[inode];
+  }
+
+  node_in_edge_list_.resize(edge_ids_.size());
+  node_out_edge_list_.resize(edge_ids_.size());
+  std::vector<size_t> in_edge_cursors(node_in_edge_offsets_.begin(),
+                                      node_in_edge_offsets_.end() - 1);
+  std::vector<size_t> out_edge_cursors(node_out_edge_offsets_.begin(),
+                                       node_out_edge_offsets_.end() - 1);
+  for (const MuxEdgeId& edge : edges()) {
+    node_in_edge_list_[in_edge_cursors[size_t(edge_sink_nodes_[edge])]++] =
+      edge;
+    node_out_edge_list_[out_edge_cursors[size_t(edge_src_nodes_[edge])]++] =
+      edge;
+  }
+}
+
 /* Invalidate (empty) the node fast lookup*/
 void MuxGraph::invalidate_node_lookup() { node_lookup_.clear(); }
 
@@ -1215,36 +1227,18 @@ bool MuxGraph::valid_mem_id(const MuxMemId& mem) const {
 /* validate an input id (from which data path signal will be progagated to the
  * output) */
 bool MuxGraph::valid_input_id(const MuxInputId& input_id) const {
-  for (const auto& lvl : node_lookup_) {
-    for (const auto& node : lvl[MUX_INPUT_NODE]) {
-      if (size_t(input_id) > size_t(node_input_ids_[node])) {
-        return false;
-      }
-    }
-  }
-
-  return true;
+  return MuxNodeId::INVALID() != node_id(input_id);
 }
 
 /* validate an output id */
 bool MuxGraph::valid_output_id(const MuxOutputId& output_id) const {
-  for (const auto& lvl : node_lookup_) {
-    for (const auto& node : lvl[MUX_OUTPUT_NODE]) {
-      if (size_t(output_id) > size_t(node_output_ids_[node])) {
-        return false;
-      }
-    }
-  }
-
-  return true;
+  return MuxNodeId::INVALID() != node_id(output_id);
 }
 
 bool MuxGraph::valid_level(const size_t& level) const {
   return level < num_node_levels();
 }
 
-bool MuxGraph::valid_node_lookup() const { return node_lookup_.empty(); }
-
 /* validate a mux graph and see if it is valid */
 bool MuxGraph::valid_mux_graph() const {
   /* A valid MUX graph should be
@@ -1257,7 +1251,7 @@ bool MuxGraph::valid_mux_graph() const {
       continue;
     }
     /* other nodes should have 1 fan-out */
-    if (1 != node_out_edges_[node].size()) {
+    if (1 != node_out_edges(node).size()) {
       return false;
     }
   }
@@ -1266,13 +1260,10 @@ bool MuxGraph::valid_mux_graph() const {
   for (const auto& node : nodes()) {
     if (MUX_INPUT_NODE == node_types_[node]) {
       MuxNodeId next_node = node;
-      while (0 < node_out_edges_[next_node].size()) {
-        MuxEdgeId edge = node_out_edges_[next_node][0];
-        /* each edge must have 1 fan-out */
-        if (1 != edge_sink_nodes_[edge].size()) {
-          return false;
-        }
-        next_node = edge_sink_nodes_[edge][0];
+      while (0 < node_out_edges(next_node).size()) {
+        /* each edge has 1 fan-out by construction */
+        MuxEdgeId edge = node_out_edges(next_node)[0];
+        next_node = edge_sink_nodes_[edge];
       }
       if (MUX_OUTPUT_NODE != node_types_[next_node]) {
         return false;
@@ -5,6 +5,7 @@
  * Include header files required by the data structure definition
  *******************************************************************/
 #include <map>
+#include <span>
 
 #include "circuit_library.h"
 #include "mux_graph_fwd.h"
@@ -38,6 +39,10 @@ namespace openfpga {
  * mux_inputs--->| Branch[N] |--->|        |
  *               +-----------+    +--------+
  *
+ * Once built, a graph is never modified. Node-to-edge relations are stored
+ * in a compressed sparse row (CSR) layout, and the input, output and level
+ * tables are precomputed, so that graphs can be shared by reference and
+ * queried without allocation
  *************************************************/
 class MuxGraph {
  private: /* data types used only in this class */
@@ -69,7 +74,7 @@ class MuxGraph {
  public: /* Public accessors: Aggregates */
   node_range nodes() const;
   /* Find the non-input nodes */
-  std::vector<MuxNodeId> non_input_nodes() const;
+  std::span<const MuxNodeId> non_input_nodes() const;
   edge_range edges() const;
   mem_range memories() const;
   /* Find the number of levels in terms of the multiplexer */
@@ -80,10 +85,10 @@ class MuxGraph {
  public: /* Public accessors: Data query */
   /* Find the number of inputs in the MUX graph */
   size_t num_inputs() const;
-  std::vector<MuxNodeId> inputs() const;
+  std::span<const MuxNodeId> inputs() const;
   /* Find the number of outputs in the MUX graph */
   size_t num_outputs() const;
-  std::vector<MuxNodeId> outputs() const;
+  std::span<const MuxNodeId> outputs() const;
   /* Find the edge between two MUX nodes */
   std::vector<MuxEdgeId> find_edges(const MuxNodeId& from_node,
                                     const MuxNodeId& to_node) const;
@@ -95,7 +100,7 @@ class MuxGraph {
   /* Find the number of SRAMs at a level in the MUX graph */
   size_t num_memory_bits_at_level(const size_t& level) const;
   /* Return memory id at level */
-  std::vector<MuxMemId> memories_at_level(const size_t& level) const;
+  const std::vector<MuxMemId>& memories_at_level(const size_t& level) const;
   /* Find the number of nodes at a given level in the MUX graph */
   size_t num_nodes_at_level(const size_t& level) const;
   /* Find the level of a node */
@@ -103,9 +108,13 @@ class MuxGraph {
   /* Find the index of a node at its level */
   size_t node_index_at_level(const MuxNodeId& node) const;
   /* Find the input edges for a node */
-  std::vector<MuxEdgeId> node_in_edges(const MuxNodeId& node) const;
+  std::span<const MuxEdgeId> node_in_edges(const MuxNodeId& node) const;
+  /* Find the output edges for a node */
+  std::span<const MuxEdgeId> node_out_edges(const MuxNodeId& node) const;
   /* Find the input nodes for a edge */
-  std::vector<MuxNodeId> edge_src_nodes(const MuxEdgeId& edge) const;
+  std::span<const MuxNodeId> edge_src_nodes(const MuxEdgeId& edge) const;
+  /* Find the output nodes for a edge */
+  std::span<const MuxNodeId> edge_sink_nodes(const MuxEdgeId& edge) const;
   /* Find the mem that control the edge */
   MuxMemId find_edge_mem(const MuxEdgeId& edge) const;
   /* Identify if the edge is controlled by the inverted output of a mem */
@@ -175,10 +184,12 @@ class MuxGraph {
    * design specifications */
   void add_fracturable_outputs(const CircuitLibrary& circuit_lib,
                                const CircuitModelId& circuit_model);
-  /* Build fast node lookup */
+  /* Build fast node lookup, as well as the input, output and level tables */
   void build_node_lookup();
   /* Build fast mem lookup */
   void build_mem_lookup();
+  /* Build the CSR tables of node-to-edge relations */
+  void build_edge_lookup();
 
  private: /* Private validators */
   /* valid ids */
@@ -188,8 +199,7 @@ class MuxGraph {
   bool valid_input_id(const MuxInputId& input_id) const;
   bool valid_output_id(const MuxOutputId& output_id) const;
   bool valid_level(const size_t& level) const;
-  /* validate/invalidate node lookup */
-  bool valid_node_lookup() const;
+  /* invalidate node lookup */
   void invalidate_node_lookup();
   void invalidate_mem_lookup();
   /* validate graph */
@@ -207,16 +217,18 @@ class MuxGraph {
     node_levels_; /* at which level, each node belongs to */
   vtr::vector<MuxNodeId, size_t>
     node_ids_at_level_; /* the index at the level that each node belongs to */
-  vtr::vector<MuxNodeId, std::vector<MuxEdgeId>>
-    node_in_edges_; /* ids of incoming edges to each node */
-  vtr::vector<MuxNodeId, std::vector<MuxEdgeId>>
-    node_out_edges_; /* ids of outgoing edges from each node */
+  /* ids of incoming/outgoing edges of each node in CSR layout: the edges of
+   * node i are in [offsets[i], offsets[i + 1]) of the edge list */
+  std::vector<size_t> node_in_edge_offsets_;
+  std::vector<MuxEdgeId> node_in_edge_list_;
+  std::vector<size_t> node_out_edge_offsets_;
+  std::vector<MuxEdgeId> node_out_edge_list_;
 
   vtr::vector<MuxEdgeId, MuxEdgeId> edge_ids_; /* Unique ids for each edge */
-  vtr::vector<MuxEdgeId, std::vector<MuxNodeId>>
-    edge_src_nodes_; /* source nodes drive this edge */
-  vtr::vector<MuxEdgeId, std::vector<MuxNodeId>>
-    edge_sink_nodes_; /* sink nodes this edge drives */
+  vtr::vector<MuxEdgeId, MuxNodeId>
+    edge_src_nodes_; /* source node drives this edge */
+  vtr::vector<MuxEdgeId, MuxNodeId>
+    edge_sink_nodes_; /* sink node this edge drives */
   vtr::vector<MuxEdgeId, CircuitModelId>
     edge_models_; /* type of each edge: tgate/pass-gate */
   vtr::vector<MuxEdgeId, MuxMemId>
@@ -230,10 +242,18 @@ class MuxGraph {
 
   /* fast look-up */
   typedef std::vector<std::vector<std::vector<MuxNodeId>>> NodeLookup;
-  mutable NodeLookup
-    node_lookup_; /* [num_levels][num_types][num_nodes_per_level] */
+  NodeLookup node_lookup_; /* [num_levels][num_types][num_nodes_per_level] */
   typedef std::vector<std::vector<MuxMemId>> MemLookup;
-  mutable MemLookup mem_lookup_; /* [num_levels][num_mems_per_level] */
+  MemLookup mem_lookup_; /* [num_levels][num_mems_per_level] */
+
+  /* Precomputed tables, which follow the order of the node look-up */
+  std::vector<MuxNodeId> input_nodes_;
+  std::vector<MuxNodeId> output_nodes_;
+  std::vector<MuxNodeId> non_input_nodes_;
+  vtr::vector<MuxInputId, MuxNodeId> input_id_nodes_;
+  vtr::vector<MuxOutputId, MuxNodeId> output_id_nodes_;
+  std::vector<std::vector<MuxNodeId>>
+    level_nodes_; /* [num_levels][num_nodes_per_level] */
 };
 
 } /* End namespace openfpga*/
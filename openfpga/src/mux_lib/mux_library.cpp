@@ -5,6 +5,8 @@
 
 #include "mux_library.h"
 
+#include <functional>
+
 #include "vtr_assert.h"
 
 /* begin namespace openfpga */
@@ -24,15 +26,16 @@ MuxLibrary::mux_range MuxLibrary::muxes() const {
 /**************************************************
  * Public accessors: data query
  *************************************************/
-/* Get a MUX graph (read-only) */
+/* Get a MUX graph (read-only)
+ * Return an invalid id if there is no mux graph for the circuit model and size
+ */
 MuxId MuxLibrary::mux_graph(const CircuitModelId& circuit_model,
                             const size_t& mux_size) const {
-  /* Make sure we have a valid mux look-up */
-  VTR_ASSERT_SAFE(valid_mux_lookup());
-  /* Validate circuit model id and mux_size */
-  VTR_ASSERT_SAFE(valid_mux_size(circuit_model, mux_size));
-
-  return mux_lookup_[circuit_model][mux_size];
+  auto result = mux_lookup_.find(MuxLookupKey(circuit_model, mux_size));
+  if (result == mux_lookup_.end()) {
+    return MuxId::INVALID();
+  }
+  return result->second;
 }
 
 const MuxGraph& MuxLibrary::mux_graph(const MuxId& mux_id) const {
@@ -78,7 +81,7 @@ void MuxLibrary::add_mux(const CircuitLibrary& circuit_lib,
   mux_circuit_models_.push_back(circuit_model);
 
   /* update mux_lookup*/
-  mux_lookup_[circuit_model][mux_size] = mux;
+  mux_lookup_[MuxLookupKey(circuit_model, mux_size)] = mux;
 }
 
 /**************************************************
@@ -88,22 +91,18 @@ bool MuxLibrary::valid_mux_id(const MuxId& mux) const {
   return size_t(mux) < mux_ids_.size() && mux_ids_[mux] == mux;
 }
 
-bool MuxLibrary::valid_mux_lookup() const { return mux_lookup_.empty(); }
-
-bool MuxLibrary::valid_mux_circuit_model_id(
-  const CircuitModelId& circuit_model) const {
-  MuxLookup::iterator it = mux_lookup_.find(circuit_model);
-  return (it != mux_lookup_.end());
-}
-
 bool MuxLibrary::valid_mux_size(const CircuitModelId& circuit_model,
                                 const size_t& mux_size) const {
-  if (false == valid_mux_circuit_model_id(circuit_model)) {
-    return false;
-  }
-  std::map<size_t, MuxId>::iterator it =
-    mux_lookup_[circuit_model].find(mux_size);
-  return (it != mux_lookup_[circuit_model].end());
+  return mux_lookup_.end() !=
+         mux_lookup_.find(MuxLookupKey(circuit_model, mux_size));
+}
+
+size_t MuxLibrary::MuxLookupKeyHash::operator()(
+  const MuxLookupKey& key) const {
+  size_t seed = std::hash<size_t>()(size_t(key.first));
+  seed ^= std::hash<size_t>()(key.second) + 0x9e3779b9 + (seed << 6) +
+          (seed >> 2);
+  return seed;
 }
 
 /**************************************************
@@ -10,7 +10,8 @@
 #ifndef MUX_LIBRARY_H
 #define MUX_LIBRARY_H
 
-#include <map>
+#include <unordered_map>
+#include <utility>
 
 #include "mux_graph.h"
 #include "mux_library_fwd.h"
@@ -46,8 +47,6 @@ class MuxLibrary {
   bool valid_mux_id(const MuxId& mux) const;
 
  private: /* Private accessors */
-  bool valid_mux_lookup() const;
-  bool valid_mux_circuit_model_id(const CircuitModelId& circuit_model) const;
   bool valid_mux_size(const CircuitModelId& circuit_model,
                       const size_t& mux_size) const;
 
@@ -70,8 +69,12 @@ class MuxLibrary {
 
   /* a fast look-up to search mux_graphs with given circuit model and mux size
    */
-  typedef std::map<CircuitModelId, std::map<size_t, MuxId>> MuxLookup;
-  mutable MuxLookup mux_lookup_;
+  typedef std::pair<CircuitModelId, size_t> MuxLookupKey;
+  struct MuxLookupKeyHash {
+    size_t operator()(const MuxLookupKey& key) const;
+  };
+  typedef std::unordered_map<MuxLookupKey, MuxId, MuxLookupKeyHash> MuxLookup;
+  MuxLookup mux_lookup_;
 };
 
 } /* end namespace openfpga */
@@ -484,15 +484,14 @@ static std::vector<std::string> redistribute_bl_vectors_to_shift_register_banks(
     ConfigRegionId region = ConfigRegionId(&region_bl_vec - &bl_vectors[0]);
     for (size_t ibit = 0; ibit < region_bl_vec.size(); ++ibit) {
       /* Find the shift register bank id and the offset in data lines */
-      BasicPort bl_port(std::string(MEMORY_BL_PORT_NAME), ibit, ibit);
       FabricBitLineBankId bank_id =
-        blwl_sr_banks.find_bl_shift_register_bank_id(region, bl_port);
-      BasicPort sr_port =
-        blwl_sr_banks.find_bl_shift_register_bank_data_port(region, bl_port);
-      VTR_ASSERT(1 == sr_port.get_width());
+        blwl_sr_banks.find_bl_shift_register_bank_id(region, ibit);
+      size_t sr_pin =
+        blwl_sr_banks.find_bl_shift_register_bank_data_pin(region, ibit);
+      VTR_ASSERT(bank_id && (size_t(-1) != sr_pin));
 
       size_t vec_index = region_start_index[region] + size_t(bank_id);
-      multi_bank_bl_vec[vec_index][sr_port.get_lsb()] = region_bl_vec[ibit];
+      multi_bank_bl_vec[vec_index][sr_pin] = region_bl_vec[ibit];
     }
   }
 
@@ -534,15 +533,14 @@ static std::vector<std::string> redistribute_wl_vectors_to_shift_register_banks(
     ConfigRegionId region = ConfigRegionId(&region_wl_vec - &wl_vectors[0]);
     for (size_t ibit = 0; ibit < region_wl_vec.size(); ++ibit) {
       /* Find the shift register bank id and the offset in data lines */
-      BasicPort wl_port(std::string(MEMORY_WL_PORT_NAME), ibit, ibit);
       FabricWordLineBankId bank_id =
-        blwl_sr_banks.find_wl_shift_register_bank_id(region, wl_port);
-      BasicPort sr_port =
-        blwl_sr_banks.find_wl_shift_register_bank_data_port(region, wl_port);
-      VTR_ASSERT(1 == sr_port.get_width());
+        blwl_sr_banks.find_wl_shift_register_bank_id(region, ibit);
+      size_t sr_pin =
+        blwl_sr_banks.find_wl_shift_register_bank_data_pin(region, ibit);
+      VTR_ASSERT(bank_id && (size_t(-1) != sr_pin));
 
       size_t vec_index = region_start_index[region] + size_t(bank_id);
-      multi_bank_wl_vec[vec_index][sr_port.get_lsb()] = region_wl_vec[ibit];
+      multi_bank_wl_vec[vec_index][sr_pin] = region_wl_vec[ibit];
     }
   }
 
@@ -611,18 +611,20 @@ bool module_net_is_local_wire(const ModuleManager& module_manager,
   /* Check all the sink modules of the net,
    * if we have a source module is the current module, this is not local wire
    */
-  for (ModuleId src_module :
-       module_manager.net_source_modules(module_id, module_net)) {
-    if (module_id == src_module) {
+  for (ModuleNetSrcId net_src :
+       module_manager.module_net_sources(module_id, module_net)) {
+    if (module_id ==
+        module_manager.net_source_module(module_id, module_net, net_src)) {
       /* Here, this is not a local wire */
       return false;
     }
   }
 
   /* Check all the sink modules of the net */
-  for (ModuleId sink_module :
-       module_manager.net_sink_modules(module_id, module_net)) {
-    if (module_id == sink_module) {
+  for (ModuleNetSinkId net_sink :
+       module_manager.module_net_sinks(module_id, module_net)) {
+    if (module_id ==
+        module_manager.net_sink_module(module_id, module_net, net_sink)) {
       /* Here, this is not a local wire */
       return false;
     }
@@ -651,9 +653,10 @@ bool module_net_include_output_short_connection(
   const ModuleNetId& module_net) {
   /* Check all the sink modules of the net */
   size_t contain_num_module_output = 0;
-  for (ModuleId sink_module :
-       module_manager.net_sink_modules(module_id, module_net)) {
-    if (module_id == sink_module) {
+  for (ModuleNetSinkId net_sink :
+       module_manager.module_net_sinks(module_id, module_net)) {
+    if (module_id ==
+        module_manager.net_sink_module(module_id, module_net, net_sink)) {
       contain_num_module_output++;
     }
   }
@@ -684,9 +687,10 @@ bool module_net_include_local_short_connection(
    * if we have a source module is the current module, this is not local wire
    */
   bool contain_module_input = false;
-  for (ModuleId src_module :
-       module_manager.net_source_modules(module_id, module_net)) {
-    if (module_id == src_module) {
+  for (ModuleNetSrcId net_src :
+       module_manager.module_net_sources(module_id, module_net)) {
+    if (module_id ==
+        module_manager.net_source_module(module_id, module_net, net_src)) {
       contain_module_input = true;
       break;
     }
@@ -694,9 +698,10 @@ bool module_net_include_local_short_connection(
 
   /* Check all the sink modules of the net */
   bool contain_module_output = false;
-  for (ModuleId sink_module :
-       module_manager.net_sink_modules(module_id, module_net)) {
-    if (module_id == sink_module) {
+  for (ModuleNetSinkId net_sink :
+       module_manager.module_net_sinks(module_id, module_net)) {
+    if (module_id ==
+        module_manager.net_sink_module(module_id, module_net, net_sink)) {
       contain_module_output = true;
       break;
     }
@@ -0,0 +1,111 @@
+/************************************************************************
+ * Member functions for class PbTypePathIndex
+ ***********************************************************************/
+#include "pb_type_path_index.h"
+
+#include "vtr_assert.h"
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+/************************************************************************
+ * Build the key of a path, e.g., clb[default].fle[physical].ble4
+ * When there are as many modes as pb_types, the key ends with a mode,
+ * e.g., clb[default].fle[physical]
+ ***********************************************************************/
+static std::string pb_type_path_key(
+  const std::vector<std::string>& pb_type_names,
+  const std::vector<std::string>& mode_names) {
+  std::string key;
+  for (size_t i = 0; i < pb_type_names.size(); ++i) {
+    if (0 < i) {
+      key += ".";
+    }
+    key += pb_type_names[i];
+    if (i < mode_names.size()) {
+      key += "[" + mode_names[i] + "]";
+    }
+  }
+  return key;
+}
+
+/************************************************************************
+ * Constructors
+ ***********************************************************************/
+PbTypePathIndex::PbTypePathIndex(
+  const std::vector<t_logical_block_type>& logical_block_types) {
+  for (const t_logical_block_type& lb_type : logical_block_types) {
+    /* By pass nullptr for pb_type head */
+    if (nullptr == lb_type.pb_type) {
+      continue;
+    }
+    add_pb_type(lb_type.pb_type, lb_type.pb_graph_head,
+                std::string(lb_type.pb_type->name));
+  }
+}
+
+/************************************************************************
+ * Public accessors
+ ***********************************************************************/
+const std::vector<PbTypePathIndex::t_pb_type_entry>&
+PbTypePathIndex::find_pb_types(
+  const std::vector<std::string>& pb_type_names,
+  const std::vector<std::string>& mode_names) const {
+  static const std::vector<t_pb_type_entry> empty_entries;
+  VTR_ASSERT(pb_type_names.size() == mode_names.size() + 1);
+  auto result = pb_types_.find(pb_type_path_key(pb_type_names, mode_names));
+  if (pb_types_.end() == result) {
+    return empty_entries;
+  }
+  return result->second;
+}
+
+const std::vector<t_interconnect*>& PbTypePathIndex::find_interconnects(
+  const std::vector<std::string>& pb_type_names,
+  const std::vector<std::string>& mode_names,
+  const std::string& interc_name) const {
+  static const std::vector<t_interconnect*> empty_interconnects;
+  VTR_ASSERT(pb_type_names.size() == mode_names.size());
+  auto result = interconnects_.find(
+    pb_type_path_key(pb_type_names, mode_names) + "." + interc_name);
+  if (interconnects_.end() == result) {
+    return empty_interconnects;
+  }
+  return result->second;
+}
+
+size_t PbTypePathIndex::num_pb_type_paths() const { return pb_types_.size(); }
+
+/************************************************************************
+ * Internal builders
+ * Walk down the pb_type graph and index every pb_type, mode and
+ * interconnect under their paths. The pb_graph is walked along with
+ * the pb_types through the first instance of each child
+ ***********************************************************************/
+void PbTypePathIndex::add_pb_type(t_pb_type* pb_type,
+                                  t_pb_graph_node* pb_graph_node,
+                                  const std::string& path) {
+  pb_types_[path].push_back({pb_type, pb_graph_node});
+
+  for (int imode = 0; imode < pb_type->num_modes; ++imode) {
+    t_mode* mode = &(pb_type->modes[imode]);
+    std::string mode_path = path + "[" + std::string(mode->name) + "]";
+    for (int iinterc = 0; iinterc < mode->num_interconnect; ++iinterc) {
+      t_interconnect* interc = &(mode->interconnect[iinterc]);
+      interconnects_[mode_path + "." + std::string(interc->name)].push_back(
+        interc);
+    }
+    for (int ichild = 0; ichild < mode->num_pb_type_children; ++ichild) {
+      t_pb_type* child_pb_type = &(mode->pb_type_children[ichild]);
+      t_pb_graph_node* child_pb_graph_node = nullptr;
+      if (nullptr != pb_graph_node && 0 < child_pb_type->num_pb) {
+        child_pb_graph_node =
+          &(pb_graph_node->child_pb_graph_nodes[mode->index][ichild][0]);
+      }
+      add_pb_type(child_pb_type, child_pb_graph_node,
+                  mode_path + "." + std::string(child_pb_type->name));
+    }
+  }
+}
+
+} /* end namespace openfpga */
@@ -0,0 +1,68 @@
+#ifndef PB_TYPE_PATH_INDEX_H
+#define PB_TYPE_PATH_INDEX_H
+
+/********************************************************************
+ * Include header files that are required by data structure declaration
+ *******************************************************************/
+#include <string>
+#include <vector>
+
+#include "openfpga_string_hash.h"
+#include "physical_types.h"
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+/********************************************************************
+ * An index from the full hierarchical path of pb_types, e.g.,
+ *   clb[default].fle[physical].ble4
+ * to the pb_types, modes and interconnects of all the logical blocks.
+ * The index is built by a single traversal of the pb_type graphs, so that
+ * any path can be resolved by a hash look-up rather than descending the
+ * graphs by name comparison.
+ *
+ * A path may be found under more than one logical block. The results are
+ * returned in the same order as the logical blocks of the device context
+ *******************************************************************/
+class PbTypePathIndex {
+ public: /* Types */
+  /* A pb_type found by a path and the pb_graph_node of its first instance
+   * (nullptr when the pb_graph is not available) */
+  struct t_pb_type_entry {
+    t_pb_type* pb_type;
+    t_pb_graph_node* pb_graph_node;
+  };
+
+ public: /* Constructors */
+  explicit PbTypePathIndex(
+    const std::vector<t_logical_block_type>& logical_block_types);
+
+ public: /* Public accessors */
+  /* Find the pb_types with the given names of pb_types and modes along the
+   * path, where the number of pb_type names is one more than that of the
+   * mode names. Return an empty list if nothing is found */
+  const std::vector<t_pb_type_entry>& find_pb_types(
+    const std::vector<std::string>& pb_type_names,
+    const std::vector<std::string>& mode_names) const;
+
+  /* Find the interconnects with a given name under the modes of a path,
+   * where the number of pb_type names is the same as that of mode names */
+  const std::vector<t_interconnect*>& find_interconnects(
+    const std::vector<std::string>& pb_type_names,
+    const std::vector<std::string>& mode_names,
+    const std::string& interc_name) const;
+
+  size_t num_pb_type_paths() const;
+
+ private: /* Internal builders */
+  void add_pb_type(t_pb_type* pb_type, t_pb_graph_node* pb_graph_node,
+                   const std::string& path);
+
+ private: /* Internal data */
+  StringMap<std::vector<t_pb_type_entry>> pb_types_;
+  StringMap<std::vector<t_interconnect*>> interconnects_;
+};
+
+} /* end namespace openfpga */
+
+#endif
@@ -5,24 +5,42 @@
 #include "vtr_log.h"
 
 void RRGraphInEdges::init(const RRGraphView& rr_graph) {
-  node_in_edges_.clear();
-  node_in_edges_.resize(rr_graph.num_nodes());
+  clear();
 
+  /* First pass: count the incoming edges of each node. The count of node i
+   * is stored at i + 1, so that a prefix sum turns them into offsets */
+  node_in_edge_offsets_.assign(rr_graph.num_nodes() + 1, 0);
+  rr_graph.rr_nodes().for_each_edge(
+    [&](RREdgeId /*edge*/, RRNodeId /*src*/, RRNodeId sink) {
+      node_in_edge_offsets_[size_t(sink) + 1]++;
+    });
+  for (size_t inode = 1; inode < node_in_edge_offsets_.size(); ++inode) {
+    node_in_edge_offsets_[inode] += node_in_edge_offsets_[inode - 1];
+  }
+
+  /* Second pass: place each edge in the slot of its sink node */
+  in_edges_.resize(node_in_edge_offsets_.back());
+  std::vector<size_t> next_slots(node_in_edge_offsets_.begin(),
+                                 node_in_edge_offsets_.end() - 1);
   rr_graph.rr_nodes().for_each_edge(
     [&](RREdgeId edge, RRNodeId /*src*/, RRNodeId sink) {
-      node_in_edges_[sink].push_back(edge);
+      in_edges_[next_slots[size_t(sink)]++] = edge;
     });
 
   is_built_ = true;
 }
 
-const std::vector<RREdgeId>& RRGraphInEdges::node_in_edges(
-  RRNodeId node) const {
+std::span<const RREdgeId> RRGraphInEdges::node_in_edges(RRNodeId node) const {
   VTR_ASSERT(is_built_);
-  return node_in_edges_[node];
+  size_t inode = size_t(node);
+  VTR_ASSERT(inode + 1 < node_in_edge_offsets_.size());
+  return std::span<const RREdgeId>(in_edges_).subspan(
+    node_in_edge_offsets_[inode],
+    node_in_edge_offsets_[inode + 1] - node_in_edge_offsets_[inode]);
 }
 
 void RRGraphInEdges::clear() {
-  node_in_edges_.clear();
+  node_in_edge_offsets_.clear();
+  in_edges_.clear();
   is_built_ = false;
 }
@@ -9,12 +9,19 @@
  * the tileable RR graph generation code that needs to traverse edges in reverse
  * (from sink to source).
  *
+ * The incoming edges of all the nodes are stored in a compressed sparse row
+ * (CSR) format: a flat array of edges grouped by sink node, along with the
+ * offset of each node in the array.
+ *
  * Usage:
  *   RRGraphInEdges in_edges;
  *   in_edges.init(rr_graph);
- *   const auto& edges = in_edges.node_in_edges(node);
+ *   for (const RREdgeId& edge : in_edges.node_in_edges(node)) { ... }
  */
 
+#include <span>
+#include <vector>
+
 #include "rr_graph_view.h"
 
 class RRGraphInEdges {
@@ -22,16 +29,20 @@ class RRGraphInEdges {
   RRGraphInEdges() = default;
 
   /**
-   * @brief Build the incoming edge lists by iterating all edges in the graph.
+   * @brief Build the incoming edge lists by iterating all edges in the graph
+   * twice: the first pass counts the incoming edges of each node and the
+   * second pass fills the flat edge array. The edges of a node are kept in
+   * the order of the graph.
    * @param rr_graph The RR graph view to read edges from.
    */
   void init(const RRGraphView& rr_graph);
 
   /**
    * @brief Return the list of incoming edges for a given node.
-   * @note init() must be called before this method.
+   * @note init() must be called before this method. The returned span is
+   * invalidated by init() and clear().
    */
-  const std::vector<RREdgeId>& node_in_edges(RRNodeId node) const;
+  std::span<const RREdgeId> node_in_edges(RRNodeId node) const;
 
   /** @brief Check if the structure has been initialized. */
   bool is_built() const { return is_built_; }
@@ -40,6 +51,9 @@ class RRGraphInEdges {
   void clear();
 
  private:
-  vtr::vector<RRNodeId, std::vector<RREdgeId>> node_in_edges_;
+  /* The incoming edges of node i are
+   * in_edges_[node_in_edge_offsets_[i], node_in_edge_offsets_[i + 1]) */
+  std::vector<size_t> node_in_edge_offsets_;
+  std::vector<RREdgeId> in_edges_;
   bool is_built_ = false;
 };
@@ -30,7 +30,16 @@
  * Accessors
  *******************************************************************/
 
-std::vector<RREdgeId> RRGSBEdges::get_chan_node_in_edges(
+/* Return the slice of a compressed sparse row storage for a given node */
+static std::span<const RREdgeId> csr_node_edges(
+  const std::vector<RREdgeId>& edges, const std::vector<size_t>& offsets,
+  const size_t& node_id) {
+  VTR_ASSERT(node_id + 1 < offsets.size());
+  return std::span<const RREdgeId>(edges).subspan(
+    offsets[node_id], offsets[node_id + 1] - offsets[node_id]);
+}
+
+std::span<const RREdgeId> RRGSBEdges::get_chan_node_in_edges(
   const RRGSB& gsb, const RRGraphInEdges& in_edges, const e_side& side,
   const size_t& track_id) const {
   SideManager side_manager(side);
@@ -39,35 +48,29 @@ std::vector<RREdgeId> RRGSBEdges::get_chan_node_in_edges(
 
   /* If sorted edges are available, return them; otherwise fall back to
    * unsorted edges from the rr_graph */
-  if (chan_node_in_edges_.empty()) {
-    std::vector<RREdgeId> unsorted_edges;
-    for (const RREdgeId& edge :
-         in_edges.node_in_edges(gsb.get_chan_node(side, track_id))) {
-      unsorted_edges.push_back(edge);
-    }
-    return unsorted_edges;
+  if (chan_node_in_edge_offsets_.empty()) {
+    return in_edges.node_in_edges(gsb.get_chan_node(side, track_id));
   }
 
-  return chan_node_in_edges_[side_manager.to_size_t()][track_id];
+  return csr_node_edges(chan_node_in_edges_,
+                        chan_node_in_edge_offsets_[side_manager.to_size_t()],
+                        track_id);
 }
 
-std::vector<RREdgeId> RRGSBEdges::get_ipin_node_in_edges(
+std::span<const RREdgeId> RRGSBEdges::get_ipin_node_in_edges(
   const RRGSB& gsb, const RRGraphInEdges& in_edges, const e_side& side,
   const size_t& ipin_id) const {
   SideManager side_manager(side);
   VTR_ASSERT(side_manager.validate());
 
   /* If sorted edges are available, return them; otherwise fall back */
-  if (ipin_node_in_edges_.empty()) {
-    std::vector<RREdgeId> unsorted_edges;
-    for (const RREdgeId& edge :
-         in_edges.node_in_edges(gsb.get_ipin_node(side, ipin_id))) {
-      unsorted_edges.push_back(edge);
-    }
-    return unsorted_edges;
+  if (ipin_node_in_edge_offsets_.empty()) {
+    return in_edges.node_in_edges(gsb.get_ipin_node(side, ipin_id));
   }
 
-  return ipin_node_in_edges_[side_manager.to_size_t()][ipin_id];
+  return csr_node_edges(ipin_node_in_edges_,
+                        ipin_node_in_edge_offsets_[side_manager.to_size_t()],
+                        ipin_id);
 }
 
 bool RRGSBEdges::is_sb_exist(const RRGSB& gsb,
@@ -131,7 +134,7 @@ bool RRGSBEdges::is_sb_exist(const RRGSB& gsb) const {
 
   if (num_sides_routing_wires == 1 && num_sides_opin_nodes == 0) {
     /* Must have sorted edges to use this overload */
-    VTR_ASSERT(!chan_node_in_edges_.empty());
+    VTR_ASSERT(!chan_node_in_edge_offsets_.empty());
     size_t num_incoming_edges = 0;
     for (size_t side = 0; side < gsb.get_num_sides(); ++side) {
       SideManager side_manager(side);
@@ -141,7 +144,10 @@ bool RRGSBEdges::is_sb_exist(const RRGSB& gsb) const {
             gsb.get_chan_node_direction(side_manager.get_side(), itrack)) {
           continue;
         }
-        num_incoming_edges += chan_node_in_edges_[side][itrack].size();
+        num_incoming_edges +=
+          csr_node_edges(chan_node_in_edges_,
+                         chan_node_in_edge_offsets_[side], itrack)
+            .size();
       }
     }
     return num_incoming_edges != 0;
@@ -177,12 +183,16 @@ void RRGSBEdges::sort_chan_node_in_edges(const RRGSB& gsb,
                                          const RRGraphView& rr_graph,
                                          const RRGraphInEdges& in_edges,
                                          const bool reorder_incoming_edges) {
-  chan_node_in_edges_.resize(gsb.get_num_sides());
+  chan_node_in_edge_offsets_.clear();
+  chan_node_in_edges_.clear();
+  chan_node_in_edge_offsets_.resize(gsb.get_num_sides());
 
+  /* Nodes are sorted one by one, appending their edges to the flat array */
   for (size_t side = 0; side < gsb.get_num_sides(); ++side) {
     SideManager side_manager(side);
-    chan_node_in_edges_[side].resize(
-      gsb.get_chan_width(side_manager.get_side()));
+    std::vector<size_t>& offsets = chan_node_in_edge_offsets_[side];
+    offsets.resize(gsb.get_chan_width(side_manager.get_side()) + 1);
+    offsets[0] = chan_node_in_edges_.size();
     for (size_t track_id = 0;
          track_id < gsb.get_chan_width(side_manager.get_side()); ++track_id) {
       /* Only sort output nodes; bypass passing wires */
@@ -194,6 +204,7 @@ void RRGSBEdges::sort_chan_node_in_edges(const RRGSB& gsb,
                                 side_manager.get_side(), track_id,
                                 reorder_incoming_edges);
       }
+      offsets[track_id + 1] = chan_node_in_edges_.size();
     }
   }
 }
@@ -201,17 +212,23 @@ void RRGSBEdges::sort_chan_node_in_edges(const RRGSB& gsb,
 void RRGSBEdges::sort_ipin_node_in_edges(const RRGSB& gsb,
                                          const RRGraphView& rr_graph,
                                          const RRGraphInEdges& in_edges) {
-  ipin_node_in_edges_.resize(gsb.get_num_sides());
+  ipin_node_in_edge_offsets_.clear();
+  ipin_node_in_edges_.clear();
+  ipin_node_in_edge_offsets_.resize(gsb.get_num_sides());
 
+  /* Nodes are sorted one by one, appending their edges to the flat array */
   for (e_rr_type cb_type : {e_rr_type::CHANX, e_rr_type::CHANY}) {
     for (e_side ipin_side : gsb.get_cb_ipin_sides(cb_type)) {
       SideManager side_manager(ipin_side);
-      ipin_node_in_edges_[size_t(ipin_side)].resize(
-        gsb.get_num_ipin_nodes(ipin_side));
+      std::vector<size_t>& offsets =
+        ipin_node_in_edge_offsets_[size_t(ipin_side)];
+      offsets.resize(gsb.get_num_ipin_nodes(ipin_side) + 1);
+      offsets[0] = ipin_node_in_edges_.size();
       for (size_t ipin_id = 0; ipin_id < gsb.get_num_ipin_nodes(ipin_side);
            ++ipin_id) {
         sort_ipin_node_in_edges(gsb, rr_graph, in_edges,
                                 side_manager.get_side(), ipin_id);
+        offsets[ipin_id + 1] = ipin_node_in_edges_.size();
       }
     }
   }
@@ -331,7 +348,9 @@ void RRGSBEdges::sort_chan_node_in_edges(const RRGSB& gsb,
     edge_counter++;
   }
 
-  auto& sorted = chan_node_in_edges_[size_t(chan_side)][track_id];
+  /* Sorted edges are appended to the flat array of the GSB */
+  auto& sorted = chan_node_in_edges_;
+  size_t first_sorted_edge = sorted.size();
 
   if (reorder_incoming_edges) {
     /* OPINs first (all sides), then routing tracks (all sides) */
@@ -377,7 +396,7 @@ void RRGSBEdges::sort_chan_node_in_edges(const RRGSB& gsb,
     }
   }
 
-  VTR_ASSERT(edge_counter == sorted.size());
+  VTR_ASSERT(edge_counter == sorted.size() - first_sorted_edge);
 }
 
 void RRGSBEdges::sort_ipin_node_in_edges(const RRGSB& gsb,
@@ -492,7 +511,9 @@ void RRGSBEdges::sort_ipin_node_in_edges(const RRGSB& gsb,
     edge_counter++;
   }
 
-  auto& sorted = ipin_node_in_edges_[size_t(ipin_side)][ipin_id];
+  /* Sorted edges are appended to the flat array of the GSB */
+  auto& sorted = ipin_node_in_edges_;
+  size_t first_sorted_edge = sorted.size();
 
   /* Store sorted edges: routing tracks first, then OPINs */
   for (size_t iside = 0; iside < NUM_2D_SIDES; ++iside) {
@@ -511,5 +532,5 @@ void RRGSBEdges::sort_ipin_node_in_edges(const RRGSB& gsb,
     }
   }
 
-  VTR_ASSERT(edge_counter == sorted.size());
+  VTR_ASSERT(edge_counter == sorted.size() - first_sorted_edge);
 }
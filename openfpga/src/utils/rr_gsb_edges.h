@@ -8,12 +8,16 @@
  *   - Sorted incoming edge lists for IPIN nodes     (ipin_node_in_edges_)
  *   - OPIN nodes that drive IPINs in CBs            (cb_opin_node_)
  *
+ * The sorted edge lists are built once and returned as read-only spans,
+ * which are shared by the fabric, bitstream and SDC generators.
+ *
  * These were previously private members of the RRGSB class in VTR,
  * but since they are only used by OpenFPGA, they now live here.
  * All access to RRGSB data goes through RRGSB's public API.
  *******************************************************************/
 
 #include <array>
+#include <span>
 #include <vector>
 
 #include "rr_graph_view.h"
@@ -31,18 +35,16 @@ class RRGSBEdges {
   /* Get the sorted (or unsorted fallback) incoming edges for a channel
    * output node at the given side and track index.
    * This overload falls back to in_edges when the cache is empty. */
-  std::vector<RREdgeId> get_chan_node_in_edges(const RRGSB& gsb,
-                                               const RRGraphInEdges& in_edges,
-                                               const e_side& side,
-                                               const size_t& track_id) const;
+  std::span<const RREdgeId> get_chan_node_in_edges(
+    const RRGSB& gsb, const RRGraphInEdges& in_edges, const e_side& side,
+    const size_t& track_id) const;
 
   /* Get the sorted (or unsorted fallback) incoming edges for an IPIN
    * node at the given side and ipin index.
    * This overload falls back to in_edges when the cache is empty. */
-  std::vector<RREdgeId> get_ipin_node_in_edges(const RRGSB& gsb,
-                                               const RRGraphInEdges& in_edges,
-                                               const e_side& side,
-                                               const size_t& ipin_id) const;
+  std::span<const RREdgeId> get_ipin_node_in_edges(
+    const RRGSB& gsb, const RRGraphInEdges& in_edges, const e_side& side,
+    const size_t& ipin_id) const;
 
   /* Check if the switch block physically exists (has routing wires /
    * OPIN nodes and at least one incoming edge).
@@ -88,13 +90,19 @@ class RRGSBEdges {
                                const e_side& ipin_side, const size_t& ipin_id);
 
  private: /* Internal Data (moved from RRGSB) */
-  /* Sorted incoming edges for each channel output node.
-   * Storage: [chan_side][track_id][edge_index] */
-  std::vector<std::vector<std::vector<RREdgeId>>> chan_node_in_edges_;
-
-  /* Sorted incoming edges for each IPIN node.
-   * Storage: [ipin_side][ipin_id][edge_index] */
-  std::vector<std::vector<std::vector<RREdgeId>>> ipin_node_in_edges_;
+  /* Sorted incoming edges for each channel output node, in a compressed
+   * sparse row format. The edges of a node are
+   * chan_node_in_edges_[offsets[track_id], offsets[track_id + 1]), where
+   * offsets is chan_node_in_edge_offsets_[chan_side] */
+  std::vector<std::vector<size_t>> chan_node_in_edge_offsets_;
+  std::vector<RREdgeId> chan_node_in_edges_;
+
+  /* Sorted incoming edges for each IPIN node, in a compressed sparse row
+   * format. The edges of a node are
+   * ipin_node_in_edges_[offsets[ipin_id], offsets[ipin_id + 1]), where
+   * offsets is ipin_node_in_edge_offsets_[ipin_side] */
+  std::vector<std::vector<size_t>> ipin_node_in_edge_offsets_;
+  std::vector<RREdgeId> ipin_node_in_edges_;
 
   /* OPIN nodes driving IPINs in connection blocks.
    * Index [0] = CBX (CHANX), [1] = CBY (CHANY).
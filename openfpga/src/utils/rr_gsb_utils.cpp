@@ -114,9 +114,9 @@ static bool is_sb_node_mirror(const RRGraphView& rr_graph,
     return true;
   }
 
-  std::vector<RREdgeId> node_in_edges =
+  std::span<const RREdgeId> node_in_edges =
     base_edges.get_chan_node_in_edges(base, in_edges, node_side, track_id);
-  std::vector<RREdgeId> cand_node_in_edges =
+  std::span<const RREdgeId> cand_node_in_edges =
     cand_edges.get_chan_node_in_edges(cand, in_edges, node_side, track_id);
 
   if (node_in_edges.size() != cand_node_in_edges.size()) {
@@ -252,9 +252,9 @@ static bool is_cb_node_mirror(const RRGraphView& rr_graph,
                               const RRGSB& cand, const RRGSBEdges& cand_edges,
                               const e_rr_type& cb_type, const e_side& node_side,
                               const size_t& node_id) {
-  std::vector<RREdgeId> node_in_edges =
+  std::span<const RREdgeId> node_in_edges =
     base_edges.get_ipin_node_in_edges(base, in_edges, node_side, node_id);
-  std::vector<RREdgeId> cand_node_in_edges =
+  std::span<const RREdgeId> cand_node_in_edges =
     cand_edges.get_ipin_node_in_edges(cand, in_edges, node_side, node_id);
   if (node_in_edges.size() != cand_node_in_edges.size()) {
     return false;
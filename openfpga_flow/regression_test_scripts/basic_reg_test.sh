@@ -24,6 +24,12 @@ echo -e "Test source commands in openfpga shell"
 run-task basic_tests/source_command/source_string $@
 run-task basic_tests/source_command/source_file $@
 
+echo -e "Test fork mode of openfpga shell"
+run-task basic_tests/fork_designs $@
+
+echo -e "Test architecture cache of openfpga shell"
+run-task basic_tests/read_arch_cache $@
+
 echo -e "Testing preloading rr_graph"
 run-task basic_tests/preload_rr_graph/preload_rr_graph_xml $@
 run-task basic_tests/preload_rr_graph/preload_rr_graph_bin $@
@@ -162,6 +168,8 @@ run-task basic_tests/fabric_key/load_external_key_multi_region_cc_fpga $@
 run-task basic_tests/fabric_key/load_external_key_qlbank_fpga $@
 run-task basic_tests/fabric_key/load_external_key_multi_region_qlbank_fpga $@
 run-task basic_tests/fabric_key/load_external_key_qlbanksr_multi_chain_fpga $@
+run-task basic_tests/fabric_key/write_bin_key $@
+run-task basic_tests/fabric_key/load_bin_key $@
 # TODO: This feature is temporarily out of test due to the emergency in delivering netlists for multi-chain shift-register memory bank
 #run-task basic_tests/fabric_key/load_external_key_multi_region_qlbanksr_fpga $@
 
@@ -265,6 +273,8 @@ run-task basic_tests/module_naming/fabric_tile_clkntwk_io_subtile_using_index $@
 run-task basic_tests/module_naming/renaming_rules $@
 run-task basic_tests/module_naming/renaming_rules_strong $@
 run-task basic_tests/module_naming/renaming_rules_on_indexed_names $@
+run-task basic_tests/module_naming/write_bin_naming_rules $@
+run-task basic_tests/module_naming/load_bin_naming_rules $@
 
 echo -e "Testing global port definition from tiles";
 run-task basic_tests/global_tile_ports/global_tile_clock $@
@@ -290,6 +300,14 @@ run-task basic_tests/clock_network/homo_1clock_1reset_3layer_2entry_disable_unus
 run-task basic_tests/clock_network/homo_1clock_1reset_2layer_y_entry $@
 run-task basic_tests/clock_network/homo_1clock_1reset_2layer_on_lut $@
 run-task basic_tests/clock_network/homo_1clock_1reset_2layer_on_lut_pb_pin_fixup $@
+run-task basic_tests/clock_network/homo_1clock_1reset_2layer_on_lut_pb_pin_fixup_threads $@
+# Ensure pb_pin_fixup with threads outputs the same netlists and bitstreams
+for serial_run_dir in ${OPENFPGA_PATH}/openfpga_flow/tasks/basic_tests/clock_network/homo_1clock_1reset_2layer_on_lut_pb_pin_fixup_threads/latest/*/*/SERIAL; do
+  if ! diff -r ${serial_run_dir}/outputs_no_time_stamp ${serial_run_dir}/../THREADS/outputs_no_time_stamp; then
+    echo -e "Detect changes in outputs of pb_pin_fixup with threads";
+    exit 1;
+  fi
+done
 # Comment out as this feature is not working fine actually. Need a revisit in future
 #run-task basic_tests/clock_network/homo_1clock_1reset_2layer_on_lut_pb_pin_fixup_msb $@
 run-task basic_tests/clock_network/homo_1clock_1reset_2layer_syntax $@
@@ -363,6 +381,7 @@ run-task _task_copy $@
 echo -e "Testing output files without time stamp";
 run-task basic_tests/no_time_stamp/device_1x1 $@
 run-task basic_tests/no_time_stamp/device_4x4 $@
+run-task basic_tests/no_time_stamp/device_4x4_threads $@
 run-task basic_tests/no_time_stamp/no_cout_in_gsb $@
 run-task basic_tests/no_time_stamp/dump_waveform $@
 echo -e "Testing bus-based mux shared config bit via golden bitstream distribution";
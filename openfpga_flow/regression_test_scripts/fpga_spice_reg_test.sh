@@ -9,3 +9,6 @@ echo -e "FPGA-SPICE regression tests";
 
 echo -e "Testing FPGA-SPICE with netlist generation";
 run-task fpga_spice/generate_spice $@
+
+echo -e "Testing FPGA-SPICE with multi-thread netlist generation";
+run-task fpga_spice/generate_spice_threads $@
@@ -72,6 +72,7 @@ run-task fpga_verilog/dsp/dual_mult_8x8_chain_dpram16k_negz $@
 run-task fpga_verilog/dsp/mult_8x8_chain_dpram16k_supertile $@
 run-task fpga_verilog/dsp/mult_8x8_chain_dpram16k_supertile_negz $@
 run-task fpga_verilog/dsp/mult_8x8_chain_dpram16k_supertile_negz_group_tile $@
+run-task fpga_verilog/dsp/mult_8x8_chain_dpram16k_flyweight_routing $@
 
 echo -e "Test specify mode bits from pcf command"
 run-task fpga_verilog/io/io_pdl_emode $@
@@ -0,0 +1,51 @@
+import sys
+import os
+
+# Usage: test.py <openfpga_path> <openfpga_script> <design_script_dir>
+assert len(sys.argv) >= 4
+openfpga_exe = os.path.abspath("%s/build/openfpga/openfpga" % sys.argv[1])
+assert os.path.exists(openfpga_exe)
+design_dir = os.path.abspath(sys.argv[3])
+
+# The common script is made of the commands after the first 'exit'
+original_openfpga = open(sys.argv[2])
+common_openfpga = open("fork_common.openfpga", "w")
+found_exit = False
+for line in original_openfpga :
+  if line.find("exit") == 0 :
+    found_exit = True
+  elif found_exit and line.find("ext_exec") != 0 :
+    common_openfpga.write(line)
+common_openfpga.close()
+original_openfpga.close()
+assert found_exit
+
+design_list = open("fork_designs.txt", "w")
+design_list.write("# Design scripts sharing the fabric of fork_common.openfpga\n")
+for design in ["design_bitstream.openfpga", "design_verilog.openfpga"] :
+  design_list.write("%s/%s\n" % (design_dir, design))
+design_list.close()
+
+# Both design scripts run on the fabric built by the common script
+cmd = "%s -f fork_common.openfpga --fork_designs fork_designs.txt --fork_jobs 2 > fork.log" % (openfpga_exe)
+assert os.system(cmd) == 0, "Fork mode failed, see fork.log"
+assert os.path.exists("fabric_bitstream.bit")
+assert os.path.exists("SRC/fabric_netlists.v")
+
+# A missing design script fails the run
+design_list = open("fork_missing_design.txt", "w")
+design_list.write("%s/design_bitstream.openfpga\n" % (design_dir))
+design_list.write("%s/missing_design.openfpga\n" % (design_dir))
+design_list.close()
+cmd = "%s -f fork_common.openfpga --fork_designs fork_missing_design.txt > fork_missing_design.log" % (openfpga_exe)
+assert os.system(cmd) != 0, "Missing design script is not reported"
+
+# A missing common script skips all the designs
+cmd = "%s -f missing_common.openfpga --fork_designs fork_designs.txt > fork_missing_common.log" % (openfpga_exe)
+assert os.system(cmd) != 0, "Missing common script is not reported"
+
+# Fork options are only valid in script mode
+cmd = "%s -batch --fork_designs fork_designs.txt > fork_no_script.log" % (openfpga_exe)
+assert os.system(cmd) != 0, "Fork mode without a script is not reported"
+
+exit(0)